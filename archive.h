@@ -0,0 +1,194 @@
+// Packed archives: single file with entries data, sorted index and names, mapped to memory for random access.
+// Entries are served directly from mapping (or from whole file buffer, if file can't be mapped).
+// This part is CPU only (no raylib or Lua calls): compression of entries is done by user.
+//
+// Layout (little endian):
+//   header  "RLPK", u32 version, u32 count, u32 indexOffset
+//   data    entries data
+//   index   count * { u32 offset, u32 size, u32 rawSize, u32 nameOffset, u32 nameLength, u32 flags }, sorted by names
+//   names   names of entries (nameOffset is relative to names start), not zero terminated
+
+#define RAY_ARCHIVE_MAGIC      "RLPK"
+#define RAY_ARCHIVE_VERSION    1
+#define RAY_ARCHIVE_HEADER     16
+#define RAY_ARCHIVE_RECORD     24
+#define RAY_ARCHIVE_COMPRESSED 1 // entry is DEFLATE compressed, rawSize is size of data after decompression
+
+#if defined(_WIN32)
+  // windows.h conflicts with raylib.h, see threads.h
+  #include <stdint.h>
+
+  void * __stdcall CreateFileA(const char * name, unsigned long access, unsigned long share, void * security, unsigned long disposition, unsigned long flags, void * templ);
+  void * __stdcall CreateFileMappingA(void * file, void * security, unsigned long protect, unsigned long sizeHigh, unsigned long sizeLow, const char * name);
+  void * __stdcall MapViewOfFile(void * mapping, unsigned long access, unsigned long offsetHigh, unsigned long offsetLow, size_t size);
+  int    __stdcall UnmapViewOfFile(const void * address);
+  unsigned long __stdcall GetFileSize(void * file, unsigned long * sizeHigh);
+  int    __stdcall CloseHandle(void * handle);
+#else
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <fcntl.h>
+  #include <unistd.h>
+#endif
+
+typedef struct {
+  const unsigned char * data;   // whole archive
+  size_t                size;
+  int                   mapped; // data is mapped, otherwise it is allocated
+  int                   count;
+  const unsigned char * index;
+  const char          * names;
+} ray_archive;
+
+typedef struct {
+  const unsigned char * data;
+  unsigned int          size;    // stored size
+  unsigned int          rawSize; // size after decompression
+  unsigned int          flags;
+  const char          * name;
+  unsigned int          nameLength;
+} ray_archive_entry;
+
+unsigned int ray_archive_u32(const unsigned char * p){
+  return (unsigned int)p[0] | (unsigned int)p[1] << 8 | (unsigned int)p[2] << 16 | (unsigned int)p[3] << 24;
+}
+
+void ray_archive_put32(unsigned char * p, unsigned int value){
+  p[0] = value;
+  p[1] = value >> 8;
+  p[2] = value >> 16;
+  p[3] = value >> 24;
+}
+
+// Maps (or reads) file, returns 0 on error
+int ray_archive_map(ray_archive * archive, const char * path){
+#if defined(_WIN32)
+  void * file = CreateFileA(path, 0x80000000 /* GENERIC_READ */, 1 /* FILE_SHARE_READ */, NULL, 3 /* OPEN_EXISTING */, 0x80 /* FILE_ATTRIBUTE_NORMAL */, NULL);
+  if (file != (void *)(intptr_t)-1) {
+    unsigned long high = 0;
+    unsigned long low  = GetFileSize(file, &high);
+    void * mapping = !high && low ? CreateFileMappingA(file, NULL, 2 /* PAGE_READONLY */, 0, 0, NULL) : NULL;
+    void * view    = mapping ? MapViewOfFile(mapping, 4 /* FILE_MAP_READ */, 0, 0, 0) : NULL;
+    // view keeps mapping and file opened
+    if (mapping) CloseHandle(mapping);
+    CloseHandle(file);
+    if (view) {
+      archive->data   = (const unsigned char *)view;
+      archive->size   = low;
+      archive->mapped = 1;
+      return 1;
+    }
+  }
+#else
+  int fd = open(path, O_RDONLY);
+  if (fd >= 0) {
+    struct stat st;
+    void * view = MAP_FAILED;
+    if (!fstat(fd, &st) && st.st_size > 0) view = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (view != MAP_FAILED) {
+      archive->data   = (const unsigned char *)view;
+      archive->size   = st.st_size;
+      archive->mapped = 1;
+      return 1;
+    }
+  }
+#endif
+  // fallback: whole file is read to memory
+  FILE * f = fopen(path, "rb");
+  if (!f) return 0;
+  fseek(f, 0, SEEK_END);
+  long size = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  unsigned char * data = size > 0 ? (unsigned char *)malloc(size) : NULL;
+  if (data && fread(data, 1, size, f) != (size_t)size) {
+    free(data);
+    data = NULL;
+  }
+  fclose(f);
+  if (!data) return 0;
+  archive->data   = data;
+  archive->size   = size;
+  archive->mapped = 0;
+  return 1;
+}
+
+void ray_archive_close(ray_archive * archive){
+  if (!archive->data) return;
+#if defined(_WIN32)
+  if (archive->mapped) UnmapViewOfFile(archive->data);
+#else
+  if (archive->mapped) munmap((void *)archive->data, archive->size);
+#endif
+  else free((void *)archive->data);
+  archive->data  = NULL;
+  archive->size  = 0;
+  archive->count = 0;
+}
+
+// Opens archive and validates it, returns error message or NULL
+const char * ray_archive_open(ray_archive * archive, const char * path){
+  memset(archive, 0, sizeof(ray_archive));
+  if (!ray_archive_map(archive, path)) return "can't read file";
+  const unsigned char * data = archive->data;
+  size_t size = archive->size;
+  if (size < RAY_ARCHIVE_HEADER || memcmp(data, RAY_ARCHIVE_MAGIC, 4)) {
+    ray_archive_close(archive);
+    return "not an archive";
+  }
+  if (ray_archive_u32(data + 4) != RAY_ARCHIVE_VERSION) {
+    ray_archive_close(archive);
+    return "unsupported archive version";
+  }
+  size_t count = ray_archive_u32(data + 8), indexOffset = ray_archive_u32(data + 12);
+  if (indexOffset > size || count > (size - indexOffset)/RAY_ARCHIVE_RECORD) {
+    ray_archive_close(archive);
+    return "index is damaged";
+  }
+  const unsigned char * index = data + indexOffset;
+  size_t namesOffset = indexOffset + count*RAY_ARCHIVE_RECORD, namesSize = size - namesOffset;
+  for (size_t i = 0; i < count; i++) {
+    const unsigned char * record = index + i*RAY_ARCHIVE_RECORD;
+    size_t offset = ray_archive_u32(record), stored = ray_archive_u32(record + 4);
+    size_t nameOffset = ray_archive_u32(record + 12), nameLength = ray_archive_u32(record + 16);
+    if (offset > indexOffset || stored > indexOffset - offset || nameOffset > namesSize || nameLength > namesSize - nameOffset) {
+      ray_archive_close(archive);
+      return "index is damaged";
+    }
+  }
+  archive->count = count;
+  archive->index = index;
+  archive->names = (const char *)data + namesOffset;
+  return NULL;
+}
+
+void ray_archive_get(ray_archive * archive, int i, ray_archive_entry * entry){
+  const unsigned char * record = archive->index + i*RAY_ARCHIVE_RECORD;
+  entry->data       = archive->data + ray_archive_u32(record);
+  entry->size       = ray_archive_u32(record + 4);
+  entry->rawSize    = ray_archive_u32(record + 8);
+  entry->name       = archive->names + ray_archive_u32(record + 12);
+  entry->nameLength = ray_archive_u32(record + 16);
+  entry->flags      = ray_archive_u32(record + 20);
+}
+
+// Compares names as bytes, shorter name is less if it is prefix of longer one
+int ray_archive_compare(const char * a, size_t alen, const char * b, size_t blen){
+  int result = memcmp(a, b, alen < blen ? alen : blen);
+  if (result) return result;
+  return alen < blen ? -1 : alen > blen;
+}
+
+// Binary search of entry, returns its index or -1
+int ray_archive_find(ray_archive * archive, const char * name, size_t len){
+  int lo = 0, hi = archive->count - 1;
+  while (lo <= hi) {
+    int mid = lo + (hi - lo)/2;
+    const unsigned char * record = archive->index + mid*RAY_ARCHIVE_RECORD;
+    int cmp = ray_archive_compare(archive->names + ray_archive_u32(record + 12), ray_archive_u32(record + 16), name, len);
+    if (!cmp) return mid;
+    if (cmp < 0) lo = mid + 1;
+    else hi = mid - 1;
+  }
+  return -1;
+}
@@ -0,0 +1,307 @@
+// Dynamic glyph atlas: glyphs are rasterized by stb_truetype on first use and packed into pages by skyline packer.
+// When all pages are full, the least recently used page is cleared and reused.
+// This part is CPU only (no raylib, rlgl or Lua calls): pages are 8 bit coverage maps, uploading is done by user.
+
+// raylib compiles stb_truetype as static, so there is own copy of implementation
+#define STBTT_STATIC
+#define STB_TRUETYPE_IMPLEMENTATION
+#include "raylib/external/stb_truetype.h"
+
+#define RAY_ATLAS_PADDING 1 // empty pixels between glyphs
+
+typedef struct {
+  int codepoint;
+  int page;                 // -1 if glyph has no image (space, or glyph is bigger than page)
+  int x, y, width, height;  // rectangle on page
+  int offsetX, offsetY;     // same as CharInfo ones
+  int advanceX;
+  int next;                 // next glyph in hash bucket or in free list
+  int pageNext;             // next glyph on the same page
+} ray_atlas_glyph;
+
+typedef struct {
+  int x, y, width;
+} ray_atlas_node;
+
+typedef struct {
+  unsigned char  * pixels;  // size*size coverage values
+  ray_atlas_node * nodes;   // skyline
+  int              nodesCount;
+  int              glyphs;  // first glyph on page, -1 if empty
+  unsigned int     stamp;   // tick of last use
+  int              dirty;   // pixels are changed, reset by user after uploading
+} ray_atlas_page;
+
+typedef struct {
+  stbtt_fontinfo    info;
+  unsigned char   * data;   // font file, owned by atlas
+  float             scale;
+  int               ascent;
+  int               fontSize;
+  int               pageSize, maxPages, pagesCount;
+  ray_atlas_page  * pages;
+  ray_atlas_glyph * glyphs;
+  int               glyphsCount, glyphsCapacity;
+  int             * buckets; // hash buckets, -1 is empty
+  int               mask;
+  int               free;    // free list of glyphs
+  unsigned int      tick;
+  int               rasterized, evicted; // statistics
+} ray_atlas;
+
+#define ray_atlas_hash(atlas, codepoint) (((unsigned int)(codepoint)*2654435761u) & (atlas)->mask)
+
+void ray_atlas_free(ray_atlas * atlas){
+  for (int i = 0; i < atlas->pagesCount; i++) {
+    free(atlas->pages[i].pixels);
+    free(atlas->pages[i].nodes);
+  }
+  free(atlas->pages);
+  free(atlas->glyphs);
+  free(atlas->buckets);
+  free(atlas->data);
+  memset(atlas, 0, sizeof(ray_atlas));
+}
+
+// Takes ownership of malloc'ed font file data (it is freed on failure too), returns 0 on failure
+int ray_atlas_init(ray_atlas * atlas, unsigned char * data, int fontSize, int pageSize, int maxPages){
+  memset(atlas, 0, sizeof(ray_atlas));
+  atlas->data = data;
+  if (!data || fontSize <= 0 || pageSize <= 0 || maxPages <= 0 ||
+      !stbtt_InitFont(&atlas->info, data, stbtt_GetFontOffsetForIndex(data, 0))) {
+    ray_atlas_free(atlas);
+    return 0;
+  }
+  int ascent, descent, lineGap;
+  stbtt_GetFontVMetrics(&atlas->info, &ascent, &descent, &lineGap);
+  atlas->scale    = stbtt_ScaleForPixelHeight(&atlas->info, (float)fontSize);
+  atlas->ascent   = (int)(ascent*atlas->scale);
+  atlas->fontSize = fontSize;
+  atlas->pageSize = pageSize;
+  atlas->maxPages = maxPages;
+  atlas->free     = -1;
+  atlas->mask     = 255;
+  atlas->pages    = (ray_atlas_page *)calloc(maxPages, sizeof(ray_atlas_page));
+  atlas->buckets  = (int *)malloc((atlas->mask + 1)*sizeof(int));
+  if (!atlas->pages || !atlas->buckets) {
+    ray_atlas_free(atlas);
+    return 0;
+  }
+  for (int i = 0; i <= atlas->mask; i++) atlas->buckets[i] = -1;
+  return 1;
+}
+
+void ray_atlas_resetPage(ray_atlas_page * page, int size){
+  memset(page->pixels, 0, size*size);
+  page->nodes[0]   = (ray_atlas_node){0, 0, size};
+  page->nodesCount = 1;
+  page->glyphs     = -1;
+  page->dirty      = 1;
+}
+
+// Returns index of new page or -1
+int ray_atlas_addPage(ray_atlas * atlas){
+  if (atlas->pagesCount >= atlas->maxPages) return -1;
+  ray_atlas_page * page = &atlas->pages[atlas->pagesCount];
+  page->pixels = (unsigned char *)malloc(atlas->pageSize*atlas->pageSize);
+  page->nodes  = (ray_atlas_node *)malloc(atlas->pageSize*sizeof(ray_atlas_node));
+  if (!page->pixels || !page->nodes) {
+    free(page->pixels);
+    free(page->nodes);
+    memset(page, 0, sizeof(ray_atlas_page));
+    return -1;
+  }
+  ray_atlas_resetPage(page, atlas->pageSize);
+  return atlas->pagesCount++;
+}
+
+// Skyline bottom-left: returns 1 and position of rectangle if it fits
+int ray_atlas_findPosition(ray_atlas_page * page, int size, int width, int height, int * node, int * x, int * y){
+  int bestY = size, bestWaste = size*size;
+  *node = -1;
+  for (int i = 0; i < page->nodesCount; i++) {
+    int left = page->nodes[i].x;
+    if (left + width > size) break;
+    int top = 0, waste = 0, remain = width;
+    for (int j = i; remain > 0; j++) {
+      if (page->nodes[j].y > top) top = page->nodes[j].y;
+      remain -= page->nodes[j].width;
+    }
+    if (top + height > size) continue;
+    remain = width;
+    for (int j = i; remain > 0; j++) {
+      int w = page->nodes[j].width < remain ? page->nodes[j].width : remain;
+      waste  += (top - page->nodes[j].y)*w;
+      remain -= w;
+    }
+    if (top < bestY || (top == bestY && waste < bestWaste)) {
+      bestY = top;
+      bestWaste = waste;
+      *node = i;
+      *x = left;
+      *y = top;
+    }
+  }
+  return *node >= 0;
+}
+
+void ray_atlas_placeRect(ray_atlas_page * page, int node, int x, int y, int width, int height){
+  int right = x + width;
+  int last  = node; // first node that is not completely covered
+  while (last < page->nodesCount && page->nodes[last].x + page->nodes[last].width <= right) last++;
+  if (last < page->nodesCount && page->nodes[last].x < right) {
+    page->nodes[last].width -= right - page->nodes[last].x;
+    page->nodes[last].x = right;
+  }
+  // replace covered nodes [node, last) with new one
+  int shift = 1 - (last - node);
+  memmove(&page->nodes[last + shift], &page->nodes[last], (page->nodesCount - last)*sizeof(ray_atlas_node));
+  page->nodesCount += shift;
+  page->nodes[node] = (ray_atlas_node){x, y + height, width};
+
+  // merge neighbours with the same height
+  for (int i = node > 0 ? node - 1 : 0; i < page->nodesCount - 1 && i <= node + 1;) {
+    if (page->nodes[i].y == page->nodes[i + 1].y) {
+      page->nodes[i].width += page->nodes[i + 1].width;
+      memmove(&page->nodes[i + 1], &page->nodes[i + 2], (page->nodesCount - i - 2)*sizeof(ray_atlas_node));
+      page->nodesCount--;
+    }
+    else i++;
+  }
+}
+
+void ray_atlas_unlink(ray_atlas * atlas, int index){
+  int * link = &atlas->buckets[ray_atlas_hash(atlas, atlas->glyphs[index].codepoint)];
+  while (*link != index) link = &atlas->glyphs[*link].next;
+  *link = atlas->glyphs[index].next;
+  atlas->glyphs[index].next = atlas->free;
+  atlas->free = index;
+}
+
+// Clears least recently used page, returns its index
+int ray_atlas_evict(ray_atlas * atlas){
+  int lru = 0;
+  for (int i = 1; i < atlas->pagesCount; i++)
+    if (atlas->pages[i].stamp < atlas->pages[lru].stamp) lru = i;
+  ray_atlas_page * page = &atlas->pages[lru];
+  for (int g = page->glyphs; g >= 0;) {
+    int next = atlas->glyphs[g].pageNext;
+    ray_atlas_unlink(atlas, g);
+    atlas->evicted++;
+    g = next;
+  }
+  ray_atlas_resetPage(page, atlas->pageSize);
+  return lru;
+}
+
+// Returns 0 on allocation failure
+int ray_atlas_growGlyphs(ray_atlas * atlas){
+  if (atlas->free >= 0) return 1;
+  if (atlas->glyphsCount == atlas->glyphsCapacity) {
+    int capacity = atlas->glyphsCapacity ? atlas->glyphsCapacity*2 : 128;
+    ray_atlas_glyph * glyphs = (ray_atlas_glyph *)realloc(atlas->glyphs, capacity*sizeof(ray_atlas_glyph));
+    if (!glyphs) return 0;
+    atlas->glyphs = glyphs;
+    atlas->glyphsCapacity = capacity;
+  }
+  // keep load factor below 1
+  if (atlas->glyphsCount > atlas->mask) {
+    int mask = atlas->mask*2 + 1;
+    int * buckets = (int *)malloc((mask + 1)*sizeof(int));
+    if (!buckets) return 0;
+    for (int i = 0; i <= mask; i++) buckets[i] = -1;
+    free(atlas->buckets);
+    atlas->buckets = buckets;
+    atlas->mask    = mask;
+    for (int i = 0; i < atlas->glyphsCount; i++) { // free list is empty here, so all glyphs are in use
+      int * bucket = &buckets[ray_atlas_hash(atlas, atlas->glyphs[i].codepoint)];
+      atlas->glyphs[i].next = *bucket;
+      *bucket = i;
+    }
+  }
+  atlas->glyphs[atlas->glyphsCount].next = atlas->free;
+  atlas->free = atlas->glyphsCount++;
+  return 1;
+}
+
+// Rasterizes glyph and places it to atlas, returns NULL on allocation failure
+ray_atlas_glyph * ray_atlas_rasterize(ray_atlas * atlas, int codepoint, int glyphIndex){
+  if (!ray_atlas_growGlyphs(atlas)) return NULL;
+  int index = atlas->free;
+  ray_atlas_glyph * glyph = &atlas->glyphs[index];
+  atlas->free = glyph->next;
+
+  int x0, y0, x1, y1;
+  stbtt_GetGlyphHMetrics(&atlas->info, glyphIndex, &glyph->advanceX, NULL);
+  stbtt_GetGlyphBitmapBox(&atlas->info, glyphIndex, atlas->scale, atlas->scale, &x0, &y0, &x1, &y1);
+  glyph->codepoint = codepoint;
+  glyph->advanceX  = (int)(glyph->advanceX*atlas->scale);
+  glyph->offsetX   = x0;
+  glyph->offsetY   = y0 + atlas->ascent;
+  glyph->width     = x1 - x0;
+  glyph->height    = y1 - y0;
+  glyph->x = glyph->y = 0;
+  glyph->page      = -1;
+  glyph->pageNext  = -1;
+
+  int width  = glyph->width  + RAY_ATLAS_PADDING;
+  int height = glyph->height + RAY_ATLAS_PADDING;
+  if (glyph->width > 0 && glyph->height > 0 && width <= atlas->pageSize && height <= atlas->pageSize) {
+    int page = -1, node = -1, x = 0, y = 0;
+    for (int i = 0; i < atlas->pagesCount && page < 0; i++)
+      if (ray_atlas_findPosition(&atlas->pages[i], atlas->pageSize, width, height, &node, &x, &y)) page = i;
+    if (page < 0) page = ray_atlas_addPage(atlas);
+    if (page < 0 && atlas->pagesCount > 0) page = ray_atlas_evict(atlas);
+    if (page >= 0 && (node >= 0 || ray_atlas_findPosition(&atlas->pages[page], atlas->pageSize, width, height, &node, &x, &y))) {
+      ray_atlas_page * p = &atlas->pages[page];
+      ray_atlas_placeRect(p, node, x, y, width, height);
+      stbtt_MakeGlyphBitmap(&atlas->info, p->pixels + y*atlas->pageSize + x, glyph->width, glyph->height,
+                            atlas->pageSize, atlas->scale, atlas->scale, glyphIndex);
+      glyph->page     = page;
+      glyph->x        = x;
+      glyph->y        = y;
+      glyph->pageNext = p->glyphs;
+      p->glyphs       = index;
+      p->dirty        = 1;
+      atlas->rasterized++;
+    }
+    else glyph->width = glyph->height = 0;
+  }
+  else glyph->width = glyph->height = 0;
+
+  // evicting could move found glyphs to free list, so glyph is linked at the end
+  int * bucket = &atlas->buckets[ray_atlas_hash(atlas, codepoint)];
+  glyph->next = *bucket;
+  *bucket = index;
+  return glyph;
+}
+
+// Returns cached glyph of codepoint without rasterizing it or marking its page as used, NULL if it is not cached
+ray_atlas_glyph * ray_atlas_find(ray_atlas * atlas, int codepoint){
+  for (int i = atlas->buckets[ray_atlas_hash(atlas, codepoint)]; i >= 0; i = atlas->glyphs[i].next)
+    if (atlas->glyphs[i].codepoint == codepoint) return &atlas->glyphs[i];
+  return NULL;
+}
+
+// Returns glyph of codepoint, rasterizing it if needed. Missing codepoints are replaced with '?' (as raylib does).
+// Pointer is valid until next call. Returns NULL on allocation failure.
+ray_atlas_glyph * ray_atlas_get(ray_atlas * atlas, int codepoint){
+  atlas->tick++;
+  ray_atlas_glyph * found = ray_atlas_find(atlas, codepoint);
+  if (found) {
+    if (found->page >= 0) atlas->pages[found->page].stamp = atlas->tick;
+    return found;
+  }
+  int glyphIndex = stbtt_FindGlyphIndex(&atlas->info, codepoint);
+  if (!glyphIndex && codepoint != '?') return ray_atlas_get(atlas, '?');
+  ray_atlas_glyph * glyph = ray_atlas_rasterize(atlas, codepoint, glyphIndex);
+  if (glyph && glyph->page >= 0) atlas->pages[glyph->page].stamp = atlas->tick;
+  return glyph;
+}
+
+// Number of cached glyphs
+int ray_atlas_count(ray_atlas * atlas){
+  int count = atlas->glyphsCount;
+  for (int i = atlas->free; i >= 0; i = atlas->glyphs[i].next) count--;
+  return count;
+}
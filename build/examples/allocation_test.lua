@@ -0,0 +1,61 @@
+-- Allocation-free math methods create no garbage: memory of Lua state stays flat over 10k iterations
+-- of every method with collector stopped, while the same work by overloads grows it
+-- luajit allocation_test.lua [iterations]
+local ray = require'raylib_luamore'
+
+local ITERATIONS = tonumber(...) or 10000
+local SLACK      = 1 -- KB, growth allowed for interpreter internals
+local test  = dofile((arg[0]:match("^(.*[/\\])") or "") .. "checks.lua")("allocation")
+local check = test.check
+
+local function grows(run)
+	collectgarbage()
+	collectgarbage("stop")
+	local before = collectgarbage("count")
+	for i = 1, ITERATIONS do run(i) end
+	local growth = collectgarbage("count") - before
+	collectgarbage("restart")
+	return growth
+end
+
+local a2, b2, o2 = ray.Vector2(1, 2), ray.Vector2(3, 4), ray.Vector2()
+local a3, b3, c3, o3 = ray.Vector3(1, 2, 3), ray.Vector3(4, 5, 6), ray.Vector3(7, 8, 10), ray.Vector3()
+local ma, mb, mo = ray.Matrix():identity(), ray.Matrix():perspective(1, 1.5, 0.1, 100), ray.Matrix()
+local qa, qb, qo = ray.Vector4(0, 0, 0, 1), ray.Vector4(0.5, 0.5, 0.5, 0.5), ray.Vector4()
+
+local cases = {
+	{"Vector2", function(i)
+		o2:copy(a2):addTo(a2, b2):subtractTo(o2, b2):scaleTo(o2, 2):multiplyTo(o2, b2):multiplyTo(o2, 0.5)
+		o2:divideTo(o2, b2):divideTo(o2, 2):negateTo(o2):normalizeTo(o2):lerpTo(a2, b2, i/ITERATIONS)
+	end},
+	{"Vector3", function(i)
+		o3:copy(a3):addTo(a3, b3):subtractTo(o3, b3):scaleTo(o3, 2):multiplyTo(o3, b3):multiplyTo(o3, 0.5)
+		o3:divideTo(o3, b3):divideTo(o3, 2):negateTo(o3):normalizeTo(o3):crossProductTo(a3, b3):perpendicularTo(o3)
+		o3:transformTo(a3, mb):rotateByQuaternionTo(a3, qb):lerpTo(a3, b3, i/ITERATIONS):reflectTo(a3, b3)
+		o3:minTo(a3, b3):maxTo(a3, b3)
+		a3:barycenter(a3, b3, c3, o3)
+	end},
+	{"Matrix", function()
+		mo:copy(ma):addTo(ma, mb):subtractTo(mo, mb):multiplyTo(ma, mb):transposeTo(mo):invertTo(mb):normalizeTo(mo)
+	end},
+	{"Vector4", function(i)
+		local t = i/ITERATIONS
+		qo:copy(qa):addTo(qa, qb):subtractTo(qo, qb):scaleTo(qo, 2):normalizeTo(qb):qInvertTo(qb):qMultiplyTo(qa, qb)
+		qo:qLerpTo(qa, qb, t):qNlerpTo(qa, qb, t):qSlerpTo(qa, qb, t):qTransformTo(qb, ma)
+		qb:qToMatrix(mo)
+		qb:qToAxisAngle(o3)
+	end},
+}
+
+for _, case in ipairs(cases) do
+	local growth = grows(case[2])
+	print(("%-8s %8.2f KB"):format(case[1], growth))
+	check(growth <= SLACK, case[1] .. " methods allocate")
+end
+
+-- control: overloads allocate, so measuring works
+local growth = grows(function() local v = a3 + b3 * 2 end)
+print(("%-8s %8.2f KB"):format("overload", growth))
+check(growth > SLACK, "overloads are expected to allocate")
+
+test.finish()
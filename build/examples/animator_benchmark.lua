@@ -0,0 +1,77 @@
+-- Animation blending speed: 100 characters with blended walk and run, poses per second of Animator
+-- with and without pose cache, and with re-skinning skipped for idle characters
+-- luajit animator_benchmark.lua [characters]
+local ray = require'raylib_luamore'
+
+local CHARACTERS = tonumber(...) or 100
+local TICKS      = 240   -- updates per second, animations are 30 fps
+local SECONDS    = 2
+local FILE       = "bench_animator.iqm"
+
+-- window is needed for mesh upload, nothing is drawn
+ray.core.SetConfigFlags("WINDOW_HIDDEN")
+ray.core.InitWindow(100, 100, "animator benchmark")
+
+-- characters are small (2048 vertices), so pose evaluation is noticeable next to skinning
+local writeTube = dofile((arg[0]:match("^(.*[/\\])") or "") .. "skinned_tube.lua")
+writeTube(FILE, {rings = 64, segments = 32, bones = 64, animations = {
+	{frames = 32, amplitude = 0.05, waves = 1}, -- walk
+	{frames = 20, amplitude = 0.15, waves = 2}, -- run
+}})
+local anims = ray.models.LoadModelAnimations(FILE)
+local walk, run = anims[1], anims[2]
+
+local characters, animators = {}, {}
+for i = 1, CHARACTERS do
+	characters[i] = ray.Model(FILE)
+	animators[i]  = ray.Animator(characters[i]):setLayer(1, walk):setLayer(2, run)
+end
+
+-- characters start in 8 groups, so groups share poses
+local function measure(title, idle)
+	collectgarbage()
+	local hits, misses = ray.models.GetPoseCacheStats()
+	local skins = 0
+	local start = ray.core.GetTime()
+	for tick = 0, TICKS*SECONDS - 1 do
+		local time = tick/TICKS
+		for i = 1, CHARACTERS do
+			local animator = animators[i]
+			if not idle or i % 2 == 0 then
+				local speed = 0.5 + 0.5*math.sin(time + i % 8) -- blend between walk and run
+				local phase = i % 8*4
+				animator:setFrame(1, time*30 + phase):setFrame(2, time*30*20/32 + phase)
+				animator:setWeight(1, 1 - speed):setWeight(2, speed)
+			end
+			if animator:update(false) then skins = skins + 1 end
+		end
+	end
+	local elapsed = ray.core.GetTime() - start
+	local h, m = ray.models.GetPoseCacheStats()
+	local updates = CHARACTERS*TICKS*SECONDS
+	print(("%-30s %9.0f poses/s  %6.2f ms/tick  %5.1f%% skinned  cache %d hits / %d misses"):format(
+		title, updates/elapsed, elapsed/(TICKS*SECONDS)*1000, skins/updates*100, h - hits, m - misses))
+end
+
+-- reference: raylib path re-skins every tick with integer frame of one animation
+collectgarbage()
+local start = ray.core.GetTime()
+for tick = 0, TICKS*SECONDS - 1 do
+	for i = 1, CHARACTERS do ray.models.UpdateModelAnimation(characters[i], walk, math.floor(tick/TICKS*30), false) end
+end
+local elapsed = ray.core.GetTime() - start
+print(("%-30s %9.0f poses/s  %6.2f ms/tick"):format("UpdateModelAnimation, 1 anim", CHARACTERS*TICKS*SECONDS/elapsed, elapsed/(TICKS*SECONDS)*1000))
+
+ray.models.SetPoseCache(0)
+measure("Animator, no cache")
+ray.models.SetPoseCache(256, 16)
+measure("Animator, cache")
+ray.models.SetPoseCache(256, 4)
+measure("Animator, cache, 1/4 frame")
+measure("Animator, half idle", true)
+
+for i = 1, CHARACTERS do characters[i]:unload() end
+walk:unload()
+run:unload()
+os.remove(FILE)
+ray.core.CloseWindow()
@@ -0,0 +1,102 @@
+-- Loading of 5000 small images: loose files versus packed archive
+local ray = require'raylib_luamore'
+local bit = require'bit'
+
+local COUNT = 5000
+local DIR   = "bench_assets"
+local PAK   = "bench_assets.pak"
+
+-- minimal PNG writer
+local crcTable = {}
+for i = 0, 255 do
+	local c = i
+	for _ = 1, 8 do
+		c = bit.band(c, 1) ~= 0 and bit.bxor(0xEDB88320, bit.rshift(c, 1)) or bit.rshift(c, 1)
+	end
+	crcTable[i] = c
+end
+
+local function crc32(s)
+	local c = 0xFFFFFFFF
+	for i = 1, #s do
+		c = bit.bxor(crcTable[bit.band(bit.bxor(c, s:byte(i)), 0xFF)], bit.rshift(c, 8))
+	end
+	return bit.bnot(c)
+end
+
+local function u32(n)
+	return string.char(bit.band(bit.rshift(n, 24), 255), bit.band(bit.rshift(n, 16), 255), bit.band(bit.rshift(n, 8), 255), bit.band(n, 255))
+end
+
+local function chunk(kind, data)
+	return u32(#data) .. kind .. data .. u32(crc32(kind .. data))
+end
+
+local function png(w, h, seed)
+	local rows = {}
+	for y = 0, h - 1 do
+		local row = {"\0"}
+		for x = 0, w - 1 do
+			row[#row + 1] = string.char((x*16 + seed)%256, (y*16)%256, seed%256, 255)
+		end
+		rows[#rows + 1] = table.concat(row)
+	end
+	return "\137PNG\r\n\26\n"
+		.. chunk("IHDR", u32(w) .. u32(h) .. "\8\6\0\0\0")
+		.. chunk("IDAT", ray.core.CompressData(table.concat(rows)))
+		.. chunk("IEND", "")
+end
+
+-- window is needed for timer only
+ray.core.SetConfigFlags("WINDOW_HIDDEN")
+ray.core.InitWindow(100, 100, "archive benchmark")
+
+os.execute('mkdir "' .. DIR .. '"')
+local names = {}
+for i = 1, COUNT do
+	names[i] = ("img%05d.png"):format(i)
+	local f = assert(io.open(DIR .. "/" .. names[i], "wb"))
+	f:write(png(16, 16, i))
+	f:close()
+end
+
+local files = {}
+for i = 1, COUNT do files[names[i]] = DIR .. "/" .. names[i] end
+ray.archive.Pack(PAK, files)
+
+local function measure(title, fn)
+	collectgarbage()
+	local start = ray.core.GetTime()
+	fn()
+	print(("%-28s %8.1f ms"):format(title, (ray.core.GetTime() - start)*1000))
+end
+
+measure("loose files, data", function()
+	for i = 1, COUNT do
+		local f = io.open(DIR .. "/" .. names[i], "rb")
+		f:read("*a")
+		f:close()
+	end
+end)
+
+measure("loose files, images", function()
+	for i = 1, COUNT do ray.Image(DIR .. "/" .. names[i]) end
+end)
+
+local pak
+measure("archive, open", function() pak = ray.archive.Open(PAK) end)
+
+measure("archive, data", function()
+	for i = 1, COUNT do pak:loadFileData(names[i]) end
+end)
+
+measure("archive, images", function()
+	for i = 1, COUNT do pak:loadImage(names[i]) end
+end)
+
+pak:close()
+for i = 1, COUNT do os.remove(DIR .. "/" .. names[i]) end
+os.remove(DIR)
+os.remove(PAK)
+
+ray.core.CloseWindow()
@@ -0,0 +1,84 @@
+-- Concurrent loading of a directory of images by rl.async: every image is decoded by pool threads and equals
+-- the image loaded on main thread, missing and broken files give errors. No window is needed.
+-- luajit async_test.lua [count [image]]
+local ray = require'raylib_luamore'
+
+local COUNT = tonumber((...)) or 64
+local LOGO  = select(2, ...) or "../../logo/raylib_luamore_256x256.png"
+local DIR   = "test_async"
+local test  = dofile((arg[0]:match("^(.*[/\\])") or "") .. "checks.lua")("async")
+local check = test.check
+
+local function same(a, b)
+	if a.width ~= b.width or a.height ~= b.height or a.format ~= b.format then return false end
+	local pa, pb = a:getBuffer(), b:getBuffer()
+	for i = 1, #pa do if pa[i] ~= pb[i] then return false end end
+	return true
+end
+
+-- directory of copies of the image with long names (paths are stored by tasks), and a broken file
+os.execute(('mkdir "%s"'):format(DIR))
+local png = assert(io.open(LOGO, "rb")):read("*a")
+local files = {}
+for i = 1, COUNT do
+	files[i] = ("%s/%s_%d.png"):format(DIR, ("long_image_name_"):rep(8), i)
+	local f = assert(io.open(files[i], "wb"))
+	f:write(png)
+	f:close()
+end
+local broken = DIR .. "/broken.png"
+assert(io.open(broken, "wb")):write(png:sub(1, 100)):close()
+
+local reference = ray.Image(LOGO)
+ray.async.SetThreadCount(4)
+
+-- all tasks are queued at once, so several workers run concurrently
+local tasks, called = {}, 0
+for i = 1, COUNT do
+	tasks[i] = ray.async.LoadImage(files[i], function(img, err)
+		called = called + 1
+		check(img and same(img, reference), "callback result of " .. files[i] .. " " .. tostring(err))
+	end)
+end
+for i = 1, COUNT do
+	local img, err = tasks[i]:wait()
+	check(img and same(img, reference), files[i] .. " " .. tostring(err))
+end
+ray.async.Update()
+check(called == COUNT, ("%d callbacks of %d tasks are called"):format(called, COUNT))
+
+-- coroutines await their tasks, resumed by caller until all are finished
+local results, running = {}, {}
+for i = 1, 8 do
+	running[i] = coroutine.create(function() results[i] = {ray.async.Await(ray.async.LoadImage(files[i]))} end)
+end
+repeat
+	local alive = 0
+	for i = 1, #running do
+		if coroutine.status(running[i]) ~= "dead" then
+			assert(coroutine.resume(running[i]))
+			alive = alive + 1
+		end
+	end
+until alive == 0
+for i = 1, #running do check(results[i][1] and same(results[i][1], reference), "await of " .. files[i]) end
+
+-- loading of the same file through asset cache is shared, but every caller gets own image
+local first, second = ray.assets.LoadImageAsync(files[1]), ray.assets.LoadImageAsync(files[1])
+local a, b = first:wait(), second:wait()
+check(a and b and a ~= b and same(a, reference) and same(b, reference), "shared loading gives copies")
+if a and b then
+	a:getBuffer()[1] = (a:getBuffer()[1] + 1) % 256
+	check(same(b, reference), "image of shared loading is changed by other caller")
+end
+
+local img, err = ray.async.LoadImage(DIR .. "/missing.png"):wait()
+check(not img and err, "missing file gives error")
+img, err = ray.async.LoadImage(broken):wait()
+check(not img and err, "broken file gives error")
+
+for i = 1, COUNT do os.remove(files[i]) end
+os.remove(broken)
+os.remove(DIR)
+
+test.finish()
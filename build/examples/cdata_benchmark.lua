@@ -0,0 +1,80 @@
+-- Userdata versus cdata of FFI layer: math by userdata methods, cdata passed to C functions
+-- (every cdata argument is checked by resolver of FFI layer) and math compiled by JIT.
+-- Also checks that cdata of wrong type is rejected. No window is needed.
+-- luajit cdata_benchmark.lua [iterations]
+local ffi = require'ffi'
+local ray = require'raylib_luamore'
+local rlf = require'raylib_luamore_ffi'
+
+local ITERATIONS = tonumber(...) or 1000000
+
+local function measure(title, run)
+	collectgarbage()
+	local start = os.clock()
+	local sink = run()
+	local time = os.clock() - start
+	print(("%-40s %8.2f M calls/s"):format(title, ITERATIONS/time/1e6))
+	return sink
+end
+
+local ua, ub, uo = ray.Vector3(1, 2, 3), ray.Vector3(4, 5, 6), ray.Vector3()
+local ca, cb, co = rlf.Vector3(1, 2, 3), rlf.Vector3(4, 5, 6), rlf.Vector3()
+
+measure("userdata method, userdata arguments", function() for i = 1, ITERATIONS do uo:addTo(ua, ub) end end)
+measure("userdata method, cdata arguments", function() for i = 1, ITERATIONS do uo:addTo(ca, cb) end end)
+measure("cdata method (JIT)", function() for i = 1, ITERATIONS do co:copy(ca):add(cb) end end)
+measure("userdata distance", function() local s = 0 for i = 1, ITERATIONS do s = s + ua:distance(ub) end return s end)
+measure("cdata distance (JIT)", function() local s = 0 for i = 1, ITERATIONS do s = s + ca:distance(cb) end return s end)
+
+-- same result by both paths
+uo:addTo(ca, cb)
+assert(uo.x == 5 and uo.y == 7 and uo.z == 9, "cdata arguments give wrong result")
+
+-- cdata of other type is rejected instead of being read as Vector3
+local array = ffi.new("Vector3[2]", {{1, 2, 3}, {4, 5, 6}})
+local wrong = {
+	{"Vector2 cdata",       rlf.Vector2(1, 2)},
+	{"pointer to Vector3",  ffi.cast("Vector3 *", array)},
+	{"array of Vector3",    array},
+	{"float array",         ffi.new("float[3]", 1, 2, 3)},
+	{"ctype of Vector3",    ffi.typeof(rlf.Vector3())},
+}
+for _, case in ipairs(wrong) do
+	local ok = pcall(uo.addTo, uo, ua, case[2])
+	print(("%-40s %s"):format(case[1], ok and "ACCEPTED" or "rejected"))
+	assert(not ok, case[1] .. " should be rejected")
+end
+-- reference to array element is the struct itself
+uo:addTo(ua, array[1])
+assert(uo.x == 5 and uo.y == 7 and uo.z == 9, "reference to Vector3 gives wrong result")
+
+-- cdata is accepted in optional arguments too, not replaced by default value
+local rect = ray.Rectangle(0, 0, 10, 10)
+assert(rect:collidePoint(rlf.Vector2(5, 5)), "Vector2 cdata point is ignored by Rectangle:collidePoint")
+assert(not rect:collidePoint(rlf.Vector2(20, 5)), "Vector2 cdata point is ignored by Rectangle:collidePoint")
+rect:setPosition(rlf.Vector2(3, 4))
+assert(rect.x == 3 and rect.y == 4, "Vector2 cdata is ignored by Rectangle:setPosition")
+local img = ray.Image(2, 2, "r8g8b8a8", rlf.Color(10, 20, 30, 40))
+local c = img:getPixel(1, 1)
+assert(c.r == 10 and c.g == 20 and c.b == 30 and c.a == 40, "Color cdata fill is ignored by Image")
+print("cdata in optional arguments accepted")
+
+-- cdata methods give same results as userdata methods
+local function same(what, u, c)
+	local uv, cv = {u:get()}, {c:get()}
+	for i = 1, math.max(#uv, #cv) do
+		assert(uv[i] == cv[i], ("%s: userdata %s, cdata %s at %d"):format(what, tostring(uv[i]), tostring(cv[i]), i))
+	end
+end
+same("Matrix:translate", ray.Matrix():translate(ray.Vector3(1, 2, 3)), rlf.Matrix():translate(rlf.Vector3(1, 2, 3)))
+same("Matrix:translate numbers", ray.Matrix():translate(1, 2, 3), rlf.Matrix():translate(1, 2, 3))
+same("Matrix:scale", ray.Matrix():scale({4, 5, 6}), rlf.Matrix():scale({4, 5, 6}))
+same("Vector2:set", ray.Vector2(1, 2):set(5), rlf.Vector2(1, 2):set(5))
+same("Vector3:set", ray.Vector3(1, 2, 3):set(nil, 7), rlf.Vector3(1, 2, 3):set(nil, 7))
+same("Vector4:set", ray.Vector4(1, 2, 3, 4):set(9), rlf.Vector4(1, 2, 3, 4):set(9))
+same("Color:set", ray.Color(1, 2, 3, 4):set(10, 20, 30), rlf.Color(1, 2, 3, 4):set(10, 20, 30))
+same("Color:fade", ray.Color(1, 2, 3, 4):fade(0.5), rlf.Color(1, 2, 3, 4):fade(0.5))
+same("Rectangle:set", ray.Rectangle(1, 2, 3, 4):set(5.5, -6.5), rlf.Rectangle(1, 2, 3, 4):set(5.5, -6.5))
+-- methods that are not attached to cdata raise error instead of returning nil
+assert(not pcall(function() return rlf.Matrix():invert() end), "missing cdata method should raise error")
+print("cdata methods match userdata methods")
@@ -0,0 +1,23 @@
+-- Shared part of *_test.lua scripts: failed checks are printed and counted, exit code tells if all passed.
+-- local test  = dofile((arg[0]:match("^(.*[/\\])") or "") .. "checks.lua")("allocation")
+-- local check = test.check
+-- check(1 + 1 == 2, "addition")
+-- test.finish() -- prints "all allocation tests passed" or "1 allocation tests failed" and exits
+return function(name)
+	local test = {failed = 0}
+
+	function test.check(ok, message)
+		if not ok then
+			test.failed = test.failed + 1
+			print("FAIL: " .. message)
+		end
+		return ok
+	end
+
+	function test.finish()
+		print(test.failed == 0 and ("all %s tests passed"):format(name) or ("%d %s tests failed"):format(test.failed, name))
+		os.exit(test.failed == 0 and 0 or 1)
+	end
+
+	return test
+end
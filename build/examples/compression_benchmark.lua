@@ -0,0 +1,94 @@
+-- Compression speed and memory: one-shot CompressData versus DeflateStream and parallel CompressBlocks,
+-- compression and decompression are timed separately, no window is needed
+-- luajit compression_benchmark.lua [oneshot|stream|blocks]
+-- Run each mode separately to compare peak memory (VmHWM is shown on Linux only).
+-- os.clock is CPU time of all threads, so CompressBlocks rates are per CPU, not per wall clock second.
+local ray = require'raylib_luamore'
+
+local MODE = ... or "all"
+local SIZE = 64*1024*1024
+local FILE = "bench_data.bin"
+
+local function peakMemory()
+	local f = io.open("/proc/self/status")
+	if not f then return "n/a" end
+	local peak = f:read("*a"):match("VmHWM:%s*(%d+)")
+	f:close()
+	return peak and ("%d MB"):format(peak/1024) or "n/a"
+end
+
+-- compressible test file, written by chunks
+local f = assert(io.open(FILE, "wb"))
+local chunk = {}
+for i = 1, 64*1024 do chunk[i] = string.char((i*7)%256, (i/64)%256, math.random(0, 3), 0) end
+chunk = table.concat(chunk)
+for _ = 1, SIZE/#chunk do f:write(chunk) end
+f:close()
+
+local function readFile()
+	local f = io.open(FILE, "rb")
+	local data = f:read("*a")
+	f:close()
+	return data
+end
+
+-- fn returns its result and compressed size, rate is measured by uncompressed size
+local function measure(title, fn)
+	collectgarbage()
+	local start = os.clock()
+	local result, packed = fn()
+	local time = os.clock() - start
+	print(("%-28s %8.1f MB/s  ratio %5.3f  peak %s"):format(title, SIZE/time/1024/1024, packed/SIZE, peakMemory()))
+	return result
+end
+
+if MODE == "all" or MODE == "oneshot" then
+	local input = readFile()
+	local data = measure("CompressData", function()
+		local data = ray.core.CompressData(input)
+		return data, #data
+	end)
+	input = nil
+	local output = measure("DecompressData", function() return ray.core.DecompressData(data), #data end)
+	assert(#output == SIZE)
+end
+
+if MODE == "all" or MODE == "stream" then
+	local packed = measure("DeflateStream", function()
+		local f, out = io.open(FILE, "rb"), io.open(FILE .. ".z", "wb")
+		local stream = ray.DeflateStream(6)
+		for data in function() return f:read(65536) end do
+			out:write(stream:write(data):read())
+		end
+		out:write(stream:finish():read())
+		f:close()
+		local packed = out:seek("end")
+		out:close()
+		return packed, packed
+	end)
+	local size = measure("InflateStream", function()
+		local inflate, size = ray.InflateStream(), 0
+		local f = io.open(FILE .. ".z", "rb")
+		for data in function() return f:read(65536) end do
+			size = size + #inflate:write(data):read()
+		end
+		f:close()
+		assert(inflate:isFinished())
+		return size, packed
+	end)
+	assert(size == SIZE)
+	os.remove(FILE .. ".z")
+end
+
+if MODE == "all" or MODE == "blocks" then
+	local input = readFile()
+	local data = measure("CompressBlocks", function()
+		local data = ray.core.CompressBlocks(input, 6)
+		return data, #data
+	end)
+	input = nil
+	local output = measure("DecompressBlocks", function() return ray.core.DecompressBlocks(data), #data end)
+	assert(#output == SIZE)
+end
+
+os.remove(FILE)
@@ -0,0 +1,133 @@
+-- Frustum culling checks of rl.models.CullInstances, no window is needed:
+-- hand-made cases for perspective and orthographic cameras, then random instances compared between
+-- scalar and SIMD modes and with brute force test of box corners
+-- luajit culling_test.lua [instances]
+local ray = require'raylib_luamore'
+
+local unpack = table.unpack or unpack
+
+local COUNT = tonumber(...) or 10001 -- not a multiple of 4, so SIMD tail is tested too
+local test  = dofile((arg[0]:match("^(.*[/\\])") or "") .. "checks.lua")("culling")
+local check = test.check
+
+-- instance matrix in Matrix field order: rotation around Y, then scale, then translation
+local function put(buf, i, x, y, z, angle, sx, sy, sz)
+	local c, s = math.cos(angle or 0), math.sin(angle or 0)
+	sx, sy, sz = sx or 1, sy or 1, sz or 1
+	local m = {c*sx, 0, s*sz, x,  0, sy, 0, y,  -s*sx, 0, c*sz, z,  0, 0, 0, 1}
+	for k = 1, 16 do buf[(i - 1)*16 + k] = m[k] end
+end
+
+local function cull(min, max, transforms, view, projection, mode)
+	ray.models.SetCullingMode(mode or "simd")
+	local visible, count = ray.models.CullInstances(min, max, transforms, view, projection)
+	local list = {}
+	for i = 1, count do list[i] = visible[i] end
+	return list
+end
+
+local function same(a, b)
+	if #a ~= #b then return false end
+	for i = 1, #a do if a[i] ~= b[i] then return false end end
+	return true
+end
+
+local unitMin, unitMax = ray.Vector3(-0.5, -0.5, -0.5), ray.Vector3(0.5, 0.5, 0.5)
+
+-- perspective camera at origin looking to -Z, 60 degrees, square screen
+do
+	local view = ray.Matrix():lookAt(ray.Vector3(0, 0, 0), ray.Vector3(0, 0, -1), ray.Vector3(0, 1, 0))
+	local projection = ray.Matrix():perspective(math.rad(60), 1, 0.01, 1000)
+	local cases = {
+		{ 0,    0, -10,   true,  "in front"},
+		{ 0,    0,  10,   false, "behind"},
+		{-50,   0, -10,   false, "far left"},
+		{ 50,   0, -10,   false, "far right"},
+		{ 0,   50, -10,   false, "above"},
+		{ 0,    0, -2000, false, "beyond far plane"},
+		{ 0,    0, -999,  true,  "crossing far plane"},
+		{-6,    0, -10,   true,  "crossing left plane"},
+		{-6.3,  0, -10,   true,  "corner inside left plane"}, -- far corner (-5.8, -10.5), frustum is 6.06 wide there
+		{-7,    0, -10,   false, "out of left plane"},
+		{ 0,    0,  0.3,  true,  "around camera"},
+	}
+	local transforms = ray.Float32Buffer(#cases*16)
+	for i, case in ipairs(cases) do put(transforms, i, case[1], case[2], case[3]) end
+	for _, mode in ipairs{"scalar", "simd"} do
+		local visible, set = cull(unitMin, unitMax, transforms, view, projection, mode), {}
+		for _, i in ipairs(visible) do set[i] = true end
+		for i, case in ipairs(cases) do
+			check(not set[i] == not case[4], ("perspective, %s: %s is %s"):format(mode, case[5], set[i] and "visible" or "culled"))
+		end
+	end
+end
+
+-- orthographic camera above origin looking down, 40x20 units
+do
+	local view = ray.Matrix():lookAt(ray.Vector3(0, 10, 0), ray.Vector3(0, 0, 0), ray.Vector3(0, 0, -1))
+	local projection = ray.Matrix():ortho(-20, 20, -10, 10, 0.01, 1000)
+	local cases = {
+		{19, 0, 0, true}, {21, 0, 0, false}, {0, 0, 9, true}, {0, 0, 11, false}, {0, -500, 0, true}, {0, 20, 0, false},
+	}
+	local transforms = ray.Float32Buffer(#cases*16)
+	for i, case in ipairs(cases) do put(transforms, i, case[1], case[2], case[3]) end
+	for _, mode in ipairs{"scalar", "simd"} do
+		check(same(cull(unitMin, unitMax, transforms, view, projection, mode), {1, 3, 5}), "orthographic, " .. mode)
+	end
+end
+
+-- random instances: modes agree, every box with a corner inside of frustum is visible
+do
+	local eye = ray.Vector3(3, 4, 5)
+	local view = ray.Matrix():lookAt(eye, ray.Vector3(0, 1, -20), ray.Vector3(0, 1, 0))
+	local projection = ray.Matrix():perspective(math.rad(45), 16/9, 0.01, 1000)
+	local v, p = view:get't', projection:get't' -- m0, m1, ... m15, element of row r and column c is [c*4 + r + 1]
+	local function transform(m, x, y, z, w)
+		local out = {}
+		for r = 0, 3 do out[r + 1] = m[r + 1]*x + m[r + 5]*y + m[r + 9]*z + m[r + 13]*w end
+		return out[1], out[2], out[3], out[4]
+	end
+
+	math.randomseed(1)
+	local transforms, boxes = ray.Float32Buffer(COUNT*16), {}
+	for i = 1, COUNT do
+		local b = {math.random()*200 - 100, math.random()*200 - 100, math.random()*200 - 100, math.random()*6.28,
+		           0.5 + math.random()*3, 0.5 + math.random()*3, 0.5 + math.random()*3}
+		boxes[i] = b
+		put(transforms, i, unpack(b))
+	end
+	local min, max = ray.Vector3(-1, 0, -1), ray.Vector3(1, 4, 1)
+	local scalar = cull(min, max, transforms, view, projection, "scalar")
+	local simd   = cull(min, max, transforms, view, projection, "simd")
+	check(same(scalar, simd), ("random: scalar found %d, simd found %d"):format(#scalar, #simd))
+
+	local visible, inside, missed = {}, 0, 0
+	for _, i in ipairs(simd) do visible[i] = true end
+	for i, b in ipairs(boxes) do
+		local c, s, hit = math.cos(b[4]), math.sin(b[4]), false
+		for k = 0, 7 do
+			local lx = (k % 2 == 0 and -1 or 1)*b[5]
+			local ly = (math.floor(k/2) % 2 == 0 and 0 or 4)*b[6]
+			local lz = (k < 4 and -1 or 1)*b[7]
+			local x, y, z = c*lx + s*lz + b[1], ly + b[2], -s*lx + c*lz + b[3]
+			local cx, cy, cz, cw = transform(p, transform(v, x, y, z, 1))
+			if cw > 0 and math.abs(cx) <= cw and math.abs(cy) <= cw and math.abs(cz) <= cw then hit = true end
+		end
+		if hit then
+			inside = inside + 1
+			if not visible[i] then missed = missed + 1 end
+		end
+	end
+	check(missed == 0, ("random: %d of %d boxes with corner in frustum are culled"):format(missed, inside))
+	print(("random: %d instances, %d visible, %d have corner in frustum"):format(COUNT, #simd, inside))
+
+	-- results into existing buffer
+	local out = ray.Int32Buffer(COUNT)
+	local buf, count = ray.models.CullInstances(min, max, transforms, view, projection, out)
+	check(buf == out and count == #simd and out[1] == simd[1], "Visible buffer is reused")
+end
+
+check(not pcall(ray.models.SetCullingMode, "gpu"), "unknown mode is error")
+ray.models.SetCullingMode("simd")
+
+test.finish()
@@ -0,0 +1,52 @@
+-- DynamicFont atlas without window: glyph rectangles of a page never overlap, and glyphs of evicted pages
+-- are rasterized again on next use. Pages are small, so ASCII doesn't fit and pages are evicted.
+-- luajit dynamicfont_test.lua font.ttf
+local ray = require'raylib_luamore'
+
+local FONT = assert((...), "usage: luajit dynamicfont_test.lua font.ttf")
+local PAGE_SIZE, MAX_PAGES = 64, 2
+local test  = dofile((arg[0]:match("^(.*[/\\])") or "") .. "checks.lua")("dynamic font")
+local check = test.check
+
+local font = ray.DynamicFont(FONT, 32, PAGE_SIZE, MAX_PAGES)
+
+-- every cached glyph is inside of its page and doesn't overlap others of the same page
+local function checkAtlas(last)
+	local rects = {}
+	for cp = 32, last do
+		local page, x, y, w, h = font:getGlyph(cp)
+		if page and page >= 0 then
+			check(page < MAX_PAGES and x >= 0 and y >= 0 and x + w <= PAGE_SIZE and y + h <= PAGE_SIZE,
+				("glyph %q is out of page"):format(string.char(cp)))
+			for _, r in ipairs(rects) do
+				if r[1] == page and x < r[2] + r[4] and r[2] < x + w and y < r[3] + r[5] and r[3] < y + h then
+					check(false, ("glyphs %q and %q overlap on page %d"):format(string.char(cp), string.char(r[6]), page))
+				end
+			end
+			rects[#rects + 1] = {page, x, y, w, h, cp}
+		end
+	end
+end
+
+local width = font:measure("A", 32, 0).x
+check(font:getGlyph(65), "measured glyph is cached")
+for cp = 33, 126 do
+	font:preload(string.char(cp))
+	checkAtlas(cp)
+end
+
+local glyphs, pages, rasterized, evicted = font:getStats()
+print(("%d glyphs cached, %d pages, %d rasterized, %d evicted"):format(glyphs, pages, rasterized, evicted))
+check(pages == MAX_PAGES, "pages are limited by MaxPages")
+check(evicted > 0, "pages are evicted")
+check(not font:getGlyph(65), "glyph of least recently used page is evicted")
+
+-- evicted glyph is rasterized again with the same metrics
+font:preload("A")
+local _, _, again = font:getStats()
+check(again == rasterized + 1, "evicted glyph is rasterized again")
+check(font:getGlyph(65), "rasterized glyph is cached")
+check(font:measure("A", 32, 0).x == width, "rasterized glyph has the same metrics")
+checkAtlas(126)
+
+test.finish()
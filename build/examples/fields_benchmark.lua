@@ -0,0 +1,45 @@
+-- Field access speed of objects (lookup tables of __index/__newindex): reads and writes per second
+-- of first and last fields of classes, method lookup, and plain Lua table as reference. No window is needed.
+-- Every class row is measured again with the former strcmp chain dispatch (metatable baseline_t) as baseline.
+-- luajit fields_benchmark.lua [iterations]
+local ray = require'raylib_luamore'
+
+local ITERATIONS = tonumber(...) or 5000000
+
+local function rate(run)
+	collectgarbage()
+	local start = os.clock()
+	run()
+	return ITERATIONS/(os.clock() - start)/1e6
+end
+
+-- obj: when given, its metatable is switched to baseline dispatchers for a second run
+local function measure(title, run, obj)
+	local current = rate(run)
+	if not obj then
+		print(("%-34s %8.1f M accesses/s"):format(title, current))
+		return
+	end
+	local mt = getmetatable(obj)
+	local index, newindex = mt.__index, mt.__newindex
+	mt.__index, mt.__newindex = mt.baseline_t.__index, mt.baseline_t.__newindex
+	local baseline = rate(run)
+	mt.__index, mt.__newindex = index, newindex
+	print(("%-34s %8.1f M accesses/s, strcmp baseline %8.1f M/s (x%.2f)"):format(title, current, baseline, current/baseline))
+end
+
+local v2, v3, m = ray.Vector2(1, 2), ray.Vector3(1, 2, 3), ray.Matrix():identity()
+local color, rect = ray.Color(10, 20, 30, 255), ray.Rectangle(0, 0, 10, 10)
+local image = ray.Image(64, 64, "r8g8b8a8")
+local plain = {x = 1, y = 2}
+
+measure("table, read x", function() local s = 0 for i = 1, ITERATIONS do s = s + plain.x end return s end)
+measure("Vector2, read x", function() local s = 0 for i = 1, ITERATIONS do s = s + v2.x end return s end, v2)
+measure("Vector2, write y", function() for i = 1, ITERATIONS do v2.y = i end end, v2)
+measure("Vector3, read z", function() local s = 0 for i = 1, ITERATIONS do s = s + v3.z end return s end, v3)
+measure("Matrix, read m1", function() local s = 0 for i = 1, ITERATIONS do s = s + m.m1 end return s end, m)
+measure("Matrix, read m16 (last field)", function() local s = 0 for i = 1, ITERATIONS do s = s + m.m16 end return s end, m)
+measure("Color, write a", function() for i = 1, ITERATIONS do color.a = i % 256 end end, color)
+measure("Rectangle, read height", function() local s = 0 for i = 1, ITERATIONS do s = s + rect.height end return s end, rect)
+measure("Image, read format", function() local s = 0 for i = 1, ITERATIONS do s = s + image.format end return s end, image)
+measure("Vector3, method lookup", function() local f for i = 1, ITERATIONS do f = v3.length end return f end, v3)
@@ -0,0 +1,75 @@
+-- Text measuring and drawing speed with large charset font: chars/s should not depend on glyphs count,
+-- as glyph index is found by lookup table instead of linear scan. Window is hidden.
+-- luajit font_benchmark.lua font.ttf [glyphs]
+local ray = require'raylib_luamore'
+
+local FONT    = assert((...), "usage: luajit font_benchmark.lua font.ttf [glyphs] (font with CJK glyphs)")
+local GLYPHS  = tonumber(select(2, ...)) or 10000
+local CHARS   = 200000
+local FIRST   = 0x4E00 -- CJK unified ideographs
+
+ray.core.SetConfigFlags("WINDOW_HIDDEN")
+ray.core.InitWindow(800, 600, "font benchmark")
+ray.core.SetTargetFPS(0)
+
+local function utf8(cp)
+	if cp < 0x80 then return string.char(cp) end
+	if cp < 0x800 then return string.char(0xC0 + math.floor(cp/64), 0x80 + cp % 64) end
+	return string.char(0xE0 + math.floor(cp/4096), 0x80 + math.floor(cp/64) % 64, 0x80 + cp % 64)
+end
+
+local codepoints = {}
+for i = 32, 126 do codepoints[#codepoints + 1] = i end
+for i = 0, GLYPHS - 1 do codepoints[#codepoints + 1] = FIRST + i end
+local small = ray.Font(FONT, 16)
+local large = ray.Font(FONT, 16, codepoints)
+print(("small font: %d glyphs, large font: %d glyphs"):format(small.charsCount, large.charsCount))
+
+-- lookup gives the same indices as loading order
+local wrong = 0
+for i, cp in ipairs(codepoints) do if large:getGlyphIndex(cp) ~= i - 1 then wrong = wrong + 1 end end
+assert(wrong == 0, wrong .. " codepoints have wrong glyph index")
+
+-- lines of 100 chars, CJK ones are spread over the whole charset
+local ascii, cjk = {}, {}
+for i = 1, 100 do
+	ascii[i] = string.char(32 + i % 95)
+	cjk[i] = utf8(FIRST + (i*7919) % GLYPHS)
+end
+ascii, cjk = table.concat(ascii), table.concat(cjk)
+local lines = CHARS/100
+
+local size = ray.Vector2()
+local function measure(title, run)
+	collectgarbage()
+	local start = os.clock()
+	run()
+	local time = os.clock() - start
+	print(("%-34s %8.2f M chars/s"):format(title, CHARS/time/1e6))
+end
+
+measure("MeasureTextEx, small font, ASCII", function() for i = 1, lines do ray.text.MeasureTextEx(small, ascii, 16, 1, size) end end)
+measure("MeasureTextEx, large font, ASCII", function() for i = 1, lines do ray.text.MeasureTextEx(large, ascii, 16, 1, size) end end)
+measure("MeasureTextEx, large font, CJK", function() for i = 1, lines do ray.text.MeasureTextEx(large, cjk, 16, 1, size) end end)
+measure("getGlyphIndex, large font", function()
+	local n = #codepoints
+	for i = 1, CHARS do large:getGlyphIndex(codepoints[i % n + 1]) end
+end)
+
+local position, white = ray.Vector2(0, 0), ray.Color("white")
+local function draw(font, text)
+	for frame = 1, 10 do
+		ray.core.BeginDrawing()
+		for i = 1, lines/10 do
+			position.y = i % 600
+			ray.text.DrawTextEx(font, text, position, 16, 1, white)
+		end
+		ray.core.EndDrawing()
+	end
+end
+measure("DrawTextEx, small font, ASCII", function() draw(small, ascii) end)
+measure("DrawTextEx, large font, CJK", function() draw(large, cjk) end)
+
+large:unload()
+small:unload()
+ray.core.CloseWindow()
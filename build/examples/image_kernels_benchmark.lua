@@ -0,0 +1,49 @@
+-- Image color operations speed in MPixels/s for every kernels mode (see rl.textures.SetImageKernels),
+-- with the largest difference of channels from raylib output. No window is needed.
+-- luajit image_kernels_benchmark.lua [size]
+local ray = require'raylib_luamore'
+
+local SIZE   = tonumber(...) or 2048
+local REPEAT = 5
+local MODES  = {"raylib", "scalar", "simd"}
+
+local source = ray.Image(SIZE, SIZE, "r8g8b8a8")
+local pixels = source:getBuffer()
+math.randomseed(1)
+for i = 1, #pixels do pixels[i] = math.random(0, 255) end
+
+local operations = {
+	{"tint",         function(img) img:tint(ray.Color(200, 100, 50, 128)) end},
+	{"invert",       function(img) img:invert() end},
+	{"grayscale",    function(img) img:grayscale() end},
+	{"contrast",     function(img) img:contrast(40) end},
+	{"brightness",   function(img) img:brightness(-30) end},
+	{"replaceColor", function(img) img:replaceColor(ray.Color(pixels[1], pixels[2], pixels[3], pixels[4]), ray.Color("red")) end},
+}
+
+local function difference(a, b)
+	local pa, pb = a:getBuffer(), b:getBuffer()
+	if #pa ~= #pb then return math.huge end
+	local diff = 0
+	for i = 1, #pa do diff = math.max(diff, math.abs(pa[i] - pb[i])) end
+	return diff
+end
+
+local prev = ray.textures.SetImageKernels("raylib")
+for _, op in ipairs(operations) do
+	local reference
+	for _, mode in ipairs(MODES) do
+		ray.textures.SetImageKernels(mode)
+		local time, result = 0
+		for i = 1, REPEAT do
+			result = source:clone()
+			collectgarbage()
+			local start = os.clock()
+			op[2](result)
+			time = time + os.clock() - start
+		end
+		reference = reference or result
+		print(("%-13s %-7s %9.1f MPixels/s   max difference %g"):format(op[1], mode, SIZE*SIZE*REPEAT/time/1e6, difference(result, reference)))
+	end
+end
+ray.textures.SetImageKernels(prev)
@@ -0,0 +1,51 @@
+-- Threaded Image:resize and Image:genMipmaps give the same bytes as SetImageThreads(1),
+-- for odd sizes and several formats (formats other than r8g8b8a8 and r8g8b8 go through raylib). No window is needed.
+-- luajit image_threads_test.lua
+local ray = require'raylib_luamore'
+
+local SIZES   = {{1, 1}, {3, 7}, {17, 5}, {255, 129}, {333, 1001}, {1024, 3}}
+local TARGETS = {{1, 1}, {5, 3}, {129, 257}, {640, 17}}
+local FORMATS = {"r8g8b8a8", "r8g8b8", "grayalpha", "r5g6b5"}
+local test  = dofile((arg[0]:match("^(.*[/\\])") or "") .. "checks.lua")("image threads")
+local check = test.check
+
+local function random(w, h, format)
+	local img = ray.Image(w, h, format)
+	local pixels = img:getBuffer()
+	for i = 1, #pixels do pixels[i] = math.random(0, format == "r5g6b5" and 65535 or 255) end
+	return img
+end
+
+local function same(a, b)
+	if a.width ~= b.width or a.height ~= b.height or a.mipmaps ~= b.mipmaps or a.format ~= b.format then return false end
+	for level = 0, a.mipmaps - 1 do
+		local pa, pb = a:getBuffer(level), b:getBuffer(level)
+		if #pa ~= #pb then return false end
+		for i = 1, #pa do if pa[i] ~= pb[i] then return false end end
+	end
+	return true
+end
+
+-- runs operation by one thread and by all pool threads on copies of the image
+local function compare(img, title, operation)
+	local prev = ray.textures.SetImageThreads(1)
+	local serial = operation(img:clone())
+	ray.textures.SetImageThreads(0)
+	local threaded = operation(img:clone())
+	ray.textures.SetImageThreads(prev)
+	check(same(serial, threaded), title)
+end
+
+math.randomseed(3)
+for _, format in ipairs(FORMATS) do
+	for _, size in ipairs(SIZES) do
+		local img = random(size[1], size[2], format)
+		local name = ("%s %dx%d"):format(format, size[1], size[2])
+		for _, target in ipairs(TARGETS) do
+			compare(img, ("%s resize to %dx%d"):format(name, target[1], target[2]), function(i) return i:resize(target[1], target[2]) end)
+		end
+		compare(img, name .. " genMipmaps", function(i) return i:genMipmaps() end)
+	end
+end
+
+test.finish()
@@ -0,0 +1,60 @@
+-- Instanced drawing speed: 10k trees by DrawModel calls versus one DrawModelInstanced call, and culling alone
+-- luajit instancing_benchmark.lua [trees]
+local ray = require'raylib_luamore'
+
+local TREES  = tonumber(...) or 10000
+local FRAMES = 100
+local WIDTH, HEIGHT = 800, 600
+
+-- vsync is off, frame time is CPU time of submission
+ray.core.InitWindow(WIDTH, HEIGHT, "instancing benchmark")
+ray.core.SetTargetFPS(0)
+
+-- Camera3D can't be created from Lua here, so trees are drawn by default screen projection (z from -1 to 0),
+-- on field 2x2 screens large, so a quarter of them is visible
+local tree = ray.Model(ray.models.GenMeshCube(6, 6, 0.5))
+local transforms = ray.Float32Buffer(TREES*16)
+local positions = {}
+for i = 0, TREES - 1 do
+	local x, y = math.random()*WIDTH*2 - WIDTH/2, math.random()*HEIGHT*2 - HEIGHT/2
+	positions[i + 1] = ray.Vector3(x, y, -0.5)
+	local m = {1, 0, 0, x,  0, 1, 0, y,  0, 0, 1, -0.5,  0, 0, 0, 1}
+	for k = 1, 16 do transforms[i*16 + k] = m[k] end
+end
+local view, projection = ray.Matrix():identity(), ray.Matrix():ortho(0, WIDTH, HEIGHT, 0, 0, 1)
+print(("%d trees, %d visible"):format(TREES, select(2, ray.models.CullInstances(tree, transforms, view, projection))))
+
+local green, background = ray.Color(40, 140, 60, 255), ray.Color(245, 245, 245, 255)
+local function measure(title, draw)
+	collectgarbage()
+	local start = ray.core.GetTime()
+	for frame = 1, FRAMES do
+		ray.core.BeginDrawing()
+		ray.core.ClearBackground(background)
+		draw()
+		ray.core.EndDrawing()
+	end
+	local time = ray.core.GetTime() - start
+	print(("%-32s %7.2f ms/frame"):format(title, time/FRAMES*1000))
+end
+
+measure("DrawModel per tree", function()
+	for i = 1, TREES do ray.models.DrawModel(tree, positions[i], 1, green) end
+end)
+for _, mode in ipairs{"scalar", "simd"} do
+	ray.models.SetCullingMode(mode)
+	measure("DrawModelInstanced, " .. mode, function() ray.models.DrawModelInstanced(tree, transforms, green) end)
+end
+
+-- culling only, without window
+local visible = ray.Int32Buffer(TREES)
+for _, mode in ipairs{"scalar", "simd"} do
+	ray.models.SetCullingMode(mode)
+	local start = ray.core.GetTime()
+	for frame = 1, FRAMES do ray.models.CullInstances(tree, transforms, view, projection, visible) end
+	local time = ray.core.GetTime() - start
+	print(("%-32s %7.1f M instances/s"):format("CullInstances, " .. mode, TREES*FRAMES/time/1e6))
+end
+
+tree:unload()
+ray.core.CloseWindow()
@@ -0,0 +1,61 @@
+-- Physics step speed from 64 to 10k bodies: spatial hash grid versus test of every pair (as Physac does),
+-- no window is needed
+-- luajit physics_benchmark.lua [max bodies]
+local ray = require'raylib_luamore'
+
+local MAX_BODIES = tonumber(...) or 10000
+local MAX_PAIRS  = 2048 -- every pair test is too slow above
+local WARMUP     = 60   -- steps before measuring, so bodies are falling on each other
+
+-- columns of alternating boxes and circles above static ground, field is as wide as it is high
+local function build(count)
+	ray.physics.ResetPhysics()
+	local columns = math.ceil(math.sqrt(count*4))
+	local width = columns*12
+	ray.physics.CreatePhysicsBodyRectangle(ray.Vector2(width/2, 500), width + 100, 20, 10):setEnabled(false)
+	math.randomseed(7)
+	for i = 0, count - 1 do
+		local position = ray.Vector2(i % columns*12 + 6 + math.random(), 480 - math.floor(i/columns)*12)
+		if i % 2 == 0 then ray.physics.CreatePhysicsBodyRectangle(position, 8, 8, 1)
+		else ray.physics.CreatePhysicsBodyCircle(position, 4, 1) end
+	end
+end
+
+local function measure(count, mode)
+	ray.physics.SetPhysicsBroadphase(mode)
+	build(count)
+	for i = 1, WARMUP do ray.physics.RunPhysicsStep() end
+	local steps = count > 1000 and 10 or 50
+	collectgarbage()
+	local start = os.clock()
+	for i = 1, steps do ray.physics.RunPhysicsStep() end
+	local time = (os.clock() - start)/steps
+	local pairs, contacts = ray.physics.GetPhysicsStats()
+	print(("%6d bodies  %-5s %9.2f ms/step  %8d pairs tested  %6d contacts"):format(count, mode, time*1000, pairs, contacts))
+end
+
+-- same simulation by both modes, pairs are tested in the same order
+do
+	local function snapshot(mode)
+		ray.physics.SetPhysicsBroadphase(mode)
+		build(256)
+		for i = 1, 100 do ray.physics.RunPhysicsStep() end
+		local list = {}
+		for i = 1, ray.physics.GetPhysicsBodiesCount() do list[i] = {ray.physics.GetPhysicsBody(i):getPosition("n")} end
+		return list
+	end
+	local grid, all = snapshot("grid"), snapshot("pairs")
+	local same = #grid == #all
+	for i = 1, #grid do same = same and grid[i][1] == all[i][1] and grid[i][2] == all[i][2] end
+	print(same and "grid and pairs give the same simulation" or "WARNING: grid and pairs differ")
+end
+
+local count = 64
+while true do
+	measure(count, "grid")
+	if count <= MAX_PAIRS then measure(count, "pairs") end
+	if count >= MAX_BODIES then break end
+	count = math.min(count*4, MAX_BODIES)
+end
+
+ray.physics.ClosePhysics()
@@ -0,0 +1,102 @@
+-- Ray picking speed: raylib GetCollisionRayModel (every triangle) versus BVH RaycastModel and RaycastModelMany
+-- luajit raycast_benchmark.lua [size]
+local ray = require'raylib_luamore'
+
+local SIZE = tonumber(...) or 500 -- heightmap pixels per side, 2*(SIZE-1)^2 triangles
+local RAYS = 1000
+
+-- window is needed for mesh upload
+ray.core.SetConfigFlags("WINDOW_HIDDEN")
+ray.core.InitWindow(100, 100, "raycast benchmark")
+
+local img = ray.Image(SIZE, SIZE, "grayscale")
+local px  = img:getBuffer()
+for y = 0, SIZE - 1 do
+	for x = 0, SIZE - 1 do
+		px[y*SIZE + x + 1] = 128 + 60*math.sin(x/17)*math.cos(y/23) + math.random(-8, 8)
+	end
+end
+local start = ray.core.GetTime()
+local terrain = ray.Model(ray.models.GenMeshHeightmap(img, ray.Vector3(SIZE, 32, SIZE)))
+print(("%d triangles, mesh generated in %.1f ms"):format(terrain:getTriangleCount(), (ray.core.GetTime() - start)*1000))
+
+start = ray.core.GetTime()
+terrain:buildBVH()
+print(("BVH built in %.1f ms"):format((ray.core.GetTime() - start)*1000))
+
+-- rays from above to random points, as mouse picking does
+local rays = ray.Float32Buffer(RAYS*6)
+for i = 0, RAYS - 1 do
+	local x, z = math.random()*SIZE, math.random()*SIZE
+	rays[i*6 + 1], rays[i*6 + 2], rays[i*6 + 3] = x, 100, z
+	-- normalized, raylib distances are measured in direction lengths
+	local dx, dz = math.random() - 0.5, math.random() - 0.5
+	local len = math.sqrt(dx*dx + 1 + dz*dz)
+	rays[i*6 + 4], rays[i*6 + 5], rays[i*6 + 6] = dx/len, -1/len, dz/len
+end
+local function rayAt(i)
+	return ray.Vector3(rays[i*6 + 1], rays[i*6 + 2], rays[i*6 + 3]), ray.Vector3(rays[i*6 + 4], rays[i*6 + 5], rays[i*6 + 6])
+end
+
+local LINEAR = 20 -- linear path is too slow for all rays
+start = ray.core.GetTime()
+local linear = {}
+for i = 0, LINEAR - 1 do
+	local position, direction = rayAt(i)
+	local hit, distance = ray.models.GetCollisionRayModel(position, direction, terrain)
+	linear[i] = hit and distance
+end
+local linearTime = (ray.core.GetTime() - start)/LINEAR
+print(("GetCollisionRayModel %10.3f ms/ray"):format(linearTime*1000))
+
+start = ray.core.GetTime()
+for i = 0, RAYS - 1 do
+	local position, direction = rayAt(i)
+	local distance = ray.models.RaycastModel(position, direction, terrain)
+	if i < LINEAR then
+		assert((distance == nil) == (linear[i] == false), "BVH and linear hits differ")
+		assert(not distance or math.abs(distance - linear[i]) < 1e-2, "BVH and linear distances differ")
+	end
+end
+local bvhTime = (ray.core.GetTime() - start)/RAYS
+print(("RaycastModel         %10.3f ms/ray  (x%.0f)"):format(bvhTime*1000, linearTime/bvhTime))
+
+start = ray.core.GetTime()
+local results, hits = ray.models.RaycastModelMany(rays, terrain)
+local manyTime = (ray.core.GetTime() - start)/RAYS
+print(("RaycastModelMany     %10.3f ms/ray  (x%.0f), %d hits"):format(manyTime*1000, linearTime/manyTime, hits))
+
+terrain:unload()
+
+-- Two meshes hit at their first triangles: mesh 1 is far floor, mesh 2 is nearer tilted triangle,
+-- so triangle index alone can't tell which mesh is hit. Written as IQM with positions only.
+local function writeTwoMeshes(filename)
+	local function u32(t) return ray.Int32Buffer(t):toString() end
+	local text      = "\0floor\0slope\0" .. ("\0"):rep(64) -- names are read by 32 bytes
+	local meshes    = u32{1, 0, 0, 4, 0, 2,  7, 0, 4, 3, 2, 1}
+	local positions = ray.Float32Buffer{-4, 0, -4,  4, 0, -4,  4, 0, 4,  -4, 0, 4,  -2, 1, -2,  2, 2, -2,  -2, 1, 2}:toString()
+	local triangles = u32{0, 1, 3,  1, 2, 3,  4, 5, 6}
+	local ofsText = 124 + 20
+	local ofsMeshes, ofsPositions = ofsText + #text, ofsText + #text + #meshes
+	local ofsTriangles = ofsPositions + #positions
+	local size = ofsTriangles + #triangles
+	local header = "INTERQUAKEMODEL\0" .. u32{2, size, 0,
+		#text, ofsText,  2, ofsMeshes,  1, 7, 124,  3, ofsTriangles, 0,  0, 0,  0, 0,  0, 0,  0, 0, 0, 0,  0, 0,  0, 0}
+	local f = assert(io.open(filename, "wb"))
+	f:write(header, u32{0, 0, 7, 3, ofsPositions}, text, meshes, positions, triangles)
+	f:close()
+end
+writeTwoMeshes("raycast_two_meshes.iqm")
+local pair = ray.Model("raycast_two_meshes.iqm")
+os.remove("raycast_two_meshes.iqm")
+-- slope is y = 1 + (x + 2)/4, so hit at x = -1 is 1.25 high, its normal is tilted along x
+local distance, point, normal, triangle, mesh = ray.models.RaycastModel(ray.Vector3(-1, 10, -1), ray.Vector3(0, -1, 0), pair)
+assert(distance and math.abs(distance - 8.75) < 1e-4, "wrong distance to nearer mesh")
+assert(mesh == 2 and triangle == 1, ("nearer mesh 2 triangle 1 is expected, got mesh %s triangle %s"):format(mesh, triangle))
+assert(math.abs(normal.x) > 0.2, "normal of farther mesh is reported")
+local results = ray.models.RaycastModelMany(ray.Float32Buffer{-1, 10, -1, 0, -1, 0}, pair)
+assert(results[6] == 2, "RaycastModelMany reports farther mesh")
+print("two meshes: nearer mesh is reported")
+pair:unload()
+
+ray.core.CloseWindow()
@@ -0,0 +1,54 @@
+-- Batched shapes drawing speed in primitives/s: DrawPixel per primitive versus DrawPixels/DrawRectangles
+-- with every kind of coordinates buffer. Window is hidden, time is CPU time of submission.
+-- luajit shapes_benchmark.lua [primitives]
+local ray = require'raylib_luamore'
+local hasffi, ffi = pcall(require, 'ffi')
+if hasffi then require'raylib_luamore_ffi' end
+
+local COUNT  = tonumber(...) or 50000
+local FRAMES = 20
+
+ray.core.SetConfigFlags("WINDOW_HIDDEN")
+ray.core.InitWindow(800, 600, "shapes benchmark")
+ray.core.SetTargetFPS(0)
+
+-- the same coordinates in every buffer kind, 4 floats per primitive (x, y, width, height)
+local floats = {}
+for i = 1, COUNT do
+	floats[#floats + 1], floats[#floats + 2] = math.random(800), math.random(600)
+	floats[#floats + 1], floats[#floats + 2] = math.random(4), math.random(4)
+end
+local buffer = ray.Float32Buffer(#floats)
+for i = 1, #floats do buffer[i] = floats[i] end
+local cdata = hasffi and ffi.new("float[?]", #floats, floats)
+local packed = hasffi and ffi.string(cdata, #floats*4)
+local red = ray.Color("red")
+
+local function measure(title, draw)
+	collectgarbage()
+	local start = os.clock()
+	for frame = 1, FRAMES do
+		ray.core.BeginDrawing()
+		ray.core.ClearBackground(ray.Color("black"))
+		draw()
+		ray.core.EndDrawing()
+	end
+	local time = os.clock() - start
+	print(("%-34s %8.2f M primitives/s"):format(title, COUNT*FRAMES/time/1e6))
+end
+
+measure("DrawPixel per pixel", function()
+	for i = 0, COUNT - 1 do ray.shapes.DrawPixel(floats[i*4 + 1], floats[i*4 + 2], red) end
+end)
+measure("DrawPixels, table", function() ray.shapes.DrawPixels(floats, red, COUNT) end)
+measure("DrawPixels, Float32Buffer", function() ray.shapes.DrawPixels(buffer, red, COUNT) end)
+measure("DrawRectangles, table", function() ray.shapes.DrawRectangles(floats, red) end)
+measure("DrawRectangles, Float32Buffer", function() ray.shapes.DrawRectangles(buffer, red) end)
+if hasffi then
+	measure("DrawRectangles, string", function() ray.shapes.DrawRectangles(packed, red) end)
+	measure("DrawRectangles, float[?] cdata", function() ray.shapes.DrawRectangles(cdata, red) end)
+	-- size of cdata is known, so too large Count is rejected
+	assert(not pcall(ray.shapes.DrawRectangles, cdata, red, COUNT + 1), "Count over cdata size is accepted")
+end
+
+ray.core.CloseWindow()
@@ -0,0 +1,88 @@
+-- Writes IQM file with tube around chain of bones and bending animations, for skinning benchmarks
+-- local writeTube = dofile("skinned_tube.lua")
+-- writeTube(filename, {rings = 128, segments = 64, bones = 32, animations = {{frames = 60, amplitude = 0.1, waves = 1}}})
+-- rigid = true binds every ring to the nearest bone only, as raylib UpdateModelAnimation skins it
+local ray = require'raylib_luamore'
+
+local function u32(t) return ray.Int32Buffer(t):toString() end
+local function f32(t) return ray.Float32Buffer(t):toString() end
+
+return function(filename, options)
+	local RINGS, SEGMENTS, BONES = options.rings or 128, options.segments or 64, options.bones or 32
+	local HEIGHT, RADIUS = 2, 0.3
+	local animations = options.animations or {{frames = 60, amplitude = 0.1, waves = 1}}
+
+	local vertexCount   = RINGS*SEGMENTS
+	local triangleCount = (RINGS - 1)*SEGMENTS*2
+	local positions, normals, indexes, weights, triangles = {}, {}, {}, {}, {}
+	local step = HEIGHT/(BONES - 1)
+	for r = 0, RINGS - 1 do
+		local y = r/(RINGS - 1)*HEIGHT
+		-- weighted between two nearest bones
+		local b = math.min(math.floor(y/step), BONES - 2)
+		local w = math.floor((y/step - b)*255 + 0.5)
+		if options.rigid then
+			b = math.floor(y/step + 0.5)
+			w = 0
+		end
+		for s = 0, SEGMENTS - 1 do
+			local a = s/SEGMENTS*2*math.pi
+			local x, z = math.cos(a), math.sin(a)
+			for _, v in ipairs{x*RADIUS, y, z*RADIUS} do positions[#positions + 1] = v end
+			for _, v in ipairs{x, 0, z} do normals[#normals + 1] = v end
+			for _, v in ipairs{b, b + 1, 0, 0} do indexes[#indexes + 1] = v end
+			for _, v in ipairs{255 - w, w, 0, 0} do weights[#weights + 1] = v end
+			if r < RINGS - 1 then
+				local i, j = r*SEGMENTS + s, r*SEGMENTS + (s + 1) % SEGMENTS
+				for _, v in ipairs{i, i + SEGMENTS, j, j, i + SEGMENTS, j + SEGMENTS} do triangles[#triangles + 1] = v end
+			end
+		end
+	end
+
+	-- rotation z is the only animated channel (mask 0x20), rotation w is 1 and quaternion is normalized by loader
+	local joints, poses, frames, anims = {}, {}, {}, {}
+	for b = 0, BONES - 1 do
+		local ty = b > 0 and step or 0
+		joints[#joints + 1] = u32{0, b - 1} .. f32{0, ty, 0,  0, 0, 0, 1,  1, 1, 1}
+		poses[#poses + 1] = u32{b - 1, 0x20} .. f32{0, ty, 0,  0, 0, -1, 1,  1, 1, 1} ..
+		                    f32{0, 0, 0,  0, 0, 2/65535, 0,  0, 0, 0}
+	end
+	local frameCount = 0
+	for _, anim in ipairs(animations) do
+		anims[#anims + 1] = u32{0, frameCount, anim.frames} .. f32{30} .. u32{0}
+		for f = 0, anim.frames - 1 do
+			for b = 0, BONES - 1 do
+				local rz = anim.amplitude*math.sin(f/anim.frames*2*math.pi*(anim.waves or 1) + b*0.3)
+				frames[#frames + 1] = math.floor((rz + 1)/2*65535 + 0.5)
+			end
+		end
+		frameCount = frameCount + anim.frames
+	end
+
+	local text = "\0tube\0" .. ("\0"):rep(64) -- names are read by 32 bytes
+	local sections = {
+		text,
+		u32{1, 0, 0, vertexCount, 0, triangleCount},               -- mesh
+		"",                                                         -- vertex arrays, filled below
+		f32(positions), f32(normals),
+		ray.Uint8Buffer(indexes):toString(), ray.Uint8Buffer(weights):toString(),
+		u32(triangles),
+		table.concat(joints), table.concat(poses), table.concat(anims),
+		ray.Uint16Buffer(frames):toString(),
+	}
+	local offsets, size = {}, 124 + 4*5*4
+	for i, data in ipairs(sections) do
+		offsets[i] = i == 3 and 124 or size
+		if i ~= 3 then size = size + #data end
+	end
+	-- position, normal, blend indexes, blend weights (type, flags, format, size, offset)
+	sections[3] = u32{0, 0, 7, 3, offsets[4],  2, 0, 7, 3, offsets[5],  4, 0, 1, 4, offsets[6],  5, 0, 1, 4, offsets[7]}
+	local header = "INTERQUAKEMODEL\0" .. u32{2, size, 0,
+		#text, offsets[1],  1, offsets[2],  4, vertexCount, offsets[3],  triangleCount, offsets[8], 0,
+		BONES, offsets[9],  BONES, offsets[10],  #animations, offsets[11],  frameCount, BONES, offsets[12], 0,  0, 0,  0, 0}
+	local f = assert(io.open(filename, "wb"))
+	f:write(header, sections[3])
+	for i, data in ipairs(sections) do if i ~= 3 then f:write(data) end end
+	f:close()
+	return vertexCount
+end
@@ -0,0 +1,74 @@
+-- Skinning speed: raylib UpdateModelAnimation versus scalar and SIMD skinning, on one and all threads.
+-- Also checks that all modes give the same vertices.
+-- luajit skinning_benchmark.lua [characters]
+local ray = require'raylib_luamore'
+
+local CHARACTERS = tonumber(...) or 200
+local RINGS, SEGMENTS, BONES, FRAMES = 128, 64, 32, 60 -- 8192 vertices, 2 bones per vertex
+local FILE = "bench_skin.iqm"
+
+-- window is needed for mesh upload, nothing is drawn
+ray.core.SetConfigFlags("WINDOW_HIDDEN")
+ray.core.InitWindow(100, 100, "skinning benchmark")
+
+-- tube around chain of bones, bending by animation
+local writeTube = dofile((arg[0]:match("^(.*[/\\])") or "") .. "skinned_tube.lua")
+writeTube(FILE, {rings = RINGS, segments = SEGMENTS, bones = BONES, animations = {{frames = FRAMES, amplitude = 0.1}}})
+
+local anim = ray.models.LoadModelAnimations(FILE)[1]
+local characters = {}
+for i = 1, CHARACTERS do characters[i] = ray.Model(FILE) end
+assert(ray.models.IsModelAnimationValid(characters[1], anim) and anim:getFrameCount() == FRAMES)
+local vertices = characters[1]:getVertexCount()
+print(("%d characters, %d vertices and %d bones each"):format(CHARACTERS, vertices, characters[1]:getBoneCount()))
+
+local function measure(title, mode, threads, upload)
+	ray.models.SetSkinningMode(mode)
+	ray.models.SetSkinningThreads(threads)
+	collectgarbage()
+	local start = ray.core.GetTime()
+	for frame = 0, FRAMES - 1 do
+		for i = 1, CHARACTERS do ray.models.UpdateModelAnimation(characters[i], anim, frame, upload) end
+	end
+	local time = ray.core.GetTime() - start
+	print(("%-36s %8.1f M vertices/s  %6.2f ms/frame"):format(title, CHARACTERS*vertices*FRAMES/time/1e6, time/FRAMES*1000))
+end
+
+measure("raylib (first bone only)",           "raylib", 1, true)
+measure("scalar, 1 thread",                   "scalar", 1, true)
+measure("simd, 1 thread",                     "simd",   1, true)
+measure("simd, all threads",                  "simd",   0, true)
+measure("scalar, 1 thread, no upload",        "scalar", 1, false)
+measure("simd, 1 thread, no upload",          "simd",   1, false)
+measure("simd, all threads, no upload",       "simd",   0, false)
+
+-- all modes give the same animVertices: scalar and SIMD for blended bones, raylib too for rigid tube
+local RIGID = "bench_skin_rigid.iqm"
+writeTube(RIGID, {rings = RINGS, segments = SEGMENTS, bones = BONES, rigid = true, animations = {{frames = FRAMES, amplitude = 0.1}}})
+local rigid, rigidAnim = ray.Model(RIGID), ray.models.LoadModelAnimations(RIGID)[1]
+local function skin(model, animation, mode, threads)
+	ray.models.SetSkinningMode(mode)
+	ray.models.SetSkinningThreads(threads)
+	ray.models.UpdateModelAnimation(model, animation, FRAMES/3, false)
+	return model:getAnimVertices()
+end
+local function compare(title, a, b)
+	local diff = 0
+	for i = 1, #a do diff = math.max(diff, math.abs(a[i] - b[i])) end
+	print(("%-36s max difference %g"):format(title, diff))
+	assert(#a == #b and diff < 1e-4, title .. " results differ")
+end
+local scalar = skin(characters[1], anim, "scalar", 1)
+compare("simd, 1 thread vs scalar",    skin(characters[1], anim, "simd", 1), scalar)
+compare("simd, all threads vs scalar", skin(characters[1], anim, "simd", 0), scalar)
+local rigidScalar = skin(rigid, rigidAnim, "scalar", 1)
+compare("rigid, raylib vs scalar",     skin(rigid, rigidAnim, "raylib", 1), rigidScalar)
+compare("rigid, simd vs scalar",       skin(rigid, rigidAnim, "simd", 0), rigidScalar)
+rigid:unload()
+rigidAnim:unload()
+os.remove(RIGID)
+
+for i = 1, CHARACTERS do characters[i]:unload() end
+anim:unload()
+os.remove(FILE)
+ray.core.CloseWindow()
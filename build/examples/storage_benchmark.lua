@@ -0,0 +1,79 @@
+-- Save data speed: StorageSaveValue versus rl.storage, and recovery of log cut by crash
+-- luajit storage_benchmark.lua
+local ray = require'raylib_luamore'
+
+local COUNT = 1000
+local FILE  = "bench_save.dat"
+
+-- window is needed for timer only
+ray.core.SetConfigFlags("WINDOW_HIDDEN")
+ray.core.InitWindow(100, 100, "storage benchmark")
+
+local function measure(title, fn)
+	collectgarbage()
+	local start = ray.core.GetTime()
+	fn()
+	local time = ray.core.GetTime() - start
+	print(("%-34s %10.0f values/s"):format(title, COUNT/time))
+end
+
+measure("StorageSaveValue", function()
+	for i = 1, COUNT do ray.core.StorageSaveValue(i % 64, i) end
+	assert(ray.core.StorageLoadValue((COUNT - 1) % 64) == COUNT - 1)
+end)
+
+measure("Storage:set, flush every value", function()
+	os.remove(FILE)
+	local save = ray.storage.Open(FILE, 0)
+	for i = 1, COUNT do save:set("value" .. i % 64, i) end
+	save:close()
+end)
+
+measure("Storage:set, batched", function()
+	os.remove(FILE)
+	local save = ray.storage.Open(FILE)
+	for i = 1, COUNT do save:set("value" .. i % 64, i) end
+	save:close()
+end)
+
+-- every value is written separately, so log contains COUNT steps
+os.remove(FILE)
+local save = ray.storage.Open(FILE, 0)
+for i = 1, 200 do
+	save:set("key" .. i, ("x"):rep(i))
+	save:set("counter", i)
+end
+save:close()
+
+local f = assert(io.open(FILE, "rb"))
+local log = f:read("*a")
+f:close()
+
+-- copies cut at every offset (as if program was stopped while writing) open with complete steps only
+local COPY = FILE .. ".cut"
+local recovered = 0
+for cut = 8, #log do
+	local f = assert(io.open(COPY, "wb"))
+	f:write(log:sub(1, cut))
+	f:close()
+	local store = ray.storage.Open(COPY)
+	local count = 0
+	while store:get("key" .. count + 1) do count = count + 1 end
+	for i = 1, count do assert(store:get("key" .. i) == ("x"):rep(i), "damaged value") end
+	local counter = store:get("counter", 0)
+	assert(counter == count or counter == count - 1, "values are not a prefix of changes")
+	local keys = #store:getKeys()
+	assert(keys == count + (counter > 0 and 1 or 0), "unexpected keys")
+	store:close()
+	-- damaged tail is dropped by compaction, so store is opened the same way again
+	local again = ray.storage.Open(COPY)
+	assert(again:get("counter", 0) == counter and #again:getKeys() == keys)
+	again:close()
+	if cut == #log then recovered = count end
+end
+assert(recovered == 200)
+print(("recovery: %d cut copies opened with consistent values"):format(#log - 7))
+
+os.remove(COPY)
+os.remove(FILE)
+ray.core.CloseWindow()
@@ -0,0 +1,55 @@
+-- Static text drawing: 1000 labels by DrawTextEx every frame versus cached TextLayout:draw
+-- luajit textlayout_benchmark.lua [labels]
+local ray = require'raylib_luamore'
+
+local LABELS = tonumber(...) or 1000
+local FRAMES = 100
+local WIDTH, HEIGHT = 800, 600
+
+-- vsync is off, frame time is CPU time of submission
+ray.core.InitWindow(WIDTH, HEIGHT, "text layout benchmark")
+ray.core.SetTargetFPS(0)
+
+local font = ray.text.GetFontDefault()
+local labels, layouts, positions = {}, {}, {}
+math.randomseed(5)
+for i = 1, LABELS do
+	labels[i] = ("Label %d: health %d/%d"):format(i, math.random(100), 100)
+	layouts[i] = ray.TextLayout(font, labels[i], 10, 1)
+	positions[i] = ray.Vector2(math.random(0, WIDTH - 150), math.random(0, HEIGHT - 10))
+end
+
+local color, background = ray.Color("darkgray"), ray.Color("raywhite")
+local function measure(title, draw)
+	collectgarbage()
+	local start = ray.core.GetTime()
+	for frame = 1, FRAMES do
+		ray.core.BeginDrawing()
+		ray.core.ClearBackground(background)
+		draw()
+		ray.core.EndDrawing()
+	end
+	local time = ray.core.GetTime() - start
+	print(("%-24s %7.2f ms/frame"):format(title, time/FRAMES*1000))
+end
+
+measure("DrawTextEx", function()
+	for i = 1, LABELS do ray.text.DrawTextEx(font, labels[i], positions[i], 10, 1, color) end
+end)
+measure("TextLayout:draw", function()
+	for i = 1, LABELS do layouts[i]:draw(positions[i], color) end
+end)
+-- same text every frame, so layouts are not rebuilt
+measure("TextLayout:setText+draw", function()
+	for i = 1, LABELS do layouts[i]:setText(labels[i]):draw(positions[i], color) end
+end)
+
+-- layout has the same size as measured text (up to float rounding)
+local size = ray.Vector2()
+for i = 1, LABELS do
+	local w, h = layouts[i]:getSize():get()
+	ray.text.MeasureTextEx(font, labels[i], 10, 1, size)
+	assert(math.abs(w - size.x) < 0.01 and math.abs(h - size.y) < 0.01, "layout size differs from MeasureTextEx for " .. labels[i])
+end
+
+ray.core.CloseWindow()
@@ -0,0 +1,78 @@
+-- Directory scanning: GetDirectoryFiles versus rl.fs.Walk and rl.fs.WalkAsync on directory with many files
+-- luajit walk_benchmark.lua [count]
+local ray = require'raylib_luamore'
+
+local COUNT = tonumber(...) or 20000
+local DIR   = "bench_walk"
+
+-- window is needed for timer only
+ray.core.SetConfigFlags("WINDOW_HIDDEN")
+ray.core.InitWindow(100, 100, "walk benchmark")
+
+-- files are created by io.open, 100 per subdirectory for recursive walking
+local sep = package.config:sub(1, 1)
+local function mkdir(path) os.execute(('mkdir "%s"'):format(sep == "\\" and path:gsub("/", "\\") or path)) end
+mkdir(DIR)
+mkdir(DIR .. "/flat")
+local created = {}
+for i = 1, COUNT do
+	local sub = ("%s/tree%d"):format(DIR, i % 100)
+	if not created[sub] then
+		mkdir(sub)
+		created[sub] = true
+	end
+	local ext = i % 2 == 0 and "png" or "txt"
+	assert(io.open(("%s/flat/file%d.%s"):format(DIR, i, ext), "wb")):close()
+	assert(io.open(("%s/file%d.%s"):format(sub, i, ext), "wb")):close()
+end
+
+local function measure(title, fn)
+	collectgarbage()
+	local start = ray.core.GetTime()
+	local count = fn()
+	print(("%-36s %8.1f ms  %d entries"):format(title, (ray.core.GetTime() - start)*1000, count))
+end
+
+measure("GetDirectoryFiles (flat)", function()
+	return #ray.core.GetDirectoryFiles(DIR .. "/flat")
+end)
+
+measure("Walk (flat)", function()
+	local count = 0
+	for _ in ray.fs.Walk(DIR .. "/flat") do count = count + 1 end
+	assert(count == COUNT)
+	return count
+end)
+
+measure("Walk (recursive, *.png)", function()
+	local count, bytes = 0, 0
+	for _, _, size in ray.fs.Walk(DIR, {extensions = "png"}) do count, bytes = count + 1, bytes + size end
+	assert(count == COUNT)
+	return count
+end)
+
+measure("WalkAsync (recursive)", function()
+	local entries = assert(ray.fs.WalkAsync(DIR, {directories = true}):wait())
+	assert(#entries == COUNT*2 + 101)
+	return #entries
+end)
+
+-- path of task is stored past the end of task struct, so long one checks that it is not cut
+local LONG = DIR .. "/" .. ("long_directory_name_"):rep(10)
+mkdir(LONG)
+for i = 1, 10 do assert(io.open(("%s/file%d.txt"):format(LONG, i), "wb")):close() end
+measure("WalkAsync (long path)", function()
+	local entries = assert(ray.fs.WalkAsync(LONG):wait())
+	assert(#entries == 10)
+	for _, entry in ipairs(entries) do assert(entry.path:sub(1, #LONG) == LONG, entry.path) end
+	return #entries
+end)
+
+-- cleanup, files are listed by walker itself
+local dirs = {}
+for path, type in ray.fs.Walk(DIR, {directories = true}) do
+	if type == "directory" then table.insert(dirs, 1, path) else os.remove(path) end
+end
+for _, path in ipairs(dirs) do os.remove(path) end
+os.remove(DIR)
+ray.core.CloseWindow()
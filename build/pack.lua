@@ -0,0 +1,28 @@
+-- Packs all files of directory to archive, entries are named by paths relative to directory
+-- luajit pack.lua Archive.pak Directory [compress]
+local rl = require'raylib_luamore'
+
+local out, root, compress = ...
+if not out or not root then
+	print("Usage: luajit pack.lua Archive.pak Directory [compress]")
+	os.exit(1)
+end
+
+local files, count = {}, 0
+local function scan(dir, prefix)
+	for _, name in ipairs(rl.core.GetDirectoryFiles(dir)) do
+		if name ~= "." and name ~= ".." then
+			local path = dir .. "/" .. name
+			if rl.core.DirectoryExists(path) then
+				scan(path, prefix .. name .. "/")
+			else
+				files[prefix .. name] = path
+				count = count + 1
+			end
+		end
+	end
+end
+scan(root, "")
+
+local size = rl.archive.Pack(out, files, compress == "compress")
+print(("%d files packed to %s, %d bytes"):format(count, out, size))
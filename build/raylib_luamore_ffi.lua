@@ -0,0 +1,525 @@
+--[[
+	raylib_luamore FFI layer (LuaJIT only)
+
+	Declares raylib math structs as cdata with the same methods as raylib_luamore classes,
+	so the math loops can be compiled by JIT. Cdata objects are accepted by raylib_luamore functions
+	wherever the struct is required; cdata of any other type (pointers, other structs) raises type error.
+
+	local rl  = require'raylib_luamore'
+	local rlf = require'raylib_luamore_ffi'
+
+	local pos, vel = rlf.Vector2(10, 10), rlf.Vector2(1, 2)
+	pos:add(vel)           -- compiled by JIT
+	rl.shapes.DrawPixel(pos, rl.Color("red"))
+
+	Only a subset of class methods is attached to cdata, the ones worth compiling by JIT:
+	* Vector2, Vector3: arithmetic (add, subtract, scale, multiply, divide, negate, lerp and their *To forms),
+	  length, dotProduct, distance, normalize; Vector2 angle, angleRad; Vector3 crossProduct, reflect, min, max,
+	  transform, rotateByQuaternion;
+	* Vector4: add, subtract, scale, multiply, identity, length, normalize, qInvert, qMultiply, qLerp, qNlerp,
+	  qSlerp, qFromAxisAngle and their *To forms;
+	* Matrix: identity, trace, transpose, add, subtract, multiply, translate, scale and their *To forms;
+	* Color: toInt, fade;
+	* Rectangle: move, getPosition, setPosition, getDimensions, setDimensions, collideRect, collidePoint;
+	* all classes: clone, get, set, copy.
+	Any other method (Matrix:invert, Color:toHSV, ...) raises error, copy cdata into userdata object to use it:
+	rl.Matrix():set(m:get()):invert().
+
+	Differences from userdata classes:
+	* methods that return new objects (clone, overloads) return cdata;
+	* Matrix fields are named m1..m16 like in userdata class;
+	* Color fields are unsigned bytes, assigning is wrapped by FFI (300 -> 44).
+]]
+
+local ffi = require'ffi'
+local bit = require'bit'
+local rl  = require'raylib_luamore'
+
+local sqrt, acos, sin, cos, atan2, min, max = math.sqrt, math.acos, math.sin, math.cos, math.atan2, math.min, math.max
+local floor, ceil, tonumber, type = math.floor, math.ceil, tonumber, type
+
+-- Same as luax_optnumber/luax_optinteger of C side: argument that is not a number leaves default value,
+-- integer arguments are truncated toward zero
+local function optnumber(x, def) return tonumber(x) or def end
+local function optinteger(x, def)
+	local n = tonumber(x)
+	if not n then return def end
+	return n < 0 and ceil(n) or floor(n)
+end
+
+-- Class table is both metatable and methods table of cdata; missing method raises error instead of returning nil
+local function class(classname)
+	local c = setmetatable({}, {__index = function(_, key)
+		error(("%s cdata has no method or field '%s'"):format(classname, tostring(key)), 2)
+	end})
+	c.__index = c
+	return c
+end
+
+ffi.cdef[[
+typedef struct Vector2 { float x, y; } Vector2;
+typedef struct Vector3 { float x, y, z; } Vector3;
+typedef struct Vector4 { float x, y, z, w; } Vector4;
+typedef struct Matrix {
+	float m1, m5, m9,  m13;
+	float m2, m6, m10, m14;
+	float m3, m7, m11, m15;
+	float m4, m8, m12, m16;
+} Matrix;
+typedef struct Color { unsigned char r, g, b, a; } Color;
+typedef struct Rectangle { float x, y, width, height; } Rectangle;
+]]
+
+local Vector2_t   = ffi.typeof("Vector2")
+local Vector3_t   = ffi.typeof("Vector3")
+local Vector4_t   = ffi.typeof("Vector4")
+local Matrix_t    = ffi.typeof("Matrix")
+local Color_t     = ffi.typeof("Color")
+local Rectangle_t = ffi.typeof("Rectangle")
+
+-- C side calls resolver for every cdata argument: it returns payload address if cdata has ctype
+-- of expected class (references to it are accepted too), nil otherwise.
+-- "float[]" is expected by functions taking float arrays, number of floats is returned as well.
+local ctypes = {Vector2 = Vector2_t, Vector3 = Vector3_t, Vector4 = Vector4_t, Matrix = Matrix_t, Color = Color_t, Rectangle = Rectangle_t}
+local floatarrays = {} -- ctype id -> is array of floats
+local function address(obj) return tonumber(ffi.cast("uintptr_t", ffi.cast("const void *", obj))) end
+local function resolve(obj, classname)
+	if tonumber(obj) then return nil end -- ctype objects (ffi.typeof results) are passed by istype, but they are numbers
+	if classname == "float[]" then
+		local ct = ffi.typeof(obj)
+		local id = tonumber(ct)
+		local isfloats = floatarrays[id]
+		if isfloats == nil then
+			isfloats = tostring(ct):match("^ctype<float %[[%d?]*%]>$") ~= nil
+			floatarrays[id] = isfloats
+		end
+		if not isfloats then return nil end
+		return address(obj), ffi.sizeof(obj)/4
+	end
+	local ct = ctypes[classname]
+	if not ct or not ffi.istype(ct, obj) then return nil end
+	return address(obj)
+end
+rl._EnableCData(resolve)
+
+local M = {}
+
+-- Vector2
+
+local Vector2 = class("Vector2")
+
+function Vector2.clone(v) return Vector2_t(v.x, v.y) end
+function Vector2.get(v) return v.x, v.y end
+function Vector2.set(v, x, y) v.x, v.y = optnumber(x, v.x), optnumber(y, v.y); return v end
+function Vector2.copy(v, s) v.x, v.y = s.x, s.y; return v end
+function Vector2.length(v) return sqrt(v.x*v.x + v.y*v.y) end
+function Vector2.dotProduct(a, b) return a.x*b.x + a.y*b.y end
+function Vector2.distance(a, b) local x, y = a.x - b.x, a.y - b.y; return sqrt(x*x + y*y) end
+function Vector2.angleRad(a, b)
+	local r = atan2(b.y - a.y, b.x - a.x)
+	if r < 0 then r = r + 2*math.pi end
+	return r
+end
+function Vector2.angle(a, b) return Vector2.angleRad(a, b)*180/math.pi end
+function Vector2.add(a, b) a.x, a.y = a.x + b.x, a.y + b.y; return a end
+function Vector2.subtract(a, b) a.x, a.y = a.x - b.x, a.y - b.y; return a end
+function Vector2.scale(a, n) a.x, a.y = a.x*n, a.y*n; return a end
+function Vector2.multiplyV(a, b) a.x, a.y = a.x*b.x, a.y*b.y; return a end
+function Vector2.multiply(a, b)
+	if type(b) == "number" then return Vector2.scale(a, b) end
+	return Vector2.multiplyV(a, b)
+end
+function Vector2.divideV(a, b) a.x, a.y = a.x/b.x, a.y/b.y; return a end
+function Vector2.divide(a, b)
+	if type(b) == "number" then a.x, a.y = a.x/b, a.y/b; return a end
+	return Vector2.divideV(a, b)
+end
+function Vector2.negate(a) a.x, a.y = -a.x, -a.y; return a end
+function Vector2.normalize(a)
+	local l = Vector2.length(a)
+	if l == 0 then l = 1 end
+	return Vector2.divide(a, l)
+end
+function Vector2.lerp(a, b, t) a.x, a.y = a.x + (b.x - a.x)*t, a.y + (b.y - a.y)*t; return a end
+
+function Vector2.addTo(o, a, b) o.x, o.y = a.x + b.x, a.y + b.y; return o end
+function Vector2.subtractTo(o, a, b) o.x, o.y = a.x - b.x, a.y - b.y; return o end
+function Vector2.scaleTo(o, a, n) o.x, o.y = a.x*n, a.y*n; return o end
+function Vector2.multiplyTo(o, a, b)
+	if type(b) == "number" then o.x, o.y = a.x*b, a.y*b; return o end
+	o.x, o.y = a.x*b.x, a.y*b.y; return o
+end
+function Vector2.divideTo(o, a, b)
+	if type(b) == "number" then o.x, o.y = a.x/b, a.y/b; return o end
+	o.x, o.y = a.x/b.x, a.y/b.y; return o
+end
+function Vector2.negateTo(o, a) o.x, o.y = -a.x, -a.y; return o end
+function Vector2.normalizeTo(o, a) return Vector2.normalize(Vector2.copy(o, a)) end
+function Vector2.lerpTo(o, a, b, t) o.x, o.y = a.x + (b.x - a.x)*t, a.y + (b.y - a.y)*t; return o end
+
+function Vector2.__add(a, b) return Vector2_t(a.x + b.x, a.y + b.y) end
+function Vector2.__sub(a, b) return Vector2_t(a.x - b.x, a.y - b.y) end
+function Vector2.__mul(a, b) return Vector2.multiply(Vector2_t(a), b) end
+function Vector2.__div(a, b) return Vector2.divide(Vector2_t(a), b) end
+function Vector2.__unm(a) return Vector2_t(-a.x, -a.y) end
+function Vector2.__len(a) return Vector2.length(a) end
+function Vector2.__eq(a, b) return ffi.istype(Vector2_t, b) and a.x == b.x and a.y == b.y end
+function Vector2.__tostring(a) return ("Vector2(%g, %g)"):format(a.x, a.y) end
+
+-- Vector3
+
+local Vector3 = class("Vector3")
+
+function Vector3.clone(v) return Vector3_t(v.x, v.y, v.z) end
+function Vector3.get(v) return v.x, v.y, v.z end
+function Vector3.set(v, x, y, z) v.x, v.y, v.z = optnumber(x, v.x), optnumber(y, v.y), optnumber(z, v.z); return v end
+function Vector3.copy(v, s) v.x, v.y, v.z = s.x, s.y, s.z; return v end
+function Vector3.length(v) return sqrt(v.x*v.x + v.y*v.y + v.z*v.z) end
+function Vector3.dotProduct(a, b) return a.x*b.x + a.y*b.y + a.z*b.z end
+function Vector3.distance(a, b)
+	local x, y, z = a.x - b.x, a.y - b.y, a.z - b.z
+	return sqrt(x*x + y*y + z*z)
+end
+function Vector3.add(a, b) a.x, a.y, a.z = a.x + b.x, a.y + b.y, a.z + b.z; return a end
+function Vector3.subtract(a, b) a.x, a.y, a.z = a.x - b.x, a.y - b.y, a.z - b.z; return a end
+function Vector3.scale(a, n) a.x, a.y, a.z = a.x*n, a.y*n, a.z*n; return a end
+function Vector3.multiplyV(a, b) a.x, a.y, a.z = a.x*b.x, a.y*b.y, a.z*b.z; return a end
+function Vector3.multiply(a, b)
+	if type(b) == "number" then return Vector3.scale(a, b) end
+	return Vector3.multiplyV(a, b)
+end
+function Vector3.divideV(a, b) a.x, a.y, a.z = a.x/b.x, a.y/b.y, a.z/b.z; return a end
+function Vector3.divide(a, b)
+	if type(b) == "number" then a.x, a.y, a.z = a.x/b, a.y/b, a.z/b; return a end
+	return Vector3.divideV(a, b)
+end
+function Vector3.negate(a) a.x, a.y, a.z = -a.x, -a.y, -a.z; return a end
+function Vector3.normalize(a)
+	local l = Vector3.length(a)
+	if l == 0 then l = 1 end
+	return Vector3.divide(a, l)
+end
+function Vector3.lerp(a, b, t)
+	a.x, a.y, a.z = a.x + (b.x - a.x)*t, a.y + (b.y - a.y)*t, a.z + (b.z - a.z)*t
+	return a
+end
+function Vector3.crossProduct(a, b)
+	a.x, a.y, a.z = a.y*b.z - a.z*b.y, a.z*b.x - a.x*b.z, a.x*b.y - a.y*b.x
+	return a
+end
+function Vector3.reflect(v, n)
+	local d = 2*Vector3.dotProduct(v, n)
+	v.x, v.y, v.z = v.x - d*n.x, v.y - d*n.y, v.z - d*n.z
+	return v
+end
+function Vector3.min(a, b) a.x, a.y, a.z = min(a.x, b.x), min(a.y, b.y), min(a.z, b.z); return a end
+function Vector3.max(a, b) a.x, a.y, a.z = max(a.x, b.x), max(a.y, b.y), max(a.z, b.z); return a end
+function Vector3.transform(v, m)
+	local x, y, z = v.x, v.y, v.z
+	v.x = m.m1*x + m.m5*y + m.m9*z  + m.m13
+	v.y = m.m2*x + m.m6*y + m.m10*z + m.m14
+	v.z = m.m3*x + m.m7*y + m.m11*z + m.m15
+	return v
+end
+function Vector3.rotateByQuaternion(v, q)
+	local x, y, z = v.x, v.y, v.z
+	local qx, qy, qz, qw = q.x, q.y, q.z, q.w
+	v.x = x*(qx*qx + qw*qw - qy*qy - qz*qz) + y*(2*qx*qy - 2*qw*qz) + z*(2*qx*qz + 2*qw*qy)
+	v.y = x*(2*qw*qz + 2*qx*qy) + y*(qw*qw - qx*qx + qy*qy - qz*qz) + z*(-2*qw*qx + 2*qy*qz)
+	v.z = x*(-2*qw*qy + 2*qx*qz) + y*(2*qw*qx + 2*qy*qz) + z*(qw*qw - qx*qx - qy*qy + qz*qz)
+	return v
+end
+
+function Vector3.addTo(o, a, b) o.x, o.y, o.z = a.x + b.x, a.y + b.y, a.z + b.z; return o end
+function Vector3.subtractTo(o, a, b) o.x, o.y, o.z = a.x - b.x, a.y - b.y, a.z - b.z; return o end
+function Vector3.scaleTo(o, a, n) o.x, o.y, o.z = a.x*n, a.y*n, a.z*n; return o end
+function Vector3.multiplyTo(o, a, b) return Vector3.multiply(Vector3.copy(o, a), b) end
+function Vector3.divideTo(o, a, b) return Vector3.divide(Vector3.copy(o, a), b) end
+function Vector3.negateTo(o, a) o.x, o.y, o.z = -a.x, -a.y, -a.z; return o end
+function Vector3.normalizeTo(o, a) return Vector3.normalize(Vector3.copy(o, a)) end
+function Vector3.lerpTo(o, a, b, t)
+	o.x, o.y, o.z = a.x + (b.x - a.x)*t, a.y + (b.y - a.y)*t, a.z + (b.z - a.z)*t
+	return o
+end
+function Vector3.crossProductTo(o, a, b)
+	o.x, o.y, o.z = a.y*b.z - a.z*b.y, a.z*b.x - a.x*b.z, a.x*b.y - a.y*b.x
+	return o
+end
+function Vector3.transformTo(o, a, m) return Vector3.transform(Vector3.copy(o, a), m) end
+function Vector3.rotateByQuaternionTo(o, a, q) return Vector3.rotateByQuaternion(Vector3.copy(o, a), q) end
+function Vector3.reflectTo(o, a, n) return Vector3.reflect(Vector3.copy(o, a), n) end
+function Vector3.minTo(o, a, b) o.x, o.y, o.z = min(a.x, b.x), min(a.y, b.y), min(a.z, b.z); return o end
+function Vector3.maxTo(o, a, b) o.x, o.y, o.z = max(a.x, b.x), max(a.y, b.y), max(a.z, b.z); return o end
+
+function Vector3.__add(a, b) return Vector3_t(a.x + b.x, a.y + b.y, a.z + b.z) end
+function Vector3.__sub(a, b) return Vector3_t(a.x - b.x, a.y - b.y, a.z - b.z) end
+function Vector3.__mul(a, b) return Vector3.multiply(Vector3_t(a), b) end
+function Vector3.__div(a, b) return Vector3.divide(Vector3_t(a), b) end
+function Vector3.__unm(a) return Vector3_t(-a.x, -a.y, -a.z) end
+function Vector3.__len(a) return Vector3.length(a) end
+function Vector3.__eq(a, b) return ffi.istype(Vector3_t, b) and a.x == b.x and a.y == b.y and a.z == b.z end
+function Vector3.__tostring(a) return ("Vector3(%g, %g, %g)"):format(a.x, a.y, a.z) end
+
+-- Vector4 (Quaternion)
+
+local Vector4 = class("Vector4")
+
+function Vector4.clone(v) return Vector4_t(v.x, v.y, v.z, v.w) end
+function Vector4.get(v) return v.x, v.y, v.z, v.w end
+function Vector4.set(v, x, y, z, w)
+	v.x, v.y, v.z, v.w = optnumber(x, v.x), optnumber(y, v.y), optnumber(z, v.z), optnumber(w, v.w)
+	return v
+end
+function Vector4.copy(v, s) v.x, v.y, v.z, v.w = s.x, s.y, s.z, s.w; return v end
+function Vector4.identity(v) v.x, v.y, v.z, v.w = 0, 0, 0, 1; return v end
+function Vector4.length(v) return sqrt(v.x*v.x + v.y*v.y + v.z*v.z + v.w*v.w) end
+function Vector4.add(a, b) a.x, a.y, a.z, a.w = a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w; return a end
+function Vector4.subtract(a, b) a.x, a.y, a.z, a.w = a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w; return a end
+function Vector4.scale(a, n) a.x, a.y, a.z, a.w = a.x*n, a.y*n, a.z*n, a.w*n; return a end
+function Vector4.multiplyV(a, b) a.x, a.y, a.z, a.w = a.x*b.x, a.y*b.y, a.z*b.z, a.w*b.w; return a end
+function Vector4.multiply(a, b)
+	if type(b) == "number" then return Vector4.scale(a, b) end
+	return Vector4.multiplyV(a, b)
+end
+function Vector4.normalize(q)
+	local l = Vector4.length(q)
+	if l == 0 then l = 1 end
+	return Vector4.scale(q, 1/l)
+end
+function Vector4.qInvert(q)
+	local l = q.x*q.x + q.y*q.y + q.z*q.z + q.w*q.w
+	if l ~= 0 then
+		local i = 1/l
+		q.x, q.y, q.z, q.w = -q.x*i, -q.y*i, -q.z*i, q.w*i
+	end
+	return q
+end
+function Vector4.qMultiply(a, b)
+	local ax, ay, az, aw = a.x, a.y, a.z, a.w
+	local bx, by, bz, bw = b.x, b.y, b.z, b.w
+	a.x = ax*bw + aw*bx + ay*bz - az*by
+	a.y = ay*bw + aw*by + az*bx - ax*bz
+	a.z = az*bw + aw*bz + ax*by - ay*bx
+	a.w = aw*bw - ax*bx - ay*by - az*bz
+	return a
+end
+function Vector4.qLerp(a, b, t)
+	a.x, a.y, a.z, a.w = a.x + (b.x - a.x)*t, a.y + (b.y - a.y)*t, a.z + (b.z - a.z)*t, a.w + (b.w - a.w)*t
+	return a
+end
+function Vector4.qNlerp(a, b, t) return Vector4.normalize(Vector4.qLerp(a, b, t)) end
+function Vector4.qSlerp(a, b, t)
+	local cosHalfTheta = a.x*b.x + a.y*b.y + a.z*b.z + a.w*b.w
+	if math.abs(cosHalfTheta) >= 1 then return a end
+	if cosHalfTheta > 0.95 then return Vector4.qNlerp(a, b, t) end
+	local halfTheta    = acos(cosHalfTheta)
+	local sinHalfTheta = sqrt(1 - cosHalfTheta*cosHalfTheta)
+	if math.abs(sinHalfTheta) < 0.001 then
+		a.x, a.y, a.z, a.w = a.x*0.5 + b.x*0.5, a.y*0.5 + b.y*0.5, a.z*0.5 + b.z*0.5, a.w*0.5 + b.w*0.5
+		return a
+	end
+	local ra, rb = sin((1 - t)*halfTheta)/sinHalfTheta, sin(t*halfTheta)/sinHalfTheta
+	a.x, a.y, a.z, a.w = a.x*ra + b.x*rb, a.y*ra + b.y*rb, a.z*ra + b.z*rb, a.w*ra + b.w*rb
+	return a
+end
+function Vector4.qFromAxisAngle(q, axis, angle)
+	local l = sqrt(axis.x*axis.x + axis.y*axis.y + axis.z*axis.z)
+	if l == 0 then l = 1 end
+	local s = sin(angle*0.5)/l
+	q.x, q.y, q.z, q.w = axis.x*s, axis.y*s, axis.z*s, cos(angle*0.5)
+	return Vector4.normalize(q)
+end
+
+function Vector4.addTo(o, a, b) return Vector4.add(Vector4.copy(o, a), b) end
+function Vector4.subtractTo(o, a, b) return Vector4.subtract(Vector4.copy(o, a), b) end
+function Vector4.scaleTo(o, a, n) return Vector4.scale(Vector4.copy(o, a), n) end
+function Vector4.normalizeTo(o, a) return Vector4.normalize(Vector4.copy(o, a)) end
+function Vector4.qInvertTo(o, a) return Vector4.qInvert(Vector4.copy(o, a)) end
+function Vector4.qMultiplyTo(o, a, b)
+	local ax, ay, az, aw = a.x, a.y, a.z, a.w
+	local bx, by, bz, bw = b.x, b.y, b.z, b.w
+	o.x = ax*bw + aw*bx + ay*bz - az*by
+	o.y = ay*bw + aw*by + az*bx - ax*bz
+	o.z = az*bw + aw*bz + ax*by - ay*bx
+	o.w = aw*bw - ax*bx - ay*by - az*bz
+	return o
+end
+function Vector4.qLerpTo(o, a, b, t) return Vector4.qLerp(Vector4.copy(o, a), b, t) end
+function Vector4.qNlerpTo(o, a, b, t) return Vector4.qNlerp(Vector4.copy(o, a), b, t) end
+function Vector4.qSlerpTo(o, a, b, t)
+	local bx, by, bz, bw = b.x, b.y, b.z, b.w -- b may be aliased with o
+	return Vector4.qSlerp(Vector4.copy(o, a), Vector4_t(bx, by, bz, bw), t)
+end
+
+function Vector4.__add(a, b) return Vector4.add(Vector4_t(a), b) end
+function Vector4.__sub(a, b) return Vector4.subtract(Vector4_t(a), b) end
+function Vector4.__mul(a, b) return Vector4.multiply(Vector4_t(a), b) end
+function Vector4.__unm(a) return Vector4_t(-a.x, -a.y, -a.z, -a.w) end
+function Vector4.__len(a) return Vector4.length(a) end
+function Vector4.__eq(a, b)
+	return ffi.istype(Vector4_t, b) and a.x == b.x and a.y == b.y and a.z == b.z and a.w == b.w
+end
+function Vector4.__tostring(a) return ("Vector4(%g, %g, %g, %g)"):format(a.x, a.y, a.z, a.w) end
+
+-- Matrix
+
+local Matrix = class("Matrix")
+
+local function matrix_multiply(o, a, b)
+	local a1, a2, a3, a4     = a.m1,  a.m2,  a.m3,  a.m4
+	local a5, a6, a7, a8     = a.m5,  a.m6,  a.m7,  a.m8
+	local a9, a10, a11, a12  = a.m9,  a.m10, a.m11, a.m12
+	local a13, a14, a15, a16 = a.m13, a.m14, a.m15, a.m16
+	local b1, b2, b3, b4     = b.m1,  b.m2,  b.m3,  b.m4
+	local b5, b6, b7, b8     = b.m5,  b.m6,  b.m7,  b.m8
+	local b9, b10, b11, b12  = b.m9,  b.m10, b.m11, b.m12
+	local b13, b14, b15, b16 = b.m13, b.m14, b.m15, b.m16
+	-- same as raymath MatrixMultiply(left, right), mN here is m(N-1) there
+	o.m1  = a1*b1  + a2*b5  + a3*b9   + a4*b13
+	o.m2  = a1*b2  + a2*b6  + a3*b10  + a4*b14
+	o.m3  = a1*b3  + a2*b7  + a3*b11  + a4*b15
+	o.m4  = a1*b4  + a2*b8  + a3*b12  + a4*b16
+	o.m5  = a5*b1  + a6*b5  + a7*b9   + a8*b13
+	o.m6  = a5*b2  + a6*b6  + a7*b10  + a8*b14
+	o.m7  = a5*b3  + a6*b7  + a7*b11  + a8*b15
+	o.m8  = a5*b4  + a6*b8  + a7*b12  + a8*b16
+	o.m9  = a9*b1  + a10*b5 + a11*b9  + a12*b13
+	o.m10 = a9*b2  + a10*b6 + a11*b10 + a12*b14
+	o.m11 = a9*b3  + a10*b7 + a11*b11 + a12*b15
+	o.m12 = a9*b4  + a10*b8 + a11*b12 + a12*b16
+	o.m13 = a13*b1 + a14*b5 + a15*b9  + a16*b13
+	o.m14 = a13*b2 + a14*b6 + a15*b10 + a16*b14
+	o.m15 = a13*b3 + a14*b7 + a15*b11 + a16*b15
+	o.m16 = a13*b4 + a14*b8 + a15*b12 + a16*b16
+	return o
+end
+
+function Matrix.clone(m) return Matrix_t(m) end
+function Matrix.copy(m, s) ffi.copy(m, s, ffi.sizeof(Matrix_t)); return m end
+function Matrix.get(m)
+	return m.m1, m.m2, m.m3, m.m4, m.m5, m.m6, m.m7, m.m8, m.m9, m.m10, m.m11, m.m12, m.m13, m.m14, m.m15, m.m16
+end
+function Matrix.set(m, ...)
+	local t = type(...) == "table" and ... or {...}
+	for i = 1, 16 do m["m" .. i] = optnumber(t[i], 0) end
+	return m
+end
+function Matrix.identity(m)
+	ffi.fill(m, ffi.sizeof(Matrix_t))
+	m.m1, m.m6, m.m11, m.m16 = 1, 1, 1, 1
+	return m
+end
+function Matrix.trace(m) return m.m1 + m.m6 + m.m11 + m.m16 end
+function Matrix.transpose(m)
+	m.m2, m.m5   = m.m5,  m.m2
+	m.m3, m.m9   = m.m9,  m.m3
+	m.m4, m.m13  = m.m13, m.m4
+	m.m7, m.m10  = m.m10, m.m7
+	m.m8, m.m14  = m.m14, m.m8
+	m.m12, m.m15 = m.m15, m.m12
+	return m
+end
+function Matrix.add(a, b)
+	for i = 1, 16 do local k = "m" .. i; a[k] = a[k] + b[k] end
+	return a
+end
+function Matrix.subtract(a, b)
+	for i = 1, 16 do local k = "m" .. i; a[k] = a[k] - b[k] end
+	return a
+end
+function Matrix.multiply(a, b) return matrix_multiply(a, a, b) end
+-- Vector3, table {x, y, z} or three numbers, like arguments of userdata Matrix:translate and Matrix:scale
+local function matrix_xyz(x, y, z)
+	if type(x) == "table" then return optnumber(x[1], 0), optnumber(x[2], 0), optnumber(x[3], 0) end
+	if type(x) == "number" and type(y) == "number" and type(z) == "number" then return x, y, z end
+	return x.x, x.y, x.z
+end
+function Matrix.translate(m, ...)
+	local x, y, z = matrix_xyz(...)
+	Matrix.identity(m)
+	m.m4, m.m8, m.m12 = x, y, z -- same cells as userdata Matrix:translate
+	return m
+end
+function Matrix.scale(m, ...)
+	local x, y, z = matrix_xyz(...)
+	Matrix.identity(m)
+	m.m1, m.m6, m.m11 = x, y, z
+	return m
+end
+
+function Matrix.addTo(o, a, b) return Matrix.add(Matrix.copy(o, a), b) end
+function Matrix.subtractTo(o, a, b) return Matrix.subtract(Matrix.copy(o, a), b) end
+function Matrix.multiplyTo(o, a, b) return matrix_multiply(o, a, b) end
+function Matrix.transposeTo(o, a) return Matrix.transpose(Matrix.copy(o, a)) end
+
+function Matrix.__add(a, b) return Matrix.add(Matrix_t(a), b) end
+function Matrix.__sub(a, b) return Matrix.subtract(Matrix_t(a), b) end
+function Matrix.__mul(a, b) return matrix_multiply(Matrix_t(), a, b) end
+function Matrix.__tostring(m)
+	return ("Matrix(%g, %g, %g, %g, %g, %g, %g, %g, %g, %g, %g, %g, %g, %g, %g, %g)"):format(Matrix.get(m))
+end
+
+-- Color
+
+local Color = class("Color")
+
+function Color.clone(c) return Color_t(c.r, c.g, c.b, c.a) end
+function Color.get(c) return c.r, c.g, c.b, c.a end
+function Color.set(c, r, g, b, a)
+	c.r, c.g, c.b, c.a = optinteger(r, c.r), optinteger(g, c.g), optinteger(b, c.b), optinteger(a, c.a)
+	return c
+end
+function Color.copy(c, s) c.r, c.g, c.b, c.a = s.r, s.g, s.b, s.a; return c end
+function Color.toInt(c) return bit.bor(bit.lshift(c.r, 24), bit.lshift(c.g, 16), bit.lshift(c.b, 8), c.a) end
+function Color.fade(c, alpha) c.a = max(0, min(1, alpha))*255; return c end
+function Color.__eq(a, b) return ffi.istype(Color_t, b) and a.r == b.r and a.g == b.g and a.b == b.b and a.a == b.a end
+function Color.__tostring(c) return ("Color(%d, %d, %d, %d)"):format(c.r, c.g, c.b, c.a) end
+
+-- Rectangle
+
+local Rectangle = class("Rectangle")
+
+function Rectangle.clone(r) return Rectangle_t(r.x, r.y, r.width, r.height) end
+function Rectangle.get(r) return r.x, r.y, r.width, r.height end
+function Rectangle.set(r, x, y, w, h)
+	r.x, r.y, r.width, r.height = optinteger(x, r.x), optinteger(y, r.y), optinteger(w, r.width), optinteger(h, r.height)
+	return r
+end
+function Rectangle.copy(r, s) r.x, r.y, r.width, r.height = s.x, s.y, s.width, s.height; return r end
+function Rectangle.move(r, x, y)
+	if type(x) ~= "number" then x, y = x.x, x.y
+	else x, y = optinteger(x, 0), optinteger(y, 0) end
+	r.x, r.y = r.x + x, r.y + y
+	return r
+end
+function Rectangle.getPosition(r) return r.x, r.y end
+function Rectangle.setPosition(r, x, y)
+	if type(x) == "table" then x, y = optnumber(x[1], r.x), optnumber(x[2], r.y)
+	elseif type(x) ~= "number" then x, y = x.x, x.y
+	else x, y = optinteger(x, r.x), optinteger(y, r.y) end
+	r.x, r.y = x, y
+	return r
+end
+function Rectangle.getDimensions(r) return r.width, r.height end
+function Rectangle.setDimensions(r, w, h) r.width, r.height = w, h; return r end
+function Rectangle.collideRect(a, b)
+	return a.x < b.x + b.width and a.x + a.width > b.x and a.y < b.y + b.height and a.y + a.height > b.y
+end
+function Rectangle.collidePoint(r, x, y)
+	if type(x) ~= "number" then x, y = x.x, x.y end
+	return x >= r.x and x <= r.x + r.width and y >= r.y and y <= r.y + r.height
+end
+function Rectangle.__eq(a, b)
+	return ffi.istype(Rectangle_t, b) and a.x == b.x and a.y == b.y and a.width == b.width and a.height == b.height
+end
+function Rectangle.__tostring(r) return ("Rectangle(%g, %g, %g, %g)"):format(r.x, r.y, r.width, r.height) end
+
+M.Vector2   = ffi.metatype(Vector2_t,   Vector2)
+M.Vector3   = ffi.metatype(Vector3_t,   Vector3)
+M.Vector4   = ffi.metatype(Vector4_t,   Vector4)
+M.Matrix    = ffi.metatype(Matrix_t,    Matrix)
+M.Color     = ffi.metatype(Color_t,     Color)
+M.Rectangle = ffi.metatype(Rectangle_t, Rectangle)
+M.Quaternion = M.Vector4
+
+return M
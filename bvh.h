@@ -0,0 +1,270 @@
+// Bounding volume hierarchy of mesh triangles for ray picking. Built once by binned SAH (surface area heuristic),
+// stored as flat array of nodes in depth-first order: left child follows its parent, right one is referenced by index.
+// Triangles are copied in leaf order as vertex and two edges, so leaves are tested without index lookups.
+// This part has no raylib or Lua calls, queries may be run by several threads at once.
+
+#define RAY_BVH_MAXLEAF  8     // bigger nodes are split even if SAH cost is not lower (if centroids differ)
+#define RAY_BVH_BINS     12
+#define RAY_BVH_DEPTH    60    // max depth of tree, traversal stack is not bigger
+#define RAY_BVH_EPSILON  1e-7f
+
+typedef struct {
+  float min[3], max[3];
+  int   start;                 // first triangle for leaves, right child for inner nodes
+  int   count;                 // triangles in leaf, 0 for inner nodes
+} ray_bvh_node;
+
+typedef struct {
+  float v0[3], e1[3], e2[3];
+} ray_bvh_triangle;
+
+typedef struct {
+  ray_bvh_node     * nodes;
+  int                nodeCount;
+  ray_bvh_triangle * triangles; // in leaf order
+  int              * ids;       // source index of triangles
+  int                count;
+} ray_bvh;
+
+typedef struct {
+  float t, u, v;               // distance in direction lengths, barycentric coordinates
+  int   triangle;              // source index, -1 if nothing is hit
+} ray_bvh_hit;
+
+typedef struct {
+  ray_bvh * bvh;
+  float   * bounds;            // min, max and centroid of triangles
+} ray_bvh_builder;
+
+float ray_bvh_area(const float * min, const float * max){
+  float x = max[0] - min[0], y = max[1] - min[1], z = max[2] - min[2];
+  return x*y + y*z + z*x;
+}
+
+void ray_bvh_grow(float * min, float * max, const float * pmin, const float * pmax){
+  for (int k = 0; k < 3; k++) {
+    if (pmin[k] < min[k]) min[k] = pmin[k];
+    if (pmax[k] > max[k]) max[k] = pmax[k];
+  }
+}
+
+void ray_bvh_reset(float * min, float * max){
+  for (int k = 0; k < 3; k++) {
+    min[k] =  3.4e38f;
+    max[k] = -3.4e38f;
+  }
+}
+
+int ray_bvh_buildNode(ray_bvh_builder * b, int first, int count, int depth){
+  ray_bvh * bvh = b->bvh;
+  int index = bvh->nodeCount++;
+  ray_bvh_node * node = &bvh->nodes[index];
+  float cmin[3], cmax[3];
+  ray_bvh_reset(node->min, node->max);
+  ray_bvh_reset(cmin, cmax);
+  for (int i = first; i < first + count; i++) {
+    const float * t = b->bounds + bvh->ids[i]*9;
+    ray_bvh_grow(node->min, node->max, t, t + 3);
+    ray_bvh_grow(cmin, cmax, t + 6, t + 6);
+  }
+  node->start = first;
+  node->count = count;
+  if (count <= 1 || depth >= RAY_BVH_DEPTH) return index;
+
+  // the cheapest split of centroids range by bins, cost of triangle test and of node test are equal
+  int   bestAxis = -1, bestSplit = 0;
+  float bestCost = count <= RAY_BVH_MAXLEAF ? (float)count : 3.4e38f;
+  float parentArea = ray_bvh_area(node->min, node->max);
+  for (int axis = 0; axis < 3; axis++) {
+    float extent = cmax[axis] - cmin[axis];
+    if (extent <= 0) continue;
+    int   binCount[RAY_BVH_BINS] = {0};
+    float binMin[RAY_BVH_BINS][3], binMax[RAY_BVH_BINS][3];
+    for (int k = 0; k < RAY_BVH_BINS; k++) ray_bvh_reset(binMin[k], binMax[k]);
+    float scale = RAY_BVH_BINS/extent;
+    for (int i = first; i < first + count; i++) {
+      const float * t = b->bounds + bvh->ids[i]*9;
+      int bin = (int)((t[6 + axis] - cmin[axis])*scale);
+      if (bin >= RAY_BVH_BINS) bin = RAY_BVH_BINS - 1;
+      binCount[bin]++;
+      ray_bvh_grow(binMin[bin], binMax[bin], t, t + 3);
+    }
+    // areas and counts of left parts, then right parts are swept
+    float leftArea[RAY_BVH_BINS], min[3], max[3];
+    int   leftCount[RAY_BVH_BINS], n = 0;
+    ray_bvh_reset(min, max);
+    for (int k = 0; k < RAY_BVH_BINS - 1; k++) {
+      n += binCount[k];
+      if (binCount[k]) ray_bvh_grow(min, max, binMin[k], binMax[k]);
+      leftCount[k] = n;
+      leftArea[k]  = n ? ray_bvh_area(min, max) : 0;
+    }
+    ray_bvh_reset(min, max);
+    n = 0;
+    for (int k = RAY_BVH_BINS - 1; k > 0; k--) {
+      n += binCount[k];
+      if (binCount[k]) ray_bvh_grow(min, max, binMin[k], binMax[k]);
+      if (!n || !leftCount[k - 1]) continue;
+      float cost = 1 + (leftArea[k - 1]*leftCount[k - 1] + ray_bvh_area(min, max)*n)/parentArea;
+      if (cost < bestCost) {
+        bestCost  = cost;
+        bestAxis  = axis;
+        bestSplit = k;
+      }
+    }
+  }
+  if (bestAxis < 0) return index;
+
+  float scale = RAY_BVH_BINS/(cmax[bestAxis] - cmin[bestAxis]);
+  int i = first, j = first + count - 1;
+  while (i <= j) {
+    const float * t = b->bounds + bvh->ids[i]*9;
+    int bin = (int)((t[6 + bestAxis] - cmin[bestAxis])*scale);
+    if (bin >= RAY_BVH_BINS) bin = RAY_BVH_BINS - 1;
+    if (bin < bestSplit) i++;
+    else {
+      int id = bvh->ids[i];
+      bvh->ids[i] = bvh->ids[j];
+      bvh->ids[j--] = id;
+    }
+  }
+  node->count = 0;
+  ray_bvh_buildNode(b, first, i - first, depth + 1);
+  int right = ray_bvh_buildNode(b, i, first + count - i, depth + 1);
+  bvh->nodes[index].start = right;
+  return index;
+}
+
+// Builds tree of triangles (indices may be NULL for not indexed ones), returns 0 on allocation failure
+int ray_bvh_build(ray_bvh * bvh, const float * vertices, const unsigned short * indices, int triangleCount){
+  memset(bvh, 0, sizeof(ray_bvh));
+  ray_bvh_builder b = {bvh, NULL};
+  int n = triangleCount > 0 ? triangleCount : 1;
+  bvh->nodes     = (ray_bvh_node *)malloc(2*n*sizeof(ray_bvh_node));
+  bvh->triangles = (ray_bvh_triangle *)malloc(n*sizeof(ray_bvh_triangle));
+  bvh->ids       = (int *)malloc(n*sizeof(int));
+  b.bounds       = (float *)malloc(n*9*sizeof(float));
+  if (!bvh->nodes || !bvh->triangles || !bvh->ids || !b.bounds) {
+    free(bvh->nodes);
+    free(bvh->triangles);
+    free(bvh->ids);
+    free(b.bounds);
+    memset(bvh, 0, sizeof(ray_bvh));
+    return 0;
+  }
+  for (int i = 0; i < triangleCount; i++) {
+    float * t = b.bounds + i*9;
+    ray_bvh_reset(t, t + 3);
+    for (int k = 0; k < 3; k++) {
+      const float * v = vertices + 3*(indices ? indices[i*3 + k] : i*3 + k);
+      ray_bvh_grow(t, t + 3, v, v);
+    }
+    for (int k = 0; k < 3; k++) t[6 + k] = (t[k] + t[3 + k])*0.5f;
+    bvh->ids[i] = i;
+  }
+  bvh->count = triangleCount;
+  if (triangleCount > 0) ray_bvh_buildNode(&b, 0, triangleCount, 0);
+  free(b.bounds);
+  for (int i = 0; i < triangleCount; i++) {
+    int id = bvh->ids[i];
+    const float * a = vertices + 3*(indices ? indices[id*3]     : id*3);
+    const float * p = vertices + 3*(indices ? indices[id*3 + 1] : id*3 + 1);
+    const float * q = vertices + 3*(indices ? indices[id*3 + 2] : id*3 + 2);
+    ray_bvh_triangle * t = &bvh->triangles[i];
+    for (int k = 0; k < 3; k++) {
+      t->v0[k] = a[k];
+      t->e1[k] = p[k] - a[k];
+      t->e2[k] = q[k] - a[k];
+    }
+  }
+  return 1;
+}
+
+void ray_bvh_free(ray_bvh * bvh){
+  free(bvh->nodes);
+  free(bvh->triangles);
+  free(bvh->ids);
+  memset(bvh, 0, sizeof(ray_bvh));
+}
+
+// Distance to box along ray, or value bigger than limit if box is missed
+float ray_bvh_box(const ray_bvh_node * node, const float * origin, const float * inv, float limit){
+  float tmin = 0, tmax = limit;
+  for (int k = 0; k < 3; k++) {
+    float t1 = (node->min[k] - origin[k])*inv[k];
+    float t2 = (node->max[k] - origin[k])*inv[k];
+    if (t1 > t2) {
+      float t = t1;
+      t1 = t2;
+      t2 = t;
+    }
+    if (t1 > tmin) tmin = t1;
+    if (t2 < tmax) tmax = t2;
+  }
+  return tmin <= tmax ? tmin : 3.4e38f;
+}
+
+// Moller-Trumbore test, both sides of triangles are hit
+void ray_bvh_triangleTest(const ray_bvh_triangle * tri, const float * origin, const float * dir, ray_bvh_hit * hit, int id){
+  const float * e1 = tri->e1, * e2 = tri->e2;
+  float p[3] = { dir[1]*e2[2] - dir[2]*e2[1], dir[2]*e2[0] - dir[0]*e2[2], dir[0]*e2[1] - dir[1]*e2[0] };
+  float det = e1[0]*p[0] + e1[1]*p[1] + e1[2]*p[2];
+  if (det > -RAY_BVH_EPSILON && det < RAY_BVH_EPSILON) return;
+  float inv = 1/det;
+  float s[3] = { origin[0] - tri->v0[0], origin[1] - tri->v0[1], origin[2] - tri->v0[2] };
+  float u = (s[0]*p[0] + s[1]*p[1] + s[2]*p[2])*inv;
+  if (u < 0 || u > 1) return;
+  float q[3] = { s[1]*e1[2] - s[2]*e1[1], s[2]*e1[0] - s[0]*e1[2], s[0]*e1[1] - s[1]*e1[0] };
+  float v = (dir[0]*q[0] + dir[1]*q[1] + dir[2]*q[2])*inv;
+  if (v < 0 || u + v > 1) return;
+  float t = (e2[0]*q[0] + e2[1]*q[1] + e2[2]*q[2])*inv;
+  if (t <= RAY_BVH_EPSILON || t >= hit->t) return;
+  hit->t = t;
+  hit->u = u;
+  hit->v = v;
+  hit->triangle = id;
+}
+
+// Finds the nearest hit closer than hit->t (set it to limit), returns 1 if hit->t is decreased.
+// Hit may be shared by several meshes, triangle indices are per mesh, so they can't tell if this one is hit.
+// Direction is not normalized, so ray may be transformed to mesh space keeping distances.
+int ray_bvh_raycast(const ray_bvh * bvh, const float * origin, const float * dir, ray_bvh_hit * hit){
+  float limit = hit->t;
+  if (!bvh->count) return 0;
+  float inv[3];
+  for (int k = 0; k < 3; k++) inv[k] = dir[k] != 0 ? 1/dir[k] : 3.4e38f;
+  int stack[RAY_BVH_DEPTH + 2], top = 0;
+  int index = 0;
+  if (ray_bvh_box(&bvh->nodes[0], origin, inv, hit->t) >= hit->t) return 0;
+  while (1) {
+    const ray_bvh_node * node = &bvh->nodes[index];
+    if (node->count) {
+      for (int i = node->start; i < node->start + node->count; i++)
+        ray_bvh_triangleTest(&bvh->triangles[i], origin, dir, hit, bvh->ids[i]);
+    }
+    else {
+      // nearer child is visited first, farther one is pushed
+      int left = index + 1, right = node->start;
+      float tl = ray_bvh_box(&bvh->nodes[left],  origin, inv, hit->t);
+      float tr = ray_bvh_box(&bvh->nodes[right], origin, inv, hit->t);
+      if (tl > tr) {
+        float t = tl;
+        tl = tr;
+        tr = t;
+        int i = left;
+        left  = right;
+        right = i;
+      }
+      if (tl < hit->t) {
+        if (tr < hit->t) stack[top++] = right;
+        index = left;
+        continue;
+      }
+    }
+    // popped nodes may be farther than hit found after they were pushed
+    do {
+      if (!top) return hit->t < limit;
+      index = stack[--top];
+    } while (ray_bvh_box(&bvh->nodes[index], origin, inv, hit->t) >= hit->t);
+  }
+}
@@ -1,15 +1,3 @@
-// used for __index and __newindex metamethods
-#define lua_class_GetFieldIfCompared(L, obj, key, cmpkey, structfield)\
-        if(!strcmp(key, cmpkey)){              \
-          lua_pushnumber(L, obj->structfield); \
-          return 1;                            \
-        }
-#define lua_class_SetFieldIfCompared(L, obj, key, value, cmpkey, structfield) \
-        if(!strcmp(key, cmpkey)){   \
-          obj->structfield = value; \
-          return 0;                 \
-        }
-
 /*!MD
 # Classes
 ## Vector2
@@ -41,6 +29,16 @@ Structure:
 | [divideV](#Vector2divideV)       | Divide vector to another vector (modifying it)
 | [normalize](#Vector2normalize)   | Normalize vector (divide each component lo vector length)
 | [lerp](#Vector2lerp)             | Interpolate vector to another by given interpolant
+| **Allocation-free methods**      | Write result of operation into the calling vector, no new objects created
+| [copy](#Vector2copy)             | Copy components of another vector
+| [addTo](#Vector2addTo)           | Store sum of two vectors
+| [subtractTo](#Vector2subtractTo) | Store subtraction of two vectors
+| [scaleTo](#Vector2scaleTo)       | Store vector multiplied by scalar
+| [multiplyTo](#Vector2multiplyTo) | Store multiplication of vector by vector or scalar
+| [divideTo](#Vector2divideTo)     | Store division of vector by vector or scalar
+| [negateTo](#Vector2negateTo)     | Store negated vector
+| [normalizeTo](#Vector2normalizeTo) | Store normalized vector
+| [lerpTo](#Vector2lerpTo)         | Store interpolation between two vectors
 | **Overloads**                    | Note: In the mul/div methods with numbers, the vector should be in FIRST place, `NewVec2 = Vec2 * 5` is ok `NewVec2 = 5 * Vec2` raises error
 | +: `NewVec2 = Vec2A + Vec2B`     | Create a new vector that is the sum of two vectors
 | -: `NewVec2 = Vec2A - Vec2B`     | Create a new vector that is the subtraction of two vectors
@@ -94,7 +92,7 @@ Vector2 Vec2 = Vector2:clone()
 Clones Vector2 object.
 */
 int lua_class_vector2_Clone(lua_State *L){
-  Vector2 * v1 = (Vector2 *)luaL_checkudata(L, 1, "Vector2");
+  Vector2 * v1 = (Vector2 *)luax_checkclass(L, 1, "Vector2");
   Vector2 * v2 = (Vector2 *)luax_newobject(L, "Vector2", sizeof(Vector2));
   v2->x = v1->x; v2->y = v1->y;
   return 1;
@@ -110,7 +108,7 @@ table t = Vector2:get('t') --> {x, y}
 Get Vector2 components.
 */
 int lua_class_vector2_Get(lua_State *L){
-  Vector2 * v = (Vector2 *)luaL_checkudata(L, 1, "Vector2");
+  Vector2 * v = (Vector2 *)luax_checkclass(L, 1, "Vector2");
   if (luax_optstring(L, 2, "\0")[0] == 't'){
     lua_newtable(L);
     luax_tnnumber(L, 1, (float)v->x);
@@ -132,7 +130,7 @@ Vector2:set(table t) -- [x, y]
 Set Vector2 components.
 */
 int lua_class_vector2_Set(lua_State *L){
-  Vector2 * v = (Vector2 *)luaL_checkudata(L, 1, "Vector2");
+  Vector2 * v = (Vector2 *)luax_checkclass(L, 1, "Vector2");
   v->x = luax_optnumber(L, 2, v->x);
   v->y = luax_optnumber(L, 3, v->y);
   lua_settop(L, 1);
@@ -147,8 +145,8 @@ Vector2:add(Vector2 Vector)
 Add vector to vector (modifying it)
 */
 int lua_class_vector2_Add(lua_State *L){
-  Vector2 * v1 = (Vector2 *)luaL_checkudata(L, 1, "Vector2");
-  Vector2 * v2 = (Vector2 *)luaL_checkudata(L, 2, "Vector2");
+  Vector2 * v1 = (Vector2 *)luax_checkclass(L, 1, "Vector2");
+  Vector2 * v2 = (Vector2 *)luax_checkclass(L, 2, "Vector2");
   v1->x += v2->x; v1->y += v2->y;
   lua_settop(L, 1);
   return 1;
@@ -162,8 +160,8 @@ Vector2:subtract(Vector2 Vector)
 Subtract vector from vector (modifying it)
 */
 int lua_class_vector2_Subtract(lua_State *L){
-  Vector2 * v1 = (Vector2 *)luaL_checkudata(L, 1, "Vector2");
-  Vector2 * v2 = (Vector2 *)luaL_checkudata(L, 2, "Vector2");
+  Vector2 * v1 = (Vector2 *)luax_checkclass(L, 1, "Vector2");
+  Vector2 * v2 = (Vector2 *)luax_checkclass(L, 2, "Vector2");
   v1->x -= v2->x; v1->y -= v2->y;
   lua_settop(L, 1);
   return 1;
@@ -177,7 +175,7 @@ number Length = Vector2:length()
 Returns vector scalar length
 */
 int lua_class_vector2_Length(lua_State *L){
-  Vector2 * v = (Vector2 *)luaL_checkudata(L, 1, "Vector2");
+  Vector2 * v = (Vector2 *)luax_checkclass(L, 1, "Vector2");
   float result = sqrtf((v->x * v->x) + (v->y * v->y));
   lua_pushnumber(L, result);
   return 1;
@@ -191,8 +189,8 @@ number Dot = Vector2:dotProduct(Vector2 Vector)
 Returns vector scalar dot product
 */
 int lua_class_vector2_DotProduct(lua_State *L){
-  Vector2 * v1 = (Vector2 *)luaL_checkudata(L, 1, "Vector2");
-  Vector2 * v2 = (Vector2 *)luaL_checkudata(L, 2, "Vector2");
+  Vector2 * v1 = (Vector2 *)luax_checkclass(L, 1, "Vector2");
+  Vector2 * v2 = (Vector2 *)luax_checkclass(L, 2, "Vector2");
   float result = (v1->x * v2->x + v1->y * v2->y);
   lua_pushnumber(L, result);
   return 1;
@@ -206,8 +204,8 @@ number Distance = Vector2:distance(Vector2 Vector)
 Returns scalar distance between two vectors
 */
 int lua_class_vector2_Distance(lua_State *L){
-  Vector2 * v1 = (Vector2 *)luaL_checkudata(L, 1, "Vector2");
-  Vector2 * v2 = (Vector2 *)luaL_checkudata(L, 2, "Vector2");
+  Vector2 * v1 = (Vector2 *)luax_checkclass(L, 1, "Vector2");
+  Vector2 * v2 = (Vector2 *)luax_checkclass(L, 2, "Vector2");
   float result = sqrtf((v1->x - v2->x)*(v1->x - v2->x) + (v1->y - v2->y)*(v1->y - v2->y));
   lua_pushnumber(L, result);
   return 1;
@@ -221,8 +219,8 @@ number Angle = Vector2:angle(Vector2 Vector)
 Returns scalar angle between two vectors (degrees)
 */
 int lua_class_vector2_Angle(lua_State *L){
-  Vector2 * v1 = (Vector2 *)luaL_checkudata(L, 1, "Vector2");
-  Vector2 * v2 = (Vector2 *)luaL_checkudata(L, 2, "Vector2");
+  Vector2 * v1 = (Vector2 *)luax_checkclass(L, 1, "Vector2");
+  Vector2 * v2 = (Vector2 *)luax_checkclass(L, 2, "Vector2");
   float result = atan2f(v2->y - v1->y, v2->x - v1->x)*(180.0f/PI);
   if (result < 0) result += 360.0f;
   lua_pushnumber(L, result);
@@ -237,8 +235,8 @@ number Angle = Vector2:angleRad(Vector2 Vector)
 Returns scalar angle between two vectors (radians)
 */
 int lua_class_vector2_AngleRad(lua_State *L){
-  Vector2 * v1 = (Vector2 *)luaL_checkudata(L, 1, "Vector2");
-  Vector2 * v2 = (Vector2 *)luaL_checkudata(L, 2, "Vector2");
+  Vector2 * v1 = (Vector2 *)luax_checkclass(L, 1, "Vector2");
+  Vector2 * v2 = (Vector2 *)luax_checkclass(L, 2, "Vector2");
   float result = atan2f(v2->y - v1->y, v2->x - v1->x);
   if (result < 0) result += 2*PI;
   lua_pushnumber(L, result);
@@ -253,7 +251,7 @@ Vector2:scale(number Scale)
 Multiply each component of vector to scalar
 */
 int lua_class_vector2_Scale(lua_State *L){
-  Vector2 * v1 = (Vector2 *)luaL_checkudata(L, 1, "Vector2");
+  Vector2 * v1 = (Vector2 *)luax_checkclass(L, 1, "Vector2");
   float n = luaL_checknumber(L, 2);
   v1->x *= n; v1->y *= n;
   lua_settop(L, 1);
@@ -268,8 +266,8 @@ Vector2:multiplyV(Vector2 Vector)
 Multiply vector to another vector (modifying it)
 */
 int lua_class_vector2_MultiplyV(lua_State *L){
-  Vector2 * v1 = (Vector2 *)luaL_checkudata(L, 1, "Vector2");
-  Vector2 * v2 = (Vector2 *)luaL_checkudata(L, 2, "Vector2");
+  Vector2 * v1 = (Vector2 *)luax_checkclass(L, 1, "Vector2");
+  Vector2 * v2 = (Vector2 *)luax_checkclass(L, 2, "Vector2");
   v1->x *= v2->x; v1->y *= v2->y;
   lua_settop(L, 1);
   return 1;
@@ -285,7 +283,7 @@ Vector2:multiply(number Scale)
 Multiply vector to scalar or another vector (modifying it)
 */
 int lua_class_vector2_Multiply(lua_State *L){
-  Vector2 * v1 = (Vector2 *)luaL_checkudata(L, 1, "Vector2");
+  Vector2 * v1 = (Vector2 *)luax_checkclass(L, 1, "Vector2");
   if (lua_isnumber(L, 2)){
     float n = luaL_checknumber(L, 2);
     v1->x *= n; v1->y *= n;
@@ -293,7 +291,7 @@ int lua_class_vector2_Multiply(lua_State *L){
     return 1;
   }
 
-  Vector2 * v2 = (Vector2 *)luaL_checkudata(L, 2, "Vector2");
+  Vector2 * v2 = (Vector2 *)luax_checkclass(L, 2, "Vector2");
   v1->x *= v2->x; v1->y *= v2->y;
   lua_settop(L, 1);
   return 1;
@@ -307,7 +305,7 @@ Vector2:negate()
 Negate each component of vector (-Vec2.x, -Vec2.y)
 */
 int lua_class_vector2_Negate(lua_State *L){
-  Vector2 * v = (Vector2 *)luaL_checkudata(L, 1, "Vector2");
+  Vector2 * v = (Vector2 *)luax_checkclass(L, 1, "Vector2");
   v->x = -v->x; v->y = -v->y;
   return 1;
 }
@@ -322,7 +320,7 @@ Vector2:divide(number Scale)
 Divide vector to scalar or another vector (modifying it)
 */
 int lua_class_vector2_Divide(lua_State *L){
-  Vector2 * v1 = (Vector2 *)luaL_checkudata(L, 1, "Vector2");
+  Vector2 * v1 = (Vector2 *)luax_checkclass(L, 1, "Vector2");
   if (lua_isnumber(L, 2)){
     float n = luaL_checknumber(L, 2);
     v1->x /= n; v1->y /= n;
@@ -330,7 +328,7 @@ int lua_class_vector2_Divide(lua_State *L){
     return 1;
   }
 
-  Vector2 * v2 = (Vector2 *)luaL_checkudata(L, 2, "Vector2");
+  Vector2 * v2 = (Vector2 *)luax_checkclass(L, 2, "Vector2");
   v1->x /= v2->x; v1->y /= v2->y;
   lua_settop(L, 1);
   return 1;
@@ -344,8 +342,8 @@ Vector2:divideV(Vector2 Vector)
 Divide vector to another vector (modifying it)
 */
 int lua_class_vector2_DivideV(lua_State *L){
-  Vector2 * v1 = (Vector2 *)luaL_checkudata(L, 1, "Vector2");
-  Vector2 * v2 = (Vector2 *)luaL_checkudata(L, 2, "Vector2");
+  Vector2 * v1 = (Vector2 *)luax_checkclass(L, 1, "Vector2");
+  Vector2 * v2 = (Vector2 *)luax_checkclass(L, 2, "Vector2");
   v1->x /= v2->x;
   v1->y /= v2->y;
   lua_pop(L, 1);
@@ -360,7 +358,7 @@ Vector2:normalize()
 Normalize vector (divide each component lo vector length)
 */
 int lua_class_vector2_Normalize(lua_State *L){
-  Vector2 * v   = (Vector2 *)luaL_checkudata(L, 1, "Vector2");
+  Vector2 * v   = (Vector2 *)luax_checkclass(L, 1, "Vector2");
   float     len = sqrtf((v->x * v->x) + (v->y * v->y));
   v->x /= len; v->y /= len;
   lua_settop(L, 1);
@@ -375,8 +373,8 @@ Vector2:lerp(Vector2 Vector, number Amount)
 Interpolate vector to another by given interpolant
 */
 int lua_class_vector2_Lerp(lua_State *L){
-  Vector2 * v1 = (Vector2 *)luaL_checkudata(L, 1, "Vector2");
-  Vector2 * v2 = (Vector2 *)luaL_checkudata(L, 2, "Vector2");
+  Vector2 * v1 = (Vector2 *)luax_checkclass(L, 1, "Vector2");
+  Vector2 * v2 = (Vector2 *)luax_checkclass(L, 2, "Vector2");
   float amount = luaL_checknumber(L, 3);
 
   v1->x = v1->x + amount * (v2->x - v1->x);
@@ -385,66 +383,204 @@ int lua_class_vector2_Lerp(lua_State *L){
   return 1;
 }
 
-int lua_class_vector2__Index(lua_State *L){
-  if (!luax_type(L, 2, LUA_TSTRING)) return 0;
-  Vector2 *    v   = (Vector2 *)luaL_checkudata(L, 1, "Vector2");
-  const char * key = luaL_checkstring(L, 2);
+/*!MD
+### Allocation-free methods
+Overloads (`+`, `-`, `*` etc) always create new objects, which is garbage for every frame.
+These methods writes result into the calling vector (it can be one of the arguments too) and returns it for chaining.
+```lua
+local pos, vel, tmp = rl.Vector2(), rl.Vector2(1, 1), rl.Vector2()
+pos:addTo(pos, tmp:scaleTo(vel, dt)) -- pos = pos + vel * dt
+```
 
-  lua_class_GetFieldIfCompared(L, v, key, "x", x); // calls "return" from this function on success
-  lua_class_GetFieldIfCompared(L, v, key, "y", y);
-  
-  luax_getclasskey(L, 1, 2);
+#### Vector2:copy
+```lua
+Vector2 Out = Vector2:copy(Vector2 Src)
+```
+Copy components of another vector
+*/
+int lua_class_vector2_Copy(lua_State *L){
+  Vector2 * out = (Vector2 *)luax_checkclass(L, 1, "Vector2");
+  Vector2 * v   = (Vector2 *)luax_checkclass(L, 2, "Vector2");
+  *out = *v;
+  lua_settop(L, 1);
   return 1;
 }
 
-int lua_class_vector2__Newindex(lua_State *L){
-  if (!luax_type(L, 2, LUA_TSTRING)) return 0;
-  Vector2 *    v     = (Vector2 *)luaL_checkudata(L, 1, "Vector2");
-  const char * key   = luaL_checkstring(L, 2);
-  float        value = luaL_checknumber(L, 3);
-  lua_class_SetFieldIfCompared(L, v, key, value, "x", x);
-  lua_class_SetFieldIfCompared(L, v, key, value, "y", y);
-  return 0;
+/*!MD
+#### Vector2:addTo
+```lua
+Vector2 Out = Vector2:addTo(Vector2 A, Vector2 B)
+```
+Store sum of two vectors (Out = A + B)
+*/
+int lua_class_vector2_AddTo(lua_State *L){
+  Vector2 * out = (Vector2 *)luax_checkclass(L, 1, "Vector2");
+  Vector2 * v1  = (Vector2 *)luax_checkclass(L, 2, "Vector2");
+  Vector2 * v2  = (Vector2 *)luax_checkclass(L, 3, "Vector2");
+  *out = Vector2Add(*v1, *v2);
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Vector2:subtractTo
+```lua
+Vector2 Out = Vector2:subtractTo(Vector2 A, Vector2 B)
+```
+Store subtraction of two vectors (Out = A - B)
+*/
+int lua_class_vector2_SubtractTo(lua_State *L){
+  Vector2 * out = (Vector2 *)luax_checkclass(L, 1, "Vector2");
+  Vector2 * v1  = (Vector2 *)luax_checkclass(L, 2, "Vector2");
+  Vector2 * v2  = (Vector2 *)luax_checkclass(L, 3, "Vector2");
+  *out = Vector2Subtract(*v1, *v2);
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Vector2:scaleTo
+```lua
+Vector2 Out = Vector2:scaleTo(Vector2 A, number Scale)
+```
+Store vector multiplied by scalar (Out = A * Scale)
+*/
+int lua_class_vector2_ScaleTo(lua_State *L){
+  Vector2 * out = (Vector2 *)luax_checkclass(L, 1, "Vector2");
+  Vector2 * v   = (Vector2 *)luax_checkclass(L, 2, "Vector2");
+  float     n   = luaL_checknumber(L, 3);
+  *out = Vector2Scale(*v, n);
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Vector2:multiplyTo
+```lua
+-- variants
+Vector2 Out = Vector2:multiplyTo(Vector2 A, Vector2 B)
+Vector2 Out = Vector2:multiplyTo(Vector2 A, number Scale)
+```
+Store multiplication of vector by vector or scalar (Out = A * B)
+*/
+int lua_class_vector2_MultiplyTo(lua_State *L){
+  Vector2 * out = (Vector2 *)luax_checkclass(L, 1, "Vector2");
+  Vector2 * v1  = (Vector2 *)luax_checkclass(L, 2, "Vector2");
+  if (lua_isnumber(L, 3)) *out = Vector2Scale(*v1, luaL_checknumber(L, 3));
+  else                    *out = Vector2MultiplyV(*v1, *(Vector2 *)luax_checkclass(L, 3, "Vector2"));
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Vector2:divideTo
+```lua
+-- variants
+Vector2 Out = Vector2:divideTo(Vector2 A, Vector2 B)
+Vector2 Out = Vector2:divideTo(Vector2 A, number Scale)
+```
+Store division of vector by vector or scalar (Out = A / B)
+*/
+int lua_class_vector2_DivideTo(lua_State *L){
+  Vector2 * out = (Vector2 *)luax_checkclass(L, 1, "Vector2");
+  Vector2 * v1  = (Vector2 *)luax_checkclass(L, 2, "Vector2");
+  if (lua_isnumber(L, 3)) *out = Vector2Divide(*v1, luaL_checknumber(L, 3));
+  else                    *out = Vector2DivideV(*v1, *(Vector2 *)luax_checkclass(L, 3, "Vector2"));
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Vector2:negateTo
+```lua
+Vector2 Out = Vector2:negateTo(Vector2 A)
+```
+Store negated vector (Out = -A)
+*/
+int lua_class_vector2_NegateTo(lua_State *L){
+  Vector2 * out = (Vector2 *)luax_checkclass(L, 1, "Vector2");
+  Vector2 * v   = (Vector2 *)luax_checkclass(L, 2, "Vector2");
+  *out = Vector2Negate(*v);
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Vector2:normalizeTo
+```lua
+Vector2 Out = Vector2:normalizeTo(Vector2 A)
+```
+Store normalized vector
+*/
+int lua_class_vector2_NormalizeTo(lua_State *L){
+  Vector2 * out = (Vector2 *)luax_checkclass(L, 1, "Vector2");
+  Vector2 * v   = (Vector2 *)luax_checkclass(L, 2, "Vector2");
+  *out = Vector2Normalize(*v);
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Vector2:lerpTo
+```lua
+Vector2 Out = Vector2:lerpTo(Vector2 A, Vector2 B, number Amount)
+```
+Store interpolation between two vectors by given interpolant
+*/
+int lua_class_vector2_LerpTo(lua_State *L){
+  Vector2 * out    = (Vector2 *)luax_checkclass(L, 1, "Vector2");
+  Vector2 * v1     = (Vector2 *)luax_checkclass(L, 2, "Vector2");
+  Vector2 * v2     = (Vector2 *)luax_checkclass(L, 3, "Vector2");
+  float     amount = luaL_checknumber(L, 4);
+  *out = Vector2Lerp(*v1, *v2, amount);
+  lua_settop(L, 1);
+  return 1;
 }
 
+luax_Field luaray_fields_vector2[] = {
+  luax_field(Vector2, "x", x, LUAX_FIELD_FLOAT),
+  luax_field(Vector2, "y", y, LUAX_FIELD_FLOAT),
+  {NULL}
+};
+
 int lua_class_vector2__Add(lua_State *L){
-  Vector2 * v1 = (Vector2 *)luaL_checkudata(L, 1, "Vector2");
-  Vector2 * v2 = (Vector2 *)luaL_checkudata(L, 2, "Vector2");
+  Vector2 * v1 = (Vector2 *)luax_checkclass(L, 1, "Vector2");
+  Vector2 * v2 = (Vector2 *)luax_checkclass(L, 2, "Vector2");
   Vector2 * v3 = (Vector2 *)luax_newobject(L, "Vector2", sizeof(Vector2));
   *v3 = Vector2Add(*v1, *v2);
   return 1;
 }
 
 int lua_class_vector2__Sub(lua_State *L){
-  Vector2 * v1 = (Vector2 *)luaL_checkudata(L, 1, "Vector2");
-  Vector2 * v2 = (Vector2 *)luaL_checkudata(L, 2, "Vector2");
+  Vector2 * v1 = (Vector2 *)luax_checkclass(L, 1, "Vector2");
+  Vector2 * v2 = (Vector2 *)luax_checkclass(L, 2, "Vector2");
   Vector2 * v3 = (Vector2 *)luax_newobject(L, "Vector2", sizeof(Vector2));
   *v3 = Vector2Subtract(*v1, *v2);
   return 1;
 }
 
 int lua_class_vector2__Mul(lua_State *L){
-  Vector2 * v1 = (Vector2 *)luaL_checkudata(L, 1, "Vector2");
+  Vector2 * v1 = (Vector2 *)luax_checkclass(L, 1, "Vector2");
   Vector2 * v3 = (Vector2 *)luax_newobject(L, "Vector2", sizeof(Vector2));
   if ( lua_isnumber(L, 2) ){
     *v3 = Vector2Scale(*v1, luaL_checknumber(L, 2));
     return 1;
   }
-  Vector2 * v2 = (Vector2 *)luaL_checkudata(L, 2, "Vector2");
+  Vector2 * v2 = (Vector2 *)luax_checkclass(L, 2, "Vector2");
   *v3 = Vector2MultiplyV(*v1, *v2);
   return 1;
 }
 
 int lua_class_vector2__Div(lua_State *L){
-  Vector2 * v1 = (Vector2 *)luaL_checkudata(L, 1, "Vector2");
-  Vector2 * v2 = (Vector2 *)luaL_checkudata(L, 2, "Vector2");
+  Vector2 * v1 = (Vector2 *)luax_checkclass(L, 1, "Vector2");
+  Vector2 * v2 = (Vector2 *)luax_checkclass(L, 2, "Vector2");
   Vector2 * v3 = (Vector2 *)luax_newobject(L, "Vector2", sizeof(Vector2));
   *v3 = Vector2DivideV(*v1, *v2);
   return 1;
 }
 
 int lua_class_vector2__Pow(lua_State *L){
-  Vector2 * v1 = (Vector2 *)luaL_checkudata(L, 1, "Vector2");
+  Vector2 * v1 = (Vector2 *)luax_checkclass(L, 1, "Vector2");
   Vector2 * v3 = (Vector2 *)luax_newobject(L, "Vector2", sizeof(Vector2));
   if ( lua_isnumber(L, 2) ){
     float n = luaL_checknumber(L, 2);
@@ -452,7 +588,7 @@ int lua_class_vector2__Pow(lua_State *L){
     v3->y = pow(v3->y, n);
     return 1;
   }
-  Vector2 * v2 = (Vector2 *)luaL_checkudata(L, 2, "Vector2");
+  Vector2 * v2 = (Vector2 *)luax_checkclass(L, 2, "Vector2");
   v3->x = pow(v3->x, v2->x);
   v3->y = pow(v3->y, v2->y);
 
@@ -460,21 +596,21 @@ int lua_class_vector2__Pow(lua_State *L){
 }
 
 int lua_class_vector2__Neg(lua_State *L){
-  Vector2 * v1 = (Vector2 *)luaL_checkudata(L, 1, "Vector2");
+  Vector2 * v1 = (Vector2 *)luax_checkclass(L, 1, "Vector2");
   Vector2 * v2 = (Vector2 *)luax_newobject(L, "Vector2", sizeof(Vector2));
   *v2 = Vector2Negate(*v1);
   return 1;
 }
 
 int lua_class_vector2__Eq(lua_State *L){
-  Vector2 * v1 = (Vector2 *)luaL_checkudata(L, 1, "Vector2");
-  Vector2 * v2 = (Vector2 *)luaL_checkudata(L, 2, "Vector2");
+  Vector2 * v1 = (Vector2 *)luax_checkclass(L, 1, "Vector2");
+  Vector2 * v2 = (Vector2 *)luax_checkclass(L, 2, "Vector2");
   lua_pushboolean(L, (v1->x == v2->x) && (v1->y == v2->y));
   return 1;
 }
 
 int lua_class_vector2__ToString(lua_State *L){
-  Vector2 * v = (Vector2 *)luaL_checkudata(L, 1, "Vector2");
+  Vector2 * v = (Vector2 *)luax_checkclass(L, 1, "Vector2");
   lua_pushfstring(L, "Vector2[%f, %f]: 0x%0.8x", v->x, v->y, v);
   return 1;
 }
@@ -498,9 +634,17 @@ luaL_Reg luaray_class_vector2[] = {
   {"divideV",    lua_class_vector2_DivideV},
   {"normalize",  lua_class_vector2_Normalize},
   {"lerp",       lua_class_vector2_Lerp},
+  // allocation-free
+  {"copy",        lua_class_vector2_Copy},
+  {"addTo",       lua_class_vector2_AddTo},
+  {"subtractTo",  lua_class_vector2_SubtractTo},
+  {"scaleTo",     lua_class_vector2_ScaleTo},
+  {"multiplyTo",  lua_class_vector2_MultiplyTo},
+  {"divideTo",    lua_class_vector2_DivideTo},
+  {"negateTo",    lua_class_vector2_NegateTo},
+  {"normalizeTo", lua_class_vector2_NormalizeTo},
+  {"lerpTo",      lua_class_vector2_LerpTo},
   // meta
-  {"__index",    lua_class_vector2__Index},
-  {"__newindex", lua_class_vector2__Newindex},
   {"__add",      lua_class_vector2__Add},
   {"__sub",      lua_class_vector2__Sub},
   {"__mul",      lua_class_vector2__Mul},
@@ -553,6 +697,23 @@ Structure:
 | [barycenter](#Vector3barycenter)                 | Create new vector that is barycenter coordinates (u, v, w) for point p with respect to triangle (a, b, c)
 | [angle](#Vector3angle)                           | Returns scalar angle between two vectors (degrees)
 | [angleRad](#Vector3angleRad)                     | Returns scalar angle between two vectors (radians)
+| **Allocation-free methods**                      | Write result of operation into the calling object, no new objects created
+| [copy](#Vector3copy)                             | Copy components of another vector
+| [addTo](#Vector3addTo)                           | Store sum of two vectors
+| [subtractTo](#Vector3subtractTo)                 | Store subtraction of two vectors
+| [scaleTo](#Vector3scaleTo)                       | Store vector multiplied by scalar
+| [multiplyTo](#Vector3multiplyTo)                 | Store multiplication of vector by vector or scalar
+| [divideTo](#Vector3divideTo)                     | Store division of vector by vector or scalar
+| [negateTo](#Vector3negateTo)                     | Store negated vector
+| [normalizeTo](#Vector3normalizeTo)               | Store normalized vector
+| [crossProductTo](#Vector3crossProductTo)         | Store cross product of two vectors
+| [perpendicularTo](#Vector3perpendicularTo)       | Store vector perpendicular to given vector
+| [transformTo](#Vector3transformTo)               | Store vector transformed by a given Matrix
+| [rotateByQuaternionTo](#Vector3rotateByQuaternionTo) | Store vector transformed by quaternion rotation
+| [lerpTo](#Vector3lerpTo)                         | Store interpolation between two vectors
+| [reflectTo](#Vector3reflectTo)                   | Store vector reflected to normal
+| [minTo](#Vector3minTo)                           | Store min value for each pair of components
+| [maxTo](#Vector3maxTo)                           | Store max value for each pair of components
 | **Overloads**                                    | Note: In the mul/div methods with numbers, the vector should be in FIRST place, `NewVec3 = Vec3 * 5` is ok `NewVec3 = 5 * Vec3` raises error
 | +: `NewVec3 = Vec3A + Vec3B`                     | Create a new vector that is the sum of two vectors
 | -: `NewVec3 = Vec3A - Vec3B`                     | Create a new vector that is the subtraction of two vectors
@@ -609,7 +770,7 @@ Vector3 Vec3 = Vector3:clone()
 Clones Vector3 object.
 */
 int lua_class_vector3_Clone(lua_State *L){
-  Vector3 * v1 = (Vector3 *)luaL_checkudata(L, 1, "Vector3");
+  Vector3 * v1 = (Vector3 *)luax_checkclass(L, 1, "Vector3");
   Vector3 * v2 = (Vector3 *)luax_newobject(L, "Vector3", sizeof(Vector3));
   v2->x = v1->x; v2->y = v1->y; v2->z = v1->z;
   return 1;
@@ -625,7 +786,7 @@ table t = Vector3:get('t') --> {x, y, z}
 Get Vector3 components.
 */
 int lua_class_vector3_Get(lua_State *L){
-  Vector3 * v = (Vector3 *)luaL_checkudata(L, 1, "Vector3");
+  Vector3 * v = (Vector3 *)luax_checkclass(L, 1, "Vector3");
   if (luax_optstring(L, 2, "\0")[0] == 't'){
     lua_newtable(L);
     luax_tnnumber(L, 1, (float)v->x);
@@ -649,7 +810,7 @@ Vector3:set(table t) -- [x, y, z]
 Set Vector3 components.
 */
 int lua_class_vector3_Set(lua_State *L){
-  Vector3 * v = (Vector3 *)luaL_checkudata(L, 1, "Vector3");
+  Vector3 * v = (Vector3 *)luax_checkclass(L, 1, "Vector3");
   v->x = luax_optnumber(L, 2, v->x);
   v->y = luax_optnumber(L, 3, v->y);
   v->z = luax_optnumber(L, 4, v->z);
@@ -665,8 +826,8 @@ Vector3:add(Vector3 Vector)
 Add vector to vector (modifying it)
 */
 int lua_class_vector3_Add(lua_State *L){
-  Vector3 * v1 = (Vector3 *)luaL_checkudata(L, 1, "Vector3");
-  Vector3 * v2 = (Vector3 *)luaL_checkudata(L, 2, "Vector3");
+  Vector3 * v1 = (Vector3 *)luax_checkclass(L, 1, "Vector3");
+  Vector3 * v2 = (Vector3 *)luax_checkclass(L, 2, "Vector3");
   v1->x += v2->x;
   v1->y += v2->y;
   v1->z += v2->z;
@@ -687,8 +848,8 @@ Vector3:subtract(Vector3 Vector)
 Subtract vector to vector (modifying it)
 */
 int lua_class_vector3_Subtract(lua_State *L){
-  Vector3 * v1 = (Vector3 *)luaL_checkudata(L, 1, "Vector3");
-  Vector3 * v2 = (Vector3 *)luaL_checkudata(L, 2, "Vector3");
+  Vector3 * v1 = (Vector3 *)luax_checkclass(L, 1, "Vector3");
+  Vector3 * v2 = (Vector3 *)luax_checkclass(L, 2, "Vector3");
   _ptr_vector3_Subtract(v1, v2);
   lua_settop(L, 1);
   return 1;
@@ -702,7 +863,7 @@ Vector3:scale(number Scale)
 Multiply each component of vector to scalar
 */
 int lua_class_vector3_Scale(lua_State *L){
-  Vector3 * v1 = (Vector3 *)luaL_checkudata(L, 1, "Vector3");
+  Vector3 * v1 = (Vector3 *)luax_checkclass(L, 1, "Vector3");
   float n = luaL_checknumber(L, 2);
   v1->x *= n; v1->y *= n; v1->z *= n;
   lua_settop(L, 1);
@@ -717,8 +878,8 @@ Vector3:multiplyV(Vector3 Vector)
 Multiply vector to another vector (modifying it)
 */
 int lua_class_vector3_MultiplyV(lua_State *L){
-  Vector3 * v1 = (Vector3 *)luaL_checkudata(L, 1, "Vector3");
-  Vector3 * v2 = (Vector3 *)luaL_checkudata(L, 2, "Vector3");
+  Vector3 * v1 = (Vector3 *)luax_checkclass(L, 1, "Vector3");
+  Vector3 * v2 = (Vector3 *)luax_checkclass(L, 2, "Vector3");
   v1->x *= v2->x; v1->y *= v2->y; v1->z *= v2->z;
   lua_settop(L, 1);
   return 1;
@@ -734,7 +895,7 @@ Vector3:multiply(number Scale)
 Multiply vector to scalar or another vector (modifying it)
 */
 int lua_class_vector3_Multiply(lua_State *L){
-  Vector3 * v1 = (Vector3 *)luaL_checkudata(L, 1, "Vector3");
+  Vector3 * v1 = (Vector3 *)luax_checkclass(L, 1, "Vector3");
   if (lua_isnumber(L, 2)){
     float n = luaL_checknumber(L, 2);
     v1->x *= n; v1->y *= n; v1->z *= n;
@@ -742,7 +903,7 @@ int lua_class_vector3_Multiply(lua_State *L){
     return 1;
   }
 
-  Vector3 * v2 = (Vector3 *)luaL_checkudata(L, 2, "Vector3");
+  Vector3 * v2 = (Vector3 *)luax_checkclass(L, 2, "Vector3");
   v1->x *= v2->x; v1->y *= v2->y; v1->z *= v2->z;
   lua_settop(L, 1);
   return 1;
@@ -763,8 +924,8 @@ Vector3 * _ptr_vector3_CrossProduct(Vector3 * v1, Vector3 * v2){
 }
 
 int lua_class_vector3_CrossProduct(lua_State *L){
-  Vector3 * v1 = (Vector3 *)luaL_checkudata(L, 1, "Vector3");
-  Vector3 * v2 = (Vector3 *)luaL_checkudata(L, 2, "Vector3");
+  Vector3 * v1 = (Vector3 *)luax_checkclass(L, 1, "Vector3");
+  Vector3 * v2 = (Vector3 *)luax_checkclass(L, 2, "Vector3");
   _ptr_vector3_CrossProduct(v1, v2);
   lua_settop(L, 1);
   return 1;
@@ -778,7 +939,7 @@ Vector3:perpendicular(Vector3 Vector)
 Calculate one vector perpendicular vector
 */
 int lua_class_vector3_Perpendicular(lua_State *L){
-  Vector3 * v = (Vector3 *)luaL_checkudata(L, 1, "Vector3");
+  Vector3 * v = (Vector3 *)luax_checkclass(L, 1, "Vector3");
   Vector3   c = {1.0f, 0.0f, 0.0f};
 
   float min  = (float)fabs(v->x);
@@ -811,7 +972,7 @@ number Length = Vector3:length()
 Returns vector scalar length
 */
 int lua_class_vector3_Length(lua_State *L){
-  Vector3 * v = (Vector3 *)luaL_checkudata(L, 1, "Vector3");
+  Vector3 * v = (Vector3 *)luax_checkclass(L, 1, "Vector3");
   float result = sqrtf(v->x*v->x + v->y*v->y + v->z*v->z);
   lua_pushnumber(L, result);
   return 1;
@@ -829,8 +990,8 @@ float _ptr_vector3_DotProduct(Vector3 * v1, Vector3 * v2){
 }
 
 int lua_class_vector3_DotProduct(lua_State *L){
-  Vector3 * v1 = (Vector3 *)luaL_checkudata(L, 1, "Vector3");
-  Vector3 * v2 = (Vector3 *)luaL_checkudata(L, 2, "Vector3");
+  Vector3 * v1 = (Vector3 *)luax_checkclass(L, 1, "Vector3");
+  Vector3 * v2 = (Vector3 *)luax_checkclass(L, 2, "Vector3");
   float result = _ptr_vector3_DotProduct(v1, v2);
   lua_pushnumber(L, result);
   return 1;
@@ -844,8 +1005,8 @@ number Distance = Vector3:distance(Vector3 Vector)
 Returns scalar distance between two vectors
 */
 int lua_class_vector3_Distance(lua_State *L){
-  Vector3 * v1 = (Vector3 *)luaL_checkudata(L, 1, "Vector3");
-  Vector3 * v2 = (Vector3 *)luaL_checkudata(L, 2, "Vector3");
+  Vector3 * v1 = (Vector3 *)luax_checkclass(L, 1, "Vector3");
+  Vector3 * v2 = (Vector3 *)luax_checkclass(L, 2, "Vector3");
   float dx = v2->x - v1->x;
   float dy = v2->y - v1->y;
   float dz = v2->z - v1->z;
@@ -862,7 +1023,7 @@ Vector3:negate()
 Negate each component of vector (-Vec3.x, -Vec3.y, -Vec3.z)
 */
 int lua_class_vector3_Negate(lua_State *L){
-  Vector3 * v = (Vector3 *)luaL_checkudata(L, 1, "Vector3");
+  Vector3 * v = (Vector3 *)luax_checkclass(L, 1, "Vector3");
   v->x = -v->x; v->y = -v->y; v->z = -v->z;
   lua_settop(L, 1);
   return 1;
@@ -878,7 +1039,7 @@ Vector3:divide(number Scale)
 Divide vector to scalar or another vector (modifying it)
 */
 int lua_class_vector3_Divide(lua_State *L){
-  Vector3 * v1 = (Vector3 *)luaL_checkudata(L, 1, "Vector3");
+  Vector3 * v1 = (Vector3 *)luax_checkclass(L, 1, "Vector3");
   if (lua_isnumber(L, 2)){
     float n = luaL_checknumber(L, 2);
     v1->x /= n; v1->y /= n; v1->z /= n;
@@ -886,7 +1047,7 @@ int lua_class_vector3_Divide(lua_State *L){
     return 1;
   }
 
-  Vector3 * v2 = (Vector3 *)luaL_checkudata(L, 2, "Vector3");
+  Vector3 * v2 = (Vector3 *)luax_checkclass(L, 2, "Vector3");
   v1->x /= v2->x; v1->y /= v2->y; v1->z /= v2->z;
   lua_settop(L, 1);
   return 1;
@@ -900,8 +1061,8 @@ Vector3:divideV(Vector3 Vector)
 Divide vector to another vector (modifying it)
 */
 int lua_class_vector3_DivideV(lua_State *L){
-  Vector3 * v1 = (Vector3 *)luaL_checkudata(L, 1, "Vector3");
-  Vector3 * v2 = (Vector3 *)luaL_checkudata(L, 2, "Vector3");
+  Vector3 * v1 = (Vector3 *)luax_checkclass(L, 1, "Vector3");
+  Vector3 * v2 = (Vector3 *)luax_checkclass(L, 2, "Vector3");
   v1->x /= v2->x; v1->y /= v2->y; v1->z /= v2->z;
   lua_settop(L, 1);
   return 1;
@@ -925,7 +1086,7 @@ Vector3 * _ptr_vector3_Normalize(Vector3 * v){
 }
 
 int lua_class_vector3_Normalize(lua_State *L){
-  Vector3 * v = (Vector3 *)luaL_checkudata(L, 1, "Vector3");
+  Vector3 * v = (Vector3 *)luax_checkclass(L, 1, "Vector3");
   _ptr_vector3_Normalize(v);
   lua_settop(L, 1);
   return 1;
@@ -939,8 +1100,8 @@ Vector3:orthoNormalize(Vector3 Vector)
 Makes vectors normalized and orthogonal to each other modifying both
 */
 int lua_class_vector3_OrthoNormalize(lua_State *L){
-  Vector3 * v1 = (Vector3 *)luaL_checkudata(L, 1, "Vector3");
-  Vector3 * v2 = (Vector3 *)luaL_checkudata(L, 2, "Vector3");
+  Vector3 * v1 = (Vector3 *)luax_checkclass(L, 1, "Vector3");
+  Vector3 * v2 = (Vector3 *)luax_checkclass(L, 2, "Vector3");
 
   _ptr_vector3_Normalize(v1);
   Vector3 vn = {v1->x, v1->y, v1->z};
@@ -960,8 +1121,8 @@ Vector3:transform(Matrix Matrix)
 Transforms a vector by a given Matrix
 */
 int lua_class_vector3_Transform(lua_State *L){
-  Vector3 * v = (Vector3 *)luaL_checkudata(L, 1, "Vector3");
-  Matrix  * m =  (Matrix *)luaL_checkudata(L, 2, "Matrix");
+  Vector3 * v = (Vector3 *)luax_checkclass(L, 1, "Vector3");
+  Matrix  * m =  (Matrix *)luax_checkclass(L, 2, "Matrix");
   float x = v->x, y = v->y, z = v->z;
   v->x = m->m0*x + m->m4*y + m->m8*z  + m->m12;
   v->y = m->m1*x + m->m5*y + m->m9*z  + m->m13;
@@ -978,8 +1139,8 @@ Vector3:rotateByQuaternion(Vector4 Quaternion)
 Transform a vector by quaternion rotation
 */
 int lua_class_vector3_RotateByQuaternion(lua_State *L){
-  Vector3 * v = (Vector3 *)luaL_checkudata(L, 1, "Vector3");
-  Vector4 * q = (Vector4 *)luaL_checkudata(L, 2, "Vector4");
+  Vector3 * v = (Vector3 *)luax_checkclass(L, 1, "Vector3");
+  Vector4 * q = (Vector4 *)luax_checkclass(L, 2, "Vector4");
   float vx = v->x, vy = v->y, vz = v->z;
   float qx = q->x, qy = q->y, qz = q->z, qw = q->w;
 
@@ -998,8 +1159,8 @@ Vector3:lerp(Vector3 Vector, number Amount)
 Interpolate vector to another by given interpolant
 */
 int lua_class_vector3_Lerp(lua_State *L){
-  Vector3 * v1 = (Vector3 *)luaL_checkudata(L, 1, "Vector3");
-  Vector3 * v2 = (Vector3 *)luaL_checkudata(L, 2, "Vector3");
+  Vector3 * v1 = (Vector3 *)luax_checkclass(L, 1, "Vector3");
+  Vector3 * v2 = (Vector3 *)luax_checkclass(L, 2, "Vector3");
   float amount = luaL_checknumber(L, 3);
   v1->x = v1->x + amount*(v2->x - v1->x);
   v1->y = v1->y + amount*(v2->y - v1->y);
@@ -1017,8 +1178,8 @@ Vector3:reflect(Vector3 Normal)
 Calculate reflected vector to normal
 */
 int lua_class_vector3_Reflect(lua_State *L){
-  Vector3 * v      = (Vector3 *)luaL_checkudata(L, 1, "Vector3");
-  Vector3 * normal = (Vector3 *)luaL_checkudata(L, 2, "Vector3");
+  Vector3 * v      = (Vector3 *)luax_checkclass(L, 1, "Vector3");
+  Vector3 * normal = (Vector3 *)luax_checkclass(L, 2, "Vector3");
   float dotProduct = _ptr_vector3_DotProduct(v, normal);
 
   v->x = v->x - (2.0f*normal->x)*dotProduct;
@@ -1037,8 +1198,8 @@ number Min = Vector3:min()
 Return min value for each pair of components
 */
 int lua_class_vector3_Min(lua_State *L){
-  Vector3 * v1 = (Vector3 *)luaL_checkudata(L, 1, "Vector3");
-  Vector3 * v2 = (Vector3 *)luaL_checkudata(L, 2, "Vector3");
+  Vector3 * v1 = (Vector3 *)luax_checkclass(L, 1, "Vector3");
+  Vector3 * v2 = (Vector3 *)luax_checkclass(L, 2, "Vector3");
 
   v1->x = fminf(v1->x, v2->x);
   v1->y = fminf(v1->y, v2->y);
@@ -1056,8 +1217,8 @@ number max = Vector3:min()
 Return max value for each pair of components
 */
 int lua_class_vector3_Max(lua_State *L){
-  Vector3 * v1 = (Vector3 *)luaL_checkudata(L, 1, "Vector3");
-  Vector3 * v2 = (Vector3 *)luaL_checkudata(L, 2, "Vector3");
+  Vector3 * v1 = (Vector3 *)luax_checkclass(L, 1, "Vector3");
+  Vector3 * v2 = (Vector3 *)luax_checkclass(L, 2, "Vector3");
 
   v1->x = fmaxf(v1->x, v2->x);
   v1->y = fmaxf(v1->y, v2->y);
@@ -1070,15 +1231,17 @@ int lua_class_vector3_Max(lua_State *L){
 /*!MD
 #### Vector3:barycenter
 ```lua
+-- variants
 Vector3 Barycenter = Vector3:barycenter(Vector3 A, Vector3 B, Vector3 C)
+Vector3 Out = Vector3:barycenter(Vector3 A, Vector3 B, Vector3 C, Vector3 Out)
 ```
-Create new vector that is barycenter coordinates (u, v, w) for point p with respect to triangle (A, B, C)
+Create new vector that is barycenter coordinates (u, v, w) for point p with respect to triangle (A, B, C), or store it to optional Out vector
 */
 int lua_class_vector3_Barycenter(lua_State *L){
-  Vector3 * p = (Vector3 *)luaL_checkudata(L, 1, "Vector3");
-  Vector3 * a = (Vector3 *)luaL_checkudata(L, 2, "Vector3");
-  Vector3 * b = (Vector3 *)luaL_checkudata(L, 3, "Vector3");
-  Vector3 * c = (Vector3 *)luaL_checkudata(L, 4, "Vector3");
+  Vector3 * p = (Vector3 *)luax_checkclass(L, 1, "Vector3");
+  Vector3 * a = (Vector3 *)luax_checkclass(L, 2, "Vector3");
+  Vector3 * b = (Vector3 *)luax_checkclass(L, 3, "Vector3");
+  Vector3 * c = (Vector3 *)luax_checkclass(L, 4, "Vector3");
 
   Vector3 v0 = Vector3Subtract(*b, *a);
   Vector3 v1 = Vector3Subtract(*c, *a);
@@ -1091,7 +1254,12 @@ int lua_class_vector3_Barycenter(lua_State *L){
 
   float denom = d00*d11 - d01*d01;
 
-  Vector3 * result = (Vector3 *)luax_newobject(L, "Vector3", sizeof(Vector3));
+  Vector3 * result;
+  if (lua_isnoneornil(L, 5)) result = (Vector3 *)luax_newobject(L, "Vector3", sizeof(Vector3));
+  else {
+    result = (Vector3 *)luax_checkclass(L, 5, "Vector3");
+    lua_settop(L, 5);
+  }
 
   result->y = (d11*d20 - d01*d21)/denom;
   result->z = (d00*d21 - d01*d20)/denom;
@@ -1099,73 +1267,320 @@ int lua_class_vector3_Barycenter(lua_State *L){
   return 1;
 }
 
-// Meta
-int lua_class_vector3__Index(lua_State *L){
-  if (!luax_type(L, 2, LUA_TSTRING)) return 0;
-  Vector3 *    v   = (Vector3 *)luaL_checkudata(L, 1, "Vector3");
-  const char * key = luaL_checkstring(L, 2);
-
-  lua_class_GetFieldIfCompared(L, v, key, "x", x); // calls "return" from this function on success
-  lua_class_GetFieldIfCompared(L, v, key, "y", y);
-  lua_class_GetFieldIfCompared(L, v, key, "z", z);
-  
-  luax_getclasskey(L, 1, 2);
+/*!MD
+### Allocation-free methods
+Like overloads, but writes result into the calling vector (it can be one of the arguments too) and returns it, no new objects created.
+```lua
+local pos, vel, tmp = rl.Vector3(), rl.Vector3(1, 1, 1), rl.Vector3()
+pos:addTo(pos, tmp:scaleTo(vel, dt)) -- pos = pos + vel * dt
+```
+
+#### Vector3:copy
+```lua
+Vector3 Out = Vector3:copy(Vector3 Src)
+```
+Copy components of another vector
+*/
+int lua_class_vector3_Copy(lua_State *L){
+  Vector3 * out = (Vector3 *)luax_checkclass(L, 1, "Vector3");
+  Vector3 * v   = (Vector3 *)luax_checkclass(L, 2, "Vector3");
+  *out = *v;
+  lua_settop(L, 1);
   return 1;
 }
 
-int lua_class_vector3__Newindex(lua_State *L){
-  if (!luax_type(L, 2, LUA_TSTRING)) return 0;
-  Vector3 *    v     = (Vector3 *)luaL_checkudata(L, 1, "Vector3");
-  const char * key   = luaL_checkstring(L, 2);
-  float        value = luaL_checknumber(L, 3);
-  lua_class_SetFieldIfCompared(L, v, key, value, "x", x);
-  lua_class_SetFieldIfCompared(L, v, key, value, "y", y);
-  lua_class_SetFieldIfCompared(L, v, key, value, "z", z);
-  return 0;
+/*!MD
+#### Vector3:addTo
+```lua
+Vector3 Out = Vector3:addTo(Vector3 A, Vector3 B)
+```
+Store sum of two vectors (Out = A + B)
+*/
+int lua_class_vector3_AddTo(lua_State *L){
+  Vector3 * out = (Vector3 *)luax_checkclass(L, 1, "Vector3");
+  Vector3 * v1  = (Vector3 *)luax_checkclass(L, 2, "Vector3");
+  Vector3 * v2  = (Vector3 *)luax_checkclass(L, 3, "Vector3");
+  *out = Vector3Add(*v1, *v2);
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Vector3:subtractTo
+```lua
+Vector3 Out = Vector3:subtractTo(Vector3 A, Vector3 B)
+```
+Store subtraction of two vectors (Out = A - B)
+*/
+int lua_class_vector3_SubtractTo(lua_State *L){
+  Vector3 * out = (Vector3 *)luax_checkclass(L, 1, "Vector3");
+  Vector3 * v1  = (Vector3 *)luax_checkclass(L, 2, "Vector3");
+  Vector3 * v2  = (Vector3 *)luax_checkclass(L, 3, "Vector3");
+  *out = Vector3Subtract(*v1, *v2);
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Vector3:scaleTo
+```lua
+Vector3 Out = Vector3:scaleTo(Vector3 A, number Scale)
+```
+Store vector multiplied by scalar (Out = A * Scale)
+*/
+int lua_class_vector3_ScaleTo(lua_State *L){
+  Vector3 * out = (Vector3 *)luax_checkclass(L, 1, "Vector3");
+  Vector3 * v   = (Vector3 *)luax_checkclass(L, 2, "Vector3");
+  float     n   = luaL_checknumber(L, 3);
+  *out = Vector3Scale(*v, n);
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Vector3:multiplyTo
+```lua
+-- variants
+Vector3 Out = Vector3:multiplyTo(Vector3 A, Vector3 B)
+Vector3 Out = Vector3:multiplyTo(Vector3 A, number Scale)
+```
+Store multiplication of vector by vector or scalar (Out = A * B)
+*/
+int lua_class_vector3_MultiplyTo(lua_State *L){
+  Vector3 * out = (Vector3 *)luax_checkclass(L, 1, "Vector3");
+  Vector3 * v1  = (Vector3 *)luax_checkclass(L, 2, "Vector3");
+  if (lua_isnumber(L, 3)) *out = Vector3Scale(*v1, luaL_checknumber(L, 3));
+  else                    *out = Vector3Multiply(*v1, *(Vector3 *)luax_checkclass(L, 3, "Vector3"));
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Vector3:divideTo
+```lua
+-- variants
+Vector3 Out = Vector3:divideTo(Vector3 A, Vector3 B)
+Vector3 Out = Vector3:divideTo(Vector3 A, number Scale)
+```
+Store division of vector by vector or scalar (Out = A / B)
+*/
+int lua_class_vector3_DivideTo(lua_State *L){
+  Vector3 * out = (Vector3 *)luax_checkclass(L, 1, "Vector3");
+  Vector3 * v1  = (Vector3 *)luax_checkclass(L, 2, "Vector3");
+  if (lua_isnumber(L, 3)) *out = Vector3Divide(*v1, luaL_checknumber(L, 3));
+  else                    *out = Vector3DivideV(*v1, *(Vector3 *)luax_checkclass(L, 3, "Vector3"));
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Vector3:negateTo
+```lua
+Vector3 Out = Vector3:negateTo(Vector3 A)
+```
+Store negated vector (Out = -A)
+*/
+int lua_class_vector3_NegateTo(lua_State *L){
+  Vector3 * out = (Vector3 *)luax_checkclass(L, 1, "Vector3");
+  Vector3 * v   = (Vector3 *)luax_checkclass(L, 2, "Vector3");
+  *out = Vector3Negate(*v);
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Vector3:normalizeTo
+```lua
+Vector3 Out = Vector3:normalizeTo(Vector3 A)
+```
+Store normalized vector
+*/
+int lua_class_vector3_NormalizeTo(lua_State *L){
+  Vector3 * out = (Vector3 *)luax_checkclass(L, 1, "Vector3");
+  Vector3 * v   = (Vector3 *)luax_checkclass(L, 2, "Vector3");
+  *out = Vector3Normalize(*v);
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Vector3:crossProductTo
+```lua
+Vector3 Out = Vector3:crossProductTo(Vector3 A, Vector3 B)
+```
+Store cross product of two vectors
+*/
+int lua_class_vector3_CrossProductTo(lua_State *L){
+  Vector3 * out = (Vector3 *)luax_checkclass(L, 1, "Vector3");
+  Vector3 * v1  = (Vector3 *)luax_checkclass(L, 2, "Vector3");
+  Vector3 * v2  = (Vector3 *)luax_checkclass(L, 3, "Vector3");
+  *out = Vector3CrossProduct(*v1, *v2);
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Vector3:perpendicularTo
+```lua
+Vector3 Out = Vector3:perpendicularTo(Vector3 A)
+```
+Store vector perpendicular to given vector
+*/
+int lua_class_vector3_PerpendicularTo(lua_State *L){
+  Vector3 * out = (Vector3 *)luax_checkclass(L, 1, "Vector3");
+  Vector3 * v   = (Vector3 *)luax_checkclass(L, 2, "Vector3");
+  *out = Vector3Perpendicular(*v);
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Vector3:transformTo
+```lua
+Vector3 Out = Vector3:transformTo(Vector3 A, Matrix Matrix)
+```
+Store vector transformed by a given Matrix
+*/
+int lua_class_vector3_TransformTo(lua_State *L){
+  Vector3 * out = (Vector3 *)luax_checkclass(L, 1, "Vector3");
+  Vector3 * v   = (Vector3 *)luax_checkclass(L, 2, "Vector3");
+  Matrix * m   = (Matrix *)luax_checkclass(L, 3, "Matrix");
+  *out = Vector3Transform(*v, *m);
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Vector3:rotateByQuaternionTo
+```lua
+Vector3 Out = Vector3:rotateByQuaternionTo(Vector3 A, Vector4 Quaternion)
+```
+Store vector transformed by quaternion rotation
+*/
+int lua_class_vector3_RotateByQuaternionTo(lua_State *L){
+  Vector3 * out = (Vector3 *)luax_checkclass(L, 1, "Vector3");
+  Vector3 * v   = (Vector3 *)luax_checkclass(L, 2, "Vector3");
+  Vector4 * q   = (Vector4 *)luax_checkclass(L, 3, "Vector4");
+  *out = Vector3RotateByQuaternion(*v, *q);
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Vector3:lerpTo
+```lua
+Vector3 Out = Vector3:lerpTo(Vector3 A, Vector3 B, number Amount)
+```
+Store interpolation between two vectors by given interpolant
+*/
+int lua_class_vector3_LerpTo(lua_State *L){
+  Vector3 * out = (Vector3 *)luax_checkclass(L, 1, "Vector3");
+  Vector3 * v1  = (Vector3 *)luax_checkclass(L, 2, "Vector3");
+  Vector3 * v2  = (Vector3 *)luax_checkclass(L, 3, "Vector3");
+  float     amount = luaL_checknumber(L, 4);
+  *out = Vector3Lerp(*v1, *v2, amount);
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Vector3:reflectTo
+```lua
+Vector3 Out = Vector3:reflectTo(Vector3 A, Vector3 Normal)
+```
+Store vector reflected to normal
+*/
+int lua_class_vector3_ReflectTo(lua_State *L){
+  Vector3 * out = (Vector3 *)luax_checkclass(L, 1, "Vector3");
+  Vector3 * v1  = (Vector3 *)luax_checkclass(L, 2, "Vector3");
+  Vector3 * v2  = (Vector3 *)luax_checkclass(L, 3, "Vector3");
+  *out = Vector3Reflect(*v1, *v2);
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Vector3:minTo
+```lua
+Vector3 Out = Vector3:minTo(Vector3 A, Vector3 B)
+```
+Store min value for each pair of components
+*/
+int lua_class_vector3_MinTo(lua_State *L){
+  Vector3 * out = (Vector3 *)luax_checkclass(L, 1, "Vector3");
+  Vector3 * v1  = (Vector3 *)luax_checkclass(L, 2, "Vector3");
+  Vector3 * v2  = (Vector3 *)luax_checkclass(L, 3, "Vector3");
+  *out = Vector3Min(*v1, *v2);
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Vector3:maxTo
+```lua
+Vector3 Out = Vector3:maxTo(Vector3 A, Vector3 B)
+```
+Store max value for each pair of components
+*/
+int lua_class_vector3_MaxTo(lua_State *L){
+  Vector3 * out = (Vector3 *)luax_checkclass(L, 1, "Vector3");
+  Vector3 * v1  = (Vector3 *)luax_checkclass(L, 2, "Vector3");
+  Vector3 * v2  = (Vector3 *)luax_checkclass(L, 3, "Vector3");
+  *out = Vector3Max(*v1, *v2);
+  lua_settop(L, 1);
+  return 1;
 }
 
+luax_Field luaray_fields_vector3[] = {
+  luax_field(Vector3, "x", x, LUAX_FIELD_FLOAT),
+  luax_field(Vector3, "y", y, LUAX_FIELD_FLOAT),
+  luax_field(Vector3, "z", z, LUAX_FIELD_FLOAT),
+  {NULL}
+};
+
+// Meta
 int lua_class_vector3__Add(lua_State *L){
-  Vector3 * v1 = (Vector3 *)luaL_checkudata(L, 1, "Vector3");
-  Vector3 * v2 = (Vector3 *)luaL_checkudata(L, 2, "Vector3");
+  Vector3 * v1 = (Vector3 *)luax_checkclass(L, 1, "Vector3");
+  Vector3 * v2 = (Vector3 *)luax_checkclass(L, 2, "Vector3");
   Vector3 * v3 = (Vector3 *)luax_newobject(L, "Vector3", sizeof(Vector3));
   *v3 = Vector3Add(*v1, *v2);
   return 1;
 }
 
 int lua_class_vector3__Sub(lua_State *L){
-  Vector3 * v1 = (Vector3 *)luaL_checkudata(L, 1, "Vector3");
-  Vector3 * v2 = (Vector3 *)luaL_checkudata(L, 2, "Vector3");
+  Vector3 * v1 = (Vector3 *)luax_checkclass(L, 1, "Vector3");
+  Vector3 * v2 = (Vector3 *)luax_checkclass(L, 2, "Vector3");
   Vector3 * v3 = (Vector3 *)luax_newobject(L, "Vector3", sizeof(Vector3));
   *v3 = Vector3Subtract(*v1, *v2);
   return 1;
 }
 
 int lua_class_vector3__Mul(lua_State *L){
-  Vector3 * v1 = (Vector3 *)luaL_checkudata(L, 1, "Vector3");
+  Vector3 * v1 = (Vector3 *)luax_checkclass(L, 1, "Vector3");
   Vector3 * v3 = (Vector3 *)luax_newobject(L, "Vector3", sizeof(Vector3));
   if ( lua_isnumber(L, 2) ){
     *v3 = Vector3Scale(*v1, luaL_checknumber(L, 2));
     return 1;
   }
-  Vector3 * v2 = (Vector3 *)luaL_checkudata(L, 2, "Vector3");
+  Vector3 * v2 = (Vector3 *)luax_checkclass(L, 2, "Vector3");
   *v3 = Vector3Multiply(*v1, *v2);
   return 1;
 }
 
 int lua_class_vector3__Div(lua_State *L){
-  Vector3 * v1 = (Vector3 *)luaL_checkudata(L, 1, "Vector3");
+  Vector3 * v1 = (Vector3 *)luax_checkclass(L, 1, "Vector3");
   Vector3 * v3 = (Vector3 *)luax_newobject(L, "Vector3", sizeof(Vector3));
   if ( lua_isnumber(L, 2) ){
     *v3 = Vector3Divide(*v1, luaL_checknumber(L, 2));
     return 1;
   }
-  Vector3 * v2 = (Vector3 *)luaL_checkudata(L, 2, "Vector3");
+  Vector3 * v2 = (Vector3 *)luax_checkclass(L, 2, "Vector3");
   *v3 = Vector3DivideV(*v1, *v2);
   return 1;
 }
 
 int lua_class_vector3__Pow(lua_State *L){
-  Vector3 * v1 = (Vector3 *)luaL_checkudata(L, 1, "Vector3");
+  Vector3 * v1 = (Vector3 *)luax_checkclass(L, 1, "Vector3");
   Vector3 * v3 = (Vector3 *)luax_newobject(L, "Vector3", sizeof(Vector3));
   if ( lua_isnumber(L, 2) ){
     float n = luaL_checknumber(L, 2);
@@ -1174,7 +1589,7 @@ int lua_class_vector3__Pow(lua_State *L){
     v3->z = pow(v3->z, n);
     return 1;
   }
-  Vector3 * v2 = (Vector3 *)luaL_checkudata(L, 2, "Vector3");
+  Vector3 * v2 = (Vector3 *)luax_checkclass(L, 2, "Vector3");
   v3->x = pow(v3->x, v2->x);
   v3->y = pow(v3->y, v2->y);
   v3->z = pow(v3->z, v2->z);
@@ -1183,21 +1598,21 @@ int lua_class_vector3__Pow(lua_State *L){
 }
 
 int lua_class_vector3__Neg(lua_State *L){
-  Vector3 * v1 = (Vector3 *)luaL_checkudata(L, 1, "Vector3");
+  Vector3 * v1 = (Vector3 *)luax_checkclass(L, 1, "Vector3");
   Vector3 * v2 = (Vector3 *)luax_newobject(L, "Vector3", sizeof(Vector3));
   *v2 = Vector3Negate(*v1);
   return 1;
 }
 
 int lua_class_vector3__Eq(lua_State *L){
-  Vector3 * v1 = (Vector3 *)luaL_checkudata(L, 1, "Vector3");
-  Vector3 * v2 = (Vector3 *)luaL_checkudata(L, 2, "Vector3");
+  Vector3 * v1 = (Vector3 *)luax_checkclass(L, 1, "Vector3");
+  Vector3 * v2 = (Vector3 *)luax_checkclass(L, 2, "Vector3");
   lua_pushboolean(L, (v1->x == v2->x) && (v1->y == v2->y) && (v1->z == v2->z) );
   return 1;
 }
 
 int lua_class_vector3__ToString(lua_State *L){
-  Vector3 * v = (Vector3 *)luaL_checkudata(L, 1, "Vector3");
+  Vector3 * v = (Vector3 *)luax_checkclass(L, 1, "Vector3");
   lua_pushfstring(L, "Vector3[%f, %f, %f]: 0x%0.8x", v->x, v->y, v->z, v);
   return 1;
 }
@@ -1228,9 +1643,24 @@ luaL_Reg luaray_class_vector3[] = {
   {"min",                lua_class_vector3_Min},
   {"max",                lua_class_vector3_Max},
   {"barycenter",         lua_class_vector3_Barycenter},
+  // allocation-free
+  {"copy",                 lua_class_vector3_Copy},
+  {"addTo",                lua_class_vector3_AddTo},
+  {"subtractTo",           lua_class_vector3_SubtractTo},
+  {"scaleTo",              lua_class_vector3_ScaleTo},
+  {"multiplyTo",           lua_class_vector3_MultiplyTo},
+  {"divideTo",             lua_class_vector3_DivideTo},
+  {"negateTo",             lua_class_vector3_NegateTo},
+  {"normalizeTo",          lua_class_vector3_NormalizeTo},
+  {"crossProductTo",       lua_class_vector3_CrossProductTo},
+  {"perpendicularTo",      lua_class_vector3_PerpendicularTo},
+  {"transformTo",          lua_class_vector3_TransformTo},
+  {"rotateByQuaternionTo", lua_class_vector3_RotateByQuaternionTo},
+  {"lerpTo",               lua_class_vector3_LerpTo},
+  {"reflectTo",            lua_class_vector3_ReflectTo},
+  {"minTo",                lua_class_vector3_MinTo},
+  {"maxTo",                lua_class_vector3_MaxTo},
   // meta
-  {"__index",            lua_class_vector3__Index},
-  {"__newindex",         lua_class_vector3__Newindex},
   {"__add",              lua_class_vector3__Add},
   {"__sub",              lua_class_vector3__Sub},
   {"__mul",              lua_class_vector3__Mul},
@@ -1294,6 +1724,14 @@ Structure:
 | [perspective](#Matrixperspective)               | Modify matrix to perspective projection matrix (by angles in radians)
 | [ortho](#Matrixortho)                           | Modify matrix to orthographic projection matrix
 | [lookAt](#MatrixlookAt)                         | Modify matrix to look-at point by three vectors
+| **Allocation-free methods**                     | Write result of operation into the calling object, no new objects created
+| [copy](#Matrixcopy)                             | Copy fields of another matrix
+| [addTo](#MatrixaddTo)                           | Store sum of two matrices
+| [subtractTo](#MatrixsubtractTo)                 | Store subtraction of two matrices
+| [multiplyTo](#MatrixmultiplyTo)                 | Store multiplication of two matrices
+| [transposeTo](#MatrixtransposeTo)               | Store transposed matrix
+| [invertTo](#MatrixinvertTo)                     | Store inverted matrix
+| [normalizeTo](#MatrixnormalizeTo)               | Store normalized matrix
 | **Overloads**                                   | 
 | +: `NewVec3 = MatrixA + MatrixB`                | Create a new matrix that is the sum of two matrices
 | -: `NewVec3 = MatrixA - MatrixB`                | Create a new matrix that is the subtraction of two matrices
@@ -1363,7 +1801,7 @@ Matrix Matrix = Matrix:clone()
 Creates copy of matrix
 */
 int lua_class_matrix_Clone(lua_State *L){
-  Matrix * m1 = (Matrix *)luaL_checkudata(L, 1, "Matrix");
+  Matrix * m1 = (Matrix *)luax_checkclass(L, 1, "Matrix");
   Matrix * m2 = (Matrix *)luax_newobject(L, "Matrix", sizeof(Matrix));
   m1->m0  = m2->m0;  m1->m1  = m2->m1;  m1->m2  = m2->m2;  m1->m3  = m2->m3;
   m1->m4  = m2->m4;  m1->m5  = m2->m5;  m1->m6  = m2->m6;  m1->m7  = m2->m7;
@@ -1382,7 +1820,7 @@ table Table = Matrix:get('t') --> Table[m1, m2, ... m16]
 Returns matrix fields
 */
 int lua_class_matrix_Get(lua_State *L){
-  Matrix * m = (Matrix *)luaL_checkudata(L, 1, "Matrix");
+  Matrix * m = (Matrix *)luax_checkclass(L, 1, "Matrix");
   if (luax_optstring(L, 2, "\0")[0] == 't'){
     lua_newtable(L);
     luax_tnnumber(L,  1, (float)m->m0);
@@ -1432,7 +1870,7 @@ Matrix:set(table Table) -- Table[m1, m2, ... m16]
 Assing values to matrix
 */
 int lua_class_matrix_Set(lua_State *L){
-  Matrix * m = (Matrix *)luaL_checkudata(L, 1, "Matrix");
+  Matrix * m = (Matrix *)luax_checkclass(L, 1, "Matrix");
   _ptr_matrix_Fill(L, m, 2);
   lua_settop(L, 1);
   return 1;
@@ -1462,7 +1900,7 @@ float _ptr_matrix_Determinant(Matrix * m){
 }
 
 int lua_class_matrix_Determinant(lua_State *L){
-  Matrix * m = (Matrix *)luaL_checkudata(L, 1, "Matrix");
+  Matrix * m = (Matrix *)luax_checkclass(L, 1, "Matrix");
   float result = _ptr_matrix_Determinant(m);
   lua_pushnumber(L, result);
   return 1;
@@ -1480,7 +1918,7 @@ float _ptr_matrix_Trace(Matrix * m){
 }
 
 int lua_class_matrix_Trace(lua_State *L){
-  Matrix * m = (Matrix *)luaL_checkudata(L, 1, "Matrix");
+  Matrix * m = (Matrix *)luax_checkclass(L, 1, "Matrix");
   float result = _ptr_matrix_Trace(m);
   lua_pushnumber(L, result);
   return 1;
@@ -1494,7 +1932,7 @@ Matrix:transpose()
 Transposes provided matrix (modifying it)
 */
 int lua_class_matrix_Transpose(lua_State *L){
-  Matrix * m = (Matrix *)luaL_checkudata(L, 1, "Matrix");
+  Matrix * m = (Matrix *)luax_checkclass(L, 1, "Matrix");
   float m1  = m->m1,  m2  = m->m2,  m3  = m->m3;
   float m4  = m->m4,  m6  = m->m6,  m7  = m->m7;
   float m8  = m->m8,  m9  = m->m9,  m11 = m->m11;
@@ -1557,7 +1995,7 @@ Matrix * _ptr_matrix_Invert(Matrix * m){
 }
 
 int lua_class_matrix_Invert(lua_State *L){
-  Matrix * m = (Matrix *)luaL_checkudata(L, 1, "Matrix");
+  Matrix * m = (Matrix *)luax_checkclass(L, 1, "Matrix");
   _ptr_matrix_Invert(m);
   lua_settop(L, 1);
   return 1;
@@ -1571,7 +2009,7 @@ Matrix:normalize()
 Normalize provided matrix (modifying it)
 */
 int lua_class_matrix_Normalize(lua_State *L){
-  Matrix * m = (Matrix *)luaL_checkudata(L, 1, "Matrix");
+  Matrix * m = (Matrix *)luax_checkclass(L, 1, "Matrix");
   float det = _ptr_matrix_Determinant(m);
 
   m->m0  /= det; m->m1  /= det; m->m2  /= det; m->m3  /= det;
@@ -1599,7 +2037,7 @@ Matrix * _ptr_matrix_Identity(Matrix * m){
 }
 
 int lua_class_matrix_Identity(lua_State *L){
-  Matrix * m = (Matrix *)luaL_checkudata(L, 1, "Matrix");
+  Matrix * m = (Matrix *)luax_checkclass(L, 1, "Matrix");
   _ptr_matrix_Identity(m);
   lua_settop(L, 1);
   return 1;
@@ -1613,8 +2051,8 @@ Matrix:add(Matrix Matrix)
 Add matrix to matrix (modifying it)
 */
 int lua_class_matrix_Add(lua_State *L){
-  Matrix * m1 = (Matrix *)luaL_checkudata(L, 1, "Matrix");
-  Matrix * m2 = (Matrix *)luaL_checkudata(L, 2, "Matrix");
+  Matrix * m1 = (Matrix *)luax_checkclass(L, 1, "Matrix");
+  Matrix * m2 = (Matrix *)luax_checkclass(L, 2, "Matrix");
 
   m1->m0  = m1->m0  + m2->m0;
   m1->m1  = m1->m1  + m2->m1;
@@ -1645,8 +2083,8 @@ Matrix:subtract(Matrix Matrix)
 Subtract matrix from matrix (modifying it)
 */
 int lua_class_matrix_Subtract(lua_State *L){
-  Matrix * m1 = (Matrix *)luaL_checkudata(L, 1, "Matrix");
-  Matrix * m2 = (Matrix *)luaL_checkudata(L, 2, "Matrix");
+  Matrix * m1 = (Matrix *)luax_checkclass(L, 1, "Matrix");
+  Matrix * m2 = (Matrix *)luax_checkclass(L, 2, "Matrix");
 
   m1->m0  = m1->m0  - m2->m0;
   m1->m1  = m1->m1  - m2->m1;
@@ -1680,7 +2118,7 @@ Matrix:translate(Vector3 Vector)
 Modify matrix to translation by given vector matrix
 */
 int lua_class_matrix_Translate(lua_State *L){
-  Matrix * m = (Matrix *)luaL_checkudata(L, 1, "Matrix");
+  Matrix * m = (Matrix *)luax_checkclass(L, 1, "Matrix");
   float x, y, z;
   if (lua_istable(L, 2)){
     lua_rawgeti(L, 2, 1); lua_rawgeti(L, 2, 2); lua_rawgeti(L, 2, 3);
@@ -1694,7 +2132,7 @@ int lua_class_matrix_Translate(lua_State *L){
     z = luaL_checknumber(L, 4);
   }
   else {
-    Vector3 * v = (Vector3 *)luaL_checkudata(L, 2, "Vector3");
+    Vector3 * v = (Vector3 *)luax_checkclass(L, 2, "Vector3");
     x = v->x; y = v->y; z = v->z;
   }
   _ptr_matrix_Identity(m);
@@ -1711,8 +2149,8 @@ Matrix:rotate(Vector3 Vector, number Angle)
 Modify matrix to rotation matrix from axis and angle (radians)
 */
 int lua_class_matrix_Rotate(lua_State *L){
-  Matrix  * m =  (Matrix *)luaL_checkudata(L, 1, "Matrix");
-  Vector3 * v = (Vector3 *)luaL_checkudata(L, 2, "Vector3");
+  Matrix  * m =  (Matrix *)luax_checkclass(L, 1, "Matrix");
+  Vector3 * v = (Vector3 *)luax_checkclass(L, 2, "Vector3");
   float a = luaL_checknumber(L, 3); // angle
   float x = v->x, y = v->y, z = v->z;
   float l = sqrtf(x*x + y*y + z*z);
@@ -1741,8 +2179,8 @@ Matrix:rotateXYZ(Vector3 Vector)
 Rotate matrix to given Vector3 (angles in radians)
 */
 int lua_class_matrix_RotateXYZ(lua_State *L){
-  Matrix  * m =  (Matrix *)luaL_checkudata(L, 1, "Matrix");
-  Vector3 * v = (Vector3 *)luaL_checkudata(L, 2, "Vector3");
+  Matrix  * m =  (Matrix *)luax_checkclass(L, 1, "Matrix");
+  Vector3 * v = (Vector3 *)luax_checkclass(L, 2, "Vector3");
   _ptr_matrix_Identity(m);
 
   float cosz = cosf(-v->z), sinz = sinf(-v->z);
@@ -1773,7 +2211,7 @@ Matrix:rotateX(number Angle)
 Rotate matrix to given angle along X-axis. (angle in radians)
 */
 int lua_class_matrix_RotateX(lua_State *L){
-  Matrix  * m =  (Matrix *)luaL_checkudata(L, 1, "Matrix");
+  Matrix  * m =  (Matrix *)luax_checkclass(L, 1, "Matrix");
   float angle = luaL_checknumber(L, 2);
 
   _ptr_matrix_Identity(m);
@@ -1797,7 +2235,7 @@ Matrix:rotateY(number Angle)
 Rotate matrix to given angle along Y-axis. (angle in radians)
 */
 int lua_class_matrix_RotateY(lua_State *L){
-  Matrix  * m =  (Matrix *)luaL_checkudata(L, 1, "Matrix");
+  Matrix  * m =  (Matrix *)luax_checkclass(L, 1, "Matrix");
   float angle = luaL_checknumber(L, 2);
 
   _ptr_matrix_Identity(m);
@@ -1821,7 +2259,7 @@ Matrix:rotateZ(number Angle)
 Rotate matrix to given angle along Z-axis. (angle in radians)
 */
 int lua_class_matrix_RotateZ(lua_State *L){
-  Matrix  * m =  (Matrix *)luaL_checkudata(L, 1, "Matrix");
+  Matrix  * m =  (Matrix *)luax_checkclass(L, 1, "Matrix");
   float angle = luaL_checknumber(L, 2);
   _ptr_matrix_Identity(m);
   float cosres = cosf(angle);
@@ -1848,7 +2286,7 @@ Matrix:scale(Vector3 Vector)
 Scale matrix by given vector
 */
 int lua_class_matrix_Scale(lua_State *L){
-  Matrix * m = (Matrix *)luaL_checkudata(L, 1, "Matrix");
+  Matrix * m = (Matrix *)luax_checkclass(L, 1, "Matrix");
   float x, y, z;
   if (lua_istable(L, 2)){
     lua_rawgeti(L, 2, 1); lua_rawgeti(L, 2, 2); lua_rawgeti(L, 2, 3);
@@ -1862,7 +2300,7 @@ int lua_class_matrix_Scale(lua_State *L){
     z = luaL_checknumber(L, 4);
   }
   else {
-    Vector3 * v = (Vector3 *)luaL_checkudata(L, 2, "Vector3");
+    Vector3 * v = (Vector3 *)luax_checkclass(L, 2, "Vector3");
     x = v->x; y = v->y; z = v->z;
   }
 
@@ -1882,8 +2320,8 @@ Matrix:multiply(Matrix Matrix)
 Multiply matrix to another (modifying it)
 */
 int lua_class_matrix_Multiply(lua_State *L){
-  Matrix * m1 = (Matrix *)luaL_checkudata(L, 1, "Matrix");
-  Matrix * m2 = (Matrix *)luaL_checkudata(L, 2, "Matrix");
+  Matrix * m1 = (Matrix *)luax_checkclass(L, 1, "Matrix");
+  Matrix * m2 = (Matrix *)luax_checkclass(L, 2, "Matrix");
   Matrix m3 = {0};
 
   m3.m0  = m1->m0*m2->m0  + m1->m1*m2->m4  + m1->m2*m2->m8   + m1->m3*m2->m12;
@@ -1933,7 +2371,7 @@ Matrix * _ptr_matrix_Frustrum(Matrix * m, double left, double right, double bott
 }
 
 int lua_class_matrix_Frustum(lua_State *L){
-  Matrix * m = (Matrix *)luaL_checkudata(L, 1, "Matrix");
+  Matrix * m = (Matrix *)luax_checkclass(L, 1, "Matrix");
   double left   = luaL_checknumber(L, 2);
   double right  = luaL_checknumber(L, 3);
   double bottom = luaL_checknumber(L, 4);
@@ -1954,7 +2392,7 @@ Matrix:perspective(number FovY, number Aspect, number Near, numner Far, number T
 Modify matrix to perspective projection matrix (by angles in radians)
 */
 int lua_class_matrix_Perspective(lua_State *L){
-  Matrix * m = (Matrix *)luaL_checkudata(L, 1, "Matrix");
+  Matrix * m = (Matrix *)luax_checkclass(L, 1, "Matrix");
   double fovy   = luaL_checknumber(L, 2);
   double aspect = luaL_checknumber(L, 3);
   double near   = luaL_checknumber(L, 4);
@@ -1976,7 +2414,7 @@ Matrix:ortho(number Left, number Right, number Bottom, numner Top, number Near,
 Modify matrix to orthographic projection matrix
 */
 int lua_class_matrix_Ortho(lua_State *L){
-  Matrix * m = (Matrix *)luaL_checkudata(L, 1, "Matrix");
+  Matrix * m = (Matrix *)luax_checkclass(L, 1, "Matrix");
   double left   = luaL_checknumber(L, 2);
   double right  = luaL_checknumber(L, 3);
   double bottom = luaL_checknumber(L, 4);
@@ -2017,10 +2455,10 @@ Matrix:lookAt(Vector3 Eye, Vector3 Target, Vector3 Up)
 Modify matrix to look-at point by three vectors
 */
 int lua_class_matrix_LookAt(lua_State *L){
-  Matrix  * m  =  (Matrix *)luaL_checkudata(L, 1, "Matrix");
-  Vector3 * eye    = (Vector3 *)luaL_checkudata(L, 2, "Vector3");
-  Vector3 * target = (Vector3 *)luaL_checkudata(L, 3, "Vector3");
-  Vector3 * up     = (Vector3 *)luaL_checkudata(L, 4, "Vector3");
+  Matrix  * m  =  (Matrix *)luax_checkclass(L, 1, "Matrix");
+  Vector3 * eye    = (Vector3 *)luax_checkclass(L, 2, "Vector3");
+  Vector3 * target = (Vector3 *)luax_checkclass(L, 3, "Vector3");
+  Vector3 * up     = (Vector3 *)luax_checkclass(L, 4, "Vector3");
 
   Vector3 z = Vector3Subtract(*eye, *target);
   _ptr_vector3_Normalize(&z);
@@ -2040,85 +2478,170 @@ int lua_class_matrix_LookAt(lua_State *L){
 }
 
 
-int lua_class_matrix__Index(lua_State *L){
-  if (!luax_type(L, 2, LUA_TSTRING)) return 0;
-  Matrix *     m   = (Matrix *)luaL_checkudata(L, 1, "Matrix");
-  const char * key = luaL_checkstring(L, 2);
+/*!MD
+### Allocation-free methods
+Like overloads, but writes result into the calling matrix (it can be one of the arguments too) and returns it, no new objects created.
+```lua
+local mvp = rl.Matrix()
+mvp:multiplyTo(model, view):multiplyTo(mvp, projection)
+```
 
-  lua_class_GetFieldIfCompared(L, m, key, "m1",  m0);
-  lua_class_GetFieldIfCompared(L, m, key, "m2",  m1);
-  lua_class_GetFieldIfCompared(L, m, key, "m3",  m2);
-  lua_class_GetFieldIfCompared(L, m, key, "m4",  m3);
-  lua_class_GetFieldIfCompared(L, m, key, "m5",  m4);
-  lua_class_GetFieldIfCompared(L, m, key, "m6",  m5);
-  lua_class_GetFieldIfCompared(L, m, key, "m7",  m6);
-  lua_class_GetFieldIfCompared(L, m, key, "m8",  m7);
-  lua_class_GetFieldIfCompared(L, m, key, "m9",  m8);
-  lua_class_GetFieldIfCompared(L, m, key, "m10", m9);
-  lua_class_GetFieldIfCompared(L, m, key, "m11", m10);
-  lua_class_GetFieldIfCompared(L, m, key, "m12", m11);
-  lua_class_GetFieldIfCompared(L, m, key, "m13", m12);
-  lua_class_GetFieldIfCompared(L, m, key, "m14", m13);
-  lua_class_GetFieldIfCompared(L, m, key, "m15", m14);
-  lua_class_GetFieldIfCompared(L, m, key, "m16", m15);
-  
-  luax_getclasskey(L, 1, 2);
+#### Matrix:copy
+```lua
+Matrix Out = Matrix:copy(Matrix Src)
+```
+Copy fields of another matrix
+*/
+int lua_class_matrix_Copy(lua_State *L){
+  Matrix  * out = (Matrix *)luax_checkclass(L, 1, "Matrix");
+  Matrix  * m   = (Matrix *)luax_checkclass(L, 2, "Matrix");
+  *out = *m;
+  lua_settop(L, 1);
   return 1;
 }
 
-int lua_class_matrix__Newindex(lua_State *L){
-  if (!luax_type(L, 2, LUA_TSTRING)) return 0;
-  Matrix *     m     = (Matrix *)luaL_checkudata(L, 1, "Matrix");
-  const char * key   = luaL_checkstring(L, 2);
-  float        value = luaL_checknumber(L, 3);
-  lua_class_SetFieldIfCompared(L, m, key, value, "m1",  m0);
-  lua_class_SetFieldIfCompared(L, m, key, value, "m2",  m1);
-  lua_class_SetFieldIfCompared(L, m, key, value, "m3",  m2);
-  lua_class_SetFieldIfCompared(L, m, key, value, "m4",  m3);
-  lua_class_SetFieldIfCompared(L, m, key, value, "m5",  m4);
-  lua_class_SetFieldIfCompared(L, m, key, value, "m6",  m5);
-  lua_class_SetFieldIfCompared(L, m, key, value, "m7",  m6);
-  lua_class_SetFieldIfCompared(L, m, key, value, "m8",  m7);
-  lua_class_SetFieldIfCompared(L, m, key, value, "m9",  m8);
-  lua_class_SetFieldIfCompared(L, m, key, value, "m10", m9);
-  lua_class_SetFieldIfCompared(L, m, key, value, "m11", m10);
-  lua_class_SetFieldIfCompared(L, m, key, value, "m12", m11);
-  lua_class_SetFieldIfCompared(L, m, key, value, "m13", m12);
-  lua_class_SetFieldIfCompared(L, m, key, value, "m14", m13);
-  lua_class_SetFieldIfCompared(L, m, key, value, "m15", m14);
-  lua_class_SetFieldIfCompared(L, m, key, value, "m16", m15);
-  return 0;
-}
-
-int lua_class_matrix__Add(lua_State *L){
-  Matrix * m1 = (Matrix *)luaL_checkudata(L, 1, "Matrix");
-  Matrix * m2 = (Matrix *)luaL_checkudata(L, 2, "Matrix");
-  Matrix * m3 = (Matrix *)luax_newobject(L, "Matrix", sizeof(Matrix));
-  *m3 = MatrixAdd(*m1, *m2);
+/*!MD
+#### Matrix:addTo
+```lua
+Matrix Out = Matrix:addTo(Matrix A, Matrix B)
+```
+Store sum of two matrices (Out = A + B)
+*/
+int lua_class_matrix_AddTo(lua_State *L){
+  Matrix  * out = (Matrix *)luax_checkclass(L, 1, "Matrix");
+  Matrix  * m1  = (Matrix *)luax_checkclass(L, 2, "Matrix");
+  Matrix  * m2  = (Matrix *)luax_checkclass(L, 3, "Matrix");
+  *out = MatrixAdd(*m1, *m2);
+  lua_settop(L, 1);
   return 1;
 }
 
-int lua_class_matrix__Sub(lua_State *L){
-  Matrix * m1 = (Matrix *)luaL_checkudata(L, 1, "Matrix");
-  Matrix * m2 = (Matrix *)luaL_checkudata(L, 2, "Matrix");
-  Matrix * m3 = (Matrix *)luax_newobject(L, "Matrix", sizeof(Matrix));
-  *m3 = MatrixSubtract(*m1, *m2);
+/*!MD
+#### Matrix:subtractTo
+```lua
+Matrix Out = Matrix:subtractTo(Matrix A, Matrix B)
+```
+Store subtraction of two matrices (Out = A - B)
+*/
+int lua_class_matrix_SubtractTo(lua_State *L){
+  Matrix  * out = (Matrix *)luax_checkclass(L, 1, "Matrix");
+  Matrix  * m1  = (Matrix *)luax_checkclass(L, 2, "Matrix");
+  Matrix  * m2  = (Matrix *)luax_checkclass(L, 3, "Matrix");
+  *out = MatrixSubtract(*m1, *m2);
+  lua_settop(L, 1);
   return 1;
 }
 
-int lua_class_matrix__Mul(lua_State *L){
-  Matrix * m1 = (Matrix *)luaL_checkudata(L, 1, "Matrix");
-  Matrix * m2 = (Matrix *)luaL_checkudata(L, 2, "Matrix");
-  Matrix * m3 = (Matrix *)luax_newobject(L, "Matrix", sizeof(Matrix));
-  *m3 = MatrixMultiply(*m1, *m2);
+/*!MD
+#### Matrix:multiplyTo
+```lua
+Matrix Out = Matrix:multiplyTo(Matrix A, Matrix B)
+```
+Store multiplication of two matrices (Out = A * B)
+*/
+int lua_class_matrix_MultiplyTo(lua_State *L){
+  Matrix  * out = (Matrix *)luax_checkclass(L, 1, "Matrix");
+  Matrix  * m1  = (Matrix *)luax_checkclass(L, 2, "Matrix");
+  Matrix  * m2  = (Matrix *)luax_checkclass(L, 3, "Matrix");
+  *out = MatrixMultiply(*m1, *m2);
+  lua_settop(L, 1);
   return 1;
 }
 
-int lua_class_matrix__Eq(lua_State *L){
-  Matrix * m1 = (Matrix *)luaL_checkudata(L, 1, "Matrix");
-  Matrix * m2 = (Matrix *)luaL_checkudata(L, 2, "Matrix");
-
-  bool eq = (m1->m0  == m2->m0 ) && (m1->m1  == m2->m1 ) &&
+/*!MD
+#### Matrix:transposeTo
+```lua
+Matrix Out = Matrix:transposeTo(Matrix A)
+```
+Store transposed matrix
+*/
+int lua_class_matrix_TransposeTo(lua_State *L){
+  Matrix  * out = (Matrix *)luax_checkclass(L, 1, "Matrix");
+  Matrix  * m   = (Matrix *)luax_checkclass(L, 2, "Matrix");
+  *out = MatrixTranspose(*m);
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Matrix:invertTo
+```lua
+Matrix Out = Matrix:invertTo(Matrix A)
+```
+Store inverted matrix
+*/
+int lua_class_matrix_InvertTo(lua_State *L){
+  Matrix  * out = (Matrix *)luax_checkclass(L, 1, "Matrix");
+  Matrix  * m   = (Matrix *)luax_checkclass(L, 2, "Matrix");
+  *out = MatrixInvert(*m);
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Matrix:normalizeTo
+```lua
+Matrix Out = Matrix:normalizeTo(Matrix A)
+```
+Store normalized matrix
+*/
+int lua_class_matrix_NormalizeTo(lua_State *L){
+  Matrix  * out = (Matrix *)luax_checkclass(L, 1, "Matrix");
+  Matrix  * m   = (Matrix *)luax_checkclass(L, 2, "Matrix");
+  *out = MatrixNormalize(*m);
+  lua_settop(L, 1);
+  return 1;
+}
+
+luax_Field luaray_fields_matrix[] = {
+  luax_field(Matrix, "m1",  m0,  LUAX_FIELD_FLOAT),
+  luax_field(Matrix, "m2",  m1,  LUAX_FIELD_FLOAT),
+  luax_field(Matrix, "m3",  m2,  LUAX_FIELD_FLOAT),
+  luax_field(Matrix, "m4",  m3,  LUAX_FIELD_FLOAT),
+  luax_field(Matrix, "m5",  m4,  LUAX_FIELD_FLOAT),
+  luax_field(Matrix, "m6",  m5,  LUAX_FIELD_FLOAT),
+  luax_field(Matrix, "m7",  m6,  LUAX_FIELD_FLOAT),
+  luax_field(Matrix, "m8",  m7,  LUAX_FIELD_FLOAT),
+  luax_field(Matrix, "m9",  m8,  LUAX_FIELD_FLOAT),
+  luax_field(Matrix, "m10", m9,  LUAX_FIELD_FLOAT),
+  luax_field(Matrix, "m11", m10, LUAX_FIELD_FLOAT),
+  luax_field(Matrix, "m12", m11, LUAX_FIELD_FLOAT),
+  luax_field(Matrix, "m13", m12, LUAX_FIELD_FLOAT),
+  luax_field(Matrix, "m14", m13, LUAX_FIELD_FLOAT),
+  luax_field(Matrix, "m15", m14, LUAX_FIELD_FLOAT),
+  luax_field(Matrix, "m16", m15, LUAX_FIELD_FLOAT),
+  {NULL}
+};
+
+int lua_class_matrix__Add(lua_State *L){
+  Matrix * m1 = (Matrix *)luax_checkclass(L, 1, "Matrix");
+  Matrix * m2 = (Matrix *)luax_checkclass(L, 2, "Matrix");
+  Matrix * m3 = (Matrix *)luax_newobject(L, "Matrix", sizeof(Matrix));
+  *m3 = MatrixAdd(*m1, *m2);
+  return 1;
+}
+
+int lua_class_matrix__Sub(lua_State *L){
+  Matrix * m1 = (Matrix *)luax_checkclass(L, 1, "Matrix");
+  Matrix * m2 = (Matrix *)luax_checkclass(L, 2, "Matrix");
+  Matrix * m3 = (Matrix *)luax_newobject(L, "Matrix", sizeof(Matrix));
+  *m3 = MatrixSubtract(*m1, *m2);
+  return 1;
+}
+
+int lua_class_matrix__Mul(lua_State *L){
+  Matrix * m1 = (Matrix *)luax_checkclass(L, 1, "Matrix");
+  Matrix * m2 = (Matrix *)luax_checkclass(L, 2, "Matrix");
+  Matrix * m3 = (Matrix *)luax_newobject(L, "Matrix", sizeof(Matrix));
+  *m3 = MatrixMultiply(*m1, *m2);
+  return 1;
+}
+
+int lua_class_matrix__Eq(lua_State *L){
+  Matrix * m1 = (Matrix *)luax_checkclass(L, 1, "Matrix");
+  Matrix * m2 = (Matrix *)luax_checkclass(L, 2, "Matrix");
+
+  bool eq = (m1->m0  == m2->m0 ) && (m1->m1  == m2->m1 ) &&
             (m1->m2  == m2->m2 ) && (m1->m3  == m2->m3 ) &&
             (m1->m4  == m2->m4 ) && (m1->m5  == m2->m5 ) &&
             (m1->m6  == m2->m6 ) && (m1->m7  == m2->m7 ) &&
@@ -2131,7 +2654,7 @@ int lua_class_matrix__Eq(lua_State *L){
 }
 
 int lua_class_matrix__ToString(lua_State *L){
-  Matrix * m = (Matrix *)luaL_checkudata(L, 1, "Matrix");
+  Matrix * m = (Matrix *)luax_checkclass(L, 1, "Matrix");
   lua_pushfstring(L, "Matrix[[%f, %f, %f, %f], [%f, %f, %f, %f], [%f, %f, %f, %f], [%f, %f, %f, %f]]: 0x%0.8x",
     m->m0,  m->m1,  m->m2,  m->m3,
     m->m4,  m->m5,  m->m6,  m->m7,
@@ -2166,6 +2689,14 @@ luaL_Reg luaray_class_matrix[] = {
   {"ortho",       lua_class_matrix_Ortho},
   {"lookAt",      lua_class_matrix_LookAt},
   {"toFloatV",    lua_class_matrix_Get},
+  // allocation-free
+  {"copy",        lua_class_matrix_Copy},
+  {"addTo",       lua_class_matrix_AddTo},
+  {"subtractTo",  lua_class_matrix_SubtractTo},
+  {"multiplyTo",  lua_class_matrix_MultiplyTo},
+  {"transposeTo", lua_class_matrix_TransposeTo},
+  {"invertTo",    lua_class_matrix_InvertTo},
+  {"normalizeTo", lua_class_matrix_NormalizeTo},
   // meta
   {"__add",       lua_class_matrix__Add},
   {"__sub",       lua_class_matrix__Sub},
@@ -2213,6 +2744,18 @@ Structure:
 | [qFromEuler](#Vector4qFromEuler)                       | Set vector components to a quaternion equivalent of Euler angles
 | [qToEuler](#Vector4qToEuler)                           | Return the Euler angles equivalent to quaternion (roll, pitch, yaw)
 | [qTransform](#Vector4qTransform)                       | Transform a quaternion given a transformation matrix
+| **Allocation-free methods**                            | Write result of operation into the calling object, no new objects created
+| [copy](#Vector4copy)                                   | Copy components of another vector
+| [addTo](#Vector4addTo)                                 | Store sum of two vectors
+| [subtractTo](#Vector4subtractTo)                       | Store subtraction of two vectors
+| [scaleTo](#Vector4scaleTo)                             | Store vector multiplied by scalar
+| [normalizeTo](#Vector4normalizeTo)                     | Store normalized quaternion
+| [qInvertTo](#Vector4qInvertTo)                         | Store inverted quaternion
+| [qMultiplyTo](#Vector4qMultiplyTo)                     | Store multiplication of two quaternions
+| [qLerpTo](#Vector4qLerpTo)                             | Store linear interpolation between two quaternions
+| [qNlerpTo](#Vector4qNlerpTo)                           | Store normalized linear interpolation between two quaternions
+| [qSlerpTo](#Vector4qSlerpTo)                           | Store spherical interpolation between two quaternions
+| [qTransformTo](#Vector4qTransformTo)                   | Store quaternion transformed by a given matrix
 | **Overloads**                                          | Note: In the mul/div methods with numbers, the vector should be in FIRST place, `NewVec4 = Vec4 * 5` is ok `NewVec4 = 5 * Vec4` raises error
 | +: `NewVec4 = Vec4A + Vec4B`                           | Create a new vector that is the sum of two vectors
 | -: `NewVec4 = Vec4A - Vec4B`                           | Create a new vector that is the subtraction of two vectors
@@ -2265,7 +2808,7 @@ Vector4 Vec4 = Vector4:clone()
 Creates copy of vector
 */
 int lua_class_vector4_Clone(lua_State *L){
-  Vector4 * v1 = (Vector4 *)luaL_checkudata(L, 1, "Vector4");
+  Vector4 * v1 = (Vector4 *)luax_checkclass(L, 1, "Vector4");
   Vector4 * v2 = (Vector4 *)luax_newobject(L, "Vector4", sizeof(Vector4));
   v2->x = v1->x; v2->y = v1->y; v2->z = v1->z; v2->w = v1->w;
   return 1;
@@ -2282,7 +2825,7 @@ table t = Vector4:get('t') --> {x, y, z, w}
 Get Vector4 components.
 */
 int lua_class_vector4_Get(lua_State *L){
-  Vector4 * v = (Vector4 *)luaL_checkudata(L, 1, "Vector4");
+  Vector4 * v = (Vector4 *)luax_checkclass(L, 1, "Vector4");
   if (luax_optstring(L, 2, "\0")[0] == 't'){
     lua_newtable(L);
     luax_tnnumber(L, 1, (float)v->x);
@@ -2308,7 +2851,7 @@ Vector4:set(table t) -- [x, y, z, w]
 Set Vector4 components.
 */
 int lua_class_vector4_Set(lua_State *L){
-  Vector4 * v = (Vector4 *)luaL_checkudata(L, 1, "Vector4");
+  Vector4 * v = (Vector4 *)luax_checkclass(L, 1, "Vector4");
   v->x = luax_optnumber(L, 2, v->x);
   v->y = luax_optnumber(L, 3, v->y);
   v->z = luax_optnumber(L, 4, v->z);
@@ -2326,8 +2869,8 @@ Vector4:add(Vector4 Vector)
 Add vector to vector (modifying it)
 */
 int lua_class_vector4_Add(lua_State *L){
-  Vector4 * v1 = (Vector4 *)luaL_checkudata(L, 1, "Vector4");
-  Vector4 * v2 = (Vector4 *)luaL_checkudata(L, 2, "Vector4");
+  Vector4 * v1 = (Vector4 *)luax_checkclass(L, 1, "Vector4");
+  Vector4 * v2 = (Vector4 *)luax_checkclass(L, 2, "Vector4");
   v1->x += v2->x;
   v1->y += v2->y;
   v1->z += v2->z;
@@ -2345,8 +2888,8 @@ Vector4:subtract(Vector4 Vector)
 Subtract vector from vector (modifying it)
 */
 int lua_class_vector4_Subtract(lua_State *L){
-  Vector4 * v1 = (Vector4 *)luaL_checkudata(L, 1, "Vector4");
-  Vector4 * v2 = (Vector4 *)luaL_checkudata(L, 2, "Vector4");
+  Vector4 * v1 = (Vector4 *)luax_checkclass(L, 1, "Vector4");
+  Vector4 * v2 = (Vector4 *)luax_checkclass(L, 2, "Vector4");
   v1->x -= v2->x;
   v1->y -= v2->y;
   v1->z -= v2->z;
@@ -2364,7 +2907,7 @@ Vector4:subtract(number Scale)
 Multiply each component of vector to scalar
 */
 int lua_class_vector4_Scale(lua_State *L){
-  Vector4 * v1 = (Vector4 *)luaL_checkudata(L, 1, "Vector4");
+  Vector4 * v1 = (Vector4 *)luax_checkclass(L, 1, "Vector4");
   float n = luaL_checknumber(L, 2);
   v1->x *= n;
   v1->y *= n;
@@ -2383,8 +2926,8 @@ Vector4:multiplyV(Vector4 Vector)
 Multiply vector to another vector (modifying it)
 */
 int lua_class_vector4_MultiplyV(lua_State *L){
-  Vector4 * v1 = (Vector4 *)luaL_checkudata(L, 1, "Vector4");
-  Vector4 * v2 = (Vector4 *)luaL_checkudata(L, 2, "Vector4");
+  Vector4 * v1 = (Vector4 *)luax_checkclass(L, 1, "Vector4");
+  Vector4 * v2 = (Vector4 *)luax_checkclass(L, 2, "Vector4");
   v1->x *= v2->x;
   v1->y *= v2->y;
   v1->z *= v2->z;
@@ -2404,7 +2947,7 @@ Vector4:multiply(Vector4 Vector)
 Multiply vector to scalar or another vector (modifying it)
 */
 int lua_class_vector4_Multiply(lua_State *L){
-  Vector4 * v1 = (Vector4 *)luaL_checkudata(L, 1, "Vector4");
+  Vector4 * v1 = (Vector4 *)luax_checkclass(L, 1, "Vector4");
   if (lua_isnumber(L, 2)){
     float n = luaL_checknumber(L, 2);
     v1->x *= n; v1->y *= n; v1->z *= n; v1->w *= n;
@@ -2413,7 +2956,7 @@ int lua_class_vector4_Multiply(lua_State *L){
     return 1;
   }
 
-  Vector4 * v2 = (Vector4 *)luaL_checkudata(L, 2, "Vector4");
+  Vector4 * v2 = (Vector4 *)luax_checkclass(L, 2, "Vector4");
   v1->x *= v2->x; v1->y *= v2->y; v1->z *= v2->z; v1->w *= v2->w;
 
   lua_settop(L, 1);
@@ -2428,7 +2971,7 @@ Vector4:identity()
 Set vector components to quaternion identity
 */
 int lua_class_vector4_Identity(lua_State *L){
-  Vector4 * v = (Vector4 *)luaL_checkudata(L, 1, "Vector4");
+  Vector4 * v = (Vector4 *)luax_checkclass(L, 1, "Vector4");
   v->x = 0.0;
   v->y = 0.0;
   v->z = 0.0;
@@ -2445,7 +2988,7 @@ number Length = Vector4:length()
 Returns vector scalar length
 */
 int lua_class_vector4_Length(lua_State *L){
-  Vector4 * v = (Vector4 *)luaL_checkudata(L, 1, "Vector4");
+  Vector4 * v = (Vector4 *)luax_checkclass(L, 1, "Vector4");
   float x = v->x, y = v->y, z = v->z, w = v->w;
   float result = (float)sqrt(x*x + y*y + z*z + w*w);
   lua_pushnumber(L, result);
@@ -2472,7 +3015,7 @@ Vector4 * _ptr_vector4_QuaternionNormalize(Vector4 * v){
 }
 
 int lua_class_vector4_Normalize(lua_State *L){
-  Vector4 * v = (Vector4 *)luaL_checkudata(L, 1, "Vector4");
+  Vector4 * v = (Vector4 *)luax_checkclass(L, 1, "Vector4");
   _ptr_vector4_QuaternionNormalize(v);
 
   lua_settop(L, 1);
@@ -2487,7 +3030,7 @@ Vector4:qInvert()
 Invert provided quaternion
 */
 int lua_class_vector4_QuaternionInvert(lua_State *L){
-  Vector4 * v = (Vector4 *)luaL_checkudata(L, 1, "Vector4");
+  Vector4 * v = (Vector4 *)luax_checkclass(L, 1, "Vector4");
   float l, il;
   l = QuaternionLength(*v);
   float lengthSq = l*l;
@@ -2508,8 +3051,8 @@ Vector4:qMultiply(Vector4 Vector)
 Multiply quaternion to another (modifying it)
 */
 int lua_class_vector4_QuaternionMultiply(lua_State *L){
-  Vector4 * v1 = (Vector4 *)luaL_checkudata(L, 1, "Vector4");
-  Vector4 * v2 = (Vector4 *)luaL_checkudata(L, 2, "Vector4");
+  Vector4 * v1 = (Vector4 *)luax_checkclass(L, 1, "Vector4");
+  Vector4 * v2 = (Vector4 *)luax_checkclass(L, 2, "Vector4");
   float vax = v1->x, vay = v1->y, vaz = v1->z, vaw = v1->w;
   float vbx = v2->x, vby = v2->y, vbz = v2->z, vbw = v2->w;
 
@@ -2530,8 +3073,8 @@ Vector4:qLerp(Vector4 Vector, scale Amount)
 Linear interpolate quaternion to another by given interpolant
 */
 int lua_class_vector4_QuaternionLerp(lua_State *L){
-  Vector4 * v1 = (Vector4 *)luaL_checkudata(L, 1, "Vector4");
-  Vector4 * v2 = (Vector4 *)luaL_checkudata(L, 2, "Vector4");
+  Vector4 * v1 = (Vector4 *)luax_checkclass(L, 1, "Vector4");
+  Vector4 * v2 = (Vector4 *)luax_checkclass(L, 2, "Vector4");
   float amount = luaL_checknumber(L, 3);
 
   v1->x = v1->x + amount*(v2->x - v1->x);
@@ -2566,8 +3109,8 @@ Vector4 * _ptr_vector4_QuaternionNlerp(Vector4 * v1, Vector4 * v2, float amount)
 }
 
 int lua_class_vector4_QuaternionNlerp(lua_State *L){
-  Vector4 * v1 = (Vector4 *)luaL_checkudata(L, 1, "Vector4");
-  Vector4 * v2 = (Vector4 *)luaL_checkudata(L, 2, "Vector4");
+  Vector4 * v1 = (Vector4 *)luax_checkclass(L, 1, "Vector4");
+  Vector4 * v2 = (Vector4 *)luax_checkclass(L, 2, "Vector4");
   float amount = luaL_checknumber(L, 3);
   _ptr_vector4_QuaternionNlerp(v1, v2, amount);
 
@@ -2583,8 +3126,8 @@ Vector4:qSlerp(Vector4 Vector, scale Amount)
 Spherical interpolate quaternion to another by given interpolant
 */
 int lua_class_vector4_QuaternionSlerp(lua_State *L){
-  Vector4 * v1 = (Vector4 *)luaL_checkudata(L, 1, "Vector4");
-  Vector4 * v2 = (Vector4 *)luaL_checkudata(L, 2, "Vector4");
+  Vector4 * v1 = (Vector4 *)luax_checkclass(L, 1, "Vector4");
+  Vector4 * v2 = (Vector4 *)luax_checkclass(L, 2, "Vector4");
   float amount = luaL_checknumber(L, 3);
 
   float cosHalfTheta =  v1->x*v2->x + v1->y*v2->y + v1->z*v2->z + v1->w*v2->w;
@@ -2631,9 +3174,9 @@ Vector4:qFromVector3ToVector3(Vector3 Vector1, Vector3 Vector2)
 Calculate quaternion based on the rotation from one vector to another
 */
 int lua_class_vector4_QuaternionFromVector3ToVector3(lua_State *L){
-  Vector4 * v1 = (Vector4 *)luaL_checkudata(L, 1, "Vector4");
-  Vector3 * v2 = (Vector3 *)luaL_checkudata(L, 2, "Vector3");
-  Vector3 * v3 = (Vector3 *)luaL_checkudata(L, 3, "Vector3");
+  Vector4 * v1 = (Vector4 *)luax_checkclass(L, 1, "Vector4");
+  Vector3 * v2 = (Vector3 *)luax_checkclass(L, 2, "Vector3");
+  Vector3 * v3 = (Vector3 *)luax_checkclass(L, 3, "Vector3");
 
   float cos2Theta = Vector3DotProduct(*v2, *v3);
   _ptr_vector3_CrossProduct(v2, v3);
@@ -2658,8 +3201,8 @@ Vector4:qFromMatrix(Matrix Matrix)
 Set vector components to a quaternion for a given rotation matrix
 */
 int lua_class_vector4_QuaternionFromMatrix(lua_State *L){
-  Vector4 * v = (Vector4 *)luaL_checkudata(L, 1, "Vector4");
-  Matrix  * m = (Matrix  *)luaL_checkudata(L, 2, "Matrix");
+  Vector4 * v = (Vector4 *)luax_checkclass(L, 1, "Vector4");
+  Matrix  * m = (Matrix  *)luax_checkclass(L, 2, "Matrix");
 
   float trace = MatrixTrace(*m);
 
@@ -2712,13 +3255,23 @@ int lua_class_vector4_QuaternionFromMatrix(lua_State *L){
 /*!MD
 #### Vector4:qToMatrix
 ```lua
+-- variants
 Matrix Matrix = Vector4:qToMatrix()
+Matrix Out = Vector4:qToMatrix(Matrix Out)
 ```
-Returns a matrix for a given quaternion
+Returns a matrix for a given quaternion (new one or stored to optional Out matrix).
+
+**Changed:** before allocation-free methods were added, qToMatrix returned the quaternion itself and the created
+matrix was lost. Code relying on `q:qToMatrix()` returning `q` for chaining should call it separately.
 */
 int lua_class_vector4_QuaternionToMatrix(lua_State *L){
-  Vector4 * v = (Vector4 *)luaL_checkudata(L, 1, "Vector4");
-  Matrix  * m = (Matrix *)luax_newobject(L, "Matrix", sizeof(Matrix));
+  Vector4 * v = (Vector4 *)luax_checkclass(L, 1, "Vector4");
+  Matrix  * m;
+  if (lua_isnoneornil(L, 2)) m = (Matrix *)luax_newobject(L, "Matrix", sizeof(Matrix));
+  else {
+    m = (Matrix *)luax_checkclass(L, 2, "Matrix");
+    lua_settop(L, 2);
+  }
 
   float x = v->x, y = v->y, z = v->z, w = v->w;
 
@@ -2742,7 +3295,6 @@ int lua_class_vector4_QuaternionToMatrix(lua_State *L){
   m->m8  = xz - wy;          m->m9  = yz + wx;          m->m10 = 1.0f - (xx + yy); m->m11 = 0.0f;
   m->m12 = 0.0f;             m->m13 = 0.0f;             m->m14 = 0.0f;             m->m15 = 1.0f;
 
-  lua_settop(L, 1);
   return 1;
 }
 
@@ -2754,8 +3306,8 @@ Vector4:qFromAxisAngle(Vector3 Vector, number Angle)
 Set vector components to a rotation quaternion for an angle and axis (radians)
 */
 int lua_class_vector4_QuaternionFromAxisAngle(lua_State *L){
-  Vector4 * v1 = (Vector4 *)luaL_checkudata(L, 1, "Vector4");
-  Vector3 * v2 = (Vector3 *)luaL_checkudata(L, 2, "Vector3");
+  Vector4 * v1 = (Vector4 *)luax_checkclass(L, 1, "Vector4");
+  Vector3 * v2 = (Vector3 *)luax_checkclass(L, 2, "Vector3");
   float angle  = luaL_checknumber(L, 3);
 
   if (Vector3Length(*v2) != 0.0f) angle *= 0.5f;
@@ -2777,14 +3329,22 @@ int lua_class_vector4_QuaternionFromAxisAngle(lua_State *L){
 /*!MD
 #### Vector4:qToAxisAngle
 ```lua
+-- variants
 Vector3 Vector, number Angle = Vector4:qToAxisAngle()
+Vector3 Out, number Angle = Vector4:qToAxisAngle(Vector3 Out)
 ```
-Returns the rotation angle and axis for a given quaternion
+Returns the rotation angle and axis for a given quaternion (axis is new vector or stored to optional Out vector)
 */
 int lua_class_vector4_QuaternionToAxisAngle(lua_State *L){
-  lua_settop(L, 1);
-  Vector4 * v1 = (Vector4 *)luaL_checkudata(L, 1, "Vector4");
-  Vector3 * v2 = (Vector3 *)luax_newobject(L, "Vector3", sizeof(Vector3));
+  Vector4 * v1 = (Vector4 *)luax_checkclass(L, 1, "Vector4");
+  Vector3 * v2;
+  if (lua_isnoneornil(L, 2)) {
+    lua_settop(L, 1);
+    v2 = (Vector3 *)luax_newobject(L, "Vector3", sizeof(Vector3));
+  } else {
+    v2 = (Vector3 *)luax_checkclass(L, 2, "Vector3");
+    lua_settop(L, 2);
+  }
 
   if (fabs(v1->w) > 1.0f) _ptr_vector4_QuaternionNormalize(v1);
   float resAngle = 0.0f;
@@ -2801,6 +3361,8 @@ int lua_class_vector4_QuaternionToAxisAngle(lua_State *L){
       // This occurs when the angle is zero.
       // Not a problem: just set an arbitrary normalized axis.
       v2->x = 1.0f;
+      v2->y = 0.0f;
+      v2->z = 0.0f;
   }
 
   lua_pushnumber(L, resAngle);
@@ -2815,7 +3377,7 @@ Vector4:qFromEuler(number Roll, number Pitch, number Yaw)
 Set vector components to a quaternion equivalent of Euler angles
 */
 int lua_class_vector4_QuaternionFromEuler(lua_State *L){
-  Vector4 * v = (Vector4 *)luaL_checkudata(L, 1, "Vector4");
+  Vector4 * v = (Vector4 *)luax_checkclass(L, 1, "Vector4");
   float roll  = luaL_checknumber(L, 2);
   float pitch = luaL_checknumber(L, 3);
   float yaw   = luaL_checknumber(L, 4);
@@ -2844,7 +3406,7 @@ number Roll, number Pitch, number Yaw = Vector4:qToEuler()
 Return the Euler angles equivalent to quaternion (roll, pitch, yaw)
 */
 int lua_class_vector4_QuaternionToEuler(lua_State *L){
-  Vector4 * v = (Vector4 *)luaL_checkudata(L, 1, "Vector4");
+  Vector4 * v = (Vector4 *)luax_checkclass(L, 1, "Vector4");
 
   // roll (x-axis rotation)
   float x0 = 2.0f*(v->w*v->x + v->y*v->z);
@@ -2872,8 +3434,8 @@ Vector4:qTransform(Matrix Matrix)
 Transform a quaternion given a transformation matrix
 */
 int lua_class_vector4_QuaternionTransform(lua_State *L){
-  Vector4 * v = (Vector4 *)luaL_checkudata(L, 1, "Vector4");
-  Matrix  * m = (Matrix  *)luaL_checkudata(L, 2, "Matrix");
+  Vector4 * v = (Vector4 *)luax_checkclass(L, 1, "Vector4");
+  Matrix  * m = (Matrix  *)luax_checkclass(L, 2, "Matrix");
   v->x = m->m0*v->x + m->m4*v->y + m->m8*v->z + m->m12*v->w;
   v->y = m->m1*v->x + m->m5*v->y + m->m9*v->z + m->m13*v->w;
   v->z = m->m2*v->x + m->m6*v->y + m->m10*v->z + m->m14*v->w;
@@ -2883,35 +3445,209 @@ int lua_class_vector4_QuaternionTransform(lua_State *L){
   return 1;
 }
 
-int lua_class_vector4__Index(lua_State *L){
-  if (!luax_type(L, 2, LUA_TSTRING)) return 0;
-  Vector4 *    v   = (Vector4 *)luaL_checkudata(L, 1, "Vector4");
-  const char * key = luaL_checkstring(L, 2);
+/*!MD
+### Allocation-free methods
+Like overloads, but writes result into the calling vector (it can be one of the arguments too) and returns it, no new objects created.
+```lua
+local rot, step = rl.Vector4():identity(), rl.Vector4()
+rot:qMultiplyTo(rot, step:qFromAxisAngle(axis, speed * dt))
+```
 
-  lua_class_GetFieldIfCompared(L, v, key, "x", x); // calls "return" from this function on success
-  lua_class_GetFieldIfCompared(L, v, key, "y", y);
-  lua_class_GetFieldIfCompared(L, v, key, "z", z);
-  lua_class_GetFieldIfCompared(L, v, key, "w", w);
-  
-  luax_getclasskey(L, 1, 2);
+#### Vector4:copy
+```lua
+Vector4 Out = Vector4:copy(Vector4 Src)
+```
+Copy components of another vector
+*/
+int lua_class_vector4_Copy(lua_State *L){
+  Vector4 * out = (Vector4 *)luax_checkclass(L, 1, "Vector4");
+  Vector4 * v   = (Vector4 *)luax_checkclass(L, 2, "Vector4");
+  *out = *v;
+  lua_settop(L, 1);
   return 1;
 }
 
-int lua_class_vector4__Newindex(lua_State *L){
-  if (!luax_type(L, 2, LUA_TSTRING)) return 0;
-  Vector4 *    v     = (Vector4 *)luaL_checkudata(L, 1, "Vector4");
-  const char * key   = luaL_checkstring(L, 2);
-  float        value = luaL_checknumber(L, 3);
-  lua_class_SetFieldIfCompared(L, v, key, value, "x", x);
-  lua_class_SetFieldIfCompared(L, v, key, value, "y", y);
-  lua_class_SetFieldIfCompared(L, v, key, value, "z", z);
-  lua_class_SetFieldIfCompared(L, v, key, value, "w", w);
-  return 0;
+/*!MD
+#### Vector4:addTo
+```lua
+Vector4 Out = Vector4:addTo(Vector4 A, Vector4 B)
+```
+Store sum of two vectors (Out = A + B)
+*/
+int lua_class_vector4_AddTo(lua_State *L){
+  Vector4 * out = (Vector4 *)luax_checkclass(L, 1, "Vector4");
+  Vector4 * v1  = (Vector4 *)luax_checkclass(L, 2, "Vector4");
+  Vector4 * v2  = (Vector4 *)luax_checkclass(L, 3, "Vector4");
+  out->x = v1->x + v2->x;
+  out->y = v1->y + v2->y;
+  out->z = v1->z + v2->z;
+  out->w = v1->w + v2->w;
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Vector4:subtractTo
+```lua
+Vector4 Out = Vector4:subtractTo(Vector4 A, Vector4 B)
+```
+Store subtraction of two vectors (Out = A - B)
+*/
+int lua_class_vector4_SubtractTo(lua_State *L){
+  Vector4 * out = (Vector4 *)luax_checkclass(L, 1, "Vector4");
+  Vector4 * v1  = (Vector4 *)luax_checkclass(L, 2, "Vector4");
+  Vector4 * v2  = (Vector4 *)luax_checkclass(L, 3, "Vector4");
+  out->x = v1->x - v2->x;
+  out->y = v1->y - v2->y;
+  out->z = v1->z - v2->z;
+  out->w = v1->w - v2->w;
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Vector4:scaleTo
+```lua
+Vector4 Out = Vector4:scaleTo(Vector4 A, number Scale)
+```
+Store vector multiplied by scalar (Out = A * Scale)
+*/
+int lua_class_vector4_ScaleTo(lua_State *L){
+  Vector4 * out = (Vector4 *)luax_checkclass(L, 1, "Vector4");
+  Vector4 * v   = (Vector4 *)luax_checkclass(L, 2, "Vector4");
+  float     n   = luaL_checknumber(L, 3);
+  out->x = v->x*n;
+  out->y = v->y*n;
+  out->z = v->z*n;
+  out->w = v->w*n;
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Vector4:normalizeTo
+```lua
+Vector4 Out = Vector4:normalizeTo(Vector4 A)
+```
+Store normalized quaternion
+*/
+int lua_class_vector4_NormalizeTo(lua_State *L){
+  Vector4 * out = (Vector4 *)luax_checkclass(L, 1, "Vector4");
+  Vector4 * v   = (Vector4 *)luax_checkclass(L, 2, "Vector4");
+  *out = QuaternionNormalize(*v);
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Vector4:qInvertTo
+```lua
+Vector4 Out = Vector4:qInvertTo(Vector4 A)
+```
+Store inverted quaternion
+*/
+int lua_class_vector4_QuaternionInvertTo(lua_State *L){
+  Vector4 * out = (Vector4 *)luax_checkclass(L, 1, "Vector4");
+  Vector4 * v   = (Vector4 *)luax_checkclass(L, 2, "Vector4");
+  *out = QuaternionInvert(*v);
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Vector4:qMultiplyTo
+```lua
+Vector4 Out = Vector4:qMultiplyTo(Vector4 A, Vector4 B)
+```
+Store multiplication of two quaternions (Out = A * B)
+*/
+int lua_class_vector4_QuaternionMultiplyTo(lua_State *L){
+  Vector4 * out = (Vector4 *)luax_checkclass(L, 1, "Vector4");
+  Vector4 * v1  = (Vector4 *)luax_checkclass(L, 2, "Vector4");
+  Vector4 * v2  = (Vector4 *)luax_checkclass(L, 3, "Vector4");
+  *out = QuaternionMultiply(*v1, *v2);
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Vector4:qLerpTo
+```lua
+Vector4 Out = Vector4:qLerpTo(Vector4 A, Vector4 B, number Amount)
+```
+Store linear interpolation between two quaternions
+*/
+int lua_class_vector4_QuaternionLerpTo(lua_State *L){
+  Vector4 * out = (Vector4 *)luax_checkclass(L, 1, "Vector4");
+  Vector4 * v1  = (Vector4 *)luax_checkclass(L, 2, "Vector4");
+  Vector4 * v2  = (Vector4 *)luax_checkclass(L, 3, "Vector4");
+  float     amount = luaL_checknumber(L, 4);
+  *out = QuaternionLerp(*v1, *v2, amount);
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Vector4:qNlerpTo
+```lua
+Vector4 Out = Vector4:qNlerpTo(Vector4 A, Vector4 B, number Amount)
+```
+Store normalized linear interpolation between two quaternions
+*/
+int lua_class_vector4_QuaternionNlerpTo(lua_State *L){
+  Vector4 * out = (Vector4 *)luax_checkclass(L, 1, "Vector4");
+  Vector4 * v1  = (Vector4 *)luax_checkclass(L, 2, "Vector4");
+  Vector4 * v2  = (Vector4 *)luax_checkclass(L, 3, "Vector4");
+  float     amount = luaL_checknumber(L, 4);
+  *out = QuaternionNlerp(*v1, *v2, amount);
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Vector4:qSlerpTo
+```lua
+Vector4 Out = Vector4:qSlerpTo(Vector4 A, Vector4 B, number Amount)
+```
+Store spherical interpolation between two quaternions
+*/
+int lua_class_vector4_QuaternionSlerpTo(lua_State *L){
+  Vector4 * out = (Vector4 *)luax_checkclass(L, 1, "Vector4");
+  Vector4 * v1  = (Vector4 *)luax_checkclass(L, 2, "Vector4");
+  Vector4 * v2  = (Vector4 *)luax_checkclass(L, 3, "Vector4");
+  float     amount = luaL_checknumber(L, 4);
+  *out = QuaternionSlerp(*v1, *v2, amount);
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Vector4:qTransformTo
+```lua
+Vector4 Out = Vector4:qTransformTo(Vector4 A, Matrix Matrix)
+```
+Store quaternion transformed by a given matrix
+*/
+int lua_class_vector4_QuaternionTransformTo(lua_State *L){
+  Vector4 * out = (Vector4 *)luax_checkclass(L, 1, "Vector4");
+  Vector4 * v   = (Vector4 *)luax_checkclass(L, 2, "Vector4");
+  Matrix  * m   = (Matrix  *)luax_checkclass(L, 3, "Matrix");
+  *out = QuaternionTransform(*v, *m);
+  lua_settop(L, 1);
+  return 1;
 }
 
+luax_Field luaray_fields_vector4[] = {
+  luax_field(Vector4, "x", x, LUAX_FIELD_FLOAT),
+  luax_field(Vector4, "y", y, LUAX_FIELD_FLOAT),
+  luax_field(Vector4, "z", z, LUAX_FIELD_FLOAT),
+  luax_field(Vector4, "w", w, LUAX_FIELD_FLOAT),
+  {NULL}
+};
+
 int lua_class_vector4__Add(lua_State *L){
-  Vector4 * v1 = (Vector4 *)luaL_checkudata(L, 1, "Vector4");
-  Vector4 * v2 = (Vector4 *)luaL_checkudata(L, 2, "Vector4");
+  Vector4 * v1 = (Vector4 *)luax_checkclass(L, 1, "Vector4");
+  Vector4 * v2 = (Vector4 *)luax_checkclass(L, 2, "Vector4");
   Vector4 * v3 = (Vector4 *)luax_newobject(L, "Vector4", sizeof(Vector4));
   v3->x = v1->x + v2->x;
   v3->y = v1->y + v2->y;
@@ -2921,8 +3657,8 @@ int lua_class_vector4__Add(lua_State *L){
 }
 
 int lua_class_vector4__Sub(lua_State *L){
-  Vector4 * v1 = (Vector4 *)luaL_checkudata(L, 1, "Vector4");
-  Vector4 * v2 = (Vector4 *)luaL_checkudata(L, 2, "Vector4");
+  Vector4 * v1 = (Vector4 *)luax_checkclass(L, 1, "Vector4");
+  Vector4 * v2 = (Vector4 *)luax_checkclass(L, 2, "Vector4");
   Vector4 * v3 = (Vector4 *)luax_newobject(L, "Vector4", sizeof(Vector4));
   v3->x = v1->x - v2->x;
   v3->y = v1->y - v2->y;
@@ -2932,7 +3668,7 @@ int lua_class_vector4__Sub(lua_State *L){
 }
 
 int lua_class_vector4__Mul(lua_State *L){
-  Vector4 * v1 = (Vector4 *)luaL_checkudata(L, 1, "Vector4");
+  Vector4 * v1 = (Vector4 *)luax_checkclass(L, 1, "Vector4");
   Vector4 * v3 = (Vector4 *)luax_newobject(L, "Vector4", sizeof(Vector4));
   if ( lua_isnumber(L, 2) ){
     float n = luaL_checknumber(L, 2);
@@ -2942,7 +3678,7 @@ int lua_class_vector4__Mul(lua_State *L){
     v3->w = v1->w * n;
     return 1;
   }
-  Vector4 * v2 = (Vector4 *)luaL_checkudata(L, 2, "Vector4");
+  Vector4 * v2 = (Vector4 *)luax_checkclass(L, 2, "Vector4");
   v3->x = v1->x * v2->x;
   v3->y = v1->y * v2->y;
   v3->z = v1->z * v2->z;
@@ -2951,7 +3687,7 @@ int lua_class_vector4__Mul(lua_State *L){
 }
 
 int lua_class_vector4__Div(lua_State *L){
-  Vector4 * v1 = (Vector4 *)luaL_checkudata(L, 1, "Vector4");
+  Vector4 * v1 = (Vector4 *)luax_checkclass(L, 1, "Vector4");
   Vector4 * v3 = (Vector4 *)luax_newobject(L, "Vector4", sizeof(Vector4));
   if ( lua_isnumber(L, 2) ){
     float n = luaL_checknumber(L, 2);
@@ -2961,7 +3697,7 @@ int lua_class_vector4__Div(lua_State *L){
     v3->w = v1->w / n;
     return 1;
   }
-  Vector4 * v2 = (Vector4 *)luaL_checkudata(L, 2, "Vector4");
+  Vector4 * v2 = (Vector4 *)luax_checkclass(L, 2, "Vector4");
   v3->x = v1->x / v2->x;
   v3->y = v1->y / v2->y;
   v3->z = v1->z / v2->z;
@@ -2970,7 +3706,7 @@ int lua_class_vector4__Div(lua_State *L){
 }
 
 int lua_class_vector4__Pow(lua_State *L){
-  Vector4 * v1 = (Vector4 *)luaL_checkudata(L, 1, "Vector4");
+  Vector4 * v1 = (Vector4 *)luax_checkclass(L, 1, "Vector4");
   Vector4 * v3 = (Vector4 *)luax_newobject(L, "Vector4", sizeof(Vector4));
   if ( lua_isnumber(L, 2) ){
     float n = luaL_checknumber(L, 2);
@@ -2980,7 +3716,7 @@ int lua_class_vector4__Pow(lua_State *L){
     v3->w = pow(v3->w, n);
     return 1;
   }
-  Vector4 * v2 = (Vector4 *)luaL_checkudata(L, 2, "Vector4");
+  Vector4 * v2 = (Vector4 *)luax_checkclass(L, 2, "Vector4");
   v3->x = pow(v3->x, v2->x);
   v3->y = pow(v3->y, v2->y);
   v3->z = pow(v3->z, v2->z);
@@ -2990,22 +3726,22 @@ int lua_class_vector4__Pow(lua_State *L){
 }
 
 int lua_class_vector4__Neg(lua_State *L){
-  Vector4 * v1 = (Vector4 *)luaL_checkudata(L, 1, "Vector4");
+  Vector4 * v1 = (Vector4 *)luax_checkclass(L, 1, "Vector4");
   Vector4 * v2 = (Vector4 *)luax_newobject(L, "Vector4", sizeof(Vector4));
   v2->x = -v2->x; v2->y = -v2->y; v2->z = -v2->z; v2->w = -v2->w;
   return 1;
 }
 
 int lua_class_vector4__Eq(lua_State *L){
-  Vector4 * v1 = (Vector4 *)luaL_checkudata(L, 1, "Vector4");
-  Vector4 * v2 = (Vector4 *)luaL_checkudata(L, 2, "Vector4");
+  Vector4 * v1 = (Vector4 *)luax_checkclass(L, 1, "Vector4");
+  Vector4 * v2 = (Vector4 *)luax_checkclass(L, 2, "Vector4");
 	bool eq = (v1->x == v2->x) && (v1->y == v2->y) && (v1->z == v2->z) && (v1->w == v2->w);
   lua_pushboolean(L, eq);
   return 1;
 }
 
 int lua_class_vector4__ToString(lua_State *L){
-  Vector4 * v = (Vector4 *)luaL_checkudata(L, 1, "Vector4");
+  Vector4 * v = (Vector4 *)luax_checkclass(L, 1, "Vector4");
   lua_pushfstring(L, "Vector4[%f, %f, %f, %f]: 0x%0.8x", v->x, v->y, v->z, v->w, v);
   return 1;
 }
@@ -3035,9 +3771,19 @@ luaL_Reg luaray_class_vector4[] = {
   {"qFromEuler",            lua_class_vector4_QuaternionFromEuler},
   {"qToEuler",              lua_class_vector4_QuaternionToEuler},
   {"qTransform",            lua_class_vector4_QuaternionTransform},
+  // allocation-free
+  {"copy",                  lua_class_vector4_Copy},
+  {"addTo",                 lua_class_vector4_AddTo},
+  {"subtractTo",            lua_class_vector4_SubtractTo},
+  {"scaleTo",               lua_class_vector4_ScaleTo},
+  {"normalizeTo",           lua_class_vector4_NormalizeTo},
+  {"qInvertTo",             lua_class_vector4_QuaternionInvertTo},
+  {"qMultiplyTo",           lua_class_vector4_QuaternionMultiplyTo},
+  {"qLerpTo",               lua_class_vector4_QuaternionLerpTo},
+  {"qNlerpTo",              lua_class_vector4_QuaternionNlerpTo},
+  {"qSlerpTo",              lua_class_vector4_QuaternionSlerpTo},
+  {"qTransformTo",          lua_class_vector4_QuaternionTransformTo},
   // meta
-  {"__index",               lua_class_vector4__Index},
-  {"__newindex",            lua_class_vector4__Newindex},
   {"__add",                 lua_class_vector4__Add},
   {"__sub",                 lua_class_vector4__Sub},
   {"__mul",                 lua_class_vector4__Mul},
@@ -3174,7 +3920,7 @@ Color Color = Color:clone()
 Creates copy of color
 */
 int lua_class_color_Clone(lua_State *L){
-  Color * c1 = (Color *)luaL_checkudata(L, 1, "Color");
+  Color * c1 = (Color *)luax_checkclass(L, 1, "Color");
   Color * c2 = (Color *)luax_newobject(L, "Color", sizeof(Color));
   c2->r = c1->r; c2->g = c1->g; c2->b = c1->b; c2->a = c1->a;
   return 1;
@@ -3190,7 +3936,7 @@ table t = Color:get('t') -- t[r, g, b, a]
 Return vector fields
 */
 int lua_class_color_Get(lua_State *L){
-  Color * c = (Color *)luaL_checkudata(L, 1, "Color");
+  Color * c = (Color *)luax_checkclass(L, 1, "Color");
   if (luax_optstring(L, 2, "\0")[0] == 't'){
     lua_newtable(L);
 		luax_tnnumber(L, 1, (float)c->r / 255.0f);
@@ -3216,7 +3962,7 @@ Color:set(table t) -- t[r, g, b, a]
 Assing values to color components
 */
 int lua_class_color_Set(lua_State *L){
-  Color * c = (Color *)luaL_checkudata(L, 1, "Color");
+  Color * c = (Color *)luax_checkclass(L, 1, "Color");
 	c->r = luax_optinteger(L, 2, c->r);
 	c->g = luax_optinteger(L, 3, c->g);
 	c->b = luax_optinteger(L, 4, c->b);
@@ -3234,7 +3980,7 @@ integer Color = Color:toInt()
 Return color integer representation
 */
 int lua_class_color_ToInteger(lua_State *L){
-  Color * c = (Color *)luaL_checkudata(L, 1, "Color");
+  Color * c = (Color *)luax_checkclass(L, 1, "Color");
   int ic = ColorToInt(*c);
   lua_pushnumber(L, ic);
   return 1;
@@ -3248,7 +3994,7 @@ Color:fromInt(integer Color)
 Set color components from a given integer
 */
 int lua_class_color_FromInteger(lua_State *L){
-  Color * c = (Color *)luaL_checkudata(L, 1, "Color");
+  Color * c = (Color *)luax_checkclass(L, 1, "Color");
   int hex   = luaL_checkinteger(L, 2);
   *c = GetColor(hex); lua_pop(L, 1);
 
@@ -3257,7 +4003,7 @@ int lua_class_color_FromInteger(lua_State *L){
 }
 
 int lua_class_color_ToString(lua_State *L){
-  Color * c = (Color *)luaL_checkudata(L, 1, "Color");
+  Color * c = (Color *)luax_checkclass(L, 1, "Color");
   int ic = ColorToInt(*c);
   lua_pushfstring(L, "%0.8x", ic);
   return 1;
@@ -3274,7 +4020,7 @@ table t = Color:normalize('t')
 Return normalized color components [float r/255, float g/255, float b/255, float a/255]
 */
 int lua_class_color_Normalize(lua_State *L){
-  Color *   c =   (Color *)luaL_checkudata(L, 1, "Color");
+  Color *   c =   (Color *)luax_checkclass(L, 1, "Color");
   if (lua_isstring(L, 2)){
     const char * s = luaL_checkstring(L, 2);
     if (s[0] == 'n'){ // to numbers
@@ -3309,7 +4055,7 @@ Color:fromNormalized(table t)
 Set color components from a given normalized values
 */
 int lua_class_color_FromNormalized(lua_State *L){
-  Color *   c = (Color *)luaL_checkudata(L, 1, "Color");
+  Color *   c = (Color *)luax_checkclass(L, 1, "Color");
   if (lua_isnumber(L, 2)){
     c->r = luaL_checkinteger(L, 2);
     c->g = luax_optinteger(L, 3, 0);
@@ -3329,7 +4075,7 @@ int lua_class_color_FromNormalized(lua_State *L){
     return 1;
   }
 
-  Vector4 * v = (Vector4 *)luaL_checkudata(L, 2, "Vector4");
+  Vector4 * v = (Vector4 *)luax_checkclass(L, 2, "Vector4");
   *c = ColorFromNormalized(*v); lua_pop(L, 1);
 	
   lua_settop(L, 1);
@@ -3344,7 +4090,7 @@ Vector3 HSV = Color:toHSV()
 Return Vector3 color hue, value and saturation
 */
 int lua_class_color_ToHSV(lua_State *L){
-  Color *   c = (Color *)luaL_checkudata(L, 1, "Color");
+  Color *   c = (Color *)luax_checkclass(L, 1, "Color");
   Vector3 * v = (Vector3 *)luax_newobject(L, "Vector3", sizeof(Vector3));
   *v = ColorToHSV(*c);
   return 1;
@@ -3358,8 +4104,8 @@ Color:fromHSV(Vector3 HSV)
 Set color components from a given Vector3 hue, value and saturation
 */
 int lua_class_color_FromHSV(lua_State *L){
-  Color *   c = (Color *)luaL_checkudata(L, 1, "Color");
-  Vector3 * v = (Vector3 *)luaL_checkudata(L, 2, "Vector3");
+  Color *   c = (Color *)luax_checkclass(L, 1, "Color");
+  Vector3 * v = (Vector3 *)luax_checkclass(L, 2, "Vector3");
   *c = ColorFromHSV(*v);
 	
   lua_settop(L, 1);
@@ -3374,44 +4120,25 @@ Color:fade(number Alpha)
 Color fade-in or fade-out, alpha goes from 0.0f to 1.0f
 */
 int lua_class_color_Fade(lua_State *L){
-  Color * c =   (Color *)luaL_checkudata(L, 1, "Color");
-  int alpha = luaL_checkinteger(L, 2);
+  Color * c =   (Color *)luax_checkclass(L, 1, "Color");
+  float alpha = luaL_checknumber(L, 2);
   *c = Fade(*c, alpha);
 	
   lua_settop(L, 1);
   return 1;
 }
 
-// metamethods mostly creates new objects
-int lua_class_color__Index(lua_State *L){
-  if (!luax_type(L, 2, LUA_TSTRING)) return 0;
-  Color * c        = (Color *)luaL_checkudata(L, 1, "Color");
-  const char * key = luaL_checkstring(L, 2);
-
-  lua_class_GetFieldIfCompared(L, c, key, "r", r);
-  lua_class_GetFieldIfCompared(L, c, key, "g", g);
-  lua_class_GetFieldIfCompared(L, c, key, "b", b);
-  lua_class_GetFieldIfCompared(L, c, key, "a", a);
-
-  luax_getclasskey(L, 1, 2);
-  return 1;
-}
-
-// metamethods mostly creates new objects
-int lua_class_color__Newindex(lua_State *L){
-  if (!luax_type(L, 2, LUA_TSTRING)) return 0;
-  Color * c        = (Color *)luaL_checkudata(L, 1, "Color");
-  const char * key = luaL_checkstring(L, 2);
-  int value        = luaL_checkinteger(L, 3);
-  lua_class_SetFieldIfCompared(L, c, key, value, "r", r);
-  lua_class_SetFieldIfCompared(L, c, key, value, "g", g);
-  lua_class_SetFieldIfCompared(L, c, key, value, "b", b);
-  lua_class_SetFieldIfCompared(L, c, key, value, "a", a);
-  return 0;
-}
+// fields
+luax_Field luaray_fields_color[] = {
+  luax_field(Color, "r", r, LUAX_FIELD_UCHAR),
+  luax_field(Color, "g", g, LUAX_FIELD_UCHAR),
+  luax_field(Color, "b", b, LUAX_FIELD_UCHAR),
+  luax_field(Color, "a", a, LUAX_FIELD_UCHAR),
+  {NULL}
+};
 
 int lua_class_color__ToString(lua_State *L){
-  Color * c = (Color *)luaL_checkudata(L, 1, "Color");
+  Color * c = (Color *)luax_checkclass(L, 1, "Color");
   lua_pushfstring(L, "Color[#%0.8x]: 0x%0.8x", ColorToInt(*c), c);
   return 1;
 }
@@ -3429,8 +4156,6 @@ luaL_Reg luaray_class_color[] = {
   {"fromHSV",        lua_class_color_FromHSV},
   {"fade",           lua_class_color_Fade},
   // meta
-  {"__index",        lua_class_color__Index},
-  {"__newindex",     lua_class_color__Newindex},
   {"__tostring",     lua_class_color__ToString},
   {NULL, NULL}
 };
@@ -3509,7 +4234,7 @@ Rectangle rec = Rectangle:clone()
 Create copy of rectangle
 */
 int lua_class_rectangle_Clone(lua_State *L){
-  Rectangle * r1 = (Color *)luaL_checkudata(L, 1, "Rectangle");
+  Rectangle * r1 = (Color *)luax_checkclass(L, 1, "Rectangle");
   Rectangle * r2 = (Color *)luax_newobject(L, "Rectangle", sizeof(Rectangle));
   r2->x      = r1->x;
   r2->y      = r1->y;
@@ -3528,7 +4253,7 @@ table Table = Rectangle:get('t') -- Table[x, y, width, height]
 Return vector fields
 */
 int lua_class_rectangle_Get(lua_State *L){
-  Rectangle * r = (Color *)luaL_checkudata(L, 1, "Rectangle");
+  Rectangle * r = (Color *)luax_checkclass(L, 1, "Rectangle");
   if (luax_optstring(L, 2, "\0")[0] == 't'){
     lua_newtable(L);
     luax_tnnumber(L, 1, r->x);
@@ -3552,7 +4277,7 @@ Rectangle:set(number x, number y, number width, number height)
 Assing values to rectangle fields
 */
 int lua_class_rectangle_Set(lua_State *L){
-  Rectangle * r = (Color *)luaL_checkudata(L, 1, "Rectangle");
+  Rectangle * r = (Color *)luax_checkclass(L, 1, "Rectangle");
 
   r->x      = luax_optinteger(L, 2, r->x);
   r->y      = luax_optinteger(L, 3, r->y);
@@ -3571,11 +4296,11 @@ Rectangle:move(number vx, number vy)
 Move rectangle by vector
 */
 int lua_class_rectangle_Move(lua_State *L){
-  Rectangle * r = (Color *)luaL_checkudata(L, 1, "Rectangle");
+  Rectangle * r = (Color *)luax_checkclass(L, 1, "Rectangle");
 	float vx = luax_optinteger(L, 2, 0.0f);
 	float vy = luax_optinteger(L, 3, 0.0f);
 	if (lua_type(L, 2) == LUA_TUSERDATA){
-		Vector2 * v = (Vector2 *)luaL_checkudata(L, 2, "Vector2");
+		Vector2 * v = (Vector2 *)luax_checkclass(L, 2, "Vector2");
 		vx = v->x; vy = v->y;
 	}
 	
@@ -3596,7 +4321,7 @@ table Position = Rectangle:getPosition('t')
 Return rectangle position
 */
 int lua_class_rectangle_GetPosition(lua_State *L){
-  Rectangle * r = (Rectangle *)luaL_checkudata(L, 1, "Rectangle");
+  Rectangle * r = (Rectangle *)luax_checkclass(L, 1, "Rectangle");
 	if (lua_type(L, 2) == LUA_TSTRING){
 		char c = luaL_checkstring(L, 1)[0];
 		if (c == 'v'){ // return Vector2
@@ -3629,11 +4354,11 @@ Rectangle:setPosition(table Position)
 Set rectangle position
 */
 int lua_class_rectangle_SetPosition(lua_State *L){
-  Rectangle * r = (Rectangle *)luaL_checkudata(L, 1, "Rectangle");
+  Rectangle * r = (Rectangle *)luax_checkclass(L, 1, "Rectangle");
 	float vx = luax_optinteger(L, 2, r->x);
 	float vy = luax_optinteger(L, 3, r->y);
 	if (luax_isclass(L, 2, "Vector2")){
-		Vector2 * v = (Vector2 *)luaL_checkudata(L, 2, "Vector2");
+		Vector2 * v = (Vector2 *)luax_checkclass(L, 2, "Vector2");
 		vx = v->x; vy = v->y;
 	}
 	if (lua_type(L, 2) == LUA_TTABLE){
@@ -3659,7 +4384,7 @@ table Position = Rectangle:getDimensions('t')
 Return rectangle width and height
 */
 int lua_class_rectangle_GetDimensions(lua_State *L){
-  Rectangle * r = (Rectangle *)luaL_checkudata(L, 1, "Rectangle");
+  Rectangle * r = (Rectangle *)luax_checkclass(L, 1, "Rectangle");
 	if (lua_type(L, 2) == LUA_TSTRING){
 		char c = luaL_checkstring(L, 1)[0];
 		if (c == 'v'){ // return Vector2
@@ -3692,11 +4417,11 @@ Rectangle:setDimensions(table Position)
 Set rectangle width and height
 */
 int lua_class_rectangle_SetDimensions(lua_State *L){
-  Rectangle * r = (Rectangle *)luaL_checkudata(L, 1, "Rectangle");
+  Rectangle * r = (Rectangle *)luax_checkclass(L, 1, "Rectangle");
 	float vx = luax_optinteger(L, 2, r->x);
 	float vy = luax_optinteger(L, 3, r->y);
 	if (luax_checkclass(L, 2, "Vector2")){
-		Vector2 * v = (Vector2 *)luaL_checkudata(L, 2, "Vector2");
+		Vector2 * v = (Vector2 *)luax_checkclass(L, 2, "Vector2");
 		vx = v->x; vy = v->y;
 	}
 	if (lua_type(L, 2) == LUA_TTABLE){
@@ -3720,9 +4445,9 @@ Draw rectangle.
 Available modes: `"fill"`, `"line"`
 */
 int lua_class_rectangle_Draw(lua_State *L){
-  Rectangle * r = (Rectangle *)luaL_checkudata(L, 1, "Rectangle");
+  Rectangle * r = (Rectangle *)luax_checkclass(L, 1, "Rectangle");
   const char * mode = luaL_checkstring(L, 2);
-  Color * c = (Color *)luaL_checkudata(L, 3, "Color");
+  Color * c = (Color *)luax_checkclass(L, 3, "Color");
 
        if (!strcmp(mode, "fill")) DrawRectangle(r->x, r->y, r->width, r->height, *c);
   else if (!strcmp(mode, "line")) DrawRectangleLines(r->x, r->y, r->width, r->height, *c);
@@ -3741,8 +4466,8 @@ Rectangle:drawPro(Color Color[, number OffsetX, number OffsetY, number Angle])
 Draw filled rectangle with angle and offset
 */
 int lua_class_rectangle_DrawPro(lua_State *L){
-  Rectangle * r = (Rectangle *)luaL_checkudata(L, 1, "Rectangle");
-  Color * c     = (Color *)luaL_checkudata(L, 2, "Color");
+  Rectangle * r = (Rectangle *)luax_checkclass(L, 1, "Rectangle");
+  Color * c     = (Color *)luax_checkclass(L, 2, "Color");
   float angle = luaL_checknumber(L, 3);
   Vector2 v = {0};
 
@@ -3751,7 +4476,7 @@ int lua_class_rectangle_DrawPro(lua_State *L){
     v.y = luaL_checknumber(L, 5);
   }
   else if (luax_isclass(L, 4, "Vector2")){
-    v = *(Vector2 *)luaL_checkudata(L, 4, "Vector2");
+    v = *(Vector2 *)luax_checkclass(L, 4, "Vector2");
   }
 
   DrawRectanglePro(*r, v, angle, *c);
@@ -3768,9 +4493,9 @@ Draw rectangle with rounded corners
 Available modes: `"fill"`, `"line"`
 */
 int lua_class_rectangle_DrawRounded(lua_State *L){
-  Rectangle * r = (Rectangle *)luaL_checkudata(L, 1, "Rectangle");
+  Rectangle * r = (Rectangle *)luax_checkclass(L, 1, "Rectangle");
   const char * mode = luaL_checkstring(L, 2);
-  Color * c = (Color *)luaL_checkudata(L, 3, "Color");
+  Color * c = (Color *)luax_checkclass(L, 3, "Color");
   float roundness = luaL_checknumber(L, 4);
   int   segments  = luax_optnumber(L, 5, roundness / 2.0);
   int   lineThick = luax_optnumber(L, 6, 1);
@@ -3793,21 +4518,21 @@ Draw rectangular color gradient
 Available modes: `"h"`, `"v"` for horizontal and vertical gradients
 */
 int lua_class_rectangle_DrawGradient(lua_State *L){
-  Rectangle * r = (Rectangle *)luaL_checkudata(L, 1, "Rectangle");
+  Rectangle * r = (Rectangle *)luax_checkclass(L, 1, "Rectangle");
 
   if (luax_type(L, 2, LUA_TSTRING)){
-    Color * c1 = (Color *)luaL_checkudata(L, 3, "Color");
-    Color * c2 = (Color *)luaL_checkudata(L, 4, "Color");
+    Color * c1 = (Color *)luax_checkclass(L, 3, "Color");
+    Color * c2 = (Color *)luax_checkclass(L, 4, "Color");
     if (luaL_checkstring(L, 2)[0] == 'v')  DrawRectangleGradientV(r->x, r->y, r->width, r->height, *c1, *c2);
     else                                   DrawRectangleGradientH(r->x, r->y, r->width, r->height, *c1, *c2);
     lua_settop(L, 1);
     return 1;
   }
 
-  Color * c1 = (Color *)luaL_checkudata(L, 2, "Color");
-  Color * c2 = (Color *)luaL_checkudata(L, 3, "Color");
-  Color * c3 = (Color *)luaL_checkudata(L, 4, "Color");
-  Color * c4 = (Color *)luaL_checkudata(L, 5, "Color");
+  Color * c1 = (Color *)luax_checkclass(L, 2, "Color");
+  Color * c2 = (Color *)luax_checkclass(L, 3, "Color");
+  Color * c3 = (Color *)luax_checkclass(L, 4, "Color");
+  Color * c4 = (Color *)luax_checkclass(L, 5, "Color");
   DrawRectangleGradientEx(*r, *c1, *c2, *c3, *c4);
   lua_settop(L, 1);
   return 1;
@@ -3821,8 +4546,8 @@ boolean isCollide = Rectangle:collideRect(Rectangle Rect)
 Check collision between two rectangles
 */
 int lua_class_rectangle_CollideRect(lua_State *L){
-  Rectangle * r1 = (Rectangle *)luaL_checkudata(L, 1, "Rectangle");
-  Rectangle * r2 = (Rectangle *)luaL_checkudata(L, 2, "Rectangle");
+  Rectangle * r1 = (Rectangle *)luax_checkclass(L, 1, "Rectangle");
+  Rectangle * r2 = (Rectangle *)luax_checkclass(L, 2, "Rectangle");
   bool result = CheckCollisionRecs(*r1, *r2);
   lua_pushboolean(L, result);
   return 1;
@@ -3838,11 +4563,11 @@ boolean isCollide = Rectangle:collideCircle(number CenterX, number CenterY, numb
 Check collision between circle and rectangle
 */
 int lua_class_rectangle_CollideCircle(lua_State *L){
-  Rectangle * r = (Rectangle *)luaL_checkudata(L, 1, "Rectangle");
+  Rectangle * r = (Rectangle *)luax_checkclass(L, 1, "Rectangle");
   Vector2 cPos = {0};
   float   cRad = 0.0f;
   if (luax_isclass(L, 2, "Vector2")){
-    cPos = *(Vector2 *)luaL_checkudata(L, 2, "Vector2");
+    cPos = *(Vector2 *)luax_checkclass(L, 2, "Vector2");
     cRad = luaL_checknumber(L, 3);
   }
   else if (lua_isnumber(L, 2)){
@@ -3864,8 +4589,8 @@ Rectangle CollRect = Rectangle:getCollisionRect(Rectangle Rect)
 Get collision rectangle for two rectangles collision
 */
 int lua_class_rectangle_GetCollisionRec(lua_State *L){
-  Rectangle * r1 = (Rectangle *)luaL_checkudata(L, 1, "Rectangle");
-  Rectangle * r2 = (Rectangle *)luaL_checkudata(L, 2, "Rectangle");
+  Rectangle * r1 = (Rectangle *)luax_checkclass(L, 1, "Rectangle");
+  Rectangle * r2 = (Rectangle *)luax_checkclass(L, 2, "Rectangle");
   Rectangle * r3 = (Rectangle *)luax_newobject(L, "Rectangle", sizeof(Rectangle));
   *r3 = GetCollisionRec(*r1, *r2);
   return 1;
@@ -3881,10 +4606,10 @@ boolean isCollide = Rectangle:collidePoint(number PointX, number PointY)
 Check if point is inside rectangle
 */
 int lua_class_rectangle_CollidePoint(lua_State *L){
-  Rectangle * r = (Rectangle *)luaL_checkudata(L, 1, "Rectangle");
+  Rectangle * r = (Rectangle *)luax_checkclass(L, 1, "Rectangle");
   Vector2 point = {0};
   if (luax_isclass(L, 2, "Vector2")){
-    point = *(Vector2 *)luaL_checkudata(L, 2, "Vector2");
+    point = *(Vector2 *)luax_checkclass(L, 2, "Vector2");
   }
   else if (lua_isnumber(L, 2)){
     point.x = luaL_checknumber(L, 2);
@@ -3897,35 +4622,17 @@ int lua_class_rectangle_CollidePoint(lua_State *L){
 }
 
 
-// meta
-int lua_class_rectangle__Index(lua_State *L){
-  if (!luax_type(L, 2, LUA_TSTRING)) return 0;
-  Rectangle * r    = (Rectangle *)luaL_checkudata(L, 1, "Rectangle");
-  const char * key = luaL_checkstring(L, 2);
-
-  lua_class_GetFieldIfCompared(L, r, key, "x",      x);
-  lua_class_GetFieldIfCompared(L, r, key, "y",      y);
-  lua_class_GetFieldIfCompared(L, r, key, "width",  width);
-  lua_class_GetFieldIfCompared(L, r, key, "height", height);
-
-  luax_getclasskey(L, 1, 2);
-  return 1;
-}
-
-int lua_class_rectangle__Newindex(lua_State *L){
-  if (!luax_type(L, 2, LUA_TSTRING)) return 0;
-  Rectangle * r    = (Rectangle *)luaL_checkudata(L, 1, "Rectangle");
-  const char * key = luaL_checkstring(L, 2);
-  int value        = luaL_checknumber(L, 3);
-  lua_class_SetFieldIfCompared(L, r, key, value, "x",      x);
-  lua_class_SetFieldIfCompared(L, r, key, value, "y",      y);
-  lua_class_SetFieldIfCompared(L, r, key, value, "width",  width);
-  lua_class_SetFieldIfCompared(L, r, key, value, "height", height);
-  return 0;
-}
+// fields
+luax_Field luaray_fields_rectangle[] = {
+  luax_field(Rectangle, "x",      x,      LUAX_FIELD_FLOAT),
+  luax_field(Rectangle, "y",      y,      LUAX_FIELD_FLOAT),
+  luax_field(Rectangle, "width",  width,  LUAX_FIELD_FLOAT),
+  luax_field(Rectangle, "height", height, LUAX_FIELD_FLOAT),
+  {NULL}
+};
 
 int lua_class_rectangle__ToString(lua_State *L){
-  Rectangle * r = (Rectangle *)luaL_checkudata(L, 1, "Rectangle");
+  Rectangle * r = (Rectangle *)luax_checkclass(L, 1, "Rectangle");
   lua_pushfstring(L, "Rectangle[%f, %f, %f, %f]: %0.8x", r->x, r->y, r->width, r->height, r);
   return 1;
 }
@@ -3948,93 +4655,524 @@ luaL_Reg luaray_class_rectangle[] = {
   {"getCollisionRect", lua_class_rectangle_GetCollisionRec},
   {"collidePoint",     lua_class_rectangle_CollidePoint},
   // meta
-  {"__index",          lua_class_rectangle__Index},
-  {"__newindex",       lua_class_rectangle__Newindex},
   {"__tostring",       lua_class_rectangle__ToString},
   {NULL, NULL}
 };
 
 /*!MD
-## Image
-Structure:
-
-| Field   | Type    |
-| :------ | :------ |
-| data    | string  |
-| width   | integer |
-| height  | integer |
-| mipmaps | integer |
-| format  | integer |
-
-Structure is read-only.
-Data stored in CPU memory (RAM), cannot be drawed directly.
-
-| **Methods**                                | description
-| :---------------------------------------   | :-----------
-| [clone](#Imageclone)                       | Create copy of image
-| [subImage](#ImagesubImage)                 | Create an image from another image piece
-| [toPOT](#ImagetoPOT)                       | Convert image to POT (power-of-two)
-| [getFormat](#ImagegetFormat)               | Get image data format
-| [setFormat](#ImagesetFormat)               | Convert image data to desired format
-| [alphaMask](#ImagealphaMask)               | Apply alpha mask to image
-| [alphaClear](#ImagealphaClear)             | Clear alpha channel to desired color
-| [alphaCrop](#ImagealphaCrop)               | Crop image depending on alpha value
-| [alphaPremultiply](#ImagealphaPremultiply) | Premultiply alpha channel
-| [crop](#Imagecrop)                         | Crop an image to a defined rectangle
-| [resize](#Imageresize)                     | Resize image (Bicubic scaling algorithm)
-| [resizeNN](#ImageresizeNN)                 | Resize image (Nearest-Neighbor scaling algorithm)
-| [resizeCanvas](#ImageresizeCanvas)         | Resize canvas and fill with color
-| [genMipmaps](#ImagegenMipmaps)             | Generate all mipmap levels for a provided image
-| [dither](#Imagedither)                     | Dither image data to 16bpp or lower (Floyd-Steinberg dithering)
-| [extractPalette](#ImageextractPalette)     | Extract color palette from image to maximum size
-| [drawImage](#ImagedrawImage)               | Draw a source image within a destination image (tint applied to source)
-| [drawRectangle](#ImagedrawRectangle)       | Draw rectangle within an image
-| [drawText](#ImagedrawText)                 | Draw text within an image
-| [flip](#Imageflip)                         | Flip image
-| [rotate](#Imagerotate)                     | Rotate image
-| [tint](#Imagetint)                         | Modify image color: tint
-| [invert](#Imageinvert)                     | Modify image color: invert
-| [grayscale](#Imagegrayscale)               | Modify image color: grayscale
-| [contrast](#Imagecontrast)                 | Modify image color: contrast (-100 to 100)
-| [brightness](#Imagebrightness)             | Modify image color: brightness (-255 to 255)
-| [replaceColor](#ImagereplaceColor)         | Modify image color: replace color
+## Buffer
+Typed arrays: contiguous blocks of numbers stored in C memory.
+Element types are `Float32Buffer`, `Int32Buffer`, `Uint16Buffer` and `Uint8Buffer`, all of them share methods.
+Buffers can be passed to functions that takes bulk data (like [DrawPixels](#DrawPixels)) without conversion.
+Indexes are started from 1, access is bounds-checked.
+```lua
+local buf = rl.Float32Buffer(4)
+buf[1], buf[2] = 10, 20
+print(#buf, buf[2]) --> 4, 20
+```
+
+| **Methods**                 | description
+| :-------------------------- | :-----------
+| [get](#Bufferget)           | Get element by index
+| [set](#Bufferset)           | Set element by index
+| [fill](#Bufferfill)         | Fill range of buffer by value
+| [copy](#Buffercopy)         | Copy elements from another buffer
+| [map](#Buffermap)           | Replace each element by result of a function
+| [slice](#Bufferslice)       | Create a view to the piece of buffer, without copying
+| [toTable](#BuffertoTable)   | Return elements as Lua table
+| [toString](#BuffertoString) | Return raw bytes as string
+| [getType](#BuffergetType)   | Return buffer element type name
+| **Overloads**               |
+| #: `Count = #Buf`           | Returns elements count
+| []: `Value = Buf[Index]`    | Get element by index
+| []: `Buf[Index] = Value`    | Set element by index
 
 ### Initialization
 ```lua
 -- variants
-Image Img = rl.Image(string Filename)
-Image Img = rl.Image(integer Width, integer Height, eTexture Format[, Color FillColor])
-```
-Creates new Image object.
-See [eTexture](#etexture).
-*/
-int lua_class_image_new(lua_State *L){
-  if (luax_type(L, 1, LUA_TSTRING)){
-    const char * fname = luaL_checkstring(L, 1);
-    if (!FileExists(fname))
-      return luaL_error(L, "Can't load image \"%s\", file is not exists", fname);
-    Image * img = (Image *)luax_newobject(L, "Image", sizeof(Image));
-    *img = LoadImage(fname);
+Float32Buffer Buf = rl.Float32Buffer(integer Count) -- zero-filled
+Float32Buffer Buf = rl.Float32Buffer(table Values)
+Float32Buffer Buf = rl.Float32Buffer(string Bytes)  -- raw bytes copy
+-- same for rl.Int32Buffer, rl.Uint16Buffer, rl.Uint8Buffer
+```
+Creates new buffer
+*/
+enum {
+  DATABUFFER_FLOAT32,
+  DATABUFFER_INT32,
+  DATABUFFER_UINT16,
+  DATABUFFER_UINT8,
+  DATABUFFER_TYPES_COUNT
+};
+
+typedef struct DataBuffer {
+  unsigned char * data;       // first element
+  int             count;      // elements count
+  int             type;       // DATABUFFER_*
+  int             parent;     // registry reference to memory owner, LUA_NOREF if buffer owns the data
+  Image *         source;      // for views of Image data, which can be reallocated by image methods, NULL otherwise
+  Image           sourceImage; // *source on view creation, view is invalid if data, dimensions or format changed
+} DataBuffer;
+
+const char * lua_class_buffer_names[DATABUFFER_TYPES_COUNT] = {"Float32Buffer", "Int32Buffer", "Uint16Buffer", "Uint8Buffer"};
+const int    lua_class_buffer_sizes[DATABUFFER_TYPES_COUNT] = {4, 4, 2, 1};
+
+// Raises error if view memory was reallocated by its owner. Freed data address can be reused by the next
+// allocation, so dimensions and format are compared too: view stays valid only if it is in bounds of the same layout.
+#define lua_class_buffer_validate(L, b) \
+        if ((b)->source && ((b)->source->data   != (b)->sourceImage.data  || (b)->source->width   != (b)->sourceImage.width || \
+                            (b)->source->height != (b)->sourceImage.height || (b)->source->mipmaps != (b)->sourceImage.mipmaps || \
+                            (b)->source->format != (b)->sourceImage.format)) \
+          luaL_error(L, "%s view is invalid, source data was reallocated", lua_class_buffer_names[(b)->type])
+
+DataBuffer * lua_class_buffer_test(lua_State *L, int idx){
+  for (int i = 0; i < DATABUFFER_TYPES_COUNT; i++)
+    if (luax_isclass(L, idx, lua_class_buffer_names[i])) {
+      DataBuffer * b = (DataBuffer *)lua_touserdata(L, idx);
+      lua_class_buffer_validate(L, b);
+      return b;
+    }
+  return NULL;
+}
+
+DataBuffer * lua_class_buffer_check(lua_State *L, int idx){
+  DataBuffer * b = lua_class_buffer_test(L, idx);
+  if (!b) luaL_typerror(L, idx, "Buffer");
+  return b;
+}
+
+// Checks buffer of given type
+DataBuffer * lua_class_buffer_checktype(lua_State *L, int idx, int type){
+  DataBuffer * b = (DataBuffer *)luaL_checkudata(L, idx, lua_class_buffer_names[type]);
+  lua_class_buffer_validate(L, b);
+  return b;
+}
+
+// Creates buffer with own zero-filled memory
+DataBuffer * lua_class_buffer_push(lua_State *L, int type, int count){
+  DataBuffer * b = (DataBuffer *)luax_newobject(L, lua_class_buffer_names[type], sizeof(DataBuffer));
+  b->data   = NULL;
+  b->count  = 0;
+  b->type   = type;
+  b->parent = LUA_NOREF;
+  b->source = NULL;
+  b->data   = (unsigned char *)calloc(count > 0 ? count : 1, lua_class_buffer_sizes[type]);
+  if (!b->data) luaL_error(L, "Can't allocate %s of %d elements", lua_class_buffer_names[type], count);
+  b->count  = count;
+  return b;
+}
+
+// Creates buffer view to foreign memory, object at ownerIdx is kept alive while view exists.
+// Set view->source (and view->sourceImage) to the owner's Image if owner can reallocate it.
+DataBuffer * lua_class_buffer_pushview(lua_State *L, int type, void * data, int count, int ownerIdx){
+  if (ownerIdx < 0 && ownerIdx > LUA_REGISTRYINDEX) ownerIdx = lua_gettop(L) + ownerIdx + 1;
+  DataBuffer * b = (DataBuffer *)luax_newobject(L, lua_class_buffer_names[type], sizeof(DataBuffer));
+  b->data   = (unsigned char *)data;
+  b->count  = count;
+  b->type   = type;
+  b->source = NULL;
+  lua_pushvalue(L, ownerIdx);
+  b->parent = lua_ref(L, 1);
+  return b;
+}
+
+double lua_class_buffer_getvalue(DataBuffer * b, int i){
+  switch (b->type) {
+    case DATABUFFER_FLOAT32: return ((float *)b->data)[i];
+    case DATABUFFER_INT32:   return ((int *)b->data)[i];
+    case DATABUFFER_UINT16:  return ((unsigned short *)b->data)[i];
+    case DATABUFFER_UINT8:   return b->data[i];
+  }
+  return 0;
+}
+
+void lua_class_buffer_setvalue(DataBuffer * b, int i, double value){
+  switch (b->type) {
+    case DATABUFFER_FLOAT32: ((float *)b->data)[i]          = value; break;
+    case DATABUFFER_INT32:   ((int *)b->data)[i]            = (int)value; break;
+    case DATABUFFER_UINT16:  ((unsigned short *)b->data)[i] = (unsigned short)(int)value; break;
+    case DATABUFFER_UINT8:   b->data[i]                     = (unsigned char)(int)value; break;
+  }
+}
+
+// converts 1-based lua index to 0-based, with bounds check
+int lua_class_buffer_checkindex(lua_State *L, int idx, DataBuffer * b){
+  int i = luaL_checkinteger(L, idx);
+  if (i < 1 || i > b->count) luaL_error(L, "%s index %d is out of range [1, %d]", lua_class_buffer_names[b->type], i, b->count);
+  return i - 1;
+}
+
+// reads optional [from, to] range into 0-based [*from, *to)
+void lua_class_buffer_checkrange(lua_State *L, int idx, DataBuffer * b, int * from, int * to){
+  *from = luax_optinteger(L, idx,     1);
+  *to   = luax_optinteger(L, idx + 1, b->count);
+  if (*from < 1 || *to > b->count || *from > *to + 1)
+    luaL_error(L, "%s range [%d, %d] is out of range [1, %d]", lua_class_buffer_names[b->type], *from, *to, b->count);
+  (*from)--;
+}
+
+int lua_class_buffer_new(lua_State *L, int type){
+  if (lua_isnumber(L, 1)) {
+    int count = luaL_checkinteger(L, 1);
+    if (count < 0) luaL_argerror(L, 1, "negative count");
+    lua_class_buffer_push(L, type, count);
     return 1;
   }
-  int width  = luaL_checkinteger(L, 1);
-  int height = luaL_checkinteger(L, 2);
-  int format = ray_enums_getFromStack(L, 3, ray_lua_enum_texturefmt);
-  Color color = luax_isclass(L, 4, "Color") ? *(Color *)luaL_checkudata(L, 4, "Color") : BLANK;
-  Image * img = (Image *)luax_newobject(L, "Image", sizeof(Image));
-  *img = LoadImagePro(NULL, 0, 0, format);
-  ImageResizeCanvas(img, width, height, 0, 0, color);
-  return 1;
+  if (lua_istable(L, 1)) {
+    int count = lua_objlen(L, 1);
+    DataBuffer * b = lua_class_buffer_push(L, type, count);
+    for (int i = 0; i < count; i++) {
+      lua_rawgeti(L, 1, i + 1);
+      lua_class_buffer_setvalue(b, i, lua_tonumber(L, -1));
+      lua_pop(L, 1);
+    }
+    return 1;
+  }
+  if (lua_type(L, 1) == LUA_TSTRING) {
+    size_t len;
+    const char * str = lua_tolstring(L, 1, &len);
+    DataBuffer * b = lua_class_buffer_push(L, type, len / lua_class_buffer_sizes[type]);
+    memcpy(b->data, str, b->count * lua_class_buffer_sizes[type]);
+    return 1;
+  }
+  return luaL_typerror(L, 1, "number, table or string");
 }
 
+int lua_class_buffer_newFloat32(lua_State *L){ return lua_class_buffer_new(L, DATABUFFER_FLOAT32); }
+int lua_class_buffer_newInt32(lua_State *L)  { return lua_class_buffer_new(L, DATABUFFER_INT32);   }
+int lua_class_buffer_newUint16(lua_State *L) { return lua_class_buffer_new(L, DATABUFFER_UINT16);  }
+int lua_class_buffer_newUint8(lua_State *L)  { return lua_class_buffer_new(L, DATABUFFER_UINT8);   }
+
 /*!MD
-#### Image:clone
+#### Buffer:get
 ```lua
-Image Img = Image:clone()
+number Value = Buffer:get(integer Index)
 ```
-Create copy of image
+Get element by index
 */
-int lua_class_image_Clone(lua_State *L){
+int lua_class_buffer_Get(lua_State *L){
+  DataBuffer * b = lua_class_buffer_check(L, 1);
+  int i = lua_class_buffer_checkindex(L, 2, b);
+  lua_pushnumber(L, lua_class_buffer_getvalue(b, i));
+  return 1;
+}
+
+/*!MD
+#### Buffer:set
+```lua
+Buffer:set(integer Index, number Value)
+```
+Set element by index
+*/
+int lua_class_buffer_Set(lua_State *L){
+  DataBuffer * b = lua_class_buffer_check(L, 1);
+  int i = lua_class_buffer_checkindex(L, 2, b);
+  lua_class_buffer_setvalue(b, i, luaL_checknumber(L, 3));
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Buffer:fill
+```lua
+Buffer:fill(number Value[, integer From, integer To])
+```
+Fill range of buffer by value (whole buffer by default)
+*/
+int lua_class_buffer_Fill(lua_State *L){
+  DataBuffer * b = lua_class_buffer_check(L, 1);
+  double value = luaL_checknumber(L, 2);
+  int from, to;
+  lua_class_buffer_checkrange(L, 3, b, &from, &to);
+
+  if (b->type == DATABUFFER_UINT8) memset(b->data + from, (unsigned char)(int)value, to - from);
+  else {
+    if (from < to) lua_class_buffer_setvalue(b, from, value);
+    int size = lua_class_buffer_sizes[b->type];
+    for (int i = from + 1; i < to; i++) memcpy(b->data + i*size, b->data + from*size, size);
+  }
+
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Buffer:copy
+```lua
+Buffer:copy(Buffer Source[, integer DestIndex, integer SourceFrom, integer SourceTo])
+```
+Copy elements from another buffer (converting values if types are different).
+Ranges can overlap.
+*/
+int lua_class_buffer_Copy(lua_State *L){
+  DataBuffer * dst = lua_class_buffer_check(L, 1);
+  DataBuffer * src = lua_class_buffer_check(L, 2);
+  int at = luax_optinteger(L, 3, 1) - 1;
+  int from, to;
+  lua_class_buffer_checkrange(L, 4, src, &from, &to);
+  int count = to - from;
+  if (at < 0 || at + count > dst->count)
+    return luaL_error(L, "%s can't fit %d elements from index %d", lua_class_buffer_names[dst->type], count, at + 1);
+
+  if (dst->type == src->type) {
+    int size = lua_class_buffer_sizes[dst->type];
+    memmove(dst->data + at*size, src->data + from*size, count*size);
+  }
+  else if (dst->data + at*lua_class_buffer_sizes[dst->type] > src->data + from*lua_class_buffer_sizes[src->type])
+    for (int i = count - 1; i >= 0; i--) lua_class_buffer_setvalue(dst, at + i, lua_class_buffer_getvalue(src, from + i));
+  else
+    for (int i = 0; i < count; i++)      lua_class_buffer_setvalue(dst, at + i, lua_class_buffer_getvalue(src, from + i));
+
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Buffer:map
+```lua
+Buffer:map(function Func[, integer From, integer To])
+```
+Replace each element by result of `Func(Value, Index)`, if function returns nil element is not changed.
+*/
+int lua_class_buffer_Map(lua_State *L){
+  DataBuffer * b = lua_class_buffer_check(L, 1);
+  luaL_checktype(L, 2, LUA_TFUNCTION);
+  int from, to;
+  lua_class_buffer_checkrange(L, 3, b, &from, &to);
+
+  for (int i = from; i < to; i++) {
+    lua_pushvalue(L, 2);
+    lua_pushnumber(L, lua_class_buffer_getvalue(b, i));
+    lua_pushinteger(L, i + 1);
+    lua_call(L, 2, 1);
+    if (!lua_isnil(L, -1)) lua_class_buffer_setvalue(b, i, luaL_checknumber(L, -1));
+    lua_pop(L, 1);
+  }
+
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Buffer:slice
+```lua
+Buffer View = Buffer:slice(integer From[, integer To])
+```
+Create a buffer of the same type that shares memory with the given range, without copying.
+Source buffer is kept alive while view exists.
+*/
+int lua_class_buffer_Slice(lua_State *L){
+  DataBuffer * b = lua_class_buffer_check(L, 1);
+  int from, to;
+  lua_class_buffer_checkrange(L, 2, b, &from, &to);
+
+  // view keeps reference to the real memory owner
+  if (b->parent != LUA_NOREF) lua_rawgeti(L, LUA_REGISTRYINDEX, b->parent);
+  else lua_pushvalue(L, 1);
+  DataBuffer * view = lua_class_buffer_pushview(L, b->type, b->data + from*lua_class_buffer_sizes[b->type], to - from, -1);
+  view->source      = b->source;
+  view->sourceImage = b->sourceImage;
+  return 1;
+}
+
+/*!MD
+#### Buffer:toTable
+```lua
+table Values = Buffer:toTable([integer From, integer To])
+```
+Return elements as Lua table
+*/
+int lua_class_buffer_ToTable(lua_State *L){
+  DataBuffer * b = lua_class_buffer_check(L, 1);
+  int from, to;
+  lua_class_buffer_checkrange(L, 2, b, &from, &to);
+  lua_createtable(L, to - from, 0);
+  for (int i = from; i < to; i++) {
+    lua_pushnumber(L, lua_class_buffer_getvalue(b, i));
+    lua_rawseti(L, -2, i - from + 1);
+  }
+  return 1;
+}
+
+/*!MD
+#### Buffer:toString
+```lua
+string Bytes = Buffer:toString([integer From, integer To])
+```
+Return raw bytes of elements as string
+*/
+int lua_class_buffer_ToString(lua_State *L){
+  DataBuffer * b = lua_class_buffer_check(L, 1);
+  int from, to;
+  lua_class_buffer_checkrange(L, 2, b, &from, &to);
+  int size = lua_class_buffer_sizes[b->type];
+  lua_pushlstring(L, (const char *)b->data + from*size, (to - from)*size);
+  return 1;
+}
+
+/*!MD
+#### Buffer:getType
+```lua
+string Type = Buffer:getType()
+```
+Return buffer element type name ("Float32Buffer", "Int32Buffer", "Uint16Buffer" or "Uint8Buffer")
+*/
+int lua_class_buffer_GetType(lua_State *L){
+  DataBuffer * b = lua_class_buffer_check(L, 1);
+  lua_pushstring(L, lua_class_buffer_names[b->type]);
+  return 1;
+}
+
+// meta
+int lua_class_buffer__Index(lua_State *L){
+  if (lua_type(L, 2) == LUA_TNUMBER) {
+    DataBuffer * b = (DataBuffer *)lua_touserdata(L, 1);
+    lua_class_buffer_validate(L, b);
+    int i = lua_class_buffer_checkindex(L, 2, b);
+    lua_pushnumber(L, lua_class_buffer_getvalue(b, i));
+    return 1;
+  }
+  luax_getclasskey(L, 1, 2);
+  return 1;
+}
+
+int lua_class_buffer__Newindex(lua_State *L){
+  DataBuffer * b = (DataBuffer *)lua_touserdata(L, 1);
+  lua_class_buffer_validate(L, b);
+  int i = lua_class_buffer_checkindex(L, 2, b);
+  lua_class_buffer_setvalue(b, i, luaL_checknumber(L, 3));
+  return 0;
+}
+
+int lua_class_buffer__Len(lua_State *L){
+  DataBuffer * b = lua_class_buffer_check(L, 1);
+  lua_pushinteger(L, b->count);
+  return 1;
+}
+
+int lua_class_buffer__GC(lua_State *L){
+  DataBuffer * b = (DataBuffer *)lua_touserdata(L, 1);
+  if (b->parent != LUA_NOREF) lua_unref(L, b->parent);
+  else free(b->data);
+  b->data   = NULL;
+  b->count  = 0;
+  b->parent = LUA_NOREF;
+  return 0;
+}
+
+int lua_class_buffer__ToString(lua_State *L){
+  DataBuffer * b = (DataBuffer *)lua_touserdata(L, 1);
+  lua_pushfstring(L, "%s[%d]: %p", lua_class_buffer_names[b->type], b->count, b->data);
+  return 1;
+}
+
+luaL_Reg luaray_class_buffer[] = {
+  {"get",        lua_class_buffer_Get},
+  {"set",        lua_class_buffer_Set},
+  {"fill",       lua_class_buffer_Fill},
+  {"copy",       lua_class_buffer_Copy},
+  {"map",        lua_class_buffer_Map},
+  {"slice",      lua_class_buffer_Slice},
+  {"toTable",    lua_class_buffer_ToTable},
+  {"toString",   lua_class_buffer_ToString},
+  {"getType",    lua_class_buffer_GetType},
+  // meta
+  {"__index",    lua_class_buffer__Index},
+  {"__newindex", lua_class_buffer__Newindex},
+  {"__len",      lua_class_buffer__Len},
+  {"__gc",       lua_class_buffer__GC},
+  {"__tostring", lua_class_buffer__ToString},
+  {NULL, NULL}
+};
+
+/*!MD
+## Image
+Structure:
+
+| Field   | Type    |
+| :------ | :------ |
+| data    | string  |
+| width   | integer |
+| height  | integer |
+| mipmaps | integer |
+| format  | integer |
+
+Structure is read-only.
+Data stored in CPU memory (RAM), cannot be drawed directly.
+
+| **Methods**                                | description
+| :---------------------------------------   | :-----------
+| [clone](#Imageclone)                       | Create copy of image
+| [subImage](#ImagesubImage)                 | Create an image from another image piece
+| [toPOT](#ImagetoPOT)                       | Convert image to POT (power-of-two)
+| [getFormat](#ImagegetFormat)               | Get image data format
+| [setFormat](#ImagesetFormat)               | Convert image data to desired format
+| [alphaMask](#ImagealphaMask)               | Apply alpha mask to image
+| [alphaClear](#ImagealphaClear)             | Clear alpha channel to desired color
+| [alphaCrop](#ImagealphaCrop)               | Crop image depending on alpha value
+| [alphaPremultiply](#ImagealphaPremultiply) | Premultiply alpha channel
+| [crop](#Imagecrop)                         | Crop an image to a defined rectangle
+| [resize](#Imageresize)                     | Resize image (Bicubic scaling algorithm)
+| [resizeNN](#ImageresizeNN)                 | Resize image (Nearest-Neighbor scaling algorithm)
+| [resizeCanvas](#ImageresizeCanvas)         | Resize canvas and fill with color
+| [genMipmaps](#ImagegenMipmaps)             | Generate all mipmap levels for a provided image
+| [dither](#Imagedither)                     | Dither image data to 16bpp or lower (Floyd-Steinberg dithering)
+| [extractPalette](#ImageextractPalette)     | Extract color palette from image to maximum size
+| [drawImage](#ImagedrawImage)               | Draw a source image within a destination image (tint applied to source)
+| [drawRectangle](#ImagedrawRectangle)       | Draw rectangle within an image
+| [drawText](#ImagedrawText)                 | Draw text within an image
+| [flip](#Imageflip)                         | Flip image
+| [rotate](#Imagerotate)                     | Rotate image
+| [tint](#Imagetint)                         | Modify image color: tint
+| [invert](#Imageinvert)                     | Modify image color: invert
+| [grayscale](#Imagegrayscale)               | Modify image color: grayscale
+| [contrast](#Imagecontrast)                 | Modify image color: contrast (-100 to 100)
+| [brightness](#Imagebrightness)             | Modify image color: brightness (-255 to 255)
+| [replaceColor](#ImagereplaceColor)         | Modify image color: replace color
+| **Pixel access**                           |
+| [getPixel](#ImagegetPixel)                 | Get pixel color
+| [setPixel](#ImagesetPixel)                 | Set pixel color
+| [getBuffer](#ImagegetBuffer)               | Return mutable view of image pixels
+| [getRow](#ImagegetRow)                     | Return mutable view of one pixel row
+| [readPixels](#ImagereadPixels)             | Read pixels of image region to buffer as RGBA bytes
+| [writePixels](#ImagewritePixels)           | Write RGBA bytes from buffer to image region
+
+### Initialization
+```lua
+-- variants
+Image Img = rl.Image(string Filename)
+Image Img = rl.Image(integer Width, integer Height, eTexture Format[, Color FillColor])
+```
+Creates new Image object.
+See [eTexture](#etexture).
+*/
+int lua_class_image_new(lua_State *L){
+  if (luax_type(L, 1, LUA_TSTRING)){
+    const char * fname = luaL_checkstring(L, 1);
+    if (!FileExists(fname))
+      return luaL_error(L, "Can't load image \"%s\", file is not exists", fname);
+    Image * img = (Image *)luax_newobject(L, "Image", sizeof(Image));
+    *img = LoadImage(fname);
+    return 1;
+  }
+  int width  = luaL_checkinteger(L, 1);
+  int height = luaL_checkinteger(L, 2);
+  int format = ray_enums_getFromStack(L, 3, ray_lua_enum_texturefmt);
+  Color color = luax_isclass(L, 4, "Color") ? *(Color *)luax_checkclass(L, 4, "Color") : BLANK;
+  Image * img = (Image *)luax_newobject(L, "Image", sizeof(Image));
+  *img = LoadImagePro(NULL, 0, 0, format);
+  ImageResizeCanvas(img, width, height, 0, 0, color);
+  return 1;
+}
+
+/*!MD
+#### Image:clone
+```lua
+Image Img = Image:clone()
+```
+Create copy of image
+*/
+int lua_class_image_Clone(lua_State *L){
   Image * img  = (Image *)luaL_checkudata(L, 1, "Image");
   Image * copy = (Image *)luax_newobject(L, "Image", sizeof(Image));
   *copy = ImageCopy(*img);
@@ -4061,7 +5199,7 @@ int lua_class_image_SubImage(lua_State *L){
     rect.width  = luaL_checknumber(L, 4);
     rect.height = luaL_checknumber(L, 5);
   }
-  else rect = *(Rectangle *)luaL_checkudata(L, 2, "Rectangle");
+  else rect = *(Rectangle *)luax_checkclass(L, 2, "Rectangle");
   
   Image * dst = (Image *)luax_newobject(L, "Image", sizeof(Image));
   *dst = ImageFromImage(*src, rect);
@@ -4207,12 +5345,14 @@ int lua_class_image_Crop(lua_State *L){
 Image Image = Image:resize(integer Width, integer Height)
 ```
 Resize image (Bicubic scaling algorithm), returns modified image for chaining.
+R8G8B8A8 and R8G8B8 images are resized by multiple threads, see [SetImageThreads](#SetImageThreads).
 */
 int lua_class_image_Resize(lua_State *L){
   Image * img = (Image *)luaL_checkudata(L, 1, "Image");
   int width   = luaL_checkinteger(L, 2);
   int height  = luaL_checkinteger(L, 3);
-  ImageResize(img, width, height);
+  if (!(width > 0 && height > 0 && ray_kernels_resizable(img) && ray_kernels_resize(img, width, height)))
+    ImageResize(img, width, height);
   lua_settop(L, 1);
   return 1;
 }
@@ -4260,10 +5400,12 @@ int lua_class_image_ResizeCanvas(lua_State *L){
 Image Image = Image:genMipmaps()
 ```
 Generate all mipmap levels for a provided image, returns modified image for chaining.
+R8G8B8A8 and R8G8B8 levels are resized by multiple threads, see [SetImageThreads](#SetImageThreads).
 */
 int lua_class_image_Mipmaps(lua_State *L){
   Image * img  = (Image *)luaL_checkudata(L, 1, "Image");
-  ImageMipmaps(img);
+  if (!(img->mipmaps == 1 && ray_kernels_resizable(img) && ray_kernels_mipmaps(img)))
+    ImageMipmaps(img);
   lua_settop(L, 1);
   return 1;
 }
@@ -4321,9 +5463,9 @@ See [Rectangle](#Rectangle), [Color](#Color).
 int lua_class_image_DrawImage(lua_State *L){
   Image     * dst     = (Image *)luaL_checkudata(L, 1, "Image");
   Image     * src     = (Image *)luaL_checkudata(L, 2, "Image");
-  Rectangle * srcRect = (Rectangle *)luaL_checkudata(L, 3, "Rectangle");
-  Rectangle * dstRect = (Rectangle *)luaL_checkudata(L, 4, "Rectangle");
-  Color     * tInt    = luax_isclass(L, 5, "Color") ? (Color *)luaL_checkudata(L, 5, "Color") : &WHITE;
+  Rectangle * srcRect = (Rectangle *)luax_checkclass(L, 3, "Rectangle");
+  Rectangle * dstRect = (Rectangle *)luax_checkclass(L, 4, "Rectangle");
+  Color     * tInt    = luax_isclass(L, 5, "Color") ? (Color *)luax_checkclass(L, 5, "Color") : &WHITE;
   ImageDraw(dst, *src, *srcRect, *dstRect, *tInt);
   lua_settop(L, 1);
   return 1;
@@ -4341,8 +5483,8 @@ Available modes: `"fill"`, `"line"`.
 int lua_class_image_DrawRectangle(lua_State *L){
   Image      * dst   = (Image *)luaL_checkudata(L, 1, "Image");
   const char * mode  = luaL_checkstring(L, 2);
-  Rectangle  * rect  = (Rectangle *)luaL_checkudata(L, 3, "Rectangle");
-  Color      * col   = luax_isclass(L, 4, "Color") ? (Color *)luaL_checkudata(L, 4, "Color") : &WHITE;
+  Rectangle  * rect  = (Rectangle *)luax_checkclass(L, 3, "Rectangle");
+  Color      * col   = luax_isclass(L, 4, "Color") ? (Color *)luax_checkclass(L, 4, "Color") : &WHITE;
   int          thick = luax_optinteger(L, 5, 1);
 
        if (!strcmp(mode, "fill")) ImageDrawRectangle(dst, *rect, *col);
@@ -4365,6 +5507,8 @@ Image Image = Image:drawText(Vector2 Position, string Text, Font Font, number Fo
 Draw text within an image, returns modified image for chaining.
 See [Vector2](#Vector2), [Color](#Color), [Font](#Font).
 */
+Font * _ptr_font_Get(lua_State *L, int index); // see Font
+
 int lua_class_image_DrawText(lua_State *L){
   Image      * dst      = (Image *)luaL_checkudata(L, 1, "Image");
   Vector2      position = {0};
@@ -4379,32 +5523,32 @@ int lua_class_image_DrawText(lua_State *L){
     // skip 5 (font)
     fontSize = luaL_checknumber(L, 6);
     if (luax_isclass(L, 5, "Font")){
-      Font * font   = (Font *)luaL_checkudata(L, 5, "Font");
+      Font * font   = _ptr_font_Get(L, 5);
       float spacing = luaL_checknumber(L, 7);
-      color         = luax_isclass(L, 8, "Color") ? *(Color *)luaL_checkudata(L, 8, "Color") : color;
+      color         = luax_isclass(L, 8, "Color") ? *(Color *)luax_checkclass(L, 8, "Color") : color;
       ImageDrawTextEx(dst, position, *font, text, fontSize, spacing, color);
     }
     else {
-      color = luax_isclass(L, 5, "Color") ? *(Color *)luaL_checkudata(L, 5, "Color") : color;
+      color = luax_isclass(L, 5, "Color") ? *(Color *)luax_checkclass(L, 5, "Color") : color;
       ImageDrawText(dst, position, text, fontSize, color);
     }
     lua_settop(L, 1);
     return 1;
   }
 
-  position = *(Vector2 *)luaL_checkudata(L, 2, "Vector2");
+  position = *(Vector2 *)luax_checkclass(L, 2, "Vector2");
   text     = luaL_checkstring(L, 3);
   // skip 4 (font)
   fontSize = luaL_checknumber(L, 5);
 
   if (luax_isclass(L, 4, "Font")){
-    Font * font   = (Color *)luaL_checkudata(L, 4, "Font");
+    Font * font   = _ptr_font_Get(L, 4);
     float spacing = luaL_checknumber(L, 6);
-    color    = luax_isclass(L, 7, "Color") ? *(Color *)luaL_checkudata(L, 7, "Color") : color;
+    color    = luax_isclass(L, 7, "Color") ? *(Color *)luax_checkclass(L, 7, "Color") : color;
     ImageDrawTextEx(dst, position, *font, text, fontSize, spacing, color);
   }
   else {
-    color    = luax_isclass(L, 4, "Color") ? *(Color *)luaL_checkudata(L, 4, "Color") : color;
+    color    = luax_isclass(L, 4, "Color") ? *(Color *)luax_checkclass(L, 4, "Color") : color;
     ImageDrawText(dst, position, text, fontSize, color);
   }
   lua_settop(L, 1);
@@ -4457,8 +5601,9 @@ See [Color](#Color).
 */
 int lua_class_image_Tint(lua_State *L){
   Image * dst = (Image *)luaL_checkudata(L, 1, "Image");
-  Color * clr = (Color *)luaL_checkudata(L, 2, "Color");
-  ImageColorTint(dst, *clr);
+  Color * clr = (Color *)luax_checkclass(L, 2, "Color");
+  if (ray_kernels_supported(dst)) ray_kernels_tint((Color *)dst->data, dst->width*dst->height, *clr);
+  else ImageColorTint(dst, *clr);
   lua_settop(L, 1);
   return 1;
 }
@@ -4472,7 +5617,8 @@ Modify image color: invert, returns modified image for chaining.
 */
 int lua_class_image_Invert(lua_State *L){
   Image * dst = (Image *)luaL_checkudata(L, 1, "Image");
-  ImageColorInvert(dst);
+  if (ray_kernels_supported(dst)) ray_kernels_invert((Color *)dst->data, dst->width*dst->height);
+  else ImageColorInvert(dst);
   lua_settop(L, 1);
   return 1;
 }
@@ -4486,7 +5632,15 @@ Modify image color: grayscale, returns modified image for chaining.
 */
 int lua_class_image_Grayscale(lua_State *L){
   Image * dst = (Image *)luaL_checkudata(L, 1, "Image");
-  ImageColorGrayscale(dst);
+  if (ray_kernels_supported(dst)) {
+    unsigned char * gray = (unsigned char *)malloc(dst->width*dst->height);
+    if (!gray) return luaL_error(L, "Can't allocate grayscale image");
+    ray_kernels_grayscale((Color *)dst->data, gray, dst->width*dst->height);
+    free(dst->data);
+    dst->data   = gray;
+    dst->format = UNCOMPRESSED_GRAYSCALE;
+  }
+  else ImageColorGrayscale(dst);
   lua_settop(L, 1);
   return 1;
 }
@@ -4501,7 +5655,8 @@ Modify image color: contrast (-100 to 100), returns modified image for chaining.
 int lua_class_image_Contrast(lua_State *L){
   Image * dst      = (Image *)luaL_checkudata(L, 1, "Image");
   float   contrast = luaL_checknumber(L, 2);
-  ImageColorContrast(dst, contrast);
+  if (ray_kernels_supported(dst)) ray_kernels_contrast((Color *)dst->data, dst->width*dst->height, contrast);
+  else ImageColorContrast(dst, contrast);
   lua_settop(L, 1);
   return 1;
 }
@@ -4516,7 +5671,8 @@ Modify image color: brightness (-255 to 255), returns modified image for chainin
 int lua_class_image_Brightness(lua_State *L){
   Image * dst        = (Image *)luaL_checkudata(L, 1, "Image");
   int     brightness = luaL_checknumber(L, 2);
-  ImageColorBrightness(dst, brightness);
+  if (ray_kernels_supported(dst)) ray_kernels_brightness((Color *)dst->data, dst->width*dst->height, brightness);
+  else ImageColorBrightness(dst, brightness);
   lua_settop(L, 1);
   return 1;
 }
@@ -4531,39 +5687,331 @@ See [Color](#Color).
 */
 int lua_class_image_ColorReplace(lua_State *L){
   Image * dst     = (Image *)luaL_checkudata(L, 1, "Image");
-  Color * clrFrom = (Color *)luaL_checkudata(L, 2, "Color");
-  Color * clrTo   = (Color *)luaL_checkudata(L, 3, "Color");
-  ImageColorReplace(dst, *clrFrom, *clrTo);
+  Color * clrFrom = (Color *)luax_checkclass(L, 2, "Color");
+  Color * clrTo   = (Color *)luax_checkclass(L, 3, "Color");
+  if (ray_kernels_supported(dst)) ray_kernels_replace((Color *)dst->data, dst->width*dst->height, *clrFrom, *clrTo);
+  else ImageColorReplace(dst, *clrFrom, *clrTo);
   lua_settop(L, 1);
   return 1;
 }
 
 
-// meta
-int lua_class_image__Index(lua_State *L){
-  if (!luax_type(L, 2, LUA_TSTRING)) return 0;
-  Image * img    = (Image *)luaL_checkudata(L, 1, "Image");
-  const char * key = luaL_checkstring(L, 2);
-
-  lua_class_GetFieldIfCompared(L, img, key, "width",   width);
-  lua_class_GetFieldIfCompared(L, img, key, "height",  height);
-  lua_class_GetFieldIfCompared(L, img, key, "mipmaps", mipmaps);
-  lua_class_GetFieldIfCompared(L, img, key, "format",  format);
-  if (!strcmp(key, "format")) {
-    const char * fmt = ray_enums_string(L, img->format, ray_lua_enum_texturefmt);
-    lua_pushstring(L, fmt);
-    return 1;
+/*!MD
+### Pixel access
+Pixel methods works with image data directly, without copying the whole image (uncompressed formats only).
+Coordinates are started from 0, like in drawing functions.
+Buffer views returned by getBuffer/getRow are invalidated by methods which reallocates image data
+(resize, crop, setFormat, grayscale etc), access to invalidated view raises error.
+```lua
+local img = rl.Image(256, 256, "r8g8b8a8")
+local px  = img:getBuffer() -- Uint8Buffer, 4 bytes per pixel
+for i = 1, #px, 4 do px[i] = (i / 4) % 256 end
+```
+*/
+
+// Checks uncompressed format of image and returns bytes per pixel
+int _ptr_image_checkPixelSize(lua_State *L, Image * img){
+  if (img->format >= COMPRESSED_DXT1_RGB || !img->data)
+    luaL_error(L, "Pixel access is not supported for compressed or empty images");
+  return ray_texture_getBytesPerPixel(img->format) / 8;
+}
+
+Color _ptr_image_GetPixel(Image * img, int i){
+  Color c = {0, 0, 0, 255};
+  switch (img->format) {
+    case UNCOMPRESSED_GRAYSCALE: {
+      unsigned char v = ((unsigned char *)img->data)[i];
+      c.r = c.g = c.b = v;
+    } break;
+    case UNCOMPRESSED_GRAY_ALPHA: {
+      unsigned char * p = (unsigned char *)img->data + i*2;
+      c.r = c.g = c.b = p[0]; c.a = p[1];
+    } break;
+    case UNCOMPRESSED_R5G6B5: {
+      unsigned short p = ((unsigned short *)img->data)[i];
+      c.r = ((p >> 11) & 0x1F)*255/31;
+      c.g = ((p >> 5)  & 0x3F)*255/63;
+      c.b = (p & 0x1F)*255/31;
+    } break;
+    case UNCOMPRESSED_R8G8B8: {
+      unsigned char * p = (unsigned char *)img->data + i*3;
+      c.r = p[0]; c.g = p[1]; c.b = p[2];
+    } break;
+    case UNCOMPRESSED_R5G5B5A1: {
+      unsigned short p = ((unsigned short *)img->data)[i];
+      c.r = ((p >> 11) & 0x1F)*255/31;
+      c.g = ((p >> 6)  & 0x1F)*255/31;
+      c.b = ((p >> 1)  & 0x1F)*255/31;
+      c.a = (p & 0x01) ? 255 : 0;
+    } break;
+    case UNCOMPRESSED_R4G4B4A4: {
+      unsigned short p = ((unsigned short *)img->data)[i];
+      c.r = ((p >> 12) & 0x0F)*17;
+      c.g = ((p >> 8)  & 0x0F)*17;
+      c.b = ((p >> 4)  & 0x0F)*17;
+      c.a = (p & 0x0F)*17;
+    } break;
+    case UNCOMPRESSED_R8G8B8A8:
+      c = ((Color *)img->data)[i];
+      break;
+    case UNCOMPRESSED_R32:
+    case UNCOMPRESSED_R32G32B32:
+    case UNCOMPRESSED_R32G32B32A32: {
+      int     channels = img->format == UNCOMPRESSED_R32 ? 1 : img->format == UNCOMPRESSED_R32G32B32 ? 3 : 4;
+      float * p        = (float *)img->data + i*channels;
+      c.r = Clamp(p[0], 0.0f, 1.0f)*255;
+      c.g = channels == 1 ? c.r : Clamp(p[1], 0.0f, 1.0f)*255;
+      c.b = channels == 1 ? c.r : Clamp(p[2], 0.0f, 1.0f)*255;
+      if (channels == 4) c.a = Clamp(p[3], 0.0f, 1.0f)*255;
+    } break;
   }
-  if (!strcmp(key, "data")) { lua_pushstring(L, img->data); return 1; }
+  return c;
+}
+
+void _ptr_image_SetPixel(Image * img, int i, Color c){
+  switch (img->format) {
+    case UNCOMPRESSED_GRAYSCALE:
+      ((unsigned char *)img->data)[i] = (unsigned char)(c.r*0.299f + c.g*0.587f + c.b*0.114f);
+      break;
+    case UNCOMPRESSED_GRAY_ALPHA: {
+      unsigned char * p = (unsigned char *)img->data + i*2;
+      p[0] = (unsigned char)(c.r*0.299f + c.g*0.587f + c.b*0.114f);
+      p[1] = c.a;
+    } break;
+    case UNCOMPRESSED_R5G6B5:
+      ((unsigned short *)img->data)[i] = (unsigned short)((c.r*31/255) << 11 | (c.g*63/255) << 5 | (c.b*31/255));
+      break;
+    case UNCOMPRESSED_R8G8B8: {
+      unsigned char * p = (unsigned char *)img->data + i*3;
+      p[0] = c.r; p[1] = c.g; p[2] = c.b;
+    } break;
+    case UNCOMPRESSED_R5G5B5A1:
+      ((unsigned short *)img->data)[i] = (unsigned short)((c.r*31/255) << 11 | (c.g*31/255) << 6 | (c.b*31/255) << 1 | (c.a > 50 ? 1 : 0));
+      break;
+    case UNCOMPRESSED_R4G4B4A4:
+      ((unsigned short *)img->data)[i] = (unsigned short)((c.r*15/255) << 12 | (c.g*15/255) << 8 | (c.b*15/255) << 4 | (c.a*15/255));
+      break;
+    case UNCOMPRESSED_R8G8B8A8:
+      ((Color *)img->data)[i] = c;
+      break;
+    case UNCOMPRESSED_R32:
+      ((float *)img->data)[i] = (c.r*0.299f + c.g*0.587f + c.b*0.114f)/255.0f;
+      break;
+    case UNCOMPRESSED_R32G32B32:
+    case UNCOMPRESSED_R32G32B32A32: {
+      int     channels = img->format == UNCOMPRESSED_R32G32B32 ? 3 : 4;
+      float * p        = (float *)img->data + i*channels;
+      p[0] = c.r/255.0f; p[1] = c.g/255.0f; p[2] = c.b/255.0f;
+      if (channels == 4) p[3] = c.a/255.0f;
+    } break;
+  }
+}
 
-  luax_getclasskey(L, 1, 2);
+// Reads optional region at idx (Rectangle or x, y, w, h numbers), clamps it to image, returns next argument index
+int _ptr_image_checkRegion(lua_State *L, int idx, Image * img, int * x, int * y, int * w, int * h){
+  *x = 0; *y = 0; *w = img->width; *h = img->height;
+  if (luax_isclass(L, idx, "Rectangle")) {
+    Rectangle * r = (Rectangle *)luax_checkclass(L, idx, "Rectangle");
+    *x = r->x; *y = r->y; *w = r->width; *h = r->height;
+    idx++;
+  }
+  else if (lua_isnumber(L, idx)) {
+    *x = luaL_checkinteger(L, idx);
+    *y = luaL_checkinteger(L, idx + 1);
+    *w = luaL_checkinteger(L, idx + 2);
+    *h = luaL_checkinteger(L, idx + 3);
+    idx += 4;
+  }
+  if (*x < 0 || *y < 0 || *w < 0 || *h < 0 || *x + *w > img->width || *y + *h > img->height)
+    luaL_error(L, "Region [%d, %d, %d, %d] is out of image [%d, %d]", *x, *y, *w, *h, img->width, img->height);
+  return idx;
+}
+
+int _ptr_image_checkPixelIndex(lua_State *L, Image * img, int xidx){
+  int x = luaL_checkinteger(L, xidx);
+  int y = luaL_checkinteger(L, xidx + 1);
+  if (x < 0 || y < 0 || x >= img->width || y >= img->height)
+    luaL_error(L, "Pixel [%d, %d] is out of image [%d, %d]", x, y, img->width, img->height);
+  return y*img->width + x;
+}
+
+/*!MD
+#### Image:getPixel
+```lua
+-- variants
+Color Pixel = Image:getPixel(integer X, integer Y)
+Color Out = Image:getPixel(integer X, integer Y, Color Out)
+```
+Get pixel color converted from image format, new Color or stored to optional Out color
+*/
+int lua_class_image_GetPixel(lua_State *L){
+  Image * img = (Image *)luaL_checkudata(L, 1, "Image");
+  _ptr_image_checkPixelSize(L, img);
+  int i = _ptr_image_checkPixelIndex(L, img, 2);
+
+  Color * c;
+  if (lua_isnoneornil(L, 4)) c = (Color *)luax_newobject(L, "Color", sizeof(Color));
+  else {
+    c = (Color *)luax_checkclass(L, 4, "Color");
+    lua_settop(L, 4);
+  }
+  *c = _ptr_image_GetPixel(img, i);
   return 1;
 }
 
-int lua_class_image__Newindex(lua_State *L){
-  return 0;
+/*!MD
+#### Image:setPixel
+```lua
+Image:setPixel(integer X, integer Y, Color Color)
+```
+Set pixel color, converting it to image format
+*/
+int lua_class_image_SetPixel(lua_State *L){
+  Image * img = (Image *)luaL_checkudata(L, 1, "Image");
+  _ptr_image_checkPixelSize(L, img);
+  int i = _ptr_image_checkPixelIndex(L, img, 2);
+  Color * c = (Color *)luax_checkclass(L, 4, "Color");
+  _ptr_image_SetPixel(img, i, *c);
+  lua_settop(L, 1);
+  return 1;
+}
+
+// Buffer type matching image format channel type
+int _ptr_image_getBufferType(Image * img){
+  switch (img->format) {
+    case UNCOMPRESSED_R5G6B5:
+    case UNCOMPRESSED_R5G5B5A1:
+    case UNCOMPRESSED_R4G4B4A4:     return DATABUFFER_UINT16;
+    case UNCOMPRESSED_R32:
+    case UNCOMPRESSED_R32G32B32:
+    case UNCOMPRESSED_R32G32B32A32: return DATABUFFER_FLOAT32;
+  }
+  return DATABUFFER_UINT8;
+}
+
+DataBuffer * _ptr_image_pushView(lua_State *L, Image * img, int offset, int bytes){
+  int type = _ptr_image_getBufferType(img);
+  DataBuffer * b = lua_class_buffer_pushview(L, type, (unsigned char *)img->data + offset, bytes / lua_class_buffer_sizes[type], 1);
+  b->source      = img;
+  b->sourceImage = *img;
+  return b;
+}
+
+/*!MD
+#### Image:getBuffer
+```lua
+Buffer View = Image:getBuffer([integer Level])
+```
+Return mutable view of image pixels of mipmap level (0 by default), without copying. Buffer type depends on image format:
+* Uint16Buffer for R5G6B5, R5G5B5A1 and R4G4B4A4 (one element per pixel);
+* Float32Buffer for R32, R32G32B32 and R32G32B32A32 (one element per channel);
+* Uint8Buffer for others (one element per channel).
+*/
+int lua_class_image_GetBuffer(lua_State *L){
+  Image * img   = (Image *)luaL_checkudata(L, 1, "Image");
+  int     level = luaL_optinteger(L, 2, 0);
+  _ptr_image_checkPixelSize(L, img);
+  if (level < 0 || level >= img->mipmaps) return luaL_error(L, "Mipmap level %d is out of image [0, %d)", level, img->mipmaps);
+  int offset = 0, w = img->width, h = img->height;
+  for (int i = 0; i < level; i++) {
+    offset += GetPixelDataSize(w, h, img->format);
+    w = w > 1 ? w/2 : 1;
+    h = h > 1 ? h/2 : 1;
+  }
+  _ptr_image_pushView(L, img, offset, GetPixelDataSize(w, h, img->format));
+  return 1;
 }
 
+/*!MD
+#### Image:getRow
+```lua
+Buffer View = Image:getRow(integer Y)
+```
+Return mutable view of one pixel row, see [getBuffer](#ImagegetBuffer)
+*/
+int lua_class_image_GetRow(lua_State *L){
+  Image * img = (Image *)luaL_checkudata(L, 1, "Image");
+  int bpp = _ptr_image_checkPixelSize(L, img);
+  int y   = luaL_checkinteger(L, 2);
+  if (y < 0 || y >= img->height) return luaL_error(L, "Row %d is out of image [0, %d)", y, img->height);
+  _ptr_image_pushView(L, img, y*img->width*bpp, img->width*bpp);
+  return 1;
+}
+
+/*!MD
+#### Image:readPixels
+```lua
+-- variants
+Uint8Buffer Dst = Image:readPixels(Uint8Buffer Dst)
+Uint8Buffer Dst = Image:readPixels(Uint8Buffer Dst, Rectangle Region)
+Uint8Buffer Dst = Image:readPixels(Uint8Buffer Dst, integer X, integer Y, integer Width, integer Height)
+```
+Read pixels of image region to buffer as RGBA bytes (4 bytes per pixel, converted from image format)
+*/
+int lua_class_image_ReadPixels(lua_State *L){
+  Image      * img = (Image *)luaL_checkudata(L, 1, "Image");
+  DataBuffer * dst = lua_class_buffer_checktype(L, 2, DATABUFFER_UINT8);
+  int x, y, w, h;
+  _ptr_image_checkPixelSize(L, img);
+  _ptr_image_checkRegion(L, 3, img, &x, &y, &w, &h);
+  if (dst->count < w*h*4) return luaL_error(L, "Buffer is too small: %d bytes needed", w*h*4);
+
+  Color * out = (Color *)dst->data;
+  if (img->format == UNCOMPRESSED_R8G8B8A8)
+    for (int j = 0; j < h; j++) memcpy(out + j*w, (Color *)img->data + (y + j)*img->width + x, w*sizeof(Color));
+  else
+    for (int j = 0; j < h; j++)
+      for (int i = 0; i < w; i++) out[j*w + i] = _ptr_image_GetPixel(img, (y + j)*img->width + x + i);
+
+  lua_settop(L, 2);
+  return 1;
+}
+
+/*!MD
+#### Image:writePixels
+```lua
+-- variants
+Image:writePixels(Uint8Buffer Src)
+Image:writePixels(Uint8Buffer Src, Rectangle Region)
+Image:writePixels(Uint8Buffer Src, integer X, integer Y, integer Width, integer Height)
+```
+Write RGBA bytes from buffer to image region (4 bytes per pixel, converted to image format)
+*/
+int lua_class_image_WritePixels(lua_State *L){
+  Image      * img = (Image *)luaL_checkudata(L, 1, "Image");
+  DataBuffer * src = lua_class_buffer_checktype(L, 2, DATABUFFER_UINT8);
+  int x, y, w, h;
+  _ptr_image_checkPixelSize(L, img);
+  _ptr_image_checkRegion(L, 3, img, &x, &y, &w, &h);
+  if (src->count < w*h*4) return luaL_error(L, "Buffer is too small: %d bytes needed", w*h*4);
+
+  Color * in = (Color *)src->data;
+  if (img->format == UNCOMPRESSED_R8G8B8A8)
+    for (int j = 0; j < h; j++) memcpy((Color *)img->data + (y + j)*img->width + x, in + j*w, w*sizeof(Color));
+  else
+    for (int j = 0; j < h; j++)
+      for (int i = 0; i < w; i++) _ptr_image_SetPixel(img, (y + j)*img->width + x + i, in[j*w + i]);
+
+  lua_settop(L, 1);
+  return 1;
+}
+
+// fields
+int lua_class_image_GetDataField(lua_State *L, void * obj){
+  Image * img = (Image *)obj;
+  lua_pushstring(L, img->data);
+  return 1;
+}
+
+luax_Field luaray_fields_image[] = {
+  luax_field(Image, "width",   width,   LUAX_FIELD_INT | LUAX_FIELD_READONLY),
+  luax_field(Image, "height",  height,  LUAX_FIELD_INT | LUAX_FIELD_READONLY),
+  luax_field(Image, "mipmaps", mipmaps, LUAX_FIELD_INT | LUAX_FIELD_READONLY),
+  luax_field(Image, "format",  format,  LUAX_FIELD_INT | LUAX_FIELD_READONLY),
+  luax_fieldcustom("data",    lua_class_image_GetDataField),
+  {NULL}
+};
+
 int lua_class_image__GC(lua_State *L){
   Image * img = (Image *)luaL_checkudata(L, 1, "Image");
   UnloadImage(*img);
@@ -4604,10 +6052,14 @@ luaL_Reg luaray_class_image[] = {
   {"contrast",         lua_class_image_Contrast},
   {"brightness",       lua_class_image_Brightness},
   {"replaceColor",     lua_class_image_ColorReplace},
+  {"getPixel",         lua_class_image_GetPixel},
+  {"setPixel",         lua_class_image_SetPixel},
+  {"getBuffer",        lua_class_image_GetBuffer},
+  {"getRow",           lua_class_image_GetRow},
+  {"readPixels",       lua_class_image_ReadPixels},
+  {"writePixels",      lua_class_image_WritePixels},
 
   // meta
-  {"__index",          lua_class_image__Index},
-  {"__newindex",       lua_class_image__Newindex},
   {"__gc",             lua_class_image__GC},
   {"__tostring",       lua_class_image__ToString},
   {NULL, NULL}
@@ -4615,57 +6067,3981 @@ luaL_Reg luaray_class_image[] = {
 
 
 /*!MD
-## Texture
+## AsyncTask
+Result of asynchronous loading function (like [rl.async.LoadImage](#LoadImage)).
+File reading and decoding are done by pool threads, task is polled or awaited from main thread.
+
+| **Methods**                      | description
+| :------------------------------- | :-----------
+| [isDone](#AsyncTaskisDone)       | Check if task is finished
+| [get](#AsyncTaskget)             | Return task result if it is finished
+| [wait](#AsyncTaskwait)           | Block calling thread until task is finished, return result
+
+### Initialization
+```lua
+AsyncTask Task = rl.async.LoadImage(string Filename[, function Callback])
+AsyncTask Task = rl.async.LoadFileData(string Filename[, function Callback])
+AsyncTask Task = rl.fs.WalkAsync(string Path[, table Options[, function Callback]])
+```
+Tasks are created by [rl.async](#Async) functions only.
+*/
+enum {
+  ASYNCTASK_IMAGE,
+  ASYNCTASK_FILEDATA,
+  ASYNCTASK_WALK,
+};
+
+enum {
+  ASYNCTASK_PENDING,
+  ASYNCTASK_DONE,     // result is ready
+  ASYNCTASK_FALLBACK, // format can't be decoded by worker, raylib loader is used on main thread
+  ASYNCTASK_FAILED,
+};
+
+// Shared by Lua object and pool job, freed by the last one, state is guarded by pool lock
+typedef struct AsyncTask {
+  int             type;     // ASYNCTASK_IMAGE, ASYNCTASK_FILEDATA, ASYNCTASK_WALK
+  int             state;    // ASYNCTASK_PENDING etc
+  int             refs;
+  int             result;   // registry reference to result object, LUA_NOREF until first get
+  const char    * error;
+  Image           image;
+  unsigned char * data;
+  int             size;
+  ray_fs_walker * walker;   // options of ASYNCTASK_WALK, entries are serialized to data
+  void         (* onResult)(lua_State *L, struct AsyncTask * task, int index); // called once for created result
+  struct AsyncTask * leader; // task which job loads result for this one, NULL if task has own job
+  int             followers; // count of tasks with this leader, they get copies of image
+  char            path[1];  // allocated with task
+} AsyncTask;
+
+void _ptr_asynctask_Release(AsyncTask * task){
+  ray_threads_lock(&ray_threads_pool.lock);
+  int refs = --task->refs;
+  ray_threads_unlock(&ray_threads_pool.lock);
+  if (refs) return;
+  UnloadImage(task->image);
+  free(task->data);
+  if (task->walker) ray_fs_close(task->walker);
+  free(task->walker);
+  if (task->leader) _ptr_asynctask_Release(task->leader);
+  free(task);
+}
+
+// Output of pool job, copied to task under pool lock when job is finished.
+// Job reads only task fields which are not changed after queueing (type, path, walker).
+typedef struct AsyncTaskResult {
+  int             state;
+  const char    * error;
+  Image           image;
+  unsigned char * data;
+  int             size;
+} AsyncTaskResult;
+
+void _ptr_asynctask_LoadImage(AsyncTask * task, AsyncTaskResult * out){
+  FILE * f = fopen(task->path, "rb");
+  if (!f) {
+    out->error = "file is not exists";
+    out->state = ASYNCTASK_FAILED;
+    return;
+  }
+  // same as LoadImage does, but without raylib functions which use static buffers
+  Image * img = &out->image;
+  int channels = 0;
+  if (stbi_is_hdr_from_file(f)) {
+    img->data = stbi_loadf_from_file(f, &img->width, &img->height, &channels, 0);
+    if      (channels == 1) img->format = UNCOMPRESSED_R32;
+    else if (channels == 3) img->format = UNCOMPRESSED_R32G32B32;
+    else if (channels == 4) img->format = UNCOMPRESSED_R32G32B32A32;
+  }
+  else {
+    img->data = stbi_load_from_file(f, &img->width, &img->height, &channels, 0);
+    if      (channels == 1) img->format = UNCOMPRESSED_GRAYSCALE;
+    else if (channels == 2) img->format = UNCOMPRESSED_GRAY_ALPHA;
+    else if (channels == 3) img->format = UNCOMPRESSED_R8G8B8;
+    else if (channels == 4) img->format = UNCOMPRESSED_R8G8B8A8;
+  }
+  fclose(f);
+  img->mipmaps = 1;
+  if (img->data && !img->format) {
+    free(img->data);
+    img->data = NULL;
+  }
+  out->state = img->data ? ASYNCTASK_DONE : ASYNCTASK_FALLBACK;
+}
+
+void _ptr_asynctask_LoadFileData(AsyncTask * task, AsyncTaskResult * out){
+  FILE * f = fopen(task->path, "rb");
+  if (!f) {
+    out->error = "file is not exists";
+    out->state = ASYNCTASK_FAILED;
+    return;
+  }
+  fseek(f, 0, SEEK_END);
+  long size = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  out->data = (unsigned char *)malloc(size > 0 ? size : 1);
+  if (size < 0 || !out->data) out->error = "can't allocate memory";
+  else if (fread(out->data, 1, size, f) != (size_t)size) out->error = "can't read file";
+  else out->size = size;
+  fclose(f);
+  out->state = out->error ? ASYNCTASK_FAILED : ASYNCTASK_DONE;
+}
+
+// Entry layout: u8 isDir, i64 size, i64 modTime, u32 pathLength, path
+void _ptr_asynctask_Walk(AsyncTask * task, AsyncTaskResult * out){
+  if (!ray_fs_open(task->walker, task->path)) {
+    out->error = "directory is not exists";
+    out->state = ASYNCTASK_FAILED;
+    return;
+  }
+  ray_fs_entry entry;
+  size_t capacity = 0;
+  while (!out->error && ray_fs_next(task->walker, &entry)) {
+    size_t len = strlen(entry.path), need = out->size + 21 + len;
+    if (need > capacity) {
+      capacity = capacity ? capacity*2 : 64*1024;
+      if (capacity < need) capacity = need;
+      unsigned char * data = capacity < 0x7FFFFFFF ? (unsigned char *)realloc(out->data, capacity) : NULL;
+      if (!data) {
+        out->error = "can't allocate memory";
+        break;
+      }
+      out->data = data;
+    }
+    unsigned char * p = out->data + out->size;
+    p[0] = entry.isDir;
+    memcpy(p + 1, &entry.size, 8);
+    memcpy(p + 9, &entry.modTime, 8);
+    ray_archive_put32(p + 17, len);
+    memcpy(p + 21, entry.path, len);
+    out->size = need;
+  }
+  ray_fs_close(task->walker);
+  out->state = out->error ? ASYNCTASK_FAILED : ASYNCTASK_DONE;
+}
+
+void _ptr_asynctask_Job(void * data){
+  AsyncTask *     task   = (AsyncTask *)data;
+  AsyncTaskResult result = {ASYNCTASK_PENDING};
+  if (task->type == ASYNCTASK_IMAGE) _ptr_asynctask_LoadImage(task, &result);
+  else if (task->type == ASYNCTASK_WALK) _ptr_asynctask_Walk(task, &result);
+  else _ptr_asynctask_LoadFileData(task, &result);
+  // main thread reads output fields only after state is changed
+  ray_threads_lock(&ray_threads_pool.lock);
+  task->image = result.image;
+  task->data  = result.data;
+  task->size  = result.size;
+  task->error = result.error;
+  task->state = result.state;
+  ray_threads_broadcast(&ray_threads_pool.done);
+  ray_threads_unlock(&ray_threads_pool.lock);
+  _ptr_asynctask_Release(task);
+}
+
+// Creates task object on top of the stack, it is not queued
+AsyncTask * _ptr_asynctask_New(lua_State *L, int type, const char * path){
+  size_t len = strlen(path);
+  AsyncTask * task = (AsyncTask *)calloc(1, sizeof(AsyncTask) + len);
+  if (!task) {
+    luaL_error(L, "Can't allocate async task");
+    return NULL;
+  }
+  AsyncTask ** ptr = (AsyncTask **)luax_newobject(L, "AsyncTask", sizeof(AsyncTask *));
+  *ptr = task;
+  task->type   = type;
+  task->refs   = 1;
+  task->result = LUA_NOREF;
+  memcpy(task->path, path, len + 1);
+  return task;
+}
+
+// Creates task object on top of the stack and queues it
+AsyncTask * _ptr_asynctask_Push(lua_State *L, int type, const char * path){
+  AsyncTask * task = _ptr_asynctask_New(L, type, path);
+  task->refs = 2;
+  ray_threads_push(_ptr_asynctask_Job, task);
+  return task;
+}
+
+// Makes task wait for the job of leader, result is copied from leader's one
+void _ptr_asynctask_Follow(AsyncTask * task, AsyncTask * leader){
+  ray_threads_lock(&ray_threads_pool.lock);
+  leader->refs++;
+  ray_threads_unlock(&ray_threads_pool.lock);
+  leader->followers++;
+  task->leader = leader;
+}
+
+int _ptr_asynctask_GetState(AsyncTask * task){
+  if (task->leader) task = task->leader;
+  ray_threads_lock(&ray_threads_pool.lock);
+  int state = task->state;
+  ray_threads_unlock(&ray_threads_pool.lock);
+  return state;
+}
+
+// Pushes result (or nil, error) of finished task
+int _ptr_asynctask_PushResult(lua_State *L, AsyncTask * task){
+  if (task->result == LUA_NOREF) {
+    AsyncTask * source = task->leader ? task->leader : task;
+    if (source->state == ASYNCTASK_FALLBACK) {
+      source->image = LoadImage(source->path);
+      if (source->image.data) source->state = ASYNCTASK_DONE;
+      else {
+        source->error = "unsupported file format";
+        source->state = ASYNCTASK_FAILED;
+      }
+    }
+    if (source->state == ASYNCTASK_FAILED) {
+      lua_pushnil(L);
+      lua_pushfstring(L, "Can't load \"%s\", %s", task->path, source->error);
+      return 2;
+    }
+    if (task->type == ASYNCTASK_IMAGE) {
+      Image * img = (Image *)luax_newobject(L, "Image", sizeof(Image));
+      if (source != task || task->followers) *img = ImageCopy(source->image); // every task gets own image
+      else {
+        *img = task->image;
+        task->image.data = NULL; // owned by Image object now
+      }
+    }
+    else if (task->type == ASYNCTASK_WALK) {
+      lua_newtable(L);
+      int n = 0;
+      for (const unsigned char * p = task->data; p < task->data + task->size; ) {
+        long long size, modTime;
+        size_t len = ray_archive_u32(p + 17);
+        memcpy(&size, p + 1, 8);
+        memcpy(&modTime, p + 9, 8);
+        lua_createtable(L, 0, 4);
+        lua_pushstring(L, "path");
+        lua_pushlstring(L, (const char *)p + 21, len);
+        lua_rawset(L, -3);
+        luax_tsstring(L,  "type", p[0] ? "directory" : "file");
+        luax_tsnumber(L,  "size", size);
+        luax_tsnumber(L,  "modTime", modTime);
+        lua_rawseti(L, -2, ++n);
+        p += 21 + len;
+      }
+      free(task->data);
+      task->data = NULL;
+    }
+    else {
+      lua_pushlstring(L, (const char *)task->data, task->size);
+      free(task->data);
+      task->data = NULL;
+    }
+    if (source->onResult) {
+      source->onResult(L, source, lua_gettop(L));
+      source->onResult = NULL;
+    }
+    task->result = luaL_ref(L, LUA_REGISTRYINDEX);
+  }
+  lua_rawgeti(L, LUA_REGISTRYINDEX, task->result);
+  return 1;
+}
+
+/*!MD
+#### AsyncTask:isDone
+```lua
+boolean Done = AsyncTask:isDone()
+```
+Check if task is finished (successfully or not).
+*/
+int lua_class_asynctask_IsDone(lua_State *L){
+  AsyncTask * task = *(AsyncTask **)luaL_checkudata(L, 1, "AsyncTask");
+  lua_pushboolean(L, _ptr_asynctask_GetState(task) != ASYNCTASK_PENDING);
+  return 1;
+}
+
+/*!MD
+#### AsyncTask:get
+```lua
+-- variants
+nil           = AsyncTask:get() -- task is not finished
+Image Img     = AsyncTask:get() -- for rl.async.LoadImage
+string Data   = AsyncTask:get() -- for rl.async.LoadFileData
+table Entries = AsyncTask:get() -- for rl.fs.WalkAsync
+nil, string E = AsyncTask:get() -- loading error
+```
+Return task result without blocking, the same object is returned on each call.
+*/
+int lua_class_asynctask_Get(lua_State *L){
+  AsyncTask * task = *(AsyncTask **)luaL_checkudata(L, 1, "AsyncTask");
+  if (_ptr_asynctask_GetState(task) == ASYNCTASK_PENDING) return 0;
+  return _ptr_asynctask_PushResult(L, task);
+}
+
+/*!MD
+#### AsyncTask:wait
+```lua
+Image/string Result, string Error = AsyncTask:wait()
+```
+Block calling thread until task is finished, return the same as AsyncTask:get.
+Use [rl.async.Await](#Await) inside of coroutines instead.
+*/
+int lua_class_asynctask_Wait(lua_State *L){
+  AsyncTask * task   = *(AsyncTask **)luaL_checkudata(L, 1, "AsyncTask");
+  AsyncTask * source = task->leader ? task->leader : task;
+  ray_threads_lock(&ray_threads_pool.lock);
+  while (source->state == ASYNCTASK_PENDING) ray_threads_wait(&ray_threads_pool.done, &ray_threads_pool.lock);
+  ray_threads_unlock(&ray_threads_pool.lock);
+  return _ptr_asynctask_PushResult(L, task);
+}
+
+int lua_class_asynctask__GC(lua_State *L){
+  AsyncTask * task = *(AsyncTask **)luaL_checkudata(L, 1, "AsyncTask");
+  luaL_unref(L, LUA_REGISTRYINDEX, task->result);
+  _ptr_asynctask_Release(task);
+  return 0;
+}
+
+int lua_class_asynctask__ToString(lua_State *L){
+  AsyncTask * task = *(AsyncTask **)luaL_checkudata(L, 1, "AsyncTask");
+  lua_pushfstring(L, "AsyncTask[%s]: %p", task->path, task);
+  return 1;
+}
+
+luaL_Reg luaray_class_asynctask[] = {
+  {"isDone",     lua_class_asynctask_IsDone},
+  {"get",        lua_class_asynctask_Get},
+  {"wait",       lua_class_asynctask_Wait},
+
+  // meta
+  {"__gc",       lua_class_asynctask__GC},
+  {"__tostring", lua_class_asynctask__ToString},
+  {NULL, NULL}
+};
+
+
+// Assets: resources with explicit unloading and sharing.
+// Every load increments references of asset and every :unload() decrements them, asset is freed when references
+// reach zero or when object is collected. Assets loaded from files are cached by path and parameters, so loading
+// the same file again returns the same object (until file modification time is changed). Released assets are kept
+// in cache while their total size fits the budget (rl.assets.SetBudget), the least recently used ones are freed first.
+typedef struct Asset {
+  void       * object;                 // userdata which contains asset
+  void      (* unload)(void * object);
+  char       * key;                    // cache key, NULL if asset is not cached
+  char       * path;                   // file of asset (allocated with key), NULL if asset is not loaded from file
+  int       (* reload)(void * object, const char * path); // loads file again in place, returns new size or 0
+  unsigned int version;                // incremented by every reload
+  int          refs;                   // loads which are not matched by unload
+  int          bytes;                  // estimated size
+  int          loaded;
+  unsigned int stamp;                  // release time, retained assets are freed from the oldest
+  long         modTime;                // file modification time on loading
+} Asset;
+
+#define ASSETS_KEY   "raylib_luamore.assets"   // weak table: key -> object, object -> Asset *
+#define RETAINED_KEY "raylib_luamore.retained" // released assets kept by budget: Asset * -> object
+
+struct {
+  int          budget;                 // bytes, 0 frees released assets immediately
+  int          retainedBytes, retainedCount;
+  unsigned int tick;
+  int          hits, misses, evictions, invalidations;
+} lua_class_assets = {0};
+
+// Pushes registry table, creates it if needed
+void _ptr_asset_PushTable(lua_State *L, const char * name, const char * mode){
+  lua_getfield(L, LUA_REGISTRYINDEX, name);
+  if (!lua_isnil(L, -1)) return;
+  lua_pop(L, 1);
+  lua_newtable(L);
+  if (mode) {
+    lua_newtable(L);
+    lua_pushstring(L, mode);
+    lua_setfield(L, -2, "__mode");
+    lua_setmetatable(L, -2);
+  }
+  lua_pushvalue(L, -1);
+  lua_setfield(L, LUA_REGISTRYINDEX, name);
+}
+
+void _ptr_asset_Unretain(lua_State *L, Asset * asset){
+  _ptr_asset_PushTable(L, RETAINED_KEY, NULL);
+  lua_pushlightuserdata(L, asset);
+  lua_rawget(L, -2);
+  if (!lua_isnil(L, -1)) {
+    lua_pushlightuserdata(L, asset);
+    lua_pushnil(L);
+    lua_rawset(L, -4);
+    lua_class_assets.retainedBytes -= asset->bytes;
+    lua_class_assets.retainedCount--;
+  }
+  lua_pop(L, 2);
+}
+
+void _ptr_asset_Free(lua_State *L, Asset * asset){
+  if (!asset->loaded) return;
+  if (!asset->refs) _ptr_asset_Unretain(L, asset);
+  if (asset->key) {
+    // entry may belong to newer object, if this one is collected
+    _ptr_asset_PushTable(L, ASSETS_KEY, "kv");
+    lua_getfield(L, -1, asset->key);
+    if (lua_touserdata(L, -1) == asset->object) {
+      lua_pushnil(L);
+      lua_setfield(L, -3, asset->key);
+    }
+    lua_pop(L, 2);
+    free(asset->key);
+    asset->key  = NULL;
+    asset->path = NULL;
+  }
+  asset->unload(asset->object);
+  asset->loaded = 0;
+  asset->refs   = 0;
+}
+
+// Frees the oldest retained assets until they fit budget
+void _ptr_asset_Trim(lua_State *L){
+  while (lua_class_assets.retainedCount > 0 && lua_class_assets.retainedBytes > lua_class_assets.budget) {
+    Asset * oldest = NULL;
+    _ptr_asset_PushTable(L, RETAINED_KEY, NULL);
+    lua_pushnil(L);
+    while (lua_next(L, -2)) {
+      Asset * asset = (Asset *)lua_touserdata(L, -2);
+      if (!oldest || asset->stamp < oldest->stamp) oldest = asset;
+      lua_pop(L, 1);
+    }
+    lua_pop(L, 1);
+    if (!oldest) break;
+    _ptr_asset_Free(L, oldest);
+    lua_class_assets.evictions++;
+  }
+}
+
+// Removes asset from cache, it is freed if nobody uses it
+void _ptr_asset_Forget(lua_State *L, Asset * asset){
+  if (!asset->refs) {
+    _ptr_asset_Free(L, asset);
+    return;
+  }
+  _ptr_asset_PushTable(L, ASSETS_KEY, "kv");
+  lua_pushnil(L);
+  lua_setfield(L, -2, asset->key);
+  lua_pop(L, 1);
+  free(asset->key);
+  asset->key  = NULL;
+  asset->path = NULL;
+}
+
+// Pushes cached object (or nil) and returns its asset, references are not changed
+Asset * _ptr_asset_Lookup(lua_State *L, const char * key){
+  _ptr_asset_PushTable(L, ASSETS_KEY, "kv");
+  lua_getfield(L, -1, key);
+  lua_pushvalue(L, -1);
+  lua_rawget(L, -3);
+  Asset * asset = (Asset *)lua_touserdata(L, -1);
+  lua_pop(L, 1);
+  lua_remove(L, -2);
+  return asset;
+}
+
+// Pushes cached object and adds reference to it, returns 0 (and pushes nothing) if there is no object.
+// Object loaded from path is dropped from cache if file is modified since loading.
+int _ptr_asset_Find(lua_State *L, const char * key, const char * path){
+  Asset * asset = _ptr_asset_Lookup(L, key);
+  if (asset && asset->loaded && path && GetFileModTime(path) != asset->modTime) {
+    _ptr_asset_Forget(L, asset);
+    lua_class_assets.invalidations++;
+    asset = NULL;
+  }
+  if (!asset || !asset->loaded) {
+    lua_pop(L, 1);
+    lua_class_assets.misses++;
+    return 0;
+  }
+  lua_class_assets.hits++;
+  if (!asset->refs) _ptr_asset_Unretain(L, asset);
+  asset->refs++;
+  return 1;
+}
+
+// Registers loaded asset of object at stack index, key and path may be NULL
+void _ptr_asset_Add(lua_State *L, int index, Asset * asset, const char * key, const char * path, int bytes, void (*unload)(void * object)){
+  asset->object  = lua_touserdata(L, index);
+  asset->unload  = unload;
+  asset->key     = NULL;
+  asset->path    = NULL;
+  asset->refs    = 1;
+  asset->bytes   = bytes;
+  asset->loaded  = 1;
+  asset->modTime = path ? GetFileModTime(path) : 0;
+  size_t len = key ? strlen(key) : 0;
+  if (!key || !(asset->key = (char *)malloc(len + 1 + (path ? strlen(path) + 1 : 0)))) return;
+  strcpy(asset->key, key);
+  if (path) asset->path = strcpy(asset->key + len + 1, path);
+  if (index < 0) index = lua_gettop(L) + index + 1;
+  _ptr_asset_PushTable(L, ASSETS_KEY, "kv");
+  lua_pushvalue(L, index);
+  lua_setfield(L, -2, key);
+  lua_pushvalue(L, index);
+  lua_pushlightuserdata(L, asset);
+  lua_rawset(L, -3);
+  lua_pop(L, 1);
+}
+
+// Removes reference (:unload), asset is freed or retained by cache if it is not used anymore
+void _ptr_asset_Release(lua_State *L, int index, Asset * asset){
+  if (!asset->loaded || !asset->refs || --asset->refs) return;
+  if (!asset->key || asset->bytes > lua_class_assets.budget) {
+    _ptr_asset_Free(L, asset);
+    return;
+  }
+  _ptr_asset_PushTable(L, RETAINED_KEY, NULL);
+  lua_pushlightuserdata(L, asset);
+  lua_pushvalue(L, index);
+  lua_rawset(L, -3);
+  lua_pop(L, 1);
+  asset->stamp = ++lua_class_assets.tick;
+  lua_class_assets.retainedBytes += asset->bytes;
+  lua_class_assets.retainedCount++;
+  _ptr_asset_Trim(L);
+}
+
+// Reloads used assets of modified file in place (objects are the same, data is replaced), returns their count.
+// Unused, not reloadable or failed ones are dropped from cache, so they are loaded from file on next request.
+int _ptr_asset_Reload(lua_State *L, const char * path){
+  int top = lua_gettop(L), count = 0, reloaded = 0;
+  lua_newtable(L);                                     // top + 1: matched objects
+  _ptr_asset_PushTable(L, ASSETS_KEY, "kv");           // top + 2
+  lua_pushnil(L);
+  while (lua_next(L, top + 2)) {
+    if (lua_type(L, -2) == LUA_TSTRING) {
+      lua_pushvalue(L, -1);
+      lua_rawget(L, top + 2);
+      Asset * asset = (Asset *)lua_touserdata(L, -1);
+      lua_pop(L, 1);
+      if (asset && asset->path && !strcmp(asset->path, path)) {
+        lua_rawseti(L, top + 1, ++count);
+        continue;
+      }
+    }
+    lua_pop(L, 1);
+  }
+  for (int i = 1; i <= count; i++) {
+    lua_rawgeti(L, top + 1, i);
+    lua_rawget(L, top + 2);
+    Asset * asset = (Asset *)lua_touserdata(L, -1);
+    lua_pop(L, 1);
+    int bytes = asset->refs && asset->reload ? asset->reload(asset->object, path) : 0;
+    if (!bytes) {
+      _ptr_asset_Forget(L, asset);
+      continue;
+    }
+    asset->bytes   = bytes;
+    asset->modTime = GetFileModTime(path);
+    asset->version++;
+    reloaded++;
+  }
+  lua_settop(L, top);
+  return reloaded;
+}
+
+
+/*!MD
+## Texture
+Texture stored in GPU memory (VRAM).
+
+| **Fields**                                 | description
+| :----------------------------------------- | :-----------
+| id                                         | OpenGL texture id, read only
+| width                                      | Texture width, read only
+| height                                     | Texture height, read only
+| mipmaps                                    | Mipmap levels, 1 by default, read only
+| format                                     | Data format (integer, see [eTexture](#etexture)), read only
+
+| **Methods**                                | description
+| :----------------------------------------- | :-----------
+| [draw](#Texturedraw)                       | Draw texture
+| [drawEx](#TexturedrawEx)                   | Draw texture with rotation and scale
+| [drawRec](#TexturedrawRec)                 | Draw part of texture
+| [drawPro](#TexturedrawPro)                 | Draw part of texture to destination rectangle
+| [setFilter](#TexturesetFilter)             | Set texture scaling filter mode
+| [setWrap](#TexturesetWrap)                 | Set texture wrapping mode
+| [genMipmaps](#TexturegenMipmaps)           | Generate GPU mipmaps
+| [getImage](#TexturegetImage)               | Get pixel data from GPU as Image
+| [unload](#Textureunload)                   | Release texture
+| [isLoaded](#TextureisLoaded)               | Check if texture is not unloaded
+
+### Initialization
+```lua
+-- variants
+Texture Tex = rl.Texture(string Filename)
+Texture Tex = rl.Texture(Image Img)
+```
+Load texture from file or from image. Textures loaded from file are shared:
+loading the same file again returns the same object, which should be unloaded the same number of times.
+*/
+typedef struct TextureObject {
+  Texture2D texture;                   // should be first, fields are accessed by offset
+  Asset     asset;
+} TextureObject;
+
+typedef struct RenderTextureObject {
+  RenderTexture2D target;              // should be first, fields are accessed by offset
+  Asset           asset;
+} RenderTextureObject;
+
+void _ptr_texture_Unload(void * object){
+  UnloadTexture(((TextureObject *)object)->texture);
+  memset(&((TextureObject *)object)->texture, 0, sizeof(Texture2D));
+}
+
+int _ptr_texture_Bytes(Texture2D texture){
+  int bytes = GetPixelDataSize(texture.width, texture.height, texture.format);
+  return texture.mipmaps > 1 ? bytes + bytes/3 : bytes;
+}
+
+// Texture id is changed, filter and wrap are reset to defaults
+int _ptr_texture_Reload(void * object, const char * path){
+  TextureObject * tex = (TextureObject *)object;
+  Image image = LoadImage(path);
+  if (!image.data) return 0;
+  Texture2D texture = LoadTextureFromImage(image);
+  UnloadImage(image);
+  if (!texture.id) return 0;
+  if (tex->texture.mipmaps > 1) GenTextureMipmaps(&texture);
+  rlglDraw(); // batch may use old texture
+  UnloadTexture(tex->texture);
+  tex->texture = texture;
+  return _ptr_texture_Bytes(texture);
+}
+
+// Returns texture of Texture or RenderTexture object, flip is set for render textures (they are upside down)
+Texture2D _ptr_texture_Check(lua_State *L, int index, int * flip){
+  if (luax_isclass(L, index, "RenderTexture")) {
+    RenderTextureObject * rt = (RenderTextureObject *)lua_touserdata(L, index);
+    if (!rt->asset.loaded) luaL_error(L, "RenderTexture is unloaded");
+    *flip = 1;
+    return rt->target.texture;
+  }
+  TextureObject * tex = (TextureObject *)luaL_checkudata(L, index, "Texture");
+  if (!tex->asset.loaded) luaL_error(L, "Texture is unloaded");
+  *flip = 0;
+  return tex->texture;
+}
+
+// Converts source rectangle for flipped texture
+Rectangle _ptr_texture_Source(Texture2D texture, Rectangle src, int flip){
+  if (flip) {
+    src.y      = texture.height - src.y - src.height;
+    src.height = -src.height;
+  }
+  return src;
+}
+
+int lua_class_texture_new(lua_State *L){
+  if (luax_isclass(L, 1, "Image")) {
+    Image * img = (Image *)luaL_checkudata(L, 1, "Image");
+    TextureObject * tex = (TextureObject *)luax_newobject(L, "Texture", sizeof(TextureObject));
+    memset(tex, 0, sizeof(TextureObject));
+    tex->texture = LoadTextureFromImage(*img);
+    _ptr_asset_Add(L, -1, &tex->asset, NULL, NULL, _ptr_texture_Bytes(tex->texture), _ptr_texture_Unload);
+    return 1;
+  }
+  const char * fname = luaL_checkstring(L, 1);
+  lua_pushfstring(L, "Texture|%s", fname);
+  if (_ptr_asset_Find(L, lua_tostring(L, -1), fname)) return 1;
+  if (!FileExists(fname))
+    return luaL_error(L, "Can't load texture \"%s\", file is not exists", fname);
+  TextureObject * tex = (TextureObject *)luax_newobject(L, "Texture", sizeof(TextureObject));
+  memset(tex, 0, sizeof(TextureObject));
+  tex->texture = LoadTexture(fname);
+  if (!tex->texture.id) return luaL_error(L, "Can't load texture \"%s\"", fname);
+  _ptr_asset_Add(L, -1, &tex->asset, lua_tostring(L, -2), fname, _ptr_texture_Bytes(tex->texture), _ptr_texture_Unload);
+  tex->asset.reload = _ptr_texture_Reload;
+  return 1;
+}
+
+/*!MD
+#### Texture:draw
+```lua
+-- variants
+Texture Tex = Texture:draw(number X, number Y[, Color Tint])
+Texture Tex = Texture:draw(Vector2 Position[, Color Tint])
+```
+Draw texture, default Tint is white.
+*/
+int lua_class_texture_Draw(lua_State *L){
+  int flip;
+  Texture2D texture = _ptr_texture_Check(L, 1, &flip);
+  Vector2 position;
+  int idx = 3;
+  if (lua_isnumber(L, 2)) {
+    position = (Vector2){ luaL_checknumber(L, 2), luaL_checknumber(L, 3) };
+    idx = 4;
+  }
+  else position = *(Vector2 *)luax_checkclass(L, 2, "Vector2");
+  Color tint = lua_isnoneornil(L, idx) ? WHITE : *(Color *)luax_checkclass(L, idx, "Color");
+  Rectangle src = _ptr_texture_Source(texture, (Rectangle){ 0, 0, texture.width, texture.height }, flip);
+  DrawTextureRec(texture, src, position, tint);
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Texture:drawEx
+```lua
+Texture Tex = Texture:drawEx(Vector2 Position, number Rotation, number Scale[, Color Tint])
+```
+Draw texture with rotation (in degrees, around top-left corner) and scale.
+*/
+int lua_class_texture_DrawEx(lua_State *L){
+  int flip;
+  Texture2D texture = _ptr_texture_Check(L, 1, &flip);
+  Vector2 position  = *(Vector2 *)luax_checkclass(L, 2, "Vector2");
+  float   rotation  = luaL_checknumber(L, 3);
+  float   scale     = luaL_checknumber(L, 4);
+  Color   tint      = lua_isnoneornil(L, 5) ? WHITE : *(Color *)luax_checkclass(L, 5, "Color");
+  Rectangle src = _ptr_texture_Source(texture, (Rectangle){ 0, 0, texture.width, texture.height }, flip);
+  Rectangle dst = { position.x, position.y, texture.width*scale, texture.height*scale };
+  DrawTexturePro(texture, src, dst, (Vector2){ 0, 0 }, rotation, tint);
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Texture:drawRec
+```lua
+Texture Tex = Texture:drawRec(Rectangle Source, Vector2 Position[, Color Tint])
+```
+Draw part of texture defined by Source rectangle.
+*/
+int lua_class_texture_DrawRec(lua_State *L){
+  int flip;
+  Texture2D texture = _ptr_texture_Check(L, 1, &flip);
+  Rectangle src      = *(Rectangle *)luax_checkclass(L, 2, "Rectangle");
+  Vector2   position = *(Vector2 *)luax_checkclass(L, 3, "Vector2");
+  Color     tint     = lua_isnoneornil(L, 4) ? WHITE : *(Color *)luax_checkclass(L, 4, "Color");
+  DrawTextureRec(texture, _ptr_texture_Source(texture, src, flip), position, tint);
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Texture:drawPro
+```lua
+Texture Tex = Texture:drawPro(Rectangle Source, Rectangle Dest, Vector2 Origin, number Rotation[, Color Tint])
+```
+Draw part of texture defined by Source rectangle to Dest rectangle, rotated around Origin (relative to Dest).
+*/
+int lua_class_texture_DrawPro(lua_State *L){
+  int flip;
+  Texture2D texture = _ptr_texture_Check(L, 1, &flip);
+  Rectangle src      = *(Rectangle *)luax_checkclass(L, 2, "Rectangle");
+  Rectangle dst      = *(Rectangle *)luax_checkclass(L, 3, "Rectangle");
+  Vector2   origin   = *(Vector2 *)luax_checkclass(L, 4, "Vector2");
+  float     rotation = luaL_checknumber(L, 5);
+  Color     tint     = lua_isnoneornil(L, 6) ? WHITE : *(Color *)luax_checkclass(L, 6, "Color");
+  DrawTexturePro(texture, _ptr_texture_Source(texture, src, flip), dst, origin, rotation, tint);
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Texture:setFilter
+```lua
+Texture Tex = Texture:setFilter(string Filter)
+```
+Set texture scaling filter mode: "point", "bilinear", "trilinear", "anisotropic4x", "anisotropic8x" or "anisotropic16x".
+*/
+const char * lua_class_texture_filters[] = {"point", "bilinear", "trilinear", "anisotropic4x", "anisotropic8x", "anisotropic16x", NULL};
+
+int lua_class_texture_SetFilter(lua_State *L){
+  int flip;
+  Texture2D texture = _ptr_texture_Check(L, 1, &flip);
+  SetTextureFilter(texture, luaL_checkoption(L, 2, NULL, lua_class_texture_filters));
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Texture:setWrap
+```lua
+Texture Tex = Texture:setWrap(string Wrap)
+```
+Set texture wrapping mode: "repeat", "clamp", "mirrorrepeat" or "mirrorclamp".
+*/
+const char * lua_class_texture_wraps[] = {"repeat", "clamp", "mirrorrepeat", "mirrorclamp", NULL};
+
+int lua_class_texture_SetWrap(lua_State *L){
+  int flip;
+  Texture2D texture = _ptr_texture_Check(L, 1, &flip);
+  SetTextureWrap(texture, luaL_checkoption(L, 2, NULL, lua_class_texture_wraps));
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Texture:genMipmaps
+```lua
+Texture Tex = Texture:genMipmaps()
+```
+Generate GPU mipmaps for texture.
+*/
+int lua_class_texture_GenMipmaps(lua_State *L){
+  TextureObject * tex = (TextureObject *)luaL_checkudata(L, 1, "Texture");
+  if (!tex->asset.loaded) return luaL_error(L, "Texture is unloaded");
+  GenTextureMipmaps(&tex->texture);
+  if (!tex->asset.refs) lua_class_assets.retainedBytes -= tex->asset.bytes;
+  tex->asset.bytes = _ptr_texture_Bytes(tex->texture);
+  if (!tex->asset.refs) lua_class_assets.retainedBytes += tex->asset.bytes;
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Texture:getImage
+```lua
+Image Img = Texture:getImage()
+```
+Get pixel data from GPU texture.
+*/
+int lua_class_texture_GetImage(lua_State *L){
+  int flip;
+  Texture2D texture = _ptr_texture_Check(L, 1, &flip);
+  Image * img = (Image *)luax_newobject(L, "Image", sizeof(Image));
+  *img = GetTextureData(texture);
+  if (flip) ImageFlipVertical(img);
+  return 1;
+}
+
+/*!MD
+#### Texture:unload
+```lua
+Texture:unload()
+```
+Release texture. Texture is freed when every load of it is released (or it is kept by asset cache, see
+[rl.assets.SetBudget](#SetBudget)). Using of freed texture raises an error.
+*/
+int lua_class_texture_Unload(lua_State *L){
+  TextureObject * tex = (TextureObject *)luaL_checkudata(L, 1, "Texture");
+  _ptr_asset_Release(L, 1, &tex->asset);
+  return 0;
+}
+
+/*!MD
+#### Texture:isLoaded
+```lua
+boolean Loaded = Texture:isLoaded()
+```
+Check if texture is not freed.
+*/
+int lua_class_texture_IsLoaded(lua_State *L){
+  TextureObject * tex = (TextureObject *)luaL_checkudata(L, 1, "Texture");
+  lua_pushboolean(L, tex->asset.loaded);
+  return 1;
+}
+
+luax_Field luaray_fields_texture[] = {
+  luax_field(TextureObject, "id",      texture.id,      LUAX_FIELD_INT | LUAX_FIELD_READONLY),
+  luax_field(TextureObject, "width",   texture.width,   LUAX_FIELD_INT | LUAX_FIELD_READONLY),
+  luax_field(TextureObject, "height",  texture.height,  LUAX_FIELD_INT | LUAX_FIELD_READONLY),
+  luax_field(TextureObject, "mipmaps", texture.mipmaps, LUAX_FIELD_INT | LUAX_FIELD_READONLY),
+  luax_field(TextureObject, "format",  texture.format,  LUAX_FIELD_INT | LUAX_FIELD_READONLY),
+  {NULL}
+};
+
+int lua_class_texture__GC(lua_State *L){
+  TextureObject * tex = (TextureObject *)luaL_checkudata(L, 1, "Texture");
+  _ptr_asset_Free(L, &tex->asset);
+  return 0;
+}
+
+int lua_class_texture__ToString(lua_State *L){
+  TextureObject * tex = (TextureObject *)luaL_checkudata(L, 1, "Texture");
+  lua_pushfstring(L, "Texture[%d, %d]: %p", tex->texture.width, tex->texture.height, tex);
+  return 1;
+}
+
+luaL_Reg luaray_class_texture[] = {
+  {"draw",       lua_class_texture_Draw},
+  {"drawEx",     lua_class_texture_DrawEx},
+  {"drawRec",    lua_class_texture_DrawRec},
+  {"drawPro",    lua_class_texture_DrawPro},
+  {"setFilter",  lua_class_texture_SetFilter},
+  {"setWrap",    lua_class_texture_SetWrap},
+  {"genMipmaps", lua_class_texture_GenMipmaps},
+  {"getImage",   lua_class_texture_GetImage},
+  {"unload",     lua_class_texture_Unload},
+  {"isLoaded",   lua_class_texture_IsLoaded},
+
+  // meta
+  {"__gc",       lua_class_texture__GC},
+  {"__tostring", lua_class_texture__ToString},
+  {NULL, NULL}
+};
+
+/*!MD
+## RenderTexture
+Texture for rendering into (framebuffer), stored in GPU memory (VRAM).
+Drawing methods are the same as [Texture](#Texture) ones (draw, drawEx, drawRec, drawPro, setFilter, setWrap,
+getImage), render texture is drawn in normal orientation.
+
+| **Fields**                                 | description
+| :----------------------------------------- | :-----------
+| id                                         | OpenGL framebuffer id, read only
+| width                                      | Texture width, read only
+| height                                     | Texture height, read only
+
+| **Methods**                                | description
+| :----------------------------------------- | :-----------
+| [beginMode](#RenderTexturebeginMode)       | Begin drawing to render texture
+| [endMode](#RenderTextureendMode)           | End drawing to render texture
+| [unload](#RenderTextureunload)             | Free render texture
+| [isLoaded](#RenderTextureisLoaded)         | Check if render texture is not freed
+
+### Initialization
+```lua
+RenderTexture Target = rl.RenderTexture(integer Width, integer Height)
+```
+Load texture for rendering.
+*/
+void _ptr_rendertexture_Unload(void * object){
+  UnloadRenderTexture(((RenderTextureObject *)object)->target);
+  memset(&((RenderTextureObject *)object)->target, 0, sizeof(RenderTexture2D));
+}
+
+RenderTextureObject * _ptr_rendertexture_Check(lua_State *L, int index){
+  RenderTextureObject * rt = (RenderTextureObject *)luaL_checkudata(L, index, "RenderTexture");
+  if (!rt->asset.loaded) luaL_error(L, "RenderTexture is unloaded");
+  return rt;
+}
+
+int lua_class_rendertexture_new(lua_State *L){
+  int width  = luaL_checkinteger(L, 1);
+  int height = luaL_checkinteger(L, 2);
+  RenderTextureObject * rt = (RenderTextureObject *)luax_newobject(L, "RenderTexture", sizeof(RenderTextureObject));
+  memset(rt, 0, sizeof(RenderTextureObject));
+  rt->target = LoadRenderTexture(width, height);
+  if (!rt->target.id) return luaL_error(L, "Can't create render texture %dx%d", width, height);
+  _ptr_asset_Add(L, -1, &rt->asset, NULL, NULL, _ptr_texture_Bytes(rt->target.texture)*2, _ptr_rendertexture_Unload);
+  return 1;
+}
+
+/*!MD
+#### RenderTexture:beginMode
+```lua
+RenderTexture Target = RenderTexture:beginMode()
+```
+Begin drawing to render texture.
+*/
+int lua_class_rendertexture_BeginMode(lua_State *L){
+  BeginTextureMode(_ptr_rendertexture_Check(L, 1)->target);
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### RenderTexture:endMode
+```lua
+RenderTexture Target = RenderTexture:endMode()
+```
+End drawing to render texture.
+*/
+int lua_class_rendertexture_EndMode(lua_State *L){
+  _ptr_rendertexture_Check(L, 1);
+  EndTextureMode();
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### RenderTexture:unload
+```lua
+RenderTexture:unload()
+```
+Free render texture, using of freed render texture raises an error.
+*/
+int lua_class_rendertexture_Unload(lua_State *L){
+  RenderTextureObject * rt = (RenderTextureObject *)luaL_checkudata(L, 1, "RenderTexture");
+  _ptr_asset_Release(L, 1, &rt->asset);
+  return 0;
+}
+
+/*!MD
+#### RenderTexture:isLoaded
+```lua
+boolean Loaded = RenderTexture:isLoaded()
+```
+Check if render texture is not freed.
+*/
+int lua_class_rendertexture_IsLoaded(lua_State *L){
+  RenderTextureObject * rt = (RenderTextureObject *)luaL_checkudata(L, 1, "RenderTexture");
+  lua_pushboolean(L, rt->asset.loaded);
+  return 1;
+}
+
+luax_Field luaray_fields_rendertexture[] = {
+  luax_field(RenderTextureObject, "id",     target.id,             LUAX_FIELD_INT | LUAX_FIELD_READONLY),
+  luax_field(RenderTextureObject, "width",  target.texture.width,  LUAX_FIELD_INT | LUAX_FIELD_READONLY),
+  luax_field(RenderTextureObject, "height", target.texture.height, LUAX_FIELD_INT | LUAX_FIELD_READONLY),
+  {NULL}
+};
+
+int lua_class_rendertexture__GC(lua_State *L){
+  RenderTextureObject * rt = (RenderTextureObject *)luaL_checkudata(L, 1, "RenderTexture");
+  _ptr_asset_Free(L, &rt->asset);
+  return 0;
+}
+
+int lua_class_rendertexture__ToString(lua_State *L){
+  RenderTextureObject * rt = (RenderTextureObject *)luaL_checkudata(L, 1, "RenderTexture");
+  lua_pushfstring(L, "RenderTexture[%d, %d]: %p", rt->target.texture.width, rt->target.texture.height, rt);
+  return 1;
+}
+
+luaL_Reg luaray_class_rendertexture[] = {
+  {"beginMode",  lua_class_rendertexture_BeginMode},
+  {"endMode",    lua_class_rendertexture_EndMode},
+  {"draw",       lua_class_texture_Draw},
+  {"drawEx",     lua_class_texture_DrawEx},
+  {"drawRec",    lua_class_texture_DrawRec},
+  {"drawPro",    lua_class_texture_DrawPro},
+  {"setFilter",  lua_class_texture_SetFilter},
+  {"setWrap",    lua_class_texture_SetWrap},
+  {"getImage",   lua_class_texture_GetImage},
+  {"unload",     lua_class_rendertexture_Unload},
+  {"isLoaded",   lua_class_rendertexture_IsLoaded},
+
+  // meta
+  {"__gc",       lua_class_rendertexture__GC},
+  {"__tostring", lua_class_rendertexture__ToString},
+  {NULL, NULL}
+};
+
+// Decoded data cached by rl.assets functions, entries are not visible from Lua and kept by asset cache only
+typedef struct AssetEntry {
+  Image           image;
+  unsigned char * data;
+  int             size;
+  Asset           asset;
+} AssetEntry;
+
+void _ptr_assetentry_Unload(void * object){
+  AssetEntry * entry = (AssetEntry *)object;
+  UnloadImage(entry->image);
+  free(entry->data);
+  entry->image = (Image){ 0 };
+  entry->data  = NULL;
+  entry->size  = 0;
+}
+
+// Creates entry on top of the stack and registers it in cache, image or data are owned by entry
+AssetEntry * _ptr_assetentry_New(lua_State *L, const char * key, const char * path, Image image, unsigned char * data, int size){
+  AssetEntry * entry = (AssetEntry *)luax_newobject(L, "AssetEntry", sizeof(AssetEntry));
+  memset(entry, 0, sizeof(AssetEntry));
+  entry->image = image;
+  entry->data  = data;
+  entry->size  = size;
+  int bytes = image.data ? GetPixelDataSize(image.width, image.height, image.format) : size;
+  _ptr_asset_Add(L, -1, &entry->asset, key, path, bytes, _ptr_assetentry_Unload);
+  return entry;
+}
+
+int lua_class_assetentry__GC(lua_State *L){
+  AssetEntry * entry = (AssetEntry *)luaL_checkudata(L, 1, "AssetEntry");
+  _ptr_asset_Free(L, &entry->asset);
+  return 0;
+}
+
+luaL_Reg luaray_class_assetentry[] = {
+  // meta
+  {"__gc",       lua_class_assetentry__GC},
+  {NULL, NULL}
+};
+
+/*!MD
+## Archive
+Packed archive opened by [rl.archive.Open](#Open). Archive file is mapped to memory, entries are found by binary search
+of the index and decoded right from the mapping, without opening files.
+
+| **Methods**                          | description
+| :----------------------------------- | :-----------
+| [loadImage](#ArchiveloadImage)       | Load image from entry
+| [loadTexture](#ArchiveloadTexture)   | Load texture from entry
+| [loadFileData](#ArchiveloadFileData) | Load entry contents as string
+| [has](#Archivehas)                   | Check if archive contains entry
+| [getFiles](#ArchivegetFiles)         | Get names of entries
+| [close](#Archiveclose)               | Unmap archive
+
+### Initialization
+```lua
+Archive Arc = rl.archive.Open(string Filename)
+```
+*/
+ray_archive * _ptr_archive_Check(lua_State *L, int index){
+  ray_archive * archive = (ray_archive *)luaL_checkudata(L, index, "Archive");
+  if (!archive->data) luaL_error(L, "Archive is closed");
+  return archive;
+}
+
+// Returns contents of entry, decompressed ones are allocated and should be freed if *owned is set
+const unsigned char * _ptr_archive_Data(lua_State *L, ray_archive * archive, int index, int * size, int * owned){
+  size_t len;
+  const char * name = luaL_checklstring(L, index, &len);
+  int i = ray_archive_find(archive, name, len);
+  if (i < 0) {
+    luaL_error(L, "Archive has no entry \"%s\"", name);
+    return NULL;
+  }
+  ray_archive_entry entry;
+  ray_archive_get(archive, i, &entry);
+  *owned = 0;
+  *size  = entry.size;
+  if (!(entry.flags & RAY_ARCHIVE_COMPRESSED)) return entry.data;
+  unsigned char * data = DecompressData((unsigned char *)entry.data, entry.size, size);
+  if (!data || *size != (int)entry.rawSize) {
+    free(data);
+    luaL_error(L, "Archive entry \"%s\" is damaged", name);
+    return NULL;
+  }
+  *owned = 1;
+  return data;
+}
+
+// Same as LoadImage for formats which are supported by stb_image
+Image _ptr_archive_DecodeImage(const unsigned char * data, int size){
+  Image img = { 0 };
+  int channels = 0;
+  img.data = stbi_load_from_memory(data, size, &img.width, &img.height, &channels, 0);
+  if      (channels == 1) img.format = UNCOMPRESSED_GRAYSCALE;
+  else if (channels == 2) img.format = UNCOMPRESSED_GRAY_ALPHA;
+  else if (channels == 3) img.format = UNCOMPRESSED_R8G8B8;
+  else if (channels == 4) img.format = UNCOMPRESSED_R8G8B8A8;
+  img.mipmaps = 1;
+  if (img.data && !img.format) {
+    free(img.data);
+    img.data = NULL;
+  }
+  return img;
+}
+
+Image _ptr_archive_LoadImage(lua_State *L, ray_archive * archive, int index){
+  int size, owned;
+  const unsigned char * data = _ptr_archive_Data(L, archive, index, &size, &owned);
+  Image img = _ptr_archive_DecodeImage(data, size);
+  if (owned) free((void *)data);
+  if (!img.data) luaL_error(L, "Can't decode image \"%s\"", lua_tostring(L, index));
+  return img;
+}
+
+/*!MD
+#### Archive:loadImage
+```lua
+Image Img = Archive:loadImage(string Name)
+```
+Load image from archive entry (formats supported by stb_image: PNG, JPG, BMP, TGA etc).
+*/
+int lua_class_archive_LoadImage(lua_State *L){
+  ray_archive * archive = _ptr_archive_Check(L, 1);
+  Image img = _ptr_archive_LoadImage(L, archive, 2);
+  Image * obj = (Image *)luax_newobject(L, "Image", sizeof(Image));
+  *obj = img;
+  return 1;
+}
+
+/*!MD
+#### Archive:loadTexture
+```lua
+Texture Tex = Archive:loadTexture(string Name)
+```
+Load texture from archive entry, image is not kept.
+*/
+int lua_class_archive_LoadTexture(lua_State *L){
+  ray_archive * archive = _ptr_archive_Check(L, 1);
+  Image img = _ptr_archive_LoadImage(L, archive, 2);
+  TextureObject * tex = (TextureObject *)luax_newobject(L, "Texture", sizeof(TextureObject));
+  memset(tex, 0, sizeof(TextureObject));
+  tex->texture = LoadTextureFromImage(img);
+  UnloadImage(img);
+  _ptr_asset_Add(L, -1, &tex->asset, NULL, NULL, _ptr_texture_Bytes(tex->texture), _ptr_texture_Unload);
+  return 1;
+}
+
+/*!MD
+#### Archive:loadFileData
+```lua
+string Data = Archive:loadFileData(string Name)
+```
+Load contents of archive entry as string.
+*/
+int lua_class_archive_LoadFileData(lua_State *L){
+  ray_archive * archive = _ptr_archive_Check(L, 1);
+  int size, owned;
+  const unsigned char * data = _ptr_archive_Data(L, archive, 2, &size, &owned);
+  lua_pushlstring(L, (const char *)data, size);
+  if (owned) free((void *)data);
+  return 1;
+}
+
+/*!MD
+#### Archive:has
+```lua
+boolean Exists = Archive:has(string Name)
+```
+Check if archive contains entry.
+*/
+int lua_class_archive_Has(lua_State *L){
+  ray_archive * archive = _ptr_archive_Check(L, 1);
+  size_t len;
+  const char * name = luaL_checklstring(L, 2, &len);
+  lua_pushboolean(L, ray_archive_find(archive, name, len) >= 0);
+  return 1;
+}
+
+/*!MD
+#### Archive:getFiles
+```lua
+table Names = Archive:getFiles()
+```
+Get names of archive entries, sorted.
+*/
+int lua_class_archive_GetFiles(lua_State *L){
+  ray_archive * archive = _ptr_archive_Check(L, 1);
+  lua_createtable(L, archive->count, 0);
+  for (int i = 0; i < archive->count; i++) {
+    ray_archive_entry entry;
+    ray_archive_get(archive, i, &entry);
+    lua_pushlstring(L, entry.name, entry.nameLength);
+    lua_rawseti(L, -2, i + 1);
+  }
+  return 1;
+}
+
+/*!MD
+#### Archive:close
+```lua
+Archive:close()
+```
+Unmap archive file, it is done by garbage collector otherwise. Loaded objects are not affected.
+*/
+int lua_class_archive_Close(lua_State *L){
+  ray_archive_close((ray_archive *)luaL_checkudata(L, 1, "Archive"));
+  return 0;
+}
+
+int lua_class_archive__ToString(lua_State *L){
+  ray_archive * archive = (ray_archive *)luaL_checkudata(L, 1, "Archive");
+  lua_pushfstring(L, "Archive[%d]: %p", archive->count, archive);
+  return 1;
+}
+
+luaL_Reg luaray_class_archive[] = {
+  {"loadImage",    lua_class_archive_LoadImage},
+  {"loadTexture",  lua_class_archive_LoadTexture},
+  {"loadFileData", lua_class_archive_LoadFileData},
+  {"has",          lua_class_archive_Has},
+  {"getFiles",     lua_class_archive_GetFiles},
+  {"close",        lua_class_archive_Close},
+
+  // meta
+  {"__gc",         lua_class_archive_Close},
+  {"__tostring",   lua_class_archive__ToString},
+  {NULL, NULL}
+};
+
+/*!MD
+## DeflateStream
+Streaming compressor: data is written by chunks and compressed by independent blocks, compressed output
+is read by chunks, so neither whole input nor whole output is kept in memory.
+Output format is the same as [rl.core.CompressBlocks](#CompressBlocks) one (not compatible with CompressData).
+```lua
+local out = io.open("save.bin.z", "wb")
+local stream = rl.DeflateStream(6)
+for chunk in function() return file:read(65536) end do
+  out:write(stream:write(chunk):read())
+end
+out:write(stream:finish():read())
+```
+
+| **Methods**                             | description
+| :-------------------------------------- | :-----------
+| [write](#DeflateStreamwrite)            | Add input data
+| [read](#DeflateStreamread)              | Take compressed output
+| [flush](#DeflateStreamflush)            | Compress buffered input
+| [finish](#DeflateStreamfinish)          | End stream
+| [isFinished](#DeflateStreamisFinished)  | Check if stream is ended
+
+### Initialization
+```lua
+DeflateStream Stream = rl.DeflateStream([integer Level[, integer BlockSize]])
+```
+Level is 0 (no compression) to 9 (best compression), 6 by default.
+BlockSize is size of independently compressed blocks (256 KB by default): bigger blocks compress better, but use more memory.
+*/
+typedef struct DeflateStream {
+  unsigned char * input;               // block buffer
+  int             inputSize, blockSize, level;
+  unsigned char * output;              // compressed frames which are not read yet
+  int             outputSize, outputCapacity;
+  int             finished;
+} DeflateStream;
+
+// Ensures space for size more bytes in output buffer
+void _ptr_stream_Reserve(lua_State *L, unsigned char ** output, int * capacity, int used, int size){
+  if (used + size <= *capacity) return;
+  int grown = *capacity ? *capacity : 4096;
+  while (grown < used + size) grown *= 2;
+  unsigned char * buffer = (unsigned char *)realloc(*output, grown);
+  if (!buffer) luaL_error(L, "Can't allocate stream buffer");
+  *output   = buffer;
+  *capacity = grown;
+}
+
+void _ptr_deflatestream_Block(lua_State *L, DeflateStream * stream){
+  if (!stream->inputSize) return;
+  _ptr_stream_Reserve(L, &stream->output, &stream->outputCapacity, stream->outputSize, stream->inputSize + RAY_COMPRESS_FRAME);
+  stream->outputSize += ray_compress_block(stream->input, stream->inputSize, stream->level, stream->output + stream->outputSize);
+  stream->inputSize = 0;
+}
+
+DeflateStream * _ptr_deflatestream_Check(lua_State *L, int index){
+  DeflateStream * stream = (DeflateStream *)luaL_checkudata(L, index, "DeflateStream");
+  if (stream->finished) luaL_error(L, "DeflateStream is finished");
+  return stream;
+}
+
+int lua_class_deflatestream_new(lua_State *L){
+  int level     = luax_optinteger(L, 1, 6);
+  int blockSize = luax_optinteger(L, 2, RAY_COMPRESS_BLOCK);
+  if (level < 0 || level > 9) return luaL_error(L, "Compression level should be in range 0..9");
+  if (blockSize < 1 || blockSize > RAY_COMPRESS_MAXBLOCK) return luaL_error(L, "Block size should be in range 1..%d", RAY_COMPRESS_MAXBLOCK);
+  DeflateStream * stream = (DeflateStream *)luax_newobject(L, "DeflateStream", sizeof(DeflateStream));
+  memset(stream, 0, sizeof(DeflateStream));
+  stream->level     = level;
+  stream->blockSize = blockSize;
+  _ptr_stream_Reserve(L, &stream->output, &stream->outputCapacity, 0, RAY_COMPRESS_HEADER);
+  memcpy(stream->output, RAY_COMPRESS_MAGIC, RAY_COMPRESS_HEADER);
+  stream->outputSize = RAY_COMPRESS_HEADER;
+  return 1;
+}
+
+/*!MD
+#### DeflateStream:write
+```lua
+DeflateStream Stream = DeflateStream:write(string Data)
+```
+Add input data, full blocks are compressed immediately.
+*/
+int lua_class_deflatestream_Write(lua_State *L){
+  DeflateStream * stream = _ptr_deflatestream_Check(L, 1);
+  size_t len;
+  const unsigned char * data = (const unsigned char *)luaL_checklstring(L, 2, &len);
+  if (!stream->input && len) {
+    stream->input = (unsigned char *)malloc(stream->blockSize);
+    if (!stream->input) return luaL_error(L, "Can't allocate stream buffer");
+  }
+  while (len) {
+    size_t part = stream->blockSize - stream->inputSize;
+    if (part > len) part = len;
+    memcpy(stream->input + stream->inputSize, data, part);
+    stream->inputSize += part;
+    data += part;
+    len  -= part;
+    if (stream->inputSize == stream->blockSize) _ptr_deflatestream_Block(L, stream);
+  }
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### DeflateStream:read
+```lua
+string Data = DeflateStream:read()
+```
+Take compressed output produced since previous call (may be empty string).
+*/
+int lua_class_deflatestream_Read(lua_State *L){
+  DeflateStream * stream = (DeflateStream *)luaL_checkudata(L, 1, "DeflateStream");
+  lua_pushlstring(L, (const char *)stream->output, stream->outputSize);
+  stream->outputSize = 0;
+  return 1;
+}
+
+/*!MD
+#### DeflateStream:flush
+```lua
+DeflateStream Stream = DeflateStream:flush()
+```
+Compress buffered input as a block, so all written data can be read.
+*/
+int lua_class_deflatestream_Flush(lua_State *L){
+  _ptr_deflatestream_Block(L, _ptr_deflatestream_Check(L, 1));
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### DeflateStream:finish
+```lua
+DeflateStream Stream = DeflateStream:finish()
+```
+Compress buffered input and end stream, output should be read after it. Stream can't be written anymore.
+*/
+int lua_class_deflatestream_Finish(lua_State *L){
+  DeflateStream * stream = _ptr_deflatestream_Check(L, 1);
+  _ptr_deflatestream_Block(L, stream);
+  _ptr_stream_Reserve(L, &stream->output, &stream->outputCapacity, stream->outputSize, RAY_COMPRESS_FRAME);
+  memset(stream->output + stream->outputSize, 0, RAY_COMPRESS_FRAME);
+  stream->outputSize += RAY_COMPRESS_FRAME;
+  stream->finished = 1;
+  free(stream->input);
+  stream->input = NULL;
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### DeflateStream:isFinished
+```lua
+boolean Finished = DeflateStream:isFinished()
+```
+Check if stream is ended by DeflateStream:finish.
+*/
+int lua_class_deflatestream_IsFinished(lua_State *L){
+  DeflateStream * stream = (DeflateStream *)luaL_checkudata(L, 1, "DeflateStream");
+  lua_pushboolean(L, stream->finished);
+  return 1;
+}
+
+int lua_class_deflatestream__GC(lua_State *L){
+  DeflateStream * stream = (DeflateStream *)luaL_checkudata(L, 1, "DeflateStream");
+  free(stream->input);
+  free(stream->output);
+  stream->input  = NULL;
+  stream->output = NULL;
+  return 0;
+}
+
+int lua_class_deflatestream__ToString(lua_State *L){
+  DeflateStream * stream = (DeflateStream *)luaL_checkudata(L, 1, "DeflateStream");
+  lua_pushfstring(L, "DeflateStream[%d]: %p", stream->level, stream);
+  return 1;
+}
+
+luaL_Reg luaray_class_deflatestream[] = {
+  {"write",      lua_class_deflatestream_Write},
+  {"read",       lua_class_deflatestream_Read},
+  {"flush",      lua_class_deflatestream_Flush},
+  {"finish",     lua_class_deflatestream_Finish},
+  {"isFinished", lua_class_deflatestream_IsFinished},
+
+  // meta
+  {"__gc",       lua_class_deflatestream__GC},
+  {"__tostring", lua_class_deflatestream__ToString},
+  {NULL, NULL}
+};
+
+/*!MD
+## InflateStream
+Streaming decompressor of [DeflateStream](#DeflateStream) and [rl.core.CompressBlocks](#CompressBlocks) output:
+compressed data is written by chunks of any size, decompressed blocks are read as they are complete.
+```lua
+local stream = rl.InflateStream()
+for chunk in function() return file:read(65536) end do
+  process(stream:write(chunk):read())
+end
+assert(stream:isFinished())
+```
+
+| **Methods**                             | description
+| :-------------------------------------- | :-----------
+| [write](#InflateStreamwrite)            | Add compressed data
+| [read](#InflateStreamread)              | Take decompressed output
+| [isFinished](#InflateStreamisFinished)  | Check if end of stream is reached
+
+### Initialization
+```lua
+InflateStream Stream = rl.InflateStream()
+```
+*/
+typedef struct InflateStream {
+  unsigned char * input;               // incomplete frame
+  int             inputSize, inputCapacity;
+  unsigned char * output;              // decompressed data which is not read yet
+  int             outputSize, outputCapacity;
+  int             started, finished;
+} InflateStream;
+
+// Decompresses complete frames, returns count of consumed bytes
+int _ptr_inflatestream_Consume(lua_State *L, InflateStream * stream, const unsigned char * data, int size){
+  int offset = 0;
+  if (!stream->started) {
+    if (size < RAY_COMPRESS_HEADER) return 0;
+    if (memcmp(data, RAY_COMPRESS_MAGIC, RAY_COMPRESS_HEADER)) luaL_error(L, "Compressed stream is damaged");
+    stream->started = 1;
+    offset = RAY_COMPRESS_HEADER;
+  }
+  while (!stream->finished && size - offset >= RAY_COMPRESS_FRAME) {
+    unsigned int rawSize = ray_archive_u32(data + offset), storedSize = ray_archive_u32(data + offset + 4);
+    if (!ray_compress_checkFrame(rawSize, storedSize)) luaL_error(L, "Compressed stream is damaged");
+    if ((unsigned int)(size - offset - RAY_COMPRESS_FRAME) < storedSize) break;
+    _ptr_stream_Reserve(L, &stream->output, &stream->outputCapacity, stream->outputSize, rawSize);
+    if (!ray_compress_unblock(data + offset + RAY_COMPRESS_FRAME, storedSize, stream->output + stream->outputSize, rawSize))
+      luaL_error(L, "Compressed stream is damaged");
+    stream->outputSize += rawSize;
+    stream->finished    = !rawSize;
+    offset += RAY_COMPRESS_FRAME + storedSize;
+  }
+  if (stream->finished && offset < size) luaL_error(L, "Compressed stream has data after its end");
+  return offset;
+}
+
+/*!MD
+#### InflateStream:write
+```lua
+InflateStream Stream = InflateStream:write(string Data)
+```
+Add compressed data, complete blocks are decompressed immediately. Damaged data raises error.
+*/
+int lua_class_inflatestream_Write(lua_State *L){
+  InflateStream * stream = (InflateStream *)luaL_checkudata(L, 1, "InflateStream");
+  size_t len;
+  const unsigned char * data = (const unsigned char *)luaL_checklstring(L, 2, &len);
+  if (stream->inputSize) {
+    _ptr_stream_Reserve(L, &stream->input, &stream->inputCapacity, stream->inputSize, len);
+    memcpy(stream->input + stream->inputSize, data, len);
+    stream->inputSize += len;
+    data = stream->input;
+    len  = stream->inputSize;
+  }
+  // frames are decompressed right from chunk if there is no incomplete one
+  int consumed = _ptr_inflatestream_Consume(L, stream, data, len);
+  int rest     = len - consumed;
+  if (data == stream->input) memmove(stream->input, stream->input + consumed, rest);
+  else if (rest) {
+    _ptr_stream_Reserve(L, &stream->input, &stream->inputCapacity, 0, rest);
+    memcpy(stream->input, data + consumed, rest);
+  }
+  stream->inputSize = rest;
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### InflateStream:read
+```lua
+string Data = InflateStream:read()
+```
+Take decompressed output produced since previous call (may be empty string).
+*/
+int lua_class_inflatestream_Read(lua_State *L){
+  InflateStream * stream = (InflateStream *)luaL_checkudata(L, 1, "InflateStream");
+  lua_pushlstring(L, (const char *)stream->output, stream->outputSize);
+  stream->outputSize = 0;
+  return 1;
+}
+
+/*!MD
+#### InflateStream:isFinished
+```lua
+boolean Finished = InflateStream:isFinished()
+```
+Check if end of compressed stream is reached.
+*/
+int lua_class_inflatestream_IsFinished(lua_State *L){
+  InflateStream * stream = (InflateStream *)luaL_checkudata(L, 1, "InflateStream");
+  lua_pushboolean(L, stream->finished);
+  return 1;
+}
+
+int lua_class_inflatestream_new(lua_State *L){
+  InflateStream * stream = (InflateStream *)luax_newobject(L, "InflateStream", sizeof(InflateStream));
+  memset(stream, 0, sizeof(InflateStream));
+  return 1;
+}
+
+int lua_class_inflatestream__GC(lua_State *L){
+  InflateStream * stream = (InflateStream *)luaL_checkudata(L, 1, "InflateStream");
+  free(stream->input);
+  free(stream->output);
+  stream->input  = NULL;
+  stream->output = NULL;
+  return 0;
+}
+
+int lua_class_inflatestream__ToString(lua_State *L){
+  InflateStream * stream = (InflateStream *)luaL_checkudata(L, 1, "InflateStream");
+  lua_pushfstring(L, "InflateStream: %p", stream);
+  return 1;
+}
+
+luaL_Reg luaray_class_inflatestream[] = {
+  {"write",      lua_class_inflatestream_Write},
+  {"read",       lua_class_inflatestream_Read},
+  {"isFinished", lua_class_inflatestream_IsFinished},
+
+  // meta
+  {"__gc",       lua_class_inflatestream__GC},
+  {"__tostring", lua_class_inflatestream__ToString},
+  {NULL, NULL}
+};
+
+/*!MD
+## Storage
+Key-value save data store opened by [rl.storage.Open](#Open-1). Values are kept in memory, changes are appended
+to log file by batches (or by Storage:flush), so saving many values doesn't rewrite the file.
+Log is compacted when it becomes twice bigger than live data. Records have checksums: if program is stopped
+in the middle of writing, store is opened with all completely written changes.
+```lua
+local save = rl.storage.Open("save.dat")
+save:set("level", 3):set("name", "hero"):set("replay", replayData)
+print(save:get("level", 1))
+save:flush() -- or save:close()
+```
+
+| **Methods**                        | description
+| :--------------------------------- | :-----------
+| [get](#Storageget)                 | Get value
+| [set](#Storageset)                 | Set or remove value
+| [getKeys](#StoragegetKeys)         | Get list of keys
+| [flush](#Storageflush)             | Write pending changes to disk
+| [compact](#Storagecompact)         | Rewrite log with live values only
+| [getStats](#StoragegetStats)       | Get sizes of store
+| [close](#Storageclose)             | Flush and close store
+
+### Initialization
+```lua
+Storage Store = rl.storage.Open(string Filename[, integer BatchSize])
+```
+*/
+#define STORAGE_COMPACT_MIN (64*1024) // log size when compaction is started
+
+typedef struct Storage {
+  FILE           * file;               // log opened for appending, NULL if closed
+  char           * path;
+  int              values;             // registry reference to table of values
+  ray_store_buffer pending;            // records which are not written yet
+  size_t           batchSize;          // pending size which triggers writing
+  size_t           fileBytes, liveBytes;
+  int              count;
+} Storage;
+
+Storage * _ptr_storage_Check(lua_State *L, int index){
+  Storage * store = (Storage *)luaL_checkudata(L, index, "Storage");
+  if (!store->file) luaL_error(L, "Storage is closed");
+  return store;
+}
+
+// Encodes value at index to record type and data, returns 0 if type of value is not supported
+int _ptr_storage_Encode(lua_State *L, int index, int * type, const void ** data, size_t * size, double * number, unsigned char * boolean){
+  switch (lua_type(L, index)) {
+    case LUA_TNUMBER:
+      *number = lua_tonumber(L, index);
+      *type = RAY_STORE_NUMBER;
+      *data = number;
+      *size = 8;
+      return 1;
+    case LUA_TBOOLEAN:
+      *boolean = lua_toboolean(L, index);
+      *type = RAY_STORE_BOOLEAN;
+      *data = boolean;
+      *size = 1;
+      return 1;
+    case LUA_TSTRING:
+      *type = RAY_STORE_STRING;
+      *data = lua_tolstring(L, index, size);
+      return 1;
+    case LUA_TNIL:
+    case LUA_TNONE:
+      *type = RAY_STORE_DELETE;
+      *data = NULL;
+      *size = 0;
+      return 1;
+  }
+  return 0;
+}
+
+size_t _ptr_storage_ValueSize(lua_State *L, int index){
+  switch (lua_type(L, index)) {
+    case LUA_TNUMBER:  return 8;
+    case LUA_TBOOLEAN: return 1;
+    case LUA_TSTRING:  return lua_objlen(L, index);
+  }
+  return 0;
+}
+
+typedef struct {
+  lua_State * L;
+  int         table;
+} _ptr_storage_Loader;
+
+void _ptr_storage_Load(void * user, int type, const char * key, size_t keyLength, const unsigned char * value, size_t valueLength){
+  _ptr_storage_Loader * loader = (_ptr_storage_Loader *)user;
+  lua_State * L = loader->L;
+  lua_pushlstring(L, key, keyLength);
+  if (type == RAY_STORE_NUMBER) {
+    double number;
+    memcpy(&number, value, 8);
+    lua_pushnumber(L, number);
+  }
+  else if (type == RAY_STORE_BOOLEAN) lua_pushboolean(L, value[0]);
+  else if (type == RAY_STORE_STRING) lua_pushlstring(L, (const char *)value, valueLength);
+  else lua_pushnil(L);
+  lua_rawset(L, loader->table);
+}
+
+// Writes pending records, returns 0 on error
+int _ptr_storage_Write(Storage * store){
+  if (!store->pending.size) return 1;
+  if (!ray_store_write(store->file, store->pending.data, store->pending.size)) return 0;
+  store->fileBytes   += store->pending.size;
+  store->pending.size = 0;
+  return 1;
+}
+
+// Rewrites log with live values, pending records are dropped (they are in table)
+void _ptr_storage_Compact(lua_State *L, Storage * store){
+  ray_store_buffer buffer = {0};
+  int ok = ray_store_header(&buffer);
+  lua_rawgeti(L, LUA_REGISTRYINDEX, store->values);
+  lua_pushnil(L);
+  while (ok && lua_next(L, -2)) {
+    int type;
+    const void * data;
+    size_t keyLength, size;
+    double number;
+    unsigned char boolean;
+    const char * key = lua_tolstring(L, -2, &keyLength);
+    _ptr_storage_Encode(L, -1, &type, &data, &size, &number, &boolean);
+    ok = ray_store_append(&buffer, type, key, keyLength, data, size);
+    lua_pop(L, ok ? 1 : 2);
+  }
+  lua_pop(L, 1);
+  if (!ok) {
+    free(buffer.data);
+    luaL_error(L, "Can't allocate memory for storage compaction");
+    return;
+  }
+  char temp[4096];
+  ray_store_tempPath(temp, sizeof(temp), store->path);
+  FILE * f = fopen(temp, "wb");
+  ok = f && ray_store_write(f, buffer.data, buffer.size);
+  if (f) fclose(f);
+  if (ok) {
+    fclose(store->file);
+    ok = ray_store_replace(store->path);
+    store->file = fopen(store->path, "ab");
+  }
+  else remove(temp);
+  free(buffer.data);
+  if (!ok || !store->file) luaL_error(L, "Can't write storage \"%s\"", store->path);
+  store->fileBytes    = buffer.size;
+  store->liveBytes    = buffer.size - RAY_STORE_HEADER;
+  store->pending.size = 0;
+}
+
+/*!MD
+#### Storage:get
+```lua
+number/string/boolean Value = Storage:get(string Key[, any Default])
+```
+Get value of key, or Default if there is no value.
+*/
+int lua_class_storage_Get(lua_State *L){
+  Storage * store = _ptr_storage_Check(L, 1);
+  luaL_checkstring(L, 2);
+  lua_rawgeti(L, LUA_REGISTRYINDEX, store->values);
+  lua_pushvalue(L, 2);
+  lua_rawget(L, -2);
+  if (lua_isnil(L, -1)) lua_pushvalue(L, 3);
+  return 1;
+}
+
+/*!MD
+#### Storage:set
+```lua
+Storage Store = Storage:set(string Key, number/string/boolean/nil Value)
+```
+Set value of key, nil removes it. Strings may contain binary data.
+*/
+int lua_class_storage_Set(lua_State *L){
+  Storage * store = _ptr_storage_Check(L, 1);
+  size_t keyLength, size;
+  const char * key = luaL_checklstring(L, 2, &keyLength);
+  int type;
+  const void * data;
+  double number;
+  unsigned char boolean;
+  lua_settop(L, 3);
+  if (!_ptr_storage_Encode(L, 3, &type, &data, &size, &number, &boolean))
+    return luaL_error(L, "Storage value should be number, string, boolean or nil");
+  if (!ray_store_append(&store->pending, type, key, keyLength, data, size))
+    return luaL_error(L, "Can't allocate memory for storage record");
+  lua_rawgeti(L, LUA_REGISTRYINDEX, store->values);                              // 4
+  lua_pushvalue(L, 2);
+  lua_rawget(L, 4);
+  if (!lua_isnil(L, -1)) {
+    store->liveBytes -= ray_store_recordSize(keyLength, _ptr_storage_ValueSize(L, -1));
+    store->count--;
+  }
+  if (type != RAY_STORE_DELETE) {
+    store->liveBytes += ray_store_recordSize(keyLength, size);
+    store->count++;
+  }
+  lua_pushvalue(L, 2);
+  lua_pushvalue(L, 3);
+  lua_rawset(L, 4);
+  if (store->pending.size >= store->batchSize && !_ptr_storage_Write(store))
+    return luaL_error(L, "Can't write storage \"%s\"", store->path);
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Storage:getKeys
+```lua
+table Keys = Storage:getKeys()
+```
+Get list of keys which have values.
+*/
+int lua_class_storage_GetKeys(lua_State *L){
+  Storage * store = _ptr_storage_Check(L, 1);
+  lua_createtable(L, store->count, 0);
+  lua_rawgeti(L, LUA_REGISTRYINDEX, store->values);
+  int i = 0;
+  lua_pushnil(L);
+  while (lua_next(L, -2)) {
+    lua_pop(L, 1);
+    lua_pushvalue(L, -1);
+    lua_rawseti(L, -4, ++i);
+  }
+  lua_pop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Storage:flush
+```lua
+Storage Store = Storage:flush()
+```
+Write pending changes and wait until they are stored on disk. Log is compacted if it is too big.
+*/
+int lua_class_storage_Flush(lua_State *L){
+  Storage * store = _ptr_storage_Check(L, 1);
+  if (!_ptr_storage_Write(store)) return luaL_error(L, "Can't write storage \"%s\"", store->path);
+  if (store->fileBytes > STORAGE_COMPACT_MIN && store->fileBytes > 2*(store->liveBytes + RAY_STORE_HEADER))
+    _ptr_storage_Compact(L, store);
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Storage:compact
+```lua
+Storage Store = Storage:compact()
+```
+Rewrite log with live values only (pending changes are written too). Log is replaced only when new one is complete.
+*/
+int lua_class_storage_Compact(lua_State *L){
+  _ptr_storage_Compact(L, _ptr_storage_Check(L, 1));
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Storage:getStats
+```lua
+integer Count, integer LiveBytes, integer FileBytes, integer PendingBytes = Storage:getStats()
+```
+Get count of values, size of their records, size of log file and size of changes which are not written yet.
+*/
+int lua_class_storage_GetStats(lua_State *L){
+  Storage * store = _ptr_storage_Check(L, 1);
+  lua_pushinteger(L, store->count);
+  lua_pushinteger(L, store->liveBytes);
+  lua_pushinteger(L, store->fileBytes);
+  lua_pushinteger(L, store->pending.size);
+  return 4;
+}
+
+/*!MD
+#### Storage:close
+```lua
+Storage:close()
+```
+Write pending changes and close store, it is done by garbage collector otherwise.
+*/
+int lua_class_storage_Close(lua_State *L){
+  Storage * store = (Storage *)luaL_checkudata(L, 1, "Storage");
+  int ok = 1;
+  if (store->file) {
+    ok = _ptr_storage_Write(store);
+    fclose(store->file);
+    store->file = NULL;
+  }
+  free(store->pending.data);
+  store->pending = (ray_store_buffer){ 0 };
+  luaL_unref(L, LUA_REGISTRYINDEX, store->values);
+  store->values = LUA_NOREF;
+  if (!ok) return luaL_error(L, "Can't write storage \"%s\"", store->path);
+  return 0;
+}
+
+int lua_class_storage__GC(lua_State *L){
+  Storage * store = (Storage *)luaL_checkudata(L, 1, "Storage");
+  if (store->file) {
+    _ptr_storage_Write(store);
+    fclose(store->file);
+    store->file = NULL;
+  }
+  free(store->pending.data);
+  free(store->path);
+  luaL_unref(L, LUA_REGISTRYINDEX, store->values);
+  return 0;
+}
+
+int lua_class_storage__ToString(lua_State *L){
+  Storage * store = (Storage *)luaL_checkudata(L, 1, "Storage");
+  lua_pushfstring(L, "Storage[%s]: %p", store->path ? store->path : "", store);
+  return 1;
+}
+
+luaL_Reg luaray_class_storage[] = {
+  {"get",        lua_class_storage_Get},
+  {"set",        lua_class_storage_Set},
+  {"getKeys",    lua_class_storage_GetKeys},
+  {"flush",      lua_class_storage_Flush},
+  {"compact",    lua_class_storage_Compact},
+  {"getStats",   lua_class_storage_GetStats},
+  {"close",      lua_class_storage_Close},
+
+  // meta
+  {"__gc",       lua_class_storage__GC},
+  {"__tostring", lua_class_storage__ToString},
+  {NULL, NULL}
+};
+
+/*!MD
+## FileWalker
+Iterator of directory entries created by [rl.fs.Walk](#Walk). Entries are read one by one, so walking of directories
+with many files needs no buffers, and can be stopped at any moment.
+```lua
+for path, type, size, modTime in rl.fs.Walk("res", {extensions = {"png", "jpg"}}) do
+  print(path, size)
+end
+```
+
+| **Methods**                        | description
+| :--------------------------------- | :-----------
+| [next](#FileWalkernext)            | Read next entry
+| [close](#FileWalkerclose)          | Stop walking
+
+### Initialization
+```lua
+FileWalker Walker = rl.fs.Walk(string Path[, table Options])
+```
+*/
+
+/*!MD
+#### FileWalker:next
+```lua
+string Path, string Type, number Size, number ModTime = FileWalker:next()
+nil = FileWalker:next() -- walking is finished
+```
+Read next entry, Type is "file" or "directory". Walker is callable the same way, so it is used by generic for.
+Directory is reported (if requested) before its contents.
+*/
+int lua_class_filewalker_Next(lua_State *L){
+  ray_fs_walker * walker = (ray_fs_walker *)luaL_checkudata(L, 1, "FileWalker");
+  ray_fs_entry entry;
+  if (!ray_fs_next(walker, &entry)) {
+    ray_fs_close(walker);
+    return 0;
+  }
+  lua_pushstring(L, entry.path);
+  lua_pushstring(L, entry.isDir ? "directory" : "file");
+  lua_pushnumber(L, entry.size);
+  lua_pushnumber(L, entry.modTime);
+  return 4;
+}
+
+/*!MD
+#### FileWalker:close
+```lua
+FileWalker:close()
+```
+Stop walking and close opened directories, it is done by garbage collector or at the end of walking otherwise.
+*/
+int lua_class_filewalker_Close(lua_State *L){
+  ray_fs_close((ray_fs_walker *)luaL_checkudata(L, 1, "FileWalker"));
+  return 0;
+}
+
+int lua_class_filewalker__ToString(lua_State *L){
+  ray_fs_walker * walker = (ray_fs_walker *)luaL_checkudata(L, 1, "FileWalker");
+  lua_pushfstring(L, "FileWalker[%s]: %p", walker->path, walker);
+  return 1;
+}
+
+luaL_Reg luaray_class_filewalker[] = {
+  {"next",       lua_class_filewalker_Next},
+  {"close",      lua_class_filewalker_Close},
+
+  // meta
+  {"__call",     lua_class_filewalker_Next},
+  {"__gc",       lua_class_filewalker_Close},
+  {"__tostring", lua_class_filewalker__ToString},
+  {NULL, NULL}
+};
+
+/*!MD
+## NPatchInfo
+### Initialization
+```lua
+--
+```
+*/
+
+
+/*!MD
+## CharInfo
+### Initialization
+```lua
+--
+```
+*/
+
+/*!MD
+## Font
+Font with glyph lookup table: glyph index of codepoint is found in O(1) (direct table for codepoints
+below 256 and hash table for the rest), so text functions of [Text](#Text) module don't depend on glyphs count.
+
+| **Fields**                                 | description
+| :----------------------------------------- | :-----------
+| baseSize                                   | Base size (default chars height), read only
+| charsCount                                 | Number of characters, read only
+
+| **Methods**                                | description
+| :----------------------------------------- | :-----------
+| [getGlyphIndex](#FontgetGlyphIndex)        | Get index of codepoint glyph
+| [unload](#Fontunload)                      | Release font
+| [isLoaded](#FontisLoaded)                  | Check if font is not freed
+
+### Initialization
+```lua
+-- variants
+Font Fnt = rl.Font(string Filename[, integer Size, table Codepoints])
+Font Fnt = rl.Font(string Filename[, integer Size, string Characters]) -- UTF-8 string of characters to load
+```
+Load font from file (TTF, OTF, FNT, image), default Size is 32, default characters are ASCII 32..126.
+Fonts are shared: loading the same file with the same parameters returns the same object, which should be unloaded
+the same number of times.
+Default font is returned by [rl.text.GetFontDefault](#GetFontDefault).
+*/
+#define FONT_GLYPHS_DIRECT 256 // codepoints with direct lookup
+
+typedef struct GlyphTable {
+  int   direct[FONT_GLYPHS_DIRECT]; // glyph index, -1 if there is no glyph
+  int * keys;                       // open addressing hash table for other codepoints, -1 is empty slot
+  int * values;
+  int   mask;                       // hash table capacity - 1
+  int   notFound;                   // index for missing codepoints, same as GetGlyphIndex returns
+} GlyphTable;
+
+typedef struct FontObject {
+  Font       font;                  // should be first, fields are accessed by offset
+  GlyphTable glyphs;
+  int        isDefault;             // default font, not owned by object
+  Asset      asset;
+} FontObject;
+
+FontObject lua_class_font_default = {0};
+
+#define _ptr_font_Hash(codepoint, mask) (((unsigned int)(codepoint)*2654435761u) & (mask))
+
+void _ptr_font_FreeGlyphs(GlyphTable * glyphs){
+  free(glyphs->keys);
+  free(glyphs->values);
+  glyphs->keys   = NULL;
+  glyphs->values = NULL;
+  glyphs->mask   = 0;
+}
+
+// Builds lookup table, the first glyph of codepoint is used (as GetGlyphIndex does)
+void _ptr_font_BuildGlyphs(GlyphTable * glyphs, Font font){
+  int hashed = 0;
+  for (int i = 0; i < FONT_GLYPHS_DIRECT; i++) glyphs->direct[i] = -1;
+  for (int i = 0; i < font.charsCount; i++) {
+    int cp = font.chars[i].value;
+    if (cp >= 0 && cp < FONT_GLYPHS_DIRECT) {
+      if (glyphs->direct[cp] < 0) glyphs->direct[cp] = i;
+    }
+    else hashed++;
+  }
+  glyphs->notFound = font.charsCount > 63 ? 63 : 0;
+
+  int capacity = 16;
+  while (capacity < hashed*2) capacity *= 2;
+  glyphs->keys   = hashed ? (int *)malloc(capacity*sizeof(int)) : NULL;
+  glyphs->values = hashed ? (int *)malloc(capacity*sizeof(int)) : NULL;
+  glyphs->mask   = capacity - 1;
+  if (!glyphs->keys || !glyphs->values) {
+    _ptr_font_FreeGlyphs(glyphs);
+    return;
+  }
+  for (int i = 0; i < capacity; i++) glyphs->keys[i] = -1;
+  for (int i = 0; i < font.charsCount; i++) {
+    int cp = font.chars[i].value;
+    if (cp >= 0 && cp < FONT_GLYPHS_DIRECT) continue;
+    int slot = _ptr_font_Hash(cp, glyphs->mask);
+    while (glyphs->keys[slot] != -1 && glyphs->keys[slot] != cp) slot = (slot + 1) & glyphs->mask;
+    if (glyphs->keys[slot] == cp) continue;
+    glyphs->keys[slot]   = cp;
+    glyphs->values[slot] = i;
+  }
+}
+
+int _ptr_font_GetGlyphIndex(GlyphTable * glyphs, int codepoint){
+  if (codepoint >= 0 && codepoint < FONT_GLYPHS_DIRECT) {
+    int index = glyphs->direct[codepoint];
+    return index < 0 ? glyphs->notFound : index;
+  }
+  if (!glyphs->keys) return glyphs->notFound;
+  int slot = _ptr_font_Hash(codepoint, glyphs->mask);
+  while (glyphs->keys[slot] != -1) {
+    if (glyphs->keys[slot] == codepoint) return glyphs->values[slot];
+    slot = (slot + 1) & glyphs->mask;
+  }
+  return glyphs->notFound;
+}
+
+// Returns default font object, its table is rebuilt if default font was reloaded (by InitWindow)
+FontObject * _ptr_font_Default(){
+  Font font = GetFontDefault();
+  if (font.chars != lua_class_font_default.font.chars || font.charsCount != lua_class_font_default.font.charsCount) {
+    _ptr_font_FreeGlyphs(&lua_class_font_default.glyphs);
+    lua_class_font_default.font      = font;
+    lua_class_font_default.isDefault = 1;
+    _ptr_font_BuildGlyphs(&lua_class_font_default.glyphs, font);
+  }
+  return &lua_class_font_default;
+}
+
+FontObject * _ptr_font_Check(lua_State *L, int index){
+  FontObject * fnt = (FontObject *)luaL_checkudata(L, index, "Font");
+  if (fnt->isDefault) return _ptr_font_Default();
+  if (!fnt->asset.loaded) luaL_error(L, "Font is unloaded");
+  return fnt;
+}
+
+Font * _ptr_font_Get(lua_State *L, int index){
+  return &_ptr_font_Check(L, index)->font;
+}
+
+void _ptr_font_Unload(void * object){
+  FontObject * fnt = (FontObject *)object;
+  _ptr_font_FreeGlyphs(&fnt->glyphs);
+  UnloadFont(fnt->font);
+  memset(&fnt->font, 0, sizeof(Font));
+}
+
+int _ptr_font_Bytes(FontObject * fnt){
+  return GetPixelDataSize(fnt->font.texture.width, fnt->font.texture.height, fnt->font.texture.format) +
+         fnt->font.charsCount*(sizeof(CharInfo) + sizeof(Rectangle)) + (fnt->glyphs.mask + 1)*2*sizeof(int);
+}
+
+// Font is loaded with the same size and codepoints, text layouts are rebuilt on drawing
+int _ptr_font_Reload(void * object, const char * path){
+  FontObject * fnt = (FontObject *)object;
+  int * codepoints = (int *)malloc((fnt->font.charsCount ? fnt->font.charsCount : 1)*sizeof(int));
+  if (!codepoints) return 0;
+  for (int i = 0; i < fnt->font.charsCount; i++) codepoints[i] = fnt->font.chars[i].value;
+  Font font = LoadFontEx(path, fnt->font.baseSize, codepoints, fnt->font.charsCount);
+  free(codepoints);
+  if (!font.chars || font.texture.id == GetFontDefault().texture.id) return 0;
+  rlglDraw(); // batch may use old texture
+  _ptr_font_Unload(fnt);
+  fnt->font = font;
+  _ptr_font_BuildGlyphs(&fnt->glyphs, fnt->font);
+  return _ptr_font_Bytes(fnt);
+}
+
+// Same as DrawTextEx
+void _ptr_font_DrawText(FontObject * fnt, const char * text, int length, Vector2 position, float fontSize, float spacing, Color tint){
+  Font  font        = fnt->font;
+  int   textOffsetY = 0;
+  float textOffsetX = 0.0f;
+  float scaleFactor = fontSize/font.baseSize;
+
+  for (int i = 0; i < length; i++) {
+    int codepointByteCount = 0;
+    int codepoint = GetNextCodepoint(&text[i], &codepointByteCount);
+    int index     = _ptr_font_GetGlyphIndex(&fnt->glyphs, codepoint);
+    if (codepoint == 0x3f) codepointByteCount = 1;
+
+    if (codepoint == '\n') {
+      textOffsetY += (int)((font.baseSize + font.baseSize/2)*scaleFactor);
+      textOffsetX = 0.0f;
+    }
+    else {
+      if ((codepoint != ' ') && (codepoint != '\t')) {
+        Rectangle rec = { position.x + textOffsetX + font.chars[index].offsetX*scaleFactor,
+                          position.y + textOffsetY + font.chars[index].offsetY*scaleFactor,
+                          font.recs[index].width*scaleFactor,
+                          font.recs[index].height*scaleFactor };
+        DrawTexturePro(font.texture, font.recs[index], rec, (Vector2){ 0, 0 }, 0.0f, tint);
+      }
+      if (font.chars[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + spacing);
+      else textOffsetX += ((float)font.chars[index].advanceX*scaleFactor + spacing);
+    }
+    i += (codepointByteCount - 1);
+  }
+}
+
+// Same as MeasureTextEx
+Vector2 _ptr_font_MeasureText(FontObject * fnt, const char * text, int length, float fontSize, float spacing){
+  Font  font          = fnt->font;
+  int   tempLen       = 0;
+  int   lenCounter    = 0;
+  float textWidth     = 0.0f;
+  float tempTextWidth = 0.0f;
+  float textHeight    = (float)font.baseSize;
+  float scaleFactor   = fontSize/(float)font.baseSize;
+
+  for (int i = 0; i < length; i++) {
+    lenCounter++;
+    int next   = 0;
+    int letter = GetNextCodepoint(&text[i], &next);
+    int index  = _ptr_font_GetGlyphIndex(&fnt->glyphs, letter);
+    if (letter == 0x3f) next = 1;
+    i += next - 1;
+
+    if (letter != '\n') {
+      if (font.chars[index].advanceX != 0) textWidth += font.chars[index].advanceX;
+      else textWidth += (font.recs[index].width + font.chars[index].offsetX);
+    }
+    else {
+      if (tempTextWidth < textWidth) tempTextWidth = textWidth;
+      lenCounter = 0;
+      textWidth  = 0;
+      textHeight += ((float)font.baseSize*1.5f);
+    }
+    if (tempLen < lenCounter) tempLen = lenCounter;
+  }
+  if (tempTextWidth < textWidth) tempTextWidth = textWidth;
+
+  Vector2 vec = { 0 };
+  vec.x = tempTextWidth*scaleFactor + (float)((tempLen - 1)*spacing);
+  vec.y = textHeight*scaleFactor;
+  return vec;
+}
+
+// Same as DrawTextRec (DrawTextRecEx without selection)
+void _ptr_font_DrawTextRec(FontObject * fnt, const char * text, int length, Rectangle rec, float fontSize, float spacing, bool wordWrap, Color tint){
+  enum { MEASURE_STATE = 0, DRAW_STATE = 1 };
+  Font  font        = fnt->font;
+  int   textOffsetY = 0;
+  float textOffsetX = 0.0f;
+  float scaleFactor = fontSize/font.baseSize;
+  int   state       = wordWrap ? MEASURE_STATE : DRAW_STATE;
+  int   startLine   = -1;
+  int   endLine     = -1;
+
+  for (int i = 0; i < length; i++) {
+    int codepointByteCount = 0;
+    int codepoint = GetNextCodepoint(&text[i], &codepointByteCount);
+    int index     = _ptr_font_GetGlyphIndex(&fnt->glyphs, codepoint);
+    if (codepoint == 0x3f) codepointByteCount = 1;
+    i += (codepointByteCount - 1);
+
+    int glyphWidth = 0;
+    if (codepoint != '\n') {
+      glyphWidth = (font.chars[index].advanceX == 0) ?
+                   (int)(font.recs[index].width*scaleFactor + spacing) :
+                   (int)(font.chars[index].advanceX*scaleFactor + spacing);
+    }
+
+    if (state == MEASURE_STATE) {
+      if ((codepoint == ' ') || (codepoint == '\t') || (codepoint == '\n')) endLine = i;
+      if ((textOffsetX + glyphWidth + 1) >= rec.width) {
+        endLine = (endLine < 1) ? i : endLine;
+        if (i == endLine) endLine -= codepointByteCount;
+        if ((startLine + codepointByteCount) == endLine) endLine = (i - codepointByteCount);
+        state = !state;
+      }
+      else if ((i + 1) == length) {
+        endLine = i;
+        state = !state;
+      }
+      else if (codepoint == '\n') state = !state;
+
+      if (state == DRAW_STATE) {
+        textOffsetX = 0;
+        i = startLine;
+        glyphWidth = 0;
+      }
+    }
+    else {
+      if (codepoint == '\n') {
+        if (!wordWrap) {
+          textOffsetY += (int)((font.baseSize + font.baseSize/2)*scaleFactor);
+          textOffsetX = 0;
+        }
+      }
+      else {
+        if (!wordWrap && ((textOffsetX + glyphWidth + 1) >= rec.width)) {
+          textOffsetY += (int)((font.baseSize + font.baseSize/2)*scaleFactor);
+          textOffsetX = 0;
+        }
+        if ((textOffsetY + (int)(font.baseSize*scaleFactor)) > rec.height) break;
+        if ((codepoint != ' ') && (codepoint != '\t')) {
+          DrawTexturePro(font.texture, font.recs[index],
+                         (Rectangle){ rec.x + textOffsetX + font.chars[index].offsetX*scaleFactor,
+                                      rec.y + textOffsetY + font.chars[index].offsetY*scaleFactor,
+                                      font.recs[index].width*scaleFactor, font.recs[index].height*scaleFactor },
+                         (Vector2){ 0, 0 }, 0.0f, tint);
+        }
+      }
+      if (wordWrap && (i == endLine)) {
+        textOffsetY += (int)((font.baseSize + font.baseSize/2)*scaleFactor);
+        textOffsetX = 0;
+        startLine = endLine;
+        endLine = -1;
+        glyphWidth = 0;
+        state = !state;
+      }
+    }
+    textOffsetX += glyphWidth;
+  }
+}
+
+int lua_class_font_new(lua_State *L){
+  const char * fname = luaL_checkstring(L, 1);
+  int size = luax_optinteger(L, 2, 32);
+
+  // cache key: path, size and codepoints
+  luaL_Buffer key;
+  luaL_buffinit(L, &key);
+  lua_pushfstring(L, "Font|%s|%d|", fname, size);
+  luaL_addvalue(&key);
+  if (lua_istable(L, 3)) {
+    for (int i = 1, count = lua_objlen(L, 3); i <= count; i++) {
+      lua_rawgeti(L, 3, i);
+      lua_pushfstring(L, "%d,", (int)lua_tointeger(L, -1));
+      lua_remove(L, -2);
+      luaL_addvalue(&key);
+    }
+  }
+  else if (lua_isstring(L, 3)) {
+    lua_pushvalue(L, 3);
+    luaL_addvalue(&key);
+  }
+  luaL_pushresult(&key);
+  if (_ptr_asset_Find(L, lua_tostring(L, -1), fname)) return 1;
+
+  if (!FileExists(fname))
+    return luaL_error(L, "Can't load font \"%s\", file is not exists", fname);
+
+  int * codepoints = NULL;
+  int   count      = 0;
+  if (lua_istable(L, 3)) {
+    count = lua_objlen(L, 3);
+    codepoints = (int *)malloc((count ? count : 1)*sizeof(int));
+    if (!codepoints) return luaL_error(L, "Can't allocate codepoints array");
+    for (int i = 0; i < count; i++) {
+      lua_rawgeti(L, 3, i + 1);
+      codepoints[i] = lua_tointeger(L, -1);
+      lua_pop(L, 1);
+    }
+  }
+  else if (lua_isstring(L, 3)) {
+    size_t len;
+    const char * text = lua_tolstring(L, 3, &len);
+    codepoints = (int *)malloc((len ? len : 1)*sizeof(int));
+    if (!codepoints) return luaL_error(L, "Can't allocate codepoints array");
+    for (size_t i = 0; i < len; count++) {
+      int bytes = 0;
+      codepoints[count] = GetNextCodepoint(&text[i], &bytes);
+      i += bytes > 0 ? bytes : 1;
+    }
+  }
+
+  FontObject * fnt = (FontObject *)luax_newobject(L, "Font", sizeof(FontObject));
+  memset(fnt, 0, sizeof(FontObject));
+  fnt->font = LoadFontEx(fname, size, codepoints, count);
+  free(codepoints);
+  _ptr_font_BuildGlyphs(&fnt->glyphs, fnt->font);
+  _ptr_asset_Add(L, -1, &fnt->asset, lua_tostring(L, -2), fname, _ptr_font_Bytes(fnt), _ptr_font_Unload);
+  fnt->asset.reload = _ptr_font_Reload;
+  return 1;
+}
+
+/*!MD
+#### Font:getGlyphIndex
+```lua
+integer Index = Font:getGlyphIndex(integer Codepoint)
+```
+Get index of codepoint glyph (starting from 0, as raylib GetGlyphIndex), index of '?' glyph is returned for missing codepoints.
+*/
+int lua_class_font_GetGlyphIndex(lua_State *L){
+  FontObject * fnt = _ptr_font_Check(L, 1);
+  lua_pushinteger(L, _ptr_font_GetGlyphIndex(&fnt->glyphs, luaL_checkinteger(L, 2)));
+  return 1;
+}
+
+int lua_class_font_GetCharsCountField(lua_State *L, void * obj){
+  lua_pushinteger(L, ((FontObject *)obj)->isDefault ? _ptr_font_Default()->font.charsCount : ((FontObject *)obj)->font.charsCount);
+  return 1;
+}
+
+int lua_class_font_GetBaseSizeField(lua_State *L, void * obj){
+  lua_pushinteger(L, ((FontObject *)obj)->isDefault ? _ptr_font_Default()->font.baseSize : ((FontObject *)obj)->font.baseSize);
+  return 1;
+}
+
+luax_Field luaray_fields_font[] = {
+  luax_fieldcustom("baseSize",   lua_class_font_GetBaseSizeField),
+  luax_fieldcustom("charsCount", lua_class_font_GetCharsCountField),
+  {NULL}
+};
+
+/*!MD
+#### Font:unload
+```lua
+Font:unload()
+```
+Release font. Font is freed when every load of it is released (or it is kept by asset cache, see
+[rl.assets.SetBudget](#SetBudget)). Using of freed font raises an error, default font is never freed.
+*/
+int lua_class_font_Unload(lua_State *L){
+  FontObject * fnt = (FontObject *)luaL_checkudata(L, 1, "Font");
+  if (!fnt->isDefault) _ptr_asset_Release(L, 1, &fnt->asset);
+  return 0;
+}
+
+/*!MD
+#### Font:isLoaded
+```lua
+boolean Loaded = Font:isLoaded()
+```
+Check if font is not freed.
+*/
+int lua_class_font_IsLoaded(lua_State *L){
+  FontObject * fnt = (FontObject *)luaL_checkudata(L, 1, "Font");
+  lua_pushboolean(L, fnt->isDefault || fnt->asset.loaded);
+  return 1;
+}
+
+int lua_class_font__GC(lua_State *L){
+  FontObject * fnt = (FontObject *)luaL_checkudata(L, 1, "Font");
+  if (!fnt->isDefault) _ptr_asset_Free(L, &fnt->asset);
+  return 0;
+}
+
+int lua_class_font__ToString(lua_State *L){
+  FontObject * fnt = _ptr_font_Check(L, 1);
+  lua_pushfstring(L, "Font[%d, %d]: %p", fnt->font.baseSize, fnt->font.charsCount, fnt);
+  return 1;
+}
+
+luaL_Reg luaray_class_font[] = {
+  {"getGlyphIndex", lua_class_font_GetGlyphIndex},
+  {"unload",        lua_class_font_Unload},
+  {"isLoaded",      lua_class_font_IsLoaded},
+
+  // meta
+  {"__gc",          lua_class_font__GC},
+  {"__tostring",    lua_class_font__ToString},
+  {NULL, NULL}
+};
+
+
+/*!MD
+## TextLayout
+Text prepared for drawing: UTF-8 decoding, glyph lookup, line breaking and quads placement are done once,
+drawing is a single append of ready quads to the rlgl batch. Useful for static labels.
+Positions are the same as [rl.text.DrawTextEx](#DrawTextEx) ones (raylib fonts have no kerning data).
+
+| **Methods**                                | description
+| :----------------------------------------- | :-----------
+| [draw](#TextLayoutdraw)                    | Draw text
+| [setText](#TextLayoutsetText)              | Replace text and rebuild layout
+| [getText](#TextLayoutgetText)              | Get text
+| [getSize](#TextLayoutgetSize)              | Get size of text block
+
+### Initialization
+```lua
+TextLayout Layout = rl.TextLayout(Font Fnt, string Text, number FontSize, number Spacing[, number WrapWidth])
+```
+Creates new text layout, if WrapWidth is passed lines are wrapped by words to fit it.
+*/
+#define TEXTLAYOUT_QUAD_FLOATS 8       // x, y, width, height, u1, v1, u2, v2
+#define TEXTLAYOUT_BATCH_QUADS 1024    // quads per rlgl buffer check
+
+typedef struct TextLayout {
+  int          fontRef;                // registry reference to Font object
+  FontObject * font;
+  char       * text;
+  int          length;
+  float        fontSize, spacing, wrapWidth;
+  unsigned int fontVersion;            // font asset version used by quads
+  float      * quads;
+  int          count;
+  Vector2      size;
+} TextLayout;
+
+// Glyph advance, same as DrawTextEx
+#define _ptr_textlayout_Advance(font, index, scale, spacing) \
+        ((font).chars[index].advanceX == 0 ? (float)(font).recs[index].width*(scale) + (spacing) : (float)(font).chars[index].advanceX*(scale) + (spacing))
+
+// Width of the word starting at text[i] (up to space or line break)
+float _ptr_textlayout_WordWidth(FontObject * fnt, const char * text, int length, int i, float scale, float spacing){
+  float width = 0;
+  while (i < length) {
+    int bytes = 0;
+    int codepoint = GetNextCodepoint(&text[i], &bytes);
+    if (codepoint == 0x3f) bytes = 1;
+    if (codepoint == ' ' || codepoint == '\t' || codepoint == '\n') break;
+    width += _ptr_textlayout_Advance(fnt->font, _ptr_font_GetGlyphIndex(&fnt->glyphs, codepoint), scale, spacing);
+    i += bytes;
+  }
+  return width;
+}
+
+// Returns 0 on allocation failure
+int _ptr_textlayout_Build(TextLayout * layout){
+  FontObject * fnt    = layout->font->isDefault ? _ptr_font_Default() : layout->font;
+  Font         font   = fnt->font;
+  const char * text   = layout->text;
+  int          length = layout->length;
+  float        scale  = layout->fontSize/font.baseSize;
+  float        lineHeight = (int)((font.baseSize + font.baseSize/2)*scale);
+
+  layout->fontVersion = fnt->asset.version;
+  free(layout->quads);
+  layout->quads = (float *)malloc((length ? length : 1)*TEXTLAYOUT_QUAD_FLOATS*sizeof(float));
+  layout->count = 0;
+  layout->size  = (Vector2){ 0, 0 };
+  if (!layout->quads) return 0;
+  if (!font.chars || !font.baseSize) return 1;
+
+  float offsetX = 0, offsetY = 0, lineWidth = 0;
+  int   wordStart = 1;
+  for (int i = 0; i < length; i++) {
+    int bytes = 0;
+    int codepoint = GetNextCodepoint(&text[i], &bytes);
+    int index     = _ptr_font_GetGlyphIndex(&fnt->glyphs, codepoint);
+    if (codepoint == 0x3f) bytes = 1;
+
+    if (codepoint == '\n') {
+      offsetY  += lineHeight;
+      offsetX   = 0;
+      wordStart = 1;
+    }
+    else {
+      float advance = _ptr_textlayout_Advance(font, index, scale, layout->spacing);
+      int   isSpace = codepoint == ' ' || codepoint == '\t';
+      if (layout->wrapWidth > 0 && offsetX > 0) {
+        // move whole word to the next line, break words which are wider than line
+        int wrap = wordStart && !isSpace ?
+                   offsetX + _ptr_textlayout_WordWidth(fnt, text, length, i, scale, layout->spacing) - layout->spacing > layout->wrapWidth :
+                   !isSpace && offsetX + advance - layout->spacing > layout->wrapWidth;
+        if (wrap) {
+          offsetY += lineHeight;
+          offsetX  = 0;
+        }
+      }
+      if (offsetX == 0 && isSpace && layout->wrapWidth > 0 && offsetY > 0 && text[i - 1] != '\n') {
+        i += bytes - 1; // skip spaces at the start of wrapped line
+        continue;
+      }
+      if (!isSpace) {
+        float * q = layout->quads + layout->count*TEXTLAYOUT_QUAD_FLOATS;
+        Rectangle src = font.recs[index];
+        q[0] = offsetX + font.chars[index].offsetX*scale;
+        q[1] = offsetY + font.chars[index].offsetY*scale;
+        q[2] = src.width*scale;
+        q[3] = src.height*scale;
+        q[4] = src.x/font.texture.width;
+        q[5] = src.y/font.texture.height;
+        q[6] = (src.x + src.width)/font.texture.width;
+        q[7] = (src.y + src.height)/font.texture.height;
+        layout->count++;
+      }
+      offsetX  += advance;
+      wordStart = isSpace;
+      if (offsetX - layout->spacing > lineWidth) lineWidth = offsetX - layout->spacing;
+    }
+    i += bytes - 1;
+  }
+  layout->size = (Vector2){ lineWidth, offsetY + font.baseSize*scale };
+  return 1;
+}
+
+void _ptr_textlayout_Draw(TextLayout * layout, Vector2 position, Color tint){
+  FontObject * fnt = layout->font->isDefault ? _ptr_font_Default() : layout->font;
+  if (!fnt->isDefault && !fnt->asset.loaded) return;
+  if (layout->fontVersion != fnt->asset.version && !_ptr_textlayout_Build(layout)) return;
+  for (int first = 0; first < layout->count; first += TEXTLAYOUT_BATCH_QUADS) {
+    int last = first + TEXTLAYOUT_BATCH_QUADS < layout->count ? first + TEXTLAYOUT_BATCH_QUADS : layout->count;
+    if (rlCheckBufferLimit((last - first)*4)) rlglDraw();
+    rlEnableTexture(fnt->font.texture.id);
+    rlBegin(RL_QUADS);
+    rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+    rlNormal3f(0.0f, 0.0f, 1.0f);
+    for (int i = first; i < last; i++) {
+      float * q = layout->quads + i*TEXTLAYOUT_QUAD_FLOATS;
+      float   x = position.x + q[0], y = position.y + q[1];
+      rlTexCoord2f(q[4], q[5]); rlVertex2f(x, y);
+      rlTexCoord2f(q[4], q[7]); rlVertex2f(x, y + q[3]);
+      rlTexCoord2f(q[6], q[7]); rlVertex2f(x + q[2], y + q[3]);
+      rlTexCoord2f(q[6], q[5]); rlVertex2f(x + q[2], y);
+    }
+    rlEnd();
+  }
+  rlDisableTexture();
+}
+
+// Copies text from stack index
+void _ptr_textlayout_SetText(lua_State *L, TextLayout * layout, int index){
+  size_t len;
+  const char * text = luaL_checklstring(L, index, &len);
+  char * copy = (char *)malloc(len + 1);
+  if (!copy) luaL_error(L, "Can't allocate text layout");
+  memcpy(copy, text, len + 1);
+  free(layout->text);
+  layout->text   = copy;
+  layout->length = len;
+  if (!_ptr_textlayout_Build(layout)) luaL_error(L, "Can't allocate text layout");
+}
+
+int lua_class_textlayout_new(lua_State *L){
+  FontObject * fnt = (FontObject *)luaL_checkudata(L, 1, "Font");
+  _ptr_font_Check(L, 1);
+  luaL_checkstring(L, 2);
+  float size      = luaL_checknumber(L, 3);
+  float spacing   = luaL_checknumber(L, 4);
+  float wrapWidth = luax_optnumber(L, 5, 0);
+  TextLayout * layout = (TextLayout *)luax_newobject(L, "TextLayout", sizeof(TextLayout));
+  memset(layout, 0, sizeof(TextLayout));
+  layout->fontSize  = size;
+  layout->spacing   = spacing;
+  layout->wrapWidth = wrapWidth;
+  layout->font      = fnt;
+  lua_pushvalue(L, 1);
+  layout->fontRef   = luaL_ref(L, LUA_REGISTRYINDEX);
+  _ptr_textlayout_SetText(L, layout, 2);
+  return 1;
+}
+
+/*!MD
+#### TextLayout:draw
+```lua
+-- variants
+TextLayout Layout = TextLayout:draw(Vector2 Position, Color Tint)
+TextLayout Layout = TextLayout:draw(number X, number Y, Color Tint)
+```
+Draw text, top-left corner is placed at Position.
+*/
+int lua_class_textlayout_Draw(lua_State *L){
+  TextLayout * layout = (TextLayout *)luaL_checkudata(L, 1, "TextLayout");
+  if (lua_isnumber(L, 2)) {
+    Vector2 position = { luaL_checknumber(L, 2), luaL_checknumber(L, 3) };
+    _ptr_textlayout_Draw(layout, position, *(Color *)luax_checkclass(L, 4, "Color"));
+  }
+  else _ptr_textlayout_Draw(layout, *(Vector2 *)luax_checkclass(L, 2, "Vector2"), *(Color *)luax_checkclass(L, 3, "Color"));
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### TextLayout:setText
+```lua
+TextLayout Layout = TextLayout:setText(string Text)
+```
+Replace text and rebuild layout (nothing is done if text is not changed).
+*/
+int lua_class_textlayout_SetText(lua_State *L){
+  TextLayout * layout = (TextLayout *)luaL_checkudata(L, 1, "TextLayout");
+  size_t len;
+  const char * text = luaL_checklstring(L, 2, &len);
+  if (len != (size_t)layout->length || memcmp(text, layout->text, len)) _ptr_textlayout_SetText(L, layout, 2);
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### TextLayout:getText
+```lua
+string Text = TextLayout:getText()
+```
+Get text of layout.
+*/
+int lua_class_textlayout_GetText(lua_State *L){
+  TextLayout * layout = (TextLayout *)luaL_checkudata(L, 1, "TextLayout");
+  lua_pushlstring(L, layout->text, layout->length);
+  return 1;
+}
+
+/*!MD
+#### TextLayout:getSize
+```lua
+Vector2 Size = TextLayout:getSize([Vector2 Out])
+```
+Get size of text block, result is written to Out if it is passed.
+*/
+int lua_class_textlayout_GetSize(lua_State *L){
+  TextLayout * layout = (TextLayout *)luaL_checkudata(L, 1, "TextLayout");
+  Vector2 * out;
+  if (lua_isnoneornil(L, 2)) out = (Vector2 *)luax_newobject(L, "Vector2", sizeof(Vector2));
+  else {
+    out = (Vector2 *)luax_checkclass(L, 2, "Vector2");
+    lua_settop(L, 2);
+  }
+  *out = layout->size;
+  return 1;
+}
+
+int lua_class_textlayout__GC(lua_State *L){
+  TextLayout * layout = (TextLayout *)luaL_checkudata(L, 1, "TextLayout");
+  luaL_unref(L, LUA_REGISTRYINDEX, layout->fontRef);
+  free(layout->text);
+  free(layout->quads);
+  layout->text  = NULL;
+  layout->quads = NULL;
+  return 0;
+}
+
+int lua_class_textlayout__ToString(lua_State *L){
+  TextLayout * layout = (TextLayout *)luaL_checkudata(L, 1, "TextLayout");
+  lua_pushfstring(L, "TextLayout[%d glyphs]: %p", layout->count, layout);
+  return 1;
+}
+
+luaL_Reg luaray_class_textlayout[] = {
+  {"draw",       lua_class_textlayout_Draw},
+  {"setText",    lua_class_textlayout_SetText},
+  {"getText",    lua_class_textlayout_GetText},
+  {"getSize",    lua_class_textlayout_GetSize},
+
+  // meta
+  {"__gc",       lua_class_textlayout__GC},
+  {"__tostring", lua_class_textlayout__ToString},
+  {NULL, NULL}
+};
+
+
+/*!MD
+## DynamicFont
+TTF/OTF font with dynamic glyph atlas: glyphs are rasterized on first use and packed into atlas pages,
+so fonts with large character sets (CJK etc) don't rasterize everything on loading.
+When all pages are full, the least recently used page is cleared and reused.
+Positions and sizes are the same as [rl.text.DrawTextEx](#DrawTextEx) and [rl.text.MeasureTextEx](#MeasureTextEx) ones.
+
+| **Fields**                                 | description
+| :----------------------------------------- | :-----------
+| baseSize                                   | Base size (default chars height), read only
+
+| **Methods**                                | description
+| :----------------------------------------- | :-----------
+| [draw](#DynamicFontdraw)                   | Draw text
+| [measure](#DynamicFontmeasure)             | Measure text size
+| [preload](#DynamicFontpreload)             | Rasterize characters of text
+| [getStats](#DynamicFontgetStats)           | Get atlas statistics
+| [getGlyph](#DynamicFontgetGlyph)           | Get atlas rectangle of cached glyph
+
+### Initialization
+```lua
+DynamicFont Fnt = rl.DynamicFont(string Filename[, integer Size, integer PageSize, integer MaxPages])
+```
+Load font from TTF/OTF file, default Size is 32, atlas pages are PageSize x PageSize (default 512), up to MaxPages (default 4).
+*/
+typedef struct DynamicFont {
+  ray_atlas       atlas;
+  unsigned int  * textures;            // texture of every page, 0 if not loaded
+  unsigned char * upload;              // gray-alpha pixels of page for uploading
+} DynamicFont;
+
+// Returns texture of page, uploading changed pixels.
+// Batch is drawn before updating: pending quads could use glyphs evicted from this page.
+unsigned int _ptr_dynamicfont_Texture(DynamicFont * fnt, int page){
+  ray_atlas_page * p = &fnt->atlas.pages[page];
+  int size = fnt->atlas.pageSize;
+  if (!p->dirty && fnt->textures[page]) return fnt->textures[page];
+  for (int i = 0; i < size*size; i++) {
+    fnt->upload[i*2]     = 255;
+    fnt->upload[i*2 + 1] = p->pixels[i];
+  }
+  if (fnt->textures[page]) {
+    rlglDraw();
+    rlUpdateTexture(fnt->textures[page], size, size, UNCOMPRESSED_GRAY_ALPHA, fnt->upload);
+  }
+  else fnt->textures[page] = rlLoadTexture(fnt->upload, size, size, UNCOMPRESSED_GRAY_ALPHA, 1);
+  p->dirty = 0;
+  return fnt->textures[page];
+}
+
+// Rasterizes glyphs of text which are not cached yet and marks their pages as used, returns 0 on allocation failure.
+// Called before drawing, so every changed page is uploaded once per text, not once per new glyph.
+int _ptr_dynamicfont_Preload(DynamicFont * fnt, const char * text, int length){
+  for (int i = 0; i < length;) {
+    int bytes = 0;
+    int codepoint = GetNextCodepoint(&text[i], &bytes);
+    i += bytes > 0 ? bytes : 1;
+    if (codepoint != '\n' && !ray_atlas_get(&fnt->atlas, codepoint)) return 0;
+  }
+  return 1;
+}
+
+// Same as DrawTextEx. Glyphs are rasterized before quads are emitted, they are rasterized again while drawing
+// only if text needs more glyphs than pages can keep (and earlier ones are evicted).
+void _ptr_dynamicfont_DrawText(DynamicFont * fnt, const char * text, int length, Vector2 position, float fontSize, float spacing, Color tint){
+  _ptr_dynamicfont_Preload(fnt, text, length);
+  int   textOffsetY = 0;
+  float textOffsetX = 0.0f;
+  float baseSize    = fnt->atlas.fontSize;
+  float scaleFactor = fontSize/baseSize;
+  float texelSize   = 1.0f/fnt->atlas.pageSize;
+
+  for (int i = 0; i < length; i++) {
+    int codepointByteCount = 0;
+    int codepoint = GetNextCodepoint(&text[i], &codepointByteCount);
+    if (codepoint == 0x3f) codepointByteCount = 1;
+    i += (codepointByteCount - 1);
+
+    if (codepoint == '\n') {
+      textOffsetY += (int)((baseSize + baseSize/2)*scaleFactor);
+      textOffsetX = 0.0f;
+      continue;
+    }
+    ray_atlas_glyph * g = ray_atlas_get(&fnt->atlas, codepoint);
+    if (!g) continue;
+    ray_atlas_glyph glyph = *g;
+    if (codepoint != ' ' && codepoint != '\t' && glyph.page >= 0) {
+      unsigned int texture = _ptr_dynamicfont_Texture(fnt, glyph.page);
+      float x = position.x + textOffsetX + glyph.offsetX*scaleFactor;
+      float y = position.y + textOffsetY + glyph.offsetY*scaleFactor;
+      float w = glyph.width*scaleFactor, h = glyph.height*scaleFactor;
+      float u1 = glyph.x*texelSize, v1 = glyph.y*texelSize;
+      float u2 = (glyph.x + glyph.width)*texelSize, v2 = (glyph.y + glyph.height)*texelSize;
+      if (rlCheckBufferLimit(4)) rlglDraw();
+      rlEnableTexture(texture);
+      rlBegin(RL_QUADS);
+      rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+      rlNormal3f(0.0f, 0.0f, 1.0f);
+      rlTexCoord2f(u1, v1); rlVertex2f(x, y);
+      rlTexCoord2f(u1, v2); rlVertex2f(x, y + h);
+      rlTexCoord2f(u2, v2); rlVertex2f(x + w, y + h);
+      rlTexCoord2f(u2, v1); rlVertex2f(x + w, y);
+      rlEnd();
+    }
+    if (glyph.advanceX == 0) textOffsetX += ((float)glyph.width*scaleFactor + spacing);
+    else textOffsetX += ((float)glyph.advanceX*scaleFactor + spacing);
+  }
+  rlDisableTexture();
+}
+
+// Same as MeasureTextEx
+Vector2 _ptr_dynamicfont_MeasureText(DynamicFont * fnt, const char * text, int length, float fontSize, float spacing){
+  int   tempLen       = 0;
+  int   lenCounter    = 0;
+  float textWidth     = 0.0f;
+  float tempTextWidth = 0.0f;
+  float baseSize      = fnt->atlas.fontSize;
+  float textHeight    = baseSize;
+  float scaleFactor   = fontSize/baseSize;
+
+  for (int i = 0; i < length; i++) {
+    lenCounter++;
+    int next   = 0;
+    int letter = GetNextCodepoint(&text[i], &next);
+    if (letter == 0x3f) next = 1;
+    i += next - 1;
+
+    if (letter != '\n') {
+      ray_atlas_glyph * glyph = ray_atlas_get(&fnt->atlas, letter);
+      if (!glyph) continue;
+      if (glyph->advanceX != 0) textWidth += glyph->advanceX;
+      else textWidth += (glyph->width + glyph->offsetX);
+    }
+    else {
+      if (tempTextWidth < textWidth) tempTextWidth = textWidth;
+      lenCounter = 0;
+      textWidth  = 0;
+      textHeight += (baseSize*1.5f);
+    }
+    if (tempLen < lenCounter) tempLen = lenCounter;
+  }
+  if (tempTextWidth < textWidth) tempTextWidth = textWidth;
+
+  Vector2 vec = { 0 };
+  vec.x = tempTextWidth*scaleFactor + (float)((tempLen - 1)*spacing);
+  vec.y = textHeight*scaleFactor;
+  return vec;
+}
+
+int lua_class_dynamicfont_new(lua_State *L){
+  const char * fname = luaL_checkstring(L, 1);
+  int size     = luax_optinteger(L, 2, 32);
+  int pageSize = luax_optinteger(L, 3, 512);
+  int maxPages = luax_optinteger(L, 4, 4);
+  if (size <= 0 || pageSize <= 0 || maxPages <= 0)
+    return luaL_error(L, "Size, PageSize and MaxPages should be positive");
+
+  FILE * f = fopen(fname, "rb");
+  if (!f) return luaL_error(L, "Can't load font \"%s\", file is not exists", fname);
+  fseek(f, 0, SEEK_END);
+  long length = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  unsigned char * data = (unsigned char *)malloc(length > 0 ? length : 1);
+  int readed = data && length > 0 && fread(data, 1, length, f) == (size_t)length;
+  fclose(f);
+  if (!readed) {
+    free(data);
+    return luaL_error(L, "Can't read font \"%s\"", fname);
+  }
+
+  DynamicFont * fnt = (DynamicFont *)luax_newobject(L, "DynamicFont", sizeof(DynamicFont));
+  memset(fnt, 0, sizeof(DynamicFont));
+  if (!ray_atlas_init(&fnt->atlas, data, size, pageSize, maxPages))
+    return luaL_error(L, "Can't load font \"%s\", it is not TTF/OTF font", fname);
+  fnt->textures = (unsigned int *)calloc(maxPages, sizeof(unsigned int));
+  fnt->upload   = (unsigned char *)malloc(pageSize*pageSize*2);
+  if (!fnt->textures || !fnt->upload) return luaL_error(L, "Can't allocate font atlas");
+  return 1;
+}
+
+/*!MD
+#### DynamicFont:draw
+```lua
+-- variants
+DynamicFont Fnt = DynamicFont:draw(string Text, Vector2 Position, number FontSize, number Spacing, Color Tint)
+DynamicFont Fnt = DynamicFont:draw(string Text, number X, number Y, number FontSize, number Spacing, Color Tint)
+```
+Draw text, missing characters are rasterized and uploaded to atlas.
+*/
+int lua_class_dynamicfont_Draw(lua_State *L){
+  DynamicFont * fnt = (DynamicFont *)luaL_checkudata(L, 1, "DynamicFont");
+  size_t len;
+  const char * text = luaL_checklstring(L, 2, &len);
+  Vector2 position;
+  int idx = 4;
+  if (lua_isnumber(L, 3)) {
+    position = (Vector2){ luaL_checknumber(L, 3), luaL_checknumber(L, 4) };
+    idx = 5;
+  }
+  else position = *(Vector2 *)luax_checkclass(L, 3, "Vector2");
+  float size    = luaL_checknumber(L, idx);
+  float spacing = luaL_checknumber(L, idx + 1);
+  Color tint    = *(Color *)luax_checkclass(L, idx + 2, "Color");
+  _ptr_dynamicfont_DrawText(fnt, text, len, position, size, spacing, tint);
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### DynamicFont:measure
+```lua
+Vector2 Size = DynamicFont:measure(string Text, number FontSize, number Spacing[, Vector2 Out])
+```
+Measure text size, result is written to Out if it is passed.
+*/
+int lua_class_dynamicfont_Measure(lua_State *L){
+  DynamicFont * fnt = (DynamicFont *)luaL_checkudata(L, 1, "DynamicFont");
+  size_t len;
+  const char * text = luaL_checklstring(L, 2, &len);
+  float size    = luaL_checknumber(L, 3);
+  float spacing = luaL_checknumber(L, 4);
+  Vector2 * out;
+  if (lua_isnoneornil(L, 5)) out = (Vector2 *)luax_newobject(L, "Vector2", sizeof(Vector2));
+  else {
+    out = (Vector2 *)luax_checkclass(L, 5, "Vector2");
+    lua_settop(L, 5);
+  }
+  *out = _ptr_dynamicfont_MeasureText(fnt, text, len, size, spacing);
+  return 1;
+}
+
+/*!MD
+#### DynamicFont:preload
+```lua
+DynamicFont Fnt = DynamicFont:preload(string Text)
+```
+Rasterize characters of UTF-8 text (if they are not rasterized yet), useful for loading screens.
+Pages are uploaded on drawing.
+*/
+int lua_class_dynamicfont_Preload(lua_State *L){
+  DynamicFont * fnt = (DynamicFont *)luaL_checkudata(L, 1, "DynamicFont");
+  size_t len;
+  const char * text = luaL_checklstring(L, 2, &len);
+  if (!_ptr_dynamicfont_Preload(fnt, text, (int)len)) return luaL_error(L, "Can't allocate font atlas");
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### DynamicFont:getStats
+```lua
+integer Glyphs, integer Pages, integer Rasterized, integer Evicted = DynamicFont:getStats()
+```
+Get number of cached glyphs, atlas pages, and total numbers of rasterized and evicted glyphs.
+*/
+int lua_class_dynamicfont_GetStats(lua_State *L){
+  DynamicFont * fnt = (DynamicFont *)luaL_checkudata(L, 1, "DynamicFont");
+  lua_pushinteger(L, ray_atlas_count(&fnt->atlas));
+  lua_pushinteger(L, fnt->atlas.pagesCount);
+  lua_pushinteger(L, fnt->atlas.rasterized);
+  lua_pushinteger(L, fnt->atlas.evicted);
+  return 4;
+}
+
+/*!MD
+#### DynamicFont:getGlyph
+```lua
+integer Page, integer X, integer Y, integer Width, integer Height = DynamicFont:getGlyph(integer Codepoint)
+nil = DynamicFont:getGlyph(integer Codepoint) -- glyph is not rasterized yet or it was evicted
+```
+Get atlas rectangle of cached glyph (pages are numbered from 0, page is -1 for glyphs without image, like space).
+Glyph is not rasterized and its page is not marked as used, so it can be used for atlas inspection.
+*/
+int lua_class_dynamicfont_GetGlyph(lua_State *L){
+  DynamicFont     * fnt   = (DynamicFont *)luaL_checkudata(L, 1, "DynamicFont");
+  ray_atlas_glyph * glyph = ray_atlas_find(&fnt->atlas, luaL_checkinteger(L, 2));
+  if (!glyph) return 0;
+  lua_pushinteger(L, glyph->page);
+  lua_pushinteger(L, glyph->x);
+  lua_pushinteger(L, glyph->y);
+  lua_pushinteger(L, glyph->width);
+  lua_pushinteger(L, glyph->height);
+  return 5;
+}
+
+int lua_class_dynamicfont_GetBaseSizeField(lua_State *L, void * obj){
+  lua_pushinteger(L, ((DynamicFont *)obj)->atlas.fontSize);
+  return 1;
+}
+
+luax_Field luaray_fields_dynamicfont[] = {
+  luax_fieldcustom("baseSize", lua_class_dynamicfont_GetBaseSizeField),
+  {NULL}
+};
+
+int lua_class_dynamicfont__GC(lua_State *L){
+  DynamicFont * fnt = (DynamicFont *)luaL_checkudata(L, 1, "DynamicFont");
+  if (fnt->textures)
+    for (int i = 0; i < fnt->atlas.maxPages; i++)
+      if (fnt->textures[i]) rlUnloadTexture(fnt->textures[i]);
+  free(fnt->textures);
+  free(fnt->upload);
+  ray_atlas_free(&fnt->atlas);
+  fnt->textures = NULL;
+  fnt->upload   = NULL;
+  return 0;
+}
+
+int lua_class_dynamicfont__ToString(lua_State *L){
+  DynamicFont * fnt = (DynamicFont *)luaL_checkudata(L, 1, "DynamicFont");
+  lua_pushfstring(L, "DynamicFont[%d, %d glyphs]: %p", fnt->atlas.fontSize, ray_atlas_count(&fnt->atlas), fnt);
+  return 1;
+}
+
+luaL_Reg luaray_class_dynamicfont[] = {
+  {"draw",       lua_class_dynamicfont_Draw},
+  {"measure",    lua_class_dynamicfont_Measure},
+  {"preload",    lua_class_dynamicfont_Preload},
+  {"getStats",   lua_class_dynamicfont_GetStats},
+  {"getGlyph",   lua_class_dynamicfont_GetGlyph},
+
+  // meta
+  {"__gc",       lua_class_dynamicfont__GC},
+  {"__tostring", lua_class_dynamicfont__ToString},
+  {NULL, NULL}
+};
+
+
+/*!MD
+## Camera3D
+### Initialization
+```lua
+--
+```
+*/
+
+/*!MD
+## Camera2D
 ### Initialization
 ```lua
 --
 ```
 */
 
+
+/*!MD
+## Mesh
+Vertex data of mesh, kept in RAM and uploaded to GPU.
+
+| **Methods**                            | description
+| :------------------------------------- | :-----------
+| [getVertexCount](#MeshgetVertexCount)  | Get count of vertices
+| [getTriangleCount](#MeshgetTriangleCount) | Get count of triangles
+| [unload](#Meshunload)                  | Unload mesh from RAM and VRAM
+| [isLoaded](#MeshisLoaded)              | Check if mesh is not unloaded
+
+### Initialization
+```lua
+Mesh Msh = rl.models.GenMeshHeightmap(Image Heightmap, Vector3 Size)
+Mesh Msh = rl.models.GenMeshCube(number Width, number Height, number Length)
+-- etc, see rl.models
+```
+Mesh is moved to model by [rl.Model](#Model)(Mesh), it is unloaded with the model then.
+*/
+typedef struct MeshObject {
+  Mesh mesh;                           // should be first
+  int  loaded;                         // 0 if mesh is unloaded or moved to Model
+} MeshObject;
+
+int _ptr_mesh_TriangleCount(Mesh * mesh){
+  // raylib sets triangleCount for indexed meshes only reliably
+  return mesh->indices ? mesh->triangleCount : mesh->vertexCount/3;
+}
+
+void _ptr_mesh_Push(lua_State *L, Mesh mesh){
+  MeshObject * obj = (MeshObject *)luax_newobject(L, "Mesh", sizeof(MeshObject));
+  obj->mesh   = mesh;
+  obj->loaded = 1;
+}
+
+MeshObject * _ptr_mesh_Check(lua_State *L, int index){
+  MeshObject * obj = (MeshObject *)luaL_checkudata(L, index, "Mesh");
+  if (!obj->loaded) luaL_error(L, "Mesh is unloaded");
+  return obj;
+}
+
+/*!MD
+#### Mesh:getVertexCount
+```lua
+integer Count = Mesh:getVertexCount()
+```
+*/
+int lua_class_mesh_GetVertexCount(lua_State *L){
+  lua_pushinteger(L, _ptr_mesh_Check(L, 1)->mesh.vertexCount);
+  return 1;
+}
+
+/*!MD
+#### Mesh:getTriangleCount
+```lua
+integer Count = Mesh:getTriangleCount()
+```
+*/
+int lua_class_mesh_GetTriangleCount(lua_State *L){
+  lua_pushinteger(L, _ptr_mesh_TriangleCount(&_ptr_mesh_Check(L, 1)->mesh));
+  return 1;
+}
+
+/*!MD
+#### Mesh:unload
+```lua
+Mesh:unload()
+```
+Unload mesh, it is done by garbage collector otherwise.
+*/
+int lua_class_mesh_Unload(lua_State *L){
+  MeshObject * obj = (MeshObject *)luaL_checkudata(L, 1, "Mesh");
+  if (obj->loaded) UnloadMesh(obj->mesh);
+  obj->loaded = 0;
+  return 0;
+}
+
+/*!MD
+#### Mesh:isLoaded
+```lua
+boolean Loaded = Mesh:isLoaded()
+```
+Check if mesh is not unloaded (or moved to model).
+*/
+int lua_class_mesh_IsLoaded(lua_State *L){
+  lua_pushboolean(L, ((MeshObject *)luaL_checkudata(L, 1, "Mesh"))->loaded);
+  return 1;
+}
+
+int lua_class_mesh__ToString(lua_State *L){
+  MeshObject * obj = (MeshObject *)luaL_checkudata(L, 1, "Mesh");
+  lua_pushfstring(L, "Mesh[%d vertices]: %p", obj->loaded ? obj->mesh.vertexCount : 0, obj);
+  return 1;
+}
+
+luaL_Reg luaray_class_mesh[] = {
+  {"getVertexCount",   lua_class_mesh_GetVertexCount},
+  {"getTriangleCount", lua_class_mesh_GetTriangleCount},
+  {"unload",           lua_class_mesh_Unload},
+  {"isLoaded",         lua_class_mesh_IsLoaded},
+
+  // meta
+  {"__gc",             lua_class_mesh_Unload},
+  {"__tostring",       lua_class_mesh__ToString},
+  {NULL, NULL}
+};
+
+/*!MD
+## Shader
+### Initialization
+```lua
+--
+```
+*/
+
+/*!MD
+## MaterialMap
+### Initialization
+```lua
+--
+```
+*/
+
+/*!MD
+## Material
+### Initialization
+```lua
+--
+```
+*/
+
+
+/*!MD
+## Model
+Meshes with materials and transform. Meshes keep vertex data in RAM, so models can be picked by rays
+([rl.models.RaycastModel](#RaycastModel)), with bounding volume hierarchy built once per mesh.
+
+| **Methods**                                | description
+| :----------------------------------------- | :-----------
+| [draw](#Modeldraw)                         | Draw model
+| [setTransform](#ModelsetTransform)         | Set local transform
+| [getTransform](#ModelgetTransform)         | Get local transform
+| [getMeshCount](#ModelgetMeshCount)         | Get count of meshes
+| [getTriangleCount](#ModelgetTriangleCount) | Get count of triangles of all meshes
+| [getVertexCount](#ModelgetVertexCount)     | Get count of vertices of all meshes
+| [getBoneCount](#ModelgetBoneCount)         | Get count of skeleton bones
+| [getAnimVertices](#ModelgetAnimVertices)   | Get copy of animated vertex positions of mesh
+| [buildBVH](#ModelbuildBVH)                 | Build picking structure of meshes
+| [unload](#Modelunload)                     | Unload model from RAM and VRAM
+| [isLoaded](#ModelisLoaded)                 | Check if model is not unloaded
+
+### Initialization
+```lua
+-- variants
+Model Mdl = rl.Model(string Filename) -- OBJ, IQM, GLTF
+Model Mdl = rl.Model(Mesh Msh)        -- mesh is moved to model
+```
+*/
+typedef struct ModelObject {
+  Model       model;                   // should be first
+  int         loaded;
+  ray_bvh   * bvh;                     // per mesh, NULL until built
+  int         bounded;                 // bounds are computed
+  BoundingBox bounds;                  // of all meshes in bind pose, without transform
+} ModelObject;
+
+ModelObject * _ptr_model_Check(lua_State *L, int index){
+  ModelObject * obj = (ModelObject *)luaL_checkudata(L, index, "Model");
+  if (!obj->loaded) luaL_error(L, "Model is unloaded");
+  return obj;
+}
+
+void _ptr_model_FreeBVH(ModelObject * obj){
+  if (!obj->bvh) return;
+  for (int i = 0; i < obj->model.meshCount; i++) ray_bvh_free(&obj->bvh[i]);
+  free(obj->bvh);
+  obj->bvh = NULL;
+}
+
+// Builds BVH of meshes if it is not built yet, bind pose vertices are used for animated meshes
+void _ptr_model_BuildBVH(lua_State *L, ModelObject * obj){
+  if (obj->bvh) return;
+  ray_bvh * bvh = (ray_bvh *)calloc(obj->model.meshCount > 0 ? obj->model.meshCount : 1, sizeof(ray_bvh));
+  if (!bvh) {
+    luaL_error(L, "Can't allocate model BVH");
+    return;
+  }
+  for (int i = 0; i < obj->model.meshCount; i++) {
+    Mesh * mesh = &obj->model.meshes[i];
+    if (!mesh->vertices) continue;
+    if (!ray_bvh_build(&bvh[i], mesh->vertices, mesh->indices, _ptr_mesh_TriangleCount(mesh))) {
+      for (int j = 0; j < i; j++) ray_bvh_free(&bvh[j]);
+      free(bvh);
+      luaL_error(L, "Can't allocate model BVH");
+      return;
+    }
+  }
+  obj->bvh = bvh;
+}
+
+typedef struct {
+  float   distance;                    // along normalized direction
+  Vector3 normal;
+  int     triangle, mesh;              // 0-based, -1 if nothing is hit
+} ModelRayHit;
+
+// Inverse of model transform, returns 0 if transform is identity
+int _ptr_model_Inverse(ModelObject * obj, Matrix * inverse){
+  Matrix identity = MatrixIdentity();
+  if (!memcmp(&obj->model.transform, &identity, sizeof(Matrix))) return 0;
+  *inverse = MatrixInvert(obj->model.transform);
+  return 1;
+}
+
+// Bounding box of meshes is computed on first call, bind pose vertices are used for animated meshes
+BoundingBox _ptr_model_Bounds(ModelObject * obj){
+  if (obj->bounded) return obj->bounds;
+  int first = 1;
+  obj->bounds = (BoundingBox){ 0 };
+  for (int i = 0; i < obj->model.meshCount; i++) {
+    Mesh * mesh = &obj->model.meshes[i];
+    if (!mesh->vertices || mesh->vertexCount <= 0) continue;
+    BoundingBox box = MeshBoundingBox(*mesh);
+    obj->bounds.min = first ? box.min : Vector3Min(obj->bounds.min, box.min);
+    obj->bounds.max = first ? box.max : Vector3Max(obj->bounds.max, box.max);
+    first = 0;
+  }
+  obj->bounded = 1;
+  return obj->bounds;
+}
+
+// Ray is transformed to model space instead of vertices, direction is not normalized there, so distances are kept
+void _ptr_model_Raycast(ModelObject * obj, const Matrix * inverse, Vector3 origin, Vector3 dir, float maxDistance, ModelRayHit * result){
+  float o[3] = { origin.x, origin.y, origin.z }, d[3] = { dir.x, dir.y, dir.z };
+  if (inverse) {
+    const Matrix * m = inverse;
+    o[0] = m->m0*origin.x + m->m4*origin.y + m->m8*origin.z  + m->m12;
+    o[1] = m->m1*origin.x + m->m5*origin.y + m->m9*origin.z  + m->m13;
+    o[2] = m->m2*origin.x + m->m6*origin.y + m->m10*origin.z + m->m14;
+    d[0] = m->m0*dir.x + m->m4*dir.y + m->m8*dir.z;
+    d[1] = m->m1*dir.x + m->m5*dir.y + m->m9*dir.z;
+    d[2] = m->m2*dir.x + m->m6*dir.y + m->m10*dir.z;
+  }
+  ray_bvh_hit hit = { maxDistance, 0, 0, -1 };
+  result->triangle = result->mesh = -1;
+  for (int i = 0; i < obj->model.meshCount; i++)
+    if (ray_bvh_raycast(&obj->bvh[i], o, d, &hit)) result->mesh = i;
+  if (result->mesh < 0) return;
+  result->distance = hit.t;
+  result->triangle = hit.triangle;
+  // normal of source triangle, transformed by inverse transposed matrix
+  Mesh * mesh = &obj->model.meshes[result->mesh];
+  Vector3 * v = (Vector3 *)mesh->vertices;
+  int i = hit.triangle*3;
+  Vector3 a = v[mesh->indices ? mesh->indices[i]     : i];
+  Vector3 b = v[mesh->indices ? mesh->indices[i + 1] : i + 1];
+  Vector3 c = v[mesh->indices ? mesh->indices[i + 2] : i + 2];
+  Vector3 n = Vector3CrossProduct(Vector3Subtract(b, a), Vector3Subtract(c, a));
+  if (inverse) {
+    const Matrix * m = inverse;
+    n = (Vector3){ m->m0*n.x + m->m1*n.y + m->m2*n.z, m->m4*n.x + m->m5*n.y + m->m6*n.z, m->m8*n.x + m->m9*n.y + m->m10*n.z };
+  }
+  result->normal = Vector3Normalize(n);
+}
+
+int lua_class_model_new(lua_State *L){
+  if (luax_isclass(L, 1, "Mesh")) {
+    MeshObject * mesh = _ptr_mesh_Check(L, 1);
+    ModelObject * obj = (ModelObject *)luax_newobject(L, "Model", sizeof(ModelObject));
+    memset(obj, 0, sizeof(ModelObject));
+    obj->model  = LoadModelFromMesh(mesh->mesh);
+    obj->loaded = 1;
+    mesh->loaded = 0; // unloaded by model
+    return 1;
+  }
+  const char * fname = luaL_checkstring(L, 1);
+  if (!FileExists(fname)) return luaL_error(L, "Can't load model \"%s\", file is not exists", fname);
+  ModelObject * obj = (ModelObject *)luax_newobject(L, "Model", sizeof(ModelObject));
+  memset(obj, 0, sizeof(ModelObject));
+  obj->model  = LoadModel(fname);
+  obj->loaded = 1;
+  return 1;
+}
+
+/*!MD
+#### Model:draw
+```lua
+Model Mdl = Model:draw(Vector3 Position[, number Scale[, Color Tint]])
+```
+Draw model with its transform, default Scale is 1 and Tint is white.
+*/
+int lua_class_model_Draw(lua_State *L){
+  ModelObject * obj = _ptr_model_Check(L, 1);
+  Vector3 position  = *(Vector3 *)luax_checkclass(L, 2, "Vector3");
+  float   scale     = luax_optnumber(L, 3, 1);
+  Color   tint      = lua_isnoneornil(L, 4) ? WHITE : *(Color *)luax_checkclass(L, 4, "Color");
+  DrawModel(obj->model, position, scale, tint);
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Model:setTransform
+```lua
+Model Mdl = Model:setTransform(Matrix Transform)
+```
+Set local transform, it is used by drawing and picking (BVH is not rebuilt).
+*/
+int lua_class_model_SetTransform(lua_State *L){
+  ModelObject * obj = _ptr_model_Check(L, 1);
+  obj->model.transform = *(Matrix *)luax_checkclass(L, 2, "Matrix");
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Model:getTransform
+```lua
+Matrix Transform = Model:getTransform()
+```
+*/
+int lua_class_model_GetTransform(lua_State *L){
+  ModelObject * obj = _ptr_model_Check(L, 1);
+  Matrix * m = (Matrix *)luax_newobject(L, "Matrix", sizeof(Matrix));
+  *m = obj->model.transform;
+  return 1;
+}
+
+/*!MD
+#### Model:getMeshCount
+```lua
+integer Count = Model:getMeshCount()
+```
+*/
+int lua_class_model_GetMeshCount(lua_State *L){
+  lua_pushinteger(L, _ptr_model_Check(L, 1)->model.meshCount);
+  return 1;
+}
+
+/*!MD
+#### Model:getTriangleCount
+```lua
+integer Count = Model:getTriangleCount()
+```
+*/
+int lua_class_model_GetTriangleCount(lua_State *L){
+  ModelObject * obj = _ptr_model_Check(L, 1);
+  int count = 0;
+  for (int i = 0; i < obj->model.meshCount; i++) count += _ptr_mesh_TriangleCount(&obj->model.meshes[i]);
+  lua_pushinteger(L, count);
+  return 1;
+}
+
+/*!MD
+#### Model:getVertexCount
+```lua
+integer Count = Model:getVertexCount()
+```
+*/
+int lua_class_model_GetVertexCount(lua_State *L){
+  ModelObject * obj = _ptr_model_Check(L, 1);
+  int count = 0;
+  for (int i = 0; i < obj->model.meshCount; i++) count += obj->model.meshes[i].vertexCount;
+  lua_pushinteger(L, count);
+  return 1;
+}
+
+/*!MD
+#### Model:getBoneCount
+```lua
+integer Count = Model:getBoneCount()
+```
+Get count of bones, 0 for models without skeleton.
+*/
+int lua_class_model_GetBoneCount(lua_State *L){
+  lua_pushinteger(L, _ptr_model_Check(L, 1)->model.boneCount);
+  return 1;
+}
+
+/*!MD
+#### Model:getAnimVertices
+```lua
+Float32Buffer Positions = Model:getAnimVertices([integer Mesh])
+```
+Get copy of vertex positions of mesh (from 1, default 1) updated by last skinning, 3 numbers per vertex.
+Bind pose positions are returned for meshes without animation data.
+*/
+int lua_class_model_GetAnimVertices(lua_State *L){
+  ModelObject * obj = _ptr_model_Check(L, 1);
+  int index = luax_optinteger(L, 2, 1);
+  if (index < 1 || index > obj->model.meshCount)
+    return luaL_error(L, "Mesh %d is out of range [1, %d]", index, obj->model.meshCount);
+  Mesh * mesh = &obj->model.meshes[index - 1];
+  const float * v = mesh->animVertices ? mesh->animVertices : mesh->vertices;
+  DataBuffer * b = lua_class_buffer_push(L, DATABUFFER_FLOAT32, v ? mesh->vertexCount*3 : 0);
+  if (v) memcpy(b->data, v, mesh->vertexCount*3*sizeof(float));
+  return 1;
+}
+
+/*!MD
+#### Model:buildBVH
+```lua
+Model Mdl = Model:buildBVH([boolean Rebuild])
+```
+Build bounding volume hierarchy of meshes (it is built by first picking otherwise). Rebuild it if mesh vertices were changed.
+Tree is built in mesh space, so it is not changed by transform.
+*/
+int lua_class_model_BuildBVH(lua_State *L){
+  ModelObject * obj = _ptr_model_Check(L, 1);
+  if (lua_toboolean(L, 2)) _ptr_model_FreeBVH(obj);
+  _ptr_model_BuildBVH(L, obj);
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Model:unload
+```lua
+Model:unload()
+```
+Unload model with its meshes and materials, it is done by garbage collector otherwise.
+*/
+int lua_class_model_Unload(lua_State *L){
+  ModelObject * obj = (ModelObject *)luaL_checkudata(L, 1, "Model");
+  if (!obj->loaded) return 0;
+  _ptr_model_FreeBVH(obj);
+  UnloadModel(obj->model);
+  obj->loaded = 0;
+  return 0;
+}
+
+/*!MD
+#### Model:isLoaded
+```lua
+boolean Loaded = Model:isLoaded()
+```
+*/
+int lua_class_model_IsLoaded(lua_State *L){
+  lua_pushboolean(L, ((ModelObject *)luaL_checkudata(L, 1, "Model"))->loaded);
+  return 1;
+}
+
+int lua_class_model__ToString(lua_State *L){
+  ModelObject * obj = (ModelObject *)luaL_checkudata(L, 1, "Model");
+  lua_pushfstring(L, "Model[%d meshes]: %p", obj->loaded ? obj->model.meshCount : 0, obj);
+  return 1;
+}
+
+luaL_Reg luaray_class_model[] = {
+  {"draw",             lua_class_model_Draw},
+  {"setTransform",     lua_class_model_SetTransform},
+  {"getTransform",     lua_class_model_GetTransform},
+  {"getMeshCount",     lua_class_model_GetMeshCount},
+  {"getTriangleCount", lua_class_model_GetTriangleCount},
+  {"getVertexCount",   lua_class_model_GetVertexCount},
+  {"getBoneCount",     lua_class_model_GetBoneCount},
+  {"getAnimVertices",  lua_class_model_GetAnimVertices},
+  {"buildBVH",         lua_class_model_BuildBVH},
+  {"unload",           lua_class_model_Unload},
+  {"isLoaded",         lua_class_model_IsLoaded},
+
+  // meta
+  {"__gc",             lua_class_model_Unload},
+  {"__tostring",       lua_class_model__ToString},
+  {NULL, NULL}
+};
+
+/*!MD
+## Transform
+### Initialization
+```lua
+--
+```
+*/
+
+
+/*!MD
+## BoneInfo
+### Initialization
+```lua
+--
+```
+*/
+
+/*!MD
+## ModelAnimation
+Bone poses of animation frames, applied to model by [rl.models.UpdateModelAnimation](#UpdateModelAnimation).
+
+| **Methods**                                     | description
+| :---------------------------------------------- | :-----------
+| [getFrameCount](#ModelAnimationgetFrameCount)   | Get count of frames
+| [getBoneCount](#ModelAnimationgetBoneCount)     | Get count of bones
+| [unload](#ModelAnimationunload)                 | Unload animation
+| [isLoaded](#ModelAnimationisLoaded)             | Check if animation is not unloaded
+
+### Initialization
+```lua
+table Animations = rl.models.LoadModelAnimations(string Filename) -- IQM
+```
+*/
+typedef struct ModelAnimationObject {
+  ModelAnimation anim;                 // should be first
+  int            loaded;
+  unsigned int   id;                   // unique, key of pose cache
+} ModelAnimationObject;
+
+unsigned int _ptr_modelanimation_lastId = 0;
+
+ModelAnimationObject * _ptr_modelanimation_Check(lua_State *L, int index){
+  ModelAnimationObject * obj = (ModelAnimationObject *)luaL_checkudata(L, index, "ModelAnimation");
+  if (!obj->loaded) luaL_error(L, "ModelAnimation is unloaded");
+  return obj;
+}
+
+/*!MD
+#### ModelAnimation:getFrameCount
+```lua
+integer Count = ModelAnimation:getFrameCount()
+```
+*/
+int lua_class_modelanimation_GetFrameCount(lua_State *L){
+  lua_pushinteger(L, _ptr_modelanimation_Check(L, 1)->anim.frameCount);
+  return 1;
+}
+
+/*!MD
+#### ModelAnimation:getBoneCount
+```lua
+integer Count = ModelAnimation:getBoneCount()
+```
+*/
+int lua_class_modelanimation_GetBoneCount(lua_State *L){
+  lua_pushinteger(L, _ptr_modelanimation_Check(L, 1)->anim.boneCount);
+  return 1;
+}
+
+/*!MD
+#### ModelAnimation:unload
+```lua
+ModelAnimation:unload()
+```
+Unload animation, it is done by garbage collector otherwise.
+*/
+int lua_class_modelanimation_Unload(lua_State *L){
+  ModelAnimationObject * obj = (ModelAnimationObject *)luaL_checkudata(L, 1, "ModelAnimation");
+  if (obj->loaded) UnloadModelAnimation(obj->anim);
+  obj->loaded = 0;
+  return 0;
+}
+
+/*!MD
+#### ModelAnimation:isLoaded
+```lua
+boolean Loaded = ModelAnimation:isLoaded()
+```
+*/
+int lua_class_modelanimation_IsLoaded(lua_State *L){
+  lua_pushboolean(L, ((ModelAnimationObject *)luaL_checkudata(L, 1, "ModelAnimation"))->loaded);
+  return 1;
+}
+
+int lua_class_modelanimation__ToString(lua_State *L){
+  ModelAnimationObject * obj = (ModelAnimationObject *)luaL_checkudata(L, 1, "ModelAnimation");
+  lua_pushfstring(L, "ModelAnimation[%d frames]: %p", obj->loaded ? obj->anim.frameCount : 0, obj);
+  return 1;
+}
+
+luaL_Reg luaray_class_modelanimation[] = {
+  {"getFrameCount", lua_class_modelanimation_GetFrameCount},
+  {"getBoneCount",  lua_class_modelanimation_GetBoneCount},
+  {"unload",        lua_class_modelanimation_Unload},
+  {"isLoaded",      lua_class_modelanimation_IsLoaded},
+
+  // meta
+  {"__gc",          lua_class_modelanimation_Unload},
+  {"__tostring",    lua_class_modelanimation__ToString},
+  {NULL, NULL}
+};
+
+/*!MD
+## Animator
+Plays up to 8 animation layers on model: frames are fractional (poses are interpolated between frames),
+layers are blended by weights. Poses are sampled once per animation and frame for all animators (see
+[rl.models.SetPoseCache](#SetPoseCache)), and model is skinned only if its pose is changed.
+
+| **Methods**                          | description
+| :----------------------------------- | :-----------
+| [setLayer](#AnimatorsetLayer)        | Set animation of layer
+| [setFrame](#AnimatorsetFrame)        | Set frame of layer
+| [getFrame](#AnimatorgetFrame)        | Get frame of layer
+| [setWeight](#AnimatorsetWeight)      | Set weight of layer
+| [update](#Animatorupdate)            | Skin model if pose is changed
+| [getStats](#AnimatorgetStats)        | Get count of updates and skinnings
+
+### Initialization
+```lua
+Animator Anim = rl.Animator(Model Mdl)
+```
+Model should be animated by one animator only (state of skinned meshes is kept by animator).
+```lua
+local animator = rl.Animator(model):setLayer(1, walk):setLayer(2, run, 0, 0)
+-- every frame
+animator:setFrame(1, time*30):setFrame(2, time*30):setWeight(2, speed)
+animator:update()
+model:draw(position)
+```
+*/
+typedef struct {
+  ModelAnimationObject * anim;         // NULL for empty layer
+  int                    animRef;
+  float                  frame, weight;
+} AnimatorLayer;
+
+typedef struct {
+  unsigned int id;
+  int          frame;                  // quantized
+  float        weight;
+} AnimatorKey;
+
+typedef struct Animator {
+  ModelObject * model;
+  int           modelRef;
+  AnimatorLayer layers[RAY_POSE_LAYERS];
+  AnimatorKey   skinned[RAY_POSE_LAYERS]; // layers of current model pose
+  int           skinnedCount;          // -1 if model is not skinned by animator
+  int           uploaded;
+  Transform   * poses;                 // scratch poses of layers and blended one
+  long long     updates, skins;
+} Animator;
+
+int lua_class_animator_new(lua_State *L){
+  ModelObject * model = _ptr_model_Check(L, 1);
+  Animator * a = (Animator *)luax_newobject(L, "Animator", sizeof(Animator));
+  memset(a, 0, sizeof(Animator));
+  a->model        = model;
+  a->skinnedCount = -1;
+  for (int i = 0; i < RAY_POSE_LAYERS; i++) a->layers[i].animRef = LUA_NOREF;
+  lua_pushvalue(L, 1);
+  a->modelRef = luaL_ref(L, LUA_REGISTRYINDEX);
+  return 1;
+}
+
+AnimatorLayer * _ptr_animator_CheckLayer(lua_State *L, Animator * a, int index){
+  int layer = luaL_checkinteger(L, index);
+  if (layer < 1 || layer > RAY_POSE_LAYERS) luaL_argerror(L, index, "layer should be from 1 to 8");
+  return &a->layers[layer - 1];
+}
+
+// Frame is converted to index of key frame, so it should be finite
+float _ptr_animator_CheckFrame(lua_State *L, int index, float def){
+  float frame = luax_optnumber(L, index, def);
+  if (!isfinite(frame)) luaL_argerror(L, index, "frame should be finite number");
+  return frame;
+}
+
+// Weights are normalized by their sum, so NaN or infinity would spread to every layer; negative ones are zeroed
+float _ptr_animator_CheckWeight(lua_State *L, int index, float def){
+  float weight = luax_optnumber(L, index, def);
+  if (!isfinite(weight)) luaL_argerror(L, index, "weight should be finite number");
+  return weight > 0 ? weight : 0;
+}
+
 /*!MD
-## RenderTexture
-### Initialization
+#### Animator:setLayer
 ```lua
---
+Animator Anim = Animator:setLayer(integer Layer, ModelAnimation Animation[, number Frame[, number Weight]])
+Animator Anim = Animator:setLayer(integer Layer, nil) -- clear layer
 ```
+Set animation of layer (from 1 to 8), default Frame is 0 and Weight is 1. Animation should match model skeleton.
 */
+int lua_class_animator_SetLayer(lua_State *L){
+  Animator * a = (Animator *)luaL_checkudata(L, 1, "Animator");
+  AnimatorLayer * layer = _ptr_animator_CheckLayer(L, a, 2);
+  ModelAnimationObject * anim = NULL;
+  if (!lua_isnoneornil(L, 3)) {
+    anim = _ptr_modelanimation_Check(L, 3);
+    if (!IsModelAnimationValid(a->model->model, anim->anim)) return luaL_error(L, "Animation doesn't match model skeleton");
+  }
+  float frame  = _ptr_animator_CheckFrame(L, 4, 0);
+  float weight = _ptr_animator_CheckWeight(L, 5, 1);
+  luaL_unref(L, LUA_REGISTRYINDEX, layer->animRef);
+  layer->anim    = anim;
+  layer->animRef = LUA_NOREF;
+  layer->frame   = frame;
+  layer->weight  = weight;
+  if (anim) {
+    lua_pushvalue(L, 3);
+    layer->animRef = luaL_ref(L, LUA_REGISTRYINDEX);
+  }
+  lua_settop(L, 1);
+  return 1;
+}
 
 /*!MD
-## NPatchInfo
-### Initialization
+#### Animator:setFrame
 ```lua
---
+Animator Anim = Animator:setFrame(integer Layer, number Frame)
+```
+Set frame of layer, it is wrapped by frame count of animation, fractional part interpolates to the next frame.
+Frame should be finite (not NaN or infinity), same for setLayer.
+*/
+int lua_class_animator_SetFrame(lua_State *L){
+  Animator * a = (Animator *)luaL_checkudata(L, 1, "Animator");
+  AnimatorLayer * layer = _ptr_animator_CheckLayer(L, a, 2);
+  luaL_checknumber(L, 3);
+  layer->frame = _ptr_animator_CheckFrame(L, 3, 0);
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### Animator:getFrame
+```lua
+number Frame = Animator:getFrame(integer Layer)
 ```
 */
+int lua_class_animator_GetFrame(lua_State *L){
+  Animator * a = (Animator *)luaL_checkudata(L, 1, "Animator");
+  lua_pushnumber(L, _ptr_animator_CheckLayer(L, a, 2)->frame);
+  return 1;
+}
 
+/*!MD
+#### Animator:setWeight
+```lua
+Animator Anim = Animator:setWeight(integer Layer, number Weight)
+```
+Set weight of layer, weights are normalized by their sum. Layers with zero weight are not evaluated.
+Weight should be finite, negative one is set to 0 (same for setLayer).
+*/
+int lua_class_animator_SetWeight(lua_State *L){
+  Animator * a = (Animator *)luaL_checkudata(L, 1, "Animator");
+  luaL_checknumber(L, 3);
+  _ptr_animator_CheckLayer(L, a, 2)->weight = _ptr_animator_CheckWeight(L, 3, 0);
+  lua_settop(L, 1);
+  return 1;
+}
 
 /*!MD
-## CharInfo
-### Initialization
+#### Animator:update
 ```lua
---
+boolean Skinned = Animator:update([boolean Upload])
 ```
+Evaluate pose of layers and skin model by it, if it differs from pose of previous update (frames are compared
+after quantization, see [rl.models.SetPoseCache](#SetPoseCache)). Skinned vertices are uploaded to GPU
+unless Upload is false. Nothing is done without layers.
 */
+int lua_class_animator_Update(lua_State *L){
+  Animator * a = (Animator *)luaL_checkudata(L, 1, "Animator");
+  int upload   = lua_isnoneornil(L, 2) || lua_toboolean(L, 2);
+  if (!a->model->loaded) return luaL_error(L, "Model is unloaded");
+  Model * model = &a->model->model;
+  ray_pose_cache * cache = ray_pose_getShared();
+  AnimatorKey keys[RAY_POSE_LAYERS];
+  AnimatorLayer * layers[RAY_POSE_LAYERS];
+  int count = 0;
+  memset(keys, 0, sizeof(keys));
+  for (int i = 0; i < RAY_POSE_LAYERS; i++) {
+    AnimatorLayer * layer = &a->layers[i];
+    if (!layer->anim || layer->weight <= 0) continue;
+    if (!layer->anim->loaded) return luaL_error(L, "ModelAnimation of layer %d is unloaded", i + 1);
+    if (layer->anim->anim.frameCount <= 0) continue;
+    keys[count].id     = layer->anim->id;
+    keys[count].frame  = ray_pose_key(cache, &layer->anim->anim, layer->frame);
+    keys[count].weight = layer->weight;
+    layers[count++]    = layer;
+  }
+  a->updates++;
+  if (!count) {
+    lua_pushboolean(L, 0);
+    return 1;
+  }
+  if (count == a->skinnedCount && !memcmp(keys, a->skinned, count*sizeof(AnimatorKey))) {
+    // the same pose, it may be not uploaded yet
+    if (upload && !a->uploaded) {
+      ray_skin_upload(model);
+      a->uploaded = 1;
+    }
+    lua_pushboolean(L, 0);
+    return 1;
+  }
+  if (!a->poses) {
+    a->poses = (Transform *)malloc((RAY_POSE_LAYERS + 1)*(model->boneCount > 0 ? model->boneCount : 1)*sizeof(Transform));
+    if (!a->poses) return luaL_error(L, "Can't allocate animator poses");
+  }
+  const Transform * poses[RAY_POSE_LAYERS];
+  float weights[RAY_POSE_LAYERS];
+  for (int i = 0; i < count; i++) {
+    ModelAnimation * anim = &layers[i]->anim->anim;
+    poses[i]   = ray_pose_get(cache, keys[i].id, anim, layers[i]->frame, a->poses + i*model->boneCount);
+    weights[i] = keys[i].weight;
+  }
+  const Transform * pose = poses[0];
+  if (count > 1) {
+    Transform * blended = a->poses + RAY_POSE_LAYERS*model->boneCount;
+    ray_pose_blend(poses, weights, count, model->boneCount, blended);
+    pose = blended;
+  }
+  if (!ray_skin_model(model, pose)) return luaL_error(L, "Can't allocate bones");
+  if (upload) ray_skin_upload(model);
+  memcpy(a->skinned, keys, sizeof(keys));
+  a->skinnedCount = count;
+  a->uploaded     = upload;
+  a->skins++;
+  lua_pushboolean(L, 1);
+  return 1;
+}
 
 /*!MD
-## Font
-### Initialization
+#### Animator:getStats
 ```lua
---
+integer Updates, integer Skins = Animator:getStats()
 ```
+Get count of update calls and count of skinnings done by them.
 */
+int lua_class_animator_GetStats(lua_State *L){
+  Animator * a = (Animator *)luaL_checkudata(L, 1, "Animator");
+  lua_pushnumber(L, (lua_Number)a->updates);
+  lua_pushnumber(L, (lua_Number)a->skins);
+  return 2;
+}
+
+int lua_class_animator__GC(lua_State *L){
+  Animator * a = (Animator *)luaL_checkudata(L, 1, "Animator");
+  for (int i = 0; i < RAY_POSE_LAYERS; i++) {
+    luaL_unref(L, LUA_REGISTRYINDEX, a->layers[i].animRef);
+    a->layers[i].anim    = NULL;
+    a->layers[i].animRef = LUA_NOREF;
+  }
+  luaL_unref(L, LUA_REGISTRYINDEX, a->modelRef);
+  a->modelRef = LUA_NOREF;
+  free(a->poses);
+  a->poses = NULL;
+  return 0;
+}
+
+int lua_class_animator__ToString(lua_State *L){
+  Animator * a = (Animator *)luaL_checkudata(L, 1, "Animator");
+  int count = 0;
+  for (int i = 0; i < RAY_POSE_LAYERS; i++) count += a->layers[i].anim != NULL;
+  lua_pushfstring(L, "Animator[%d layers]: %p", count, a);
+  return 1;
+}
+
+luaL_Reg luaray_class_animator[] = {
+  {"setLayer",   lua_class_animator_SetLayer},
+  {"setFrame",   lua_class_animator_SetFrame},
+  {"getFrame",   lua_class_animator_GetFrame},
+  {"setWeight",  lua_class_animator_SetWeight},
+  {"update",     lua_class_animator_Update},
+  {"getStats",   lua_class_animator_GetStats},
+
+  // meta
+  {"__gc",       lua_class_animator__GC},
+  {"__tostring", lua_class_animator__ToString},
+  {NULL, NULL}
+};
 
 
 /*!MD
-## Camera3D
+## Ray
 ### Initialization
 ```lua
 --
 ```
 */
 
+
 /*!MD
-## Camera2D
+## RayHitInfo
 ### Initialization
 ```lua
 --
@@ -4674,7 +10050,7 @@ luaL_Reg luaray_class_image[] = {
 
 
 /*!MD
-## Mesh
+## BoundingBox
 ### Initialization
 ```lua
 --
@@ -4682,7 +10058,7 @@ luaL_Reg luaray_class_image[] = {
 */
 
 /*!MD
-## Shader
+## Wave
 ### Initialization
 ```lua
 --
@@ -4690,7 +10066,7 @@ luaL_Reg luaray_class_image[] = {
 */
 
 /*!MD
-## MaterialMap
+## Sound
 ### Initialization
 ```lua
 --
@@ -4698,7 +10074,7 @@ luaL_Reg luaray_class_image[] = {
 */
 
 /*!MD
-## Material
+## Music
 ### Initialization
 ```lua
 --
@@ -4707,15 +10083,16 @@ luaL_Reg luaray_class_image[] = {
 
 
 /*!MD
-## Model
+## AudioStream
 ### Initialization
 ```lua
 --
 ```
 */
 
+
 /*!MD
-## Transform
+## VrDeviceInfo
 ### Initialization
 ```lua
 --
@@ -4724,111 +10101,477 @@ luaL_Reg luaray_class_image[] = {
 
 
 /*!MD
-## BoneInfo
-### Initialization
+## PhysicsBody
+2D rigid body of physics world, created by [rl.physics](#Physics) functions like
+[CreatePhysicsBodyRectangle](#CreatePhysicsBodyRectangle). World keeps body till it is destroyed.
+
+| **Methods**                                  | description
+| :------------------------------------------- | :-----------
+| [getPosition](#PhysicsBodygetPosition)       | Get position of body center
+| [setPosition](#PhysicsBodysetPosition)       | Move body
+| [getVelocity](#PhysicsBodygetVelocity)       | Get linear velocity
+| [setVelocity](#PhysicsBodysetVelocity)       | Set linear velocity
+| [getAngularVelocity](#PhysicsBodygetAngularVelocity) | Get angular velocity
+| [setAngularVelocity](#PhysicsBodysetAngularVelocity) | Set angular velocity
+| [getRotation](#PhysicsBodygetRotation)       | Get rotation in radians
+| [setRotation](#PhysicsBodysetRotation)       | Set rotation in radians
+| [addForce](#PhysicsBodyaddForce)             | Add force for next step
+| [addTorque](#PhysicsBodyaddTorque)           | Add torque for next step
+| [isGrounded](#PhysicsBodyisGrounded)         | Check if body stands on other body
+| [setEnabled](#PhysicsBodysetEnabled)         | Enable or disable dynamics
+| [setUseGravity](#PhysicsBodysetUseGravity)   | Enable or disable gravity
+| [setFreezeOrient](#PhysicsBodysetFreezeOrient) | Disable or enable rotation
+| [setFriction](#PhysicsBodysetFriction)       | Set static and dynamic friction
+| [setRestitution](#PhysicsBodysetRestitution) | Set bounciness
+| [getMass](#PhysicsBodygetMass)               | Get mass and inertia
+| [getVertexCount](#PhysicsBodygetVertexCount) | Get count of shape vertices
+| [getVertex](#PhysicsBodygetVertex)           | Get shape vertex in world space
+| [destroy](#PhysicsBodydestroy)               | Remove body from world
+| [isValid](#PhysicsBodyisValid)               | Check if body is in world
+
 ```lua
---
+local ground = rl.physics.CreatePhysicsBodyRectangle(rl.Vector2(400, 500), 800, 20, 10)
+ground:setEnabled(false)
+local ball = rl.physics.CreatePhysicsBodyCircle(rl.Vector2(400, 100), 20, 1)
+-- every frame
+rl.physics.RunPhysicsStep(rl.core.GetFrameTime())
+local position = ball:getPosition()
 ```
 */
+typedef struct {
+  ray_physics_body body;               // should be first, world keeps pointers to bodies
+  int              ref;                // keeps object alive while body is in world
+} PhysicsBodyObject;
+
+PhysicsBodyObject * _ptr_physicsbody_New(lua_State *L){
+  PhysicsBodyObject * obj = (PhysicsBodyObject *)luax_newobject(L, "PhysicsBody", sizeof(PhysicsBodyObject));
+  memset(obj, 0, sizeof(PhysicsBodyObject));
+  obj->body.index = -1;
+  obj->ref        = LUA_NOREF;
+  return obj;
+}
+
+// Adds object on top of stack to shared world, shape of body should be set
+void _ptr_physicsbody_Add(lua_State *L, PhysicsBodyObject * obj){
+  if (!ray_physics_add(&ray_physics_shared, &obj->body)) luaL_error(L, "Can't allocate physics body");
+  lua_pushvalue(L, -1);
+  obj->ref = luaL_ref(L, LUA_REGISTRYINDEX);
+}
+
+PhysicsBodyObject * _ptr_physicsbody_Check(lua_State *L, int index){
+  PhysicsBodyObject * obj = (PhysicsBodyObject *)luaL_checkudata(L, index, "PhysicsBody");
+  if (obj->body.index < 0) luaL_error(L, "Physics body is destroyed");
+  return obj;
+}
+
+void _ptr_physicsbody_Destroy(lua_State *L, PhysicsBodyObject * obj){
+  if (obj->body.index < 0) return;
+  ray_physics_remove(&ray_physics_shared, &obj->body);
+  luaL_unref(L, LUA_REGISTRYINDEX, obj->ref);
+  obj->ref = LUA_NOREF;
+}
+
+// Destroys every body of shared world
+void _ptr_physicsbody_DestroyAll(lua_State *L){
+  while (ray_physics_shared.bodyCount > 0) {
+    _ptr_physicsbody_Destroy(L, (PhysicsBodyObject *)ray_physics_shared.bodies[ray_physics_shared.bodyCount - 1]);
+  }
+}
 
 /*!MD
-## ModelAnimation
-### Initialization
+#### PhysicsBody:getPosition
 ```lua
---
+Vector2 Position = PhysicsBody:getPosition()
+number X, number Y = PhysicsBody:getPosition("n")
 ```
 */
+int lua_class_physicsbody_GetPosition(lua_State *L){
+  PhysicsBodyObject * obj = _ptr_physicsbody_Check(L, 1);
+  if (luax_optstring(L, 2, "\0")[0] == 'n') {
+    lua_pushnumber(L, obj->body.position.x);
+    lua_pushnumber(L, obj->body.position.y);
+    return 2;
+  }
+  Vector2 * v = luax_newobject(L, "Vector2", sizeof(Vector2));
+  *v = obj->body.position;
+  return 1;
+}
 
+/*!MD
+#### PhysicsBody:setPosition
+```lua
+PhysicsBody Body = PhysicsBody:setPosition(Vector2 Position)
+```
+*/
+int lua_class_physicsbody_SetPosition(lua_State *L){
+  _ptr_physicsbody_Check(L, 1)->body.position = *(Vector2 *)luax_checkclass(L, 2, "Vector2");
+  lua_settop(L, 1);
+  return 1;
+}
 
 /*!MD
-## Ray
-### Initialization
+#### PhysicsBody:getVelocity
 ```lua
---
+Vector2 Velocity = PhysicsBody:getVelocity()
+number X, number Y = PhysicsBody:getVelocity("n")
+```
+Velocity is in units per millisecond, as time step.
+*/
+int lua_class_physicsbody_GetVelocity(lua_State *L){
+  PhysicsBodyObject * obj = _ptr_physicsbody_Check(L, 1);
+  if (luax_optstring(L, 2, "\0")[0] == 'n') {
+    lua_pushnumber(L, obj->body.velocity.x);
+    lua_pushnumber(L, obj->body.velocity.y);
+    return 2;
+  }
+  Vector2 * v = luax_newobject(L, "Vector2", sizeof(Vector2));
+  *v = obj->body.velocity;
+  return 1;
+}
+
+/*!MD
+#### PhysicsBody:setVelocity
+```lua
+PhysicsBody Body = PhysicsBody:setVelocity(Vector2 Velocity)
 ```
 */
+int lua_class_physicsbody_SetVelocity(lua_State *L){
+  _ptr_physicsbody_Check(L, 1)->body.velocity = *(Vector2 *)luax_checkclass(L, 2, "Vector2");
+  lua_settop(L, 1);
+  return 1;
+}
 
+/*!MD
+#### PhysicsBody:getAngularVelocity
+```lua
+number Velocity = PhysicsBody:getAngularVelocity()
+```
+*/
+int lua_class_physicsbody_GetAngularVelocity(lua_State *L){
+  lua_pushnumber(L, _ptr_physicsbody_Check(L, 1)->body.angularVelocity);
+  return 1;
+}
 
 /*!MD
-## RayHitInfo
-### Initialization
+#### PhysicsBody:setAngularVelocity
 ```lua
---
+PhysicsBody Body = PhysicsBody:setAngularVelocity(number Velocity)
 ```
 */
+int lua_class_physicsbody_SetAngularVelocity(lua_State *L){
+  _ptr_physicsbody_Check(L, 1)->body.angularVelocity = luaL_checknumber(L, 2);
+  lua_settop(L, 1);
+  return 1;
+}
 
+/*!MD
+#### PhysicsBody:getRotation
+```lua
+number Radians = PhysicsBody:getRotation()
+```
+*/
+int lua_class_physicsbody_GetRotation(lua_State *L){
+  lua_pushnumber(L, _ptr_physicsbody_Check(L, 1)->body.orient);
+  return 1;
+}
 
 /*!MD
-## BoundingBox
-### Initialization
+#### PhysicsBody:setRotation
 ```lua
---
+PhysicsBody Body = PhysicsBody:setRotation(number Radians)
 ```
 */
+int lua_class_physicsbody_SetRotation(lua_State *L){
+  ray_physics_bodyRotation(&_ptr_physicsbody_Check(L, 1)->body, luaL_checknumber(L, 2));
+  lua_settop(L, 1);
+  return 1;
+}
 
 /*!MD
-## Wave
-### Initialization
+#### PhysicsBody:addForce
 ```lua
---
+PhysicsBody Body = PhysicsBody:addForce(Vector2 Force)
 ```
+Forces are applied by the next step and cleared.
 */
+int lua_class_physicsbody_AddForce(lua_State *L){
+  PhysicsBodyObject * obj = _ptr_physicsbody_Check(L, 1);
+  obj->body.force = Vector2Add(obj->body.force, *(Vector2 *)luax_checkclass(L, 2, "Vector2"));
+  lua_settop(L, 1);
+  return 1;
+}
 
 /*!MD
-## Sound
-### Initialization
+#### PhysicsBody:addTorque
 ```lua
---
+PhysicsBody Body = PhysicsBody:addTorque(number Amount)
 ```
 */
+int lua_class_physicsbody_AddTorque(lua_State *L){
+  _ptr_physicsbody_Check(L, 1)->body.torque += luaL_checknumber(L, 2);
+  lua_settop(L, 1);
+  return 1;
+}
 
 /*!MD
-## Music
-### Initialization
+#### PhysicsBody:isGrounded
 ```lua
---
+boolean Grounded = PhysicsBody:isGrounded()
 ```
+True if body touched other body from above at the last step.
 */
+int lua_class_physicsbody_IsGrounded(lua_State *L){
+  lua_pushboolean(L, _ptr_physicsbody_Check(L, 1)->body.isGrounded);
+  return 1;
+}
 
+/*!MD
+#### PhysicsBody:setEnabled
+```lua
+PhysicsBody Body = PhysicsBody:setEnabled(boolean Enabled)
+```
+Disabled body doesn't move, but other bodies collide with it.
+*/
+int lua_class_physicsbody_SetEnabled(lua_State *L){
+  _ptr_physicsbody_Check(L, 1)->body.enabled = lua_toboolean(L, 2);
+  lua_settop(L, 1);
+  return 1;
+}
 
 /*!MD
-## AudioStream
-### Initialization
+#### PhysicsBody:setUseGravity
 ```lua
---
+PhysicsBody Body = PhysicsBody:setUseGravity(boolean UseGravity)
+```
+*/
+int lua_class_physicsbody_SetUseGravity(lua_State *L){
+  _ptr_physicsbody_Check(L, 1)->body.useGravity = lua_toboolean(L, 2);
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### PhysicsBody:setFreezeOrient
+```lua
+PhysicsBody Body = PhysicsBody:setFreezeOrient(boolean Freeze)
 ```
 */
+int lua_class_physicsbody_SetFreezeOrient(lua_State *L){
+  _ptr_physicsbody_Check(L, 1)->body.freezeOrient = lua_toboolean(L, 2);
+  lua_settop(L, 1);
+  return 1;
+}
 
+/*!MD
+#### PhysicsBody:setFriction
+```lua
+PhysicsBody Body = PhysicsBody:setFriction(number Static[, number Dynamic])
+```
+Default friction is 0.4 static and 0.2 dynamic, Dynamic is half of Static if omitted.
+*/
+int lua_class_physicsbody_SetFriction(lua_State *L){
+  PhysicsBodyObject * obj = _ptr_physicsbody_Check(L, 1);
+  obj->body.staticFriction  = luaL_checknumber(L, 2);
+  obj->body.dynamicFriction = luax_optnumber(L, 3, obj->body.staticFriction/2);
+  lua_settop(L, 1);
+  return 1;
+}
 
 /*!MD
-## VrDeviceInfo
-### Initialization
+#### PhysicsBody:setRestitution
 ```lua
---
+PhysicsBody Body = PhysicsBody:setRestitution(number Restitution)
+```
+*/
+int lua_class_physicsbody_SetRestitution(lua_State *L){
+  _ptr_physicsbody_Check(L, 1)->body.restitution = luaL_checknumber(L, 2);
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### PhysicsBody:getMass
+```lua
+number Mass, number Inertia = PhysicsBody:getMass()
+```
+*/
+int lua_class_physicsbody_GetMass(lua_State *L){
+  PhysicsBodyObject * obj = _ptr_physicsbody_Check(L, 1);
+  lua_pushnumber(L, obj->body.mass);
+  lua_pushnumber(L, obj->body.inertia);
+  return 2;
+}
+
+/*!MD
+#### PhysicsBody:getVertexCount
+```lua
+integer Count = PhysicsBody:getVertexCount()
 ```
 */
+int lua_class_physicsbody_GetVertexCount(lua_State *L){
+  lua_pushinteger(L, _ptr_physicsbody_Check(L, 1)->body.vertexCount);
+  return 1;
+}
+
+/*!MD
+#### PhysicsBody:getVertex
+```lua
+Vector2 Vertex = PhysicsBody:getVertex(integer Index)
+number X, number Y = PhysicsBody:getVertex(integer Index, "n")
+```
+Vertex of shape in world space, Index is from 1 to vertex count.
+*/
+int lua_class_physicsbody_GetVertex(lua_State *L){
+  PhysicsBodyObject * obj = _ptr_physicsbody_Check(L, 1);
+  int index = luaL_checkinteger(L, 2);
+  if (index < 1 || index > obj->body.vertexCount) return luaL_argerror(L, 2, "vertex index is out of range");
+  Vector2 vertex = ray_physics_bodyVertex(&obj->body, index - 1);
+  if (luax_optstring(L, 3, "\0")[0] == 'n') {
+    lua_pushnumber(L, vertex.x);
+    lua_pushnumber(L, vertex.y);
+    return 2;
+  }
+  Vector2 * v = luax_newobject(L, "Vector2", sizeof(Vector2));
+  *v = vertex;
+  return 1;
+}
+
+/*!MD
+#### PhysicsBody:destroy
+```lua
+PhysicsBody:destroy()
+```
+Remove body from world, see [DestroyPhysicsBody](#DestroyPhysicsBody).
+*/
+int lua_class_physicsbody_Destroy(lua_State *L){
+  _ptr_physicsbody_Destroy(L, (PhysicsBodyObject *)luaL_checkudata(L, 1, "PhysicsBody"));
+  return 0;
+}
+
+/*!MD
+#### PhysicsBody:isValid
+```lua
+boolean Valid = PhysicsBody:isValid()
+```
+*/
+int lua_class_physicsbody_IsValid(lua_State *L){
+  PhysicsBodyObject * obj = (PhysicsBodyObject *)luaL_checkudata(L, 1, "PhysicsBody");
+  lua_pushboolean(L, obj->body.index >= 0);
+  return 1;
+}
+
+int lua_class_physicsbody__ToString(lua_State *L){
+  PhysicsBodyObject * obj = (PhysicsBodyObject *)luaL_checkudata(L, 1, "PhysicsBody");
+  if (obj->body.index < 0) lua_pushfstring(L, "PhysicsBody[destroyed]: %p", obj);
+  else lua_pushfstring(L, "PhysicsBody[%d vertices]: %p", obj->body.vertexCount, obj);
+  return 1;
+}
+
+luaL_Reg luaray_class_physicsbody[] = {
+  {"getPosition",        lua_class_physicsbody_GetPosition},
+  {"setPosition",        lua_class_physicsbody_SetPosition},
+  {"getVelocity",        lua_class_physicsbody_GetVelocity},
+  {"setVelocity",        lua_class_physicsbody_SetVelocity},
+  {"getAngularVelocity", lua_class_physicsbody_GetAngularVelocity},
+  {"setAngularVelocity", lua_class_physicsbody_SetAngularVelocity},
+  {"getRotation",        lua_class_physicsbody_GetRotation},
+  {"setRotation",        lua_class_physicsbody_SetRotation},
+  {"addForce",           lua_class_physicsbody_AddForce},
+  {"addTorque",          lua_class_physicsbody_AddTorque},
+  {"isGrounded",         lua_class_physicsbody_IsGrounded},
+  {"setEnabled",         lua_class_physicsbody_SetEnabled},
+  {"setUseGravity",      lua_class_physicsbody_SetUseGravity},
+  {"setFreezeOrient",    lua_class_physicsbody_SetFreezeOrient},
+  {"setFriction",        lua_class_physicsbody_SetFriction},
+  {"setRestitution",     lua_class_physicsbody_SetRestitution},
+  {"getMass",            lua_class_physicsbody_GetMass},
+  {"getVertexCount",     lua_class_physicsbody_GetVertexCount},
+  {"getVertex",          lua_class_physicsbody_GetVertex},
+  {"destroy",            lua_class_physicsbody_Destroy},
+  {"isValid",            lua_class_physicsbody_IsValid},
+
+  // meta
+  {"__tostring",         lua_class_physicsbody__ToString},
+  {NULL, NULL}
+};
 
 
 // register table should be on top of stack
 void lua_class_register(lua_State * L){
   luax_newclass(L,   "Vector2",   luaray_class_vector2);
   luax_tsfunction(L, "Vector2",   lua_class_vector2_new);
+  luax_setclassfields(L, "Vector2",   luaray_fields_vector2);
 
   luax_newclass(L,   "Vector3",   luaray_class_vector3);
   luax_tsfunction(L, "Vector3",   lua_class_vector3_new);
+  luax_setclassfields(L, "Vector3",   luaray_fields_vector3);
 
   luax_newclass(L,   "Matrix",    luaray_class_matrix);
   luax_tsfunction(L, "Matrix",    lua_class_matrix_new);
+  luax_setclassfields(L, "Matrix",    luaray_fields_matrix);
 
   luax_newclass(L,   "Vector4",   luaray_class_vector4);
   luax_tsfunction(L, "Vector4",   lua_class_vector4_new);
+  luax_setclassfields(L, "Vector4",   luaray_fields_vector4);
 
   luax_newclass(L,   "Color",     luaray_class_color);
   luax_tsfunction(L, "Color",     lua_class_color_new);
+  luax_setclassfields(L, "Color",     luaray_fields_color);
 
   luax_newclass(L,   "Rectangle", luaray_class_rectangle);
   luax_tsfunction(L, "Rectangle", lua_class_rectangle_new);
+  luax_setclassfields(L, "Rectangle", luaray_fields_rectangle);
 
   luax_newclass(L,   "Image",     luaray_class_image);
   luax_tsfunction(L, "Image",     lua_class_image_new);
+  luax_setclassfields(L, "Image",     luaray_fields_image);
+
+  luax_newclass(L,   "AsyncTask", luaray_class_asynctask);
+
+  luax_newclass(L,   "Texture",   luaray_class_texture);
+  luax_tsfunction(L, "Texture",   lua_class_texture_new);
+  luax_setclassfields(L, "Texture",   luaray_fields_texture);
+
+  luax_newclass(L,   "RenderTexture", luaray_class_rendertexture);
+  luax_tsfunction(L, "RenderTexture", lua_class_rendertexture_new);
+  luax_setclassfields(L, "RenderTexture", luaray_fields_rendertexture);
+
+  luax_newclass(L,   "AssetEntry", luaray_class_assetentry);
+
+  luax_newclass(L,   "Archive",   luaray_class_archive);
+
+  luax_newclass(L,   "DeflateStream", luaray_class_deflatestream);
+  luax_tsfunction(L, "DeflateStream", lua_class_deflatestream_new);
+
+  luax_newclass(L,   "InflateStream", luaray_class_inflatestream);
+  luax_tsfunction(L, "InflateStream", lua_class_inflatestream_new);
+  luax_newclass(L,   "Storage",       luaray_class_storage);
+  luax_newclass(L,   "FileWalker",    luaray_class_filewalker);
+  luax_newclass(L,   "Mesh",          luaray_class_mesh);
+  luax_newclass(L,   "Model",         luaray_class_model);
+  luax_tsfunction(L, "Model",         lua_class_model_new);
+  luax_newclass(L,   "ModelAnimation", luaray_class_modelanimation);
+  luax_newclass(L,   "Animator",      luaray_class_animator);
+  luax_tsfunction(L, "Animator",      lua_class_animator_new);
+  luax_newclass(L,   "PhysicsBody",   luaray_class_physicsbody);
+
+  luax_newclass(L,   "Font",      luaray_class_font);
+  luax_tsfunction(L, "Font",      lua_class_font_new);
+  luax_setclassfields(L, "Font",      luaray_fields_font);
+
+  luax_newclass(L,   "TextLayout", luaray_class_textlayout);
+  luax_tsfunction(L, "TextLayout", lua_class_textlayout_new);
+
+  luax_newclass(L,   "DynamicFont", luaray_class_dynamicfont);
+  luax_tsfunction(L, "DynamicFont", lua_class_dynamicfont_new);
+  luax_setclassfields(L, "DynamicFont", luaray_fields_dynamicfont);
+
+  luax_newclass(L,   "Float32Buffer", luaray_class_buffer);
+  luax_tsfunction(L, "Float32Buffer", lua_class_buffer_newFloat32);
+  luax_newclass(L,   "Int32Buffer",   luaray_class_buffer);
+  luax_tsfunction(L, "Int32Buffer",   lua_class_buffer_newInt32);
+  luax_newclass(L,   "Uint16Buffer",  luaray_class_buffer);
+  luax_tsfunction(L, "Uint16Buffer",  lua_class_buffer_newUint16);
+  luax_newclass(L,   "Uint8Buffer",   luaray_class_buffer);
+  luax_tsfunction(L, "Uint8Buffer",   lua_class_buffer_newUint8);
 }
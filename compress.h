@@ -0,0 +1,147 @@
+// Block compression: data is split to independent DEFLATE (zlib) blocks, so it can be compressed and decompressed
+// by parts with bounded memory, or by several threads at once. Uses zlib functions of stb libraries linked with raylib.
+// This part has no Lua calls, little endian helpers are shared with archive.h.
+//
+// Stream layout (little endian):
+//   "RLZ1", frames..., end frame
+//   frame   u32 rawSize, u32 storedSize, data; block is stored as is if storedSize == rawSize
+//   end     u32 0, u32 0
+
+#define RAY_COMPRESS_MAGIC    "RLZ1"
+#define RAY_COMPRESS_HEADER   4
+#define RAY_COMPRESS_FRAME    8
+#define RAY_COMPRESS_BLOCK    (256*1024)  // default block size
+#define RAY_COMPRESS_MAXBLOCK (16*1024*1024)
+
+// declared by raylib core.c the same way, stb_image_write.h is compiled in textures.c
+unsigned char * stbi_zlib_compress(unsigned char * data, int data_len, int * out_len, int quality);
+
+// Level 0 stores data, 1..9 are mapped to stb quality (6 is raylib CompressData one)
+int ray_compress_quality(int level){
+  return level <= 6 ? level + 2 : (level - 6)*8 + 8;
+}
+
+// Writes frame of compressed block to out (it should fit size + RAY_COMPRESS_FRAME bytes), returns frame size
+int ray_compress_block(const unsigned char * data, int size, int level, unsigned char * out){
+  int packed = 0;
+  unsigned char * compressed = level > 0 && size ? stbi_zlib_compress((unsigned char *)data, size, &packed, ray_compress_quality(level)) : NULL;
+  if (!compressed || packed >= size) {
+    packed = size;
+    memcpy(out + RAY_COMPRESS_FRAME, data, size);
+  }
+  else memcpy(out + RAY_COMPRESS_FRAME, compressed, packed);
+  free(compressed);
+  ray_archive_put32(out, size);
+  ray_archive_put32(out + 4, packed);
+  return packed + RAY_COMPRESS_FRAME;
+}
+
+// Checks frame header, returns 0 if it is invalid
+int ray_compress_checkFrame(unsigned int rawSize, unsigned int storedSize){
+  return rawSize <= RAY_COMPRESS_MAXBLOCK && storedSize <= rawSize && (rawSize || !storedSize);
+}
+
+// Decompresses frame data to out, returns 0 on error
+int ray_compress_unblock(const unsigned char * stored, int storedSize, unsigned char * out, int rawSize){
+  if (storedSize == rawSize) {
+    memcpy(out, stored, rawSize);
+    return 1;
+  }
+  return stbi_zlib_decode_buffer((char *)out, rawSize, (const char *)stored, storedSize) == rawSize;
+}
+
+typedef struct {
+  const unsigned char * src;
+  unsigned char       * dst;
+  int                   size, blockSize, level;
+  int                 * sizes;   // frame sizes (compressing) or frame offsets (decompressing)
+  int                 * offsets; // output offsets (decompressing)
+  int                   failed;
+} ray_compress_job;
+
+void ray_compress_blockJob(void * data, int i){
+  ray_compress_job * job = (ray_compress_job *)data;
+  int offset = i*job->blockSize;
+  int size   = job->size - offset < job->blockSize ? job->size - offset : job->blockSize;
+  job->sizes[i] = ray_compress_block(job->src + offset, size, job->level, job->dst + (size_t)i*(job->blockSize + RAY_COMPRESS_FRAME));
+}
+
+// Compresses blocks by pool threads, returns allocated stream or NULL
+unsigned char * ray_compress_blocks(const unsigned char * data, int size, int level, int blockSize, int * outSize){
+  int count = (size + blockSize - 1)/blockSize;
+  int slot  = blockSize + RAY_COMPRESS_FRAME;
+  unsigned char * out = (unsigned char *)malloc(RAY_COMPRESS_HEADER + (size_t)count*slot + RAY_COMPRESS_FRAME);
+  int * sizes = (int *)malloc((count ? count : 1)*sizeof(int));
+  if (!out || !sizes) {
+    free(out);
+    free(sizes);
+    return NULL;
+  }
+  ray_compress_job job = {data, out + RAY_COMPRESS_HEADER, size, blockSize, level, sizes, NULL, 0};
+  ray_threads_parallel(ray_compress_blockJob, &job, count, 0);
+  // frames are written to slots, moving them back to back doesn't overlap following ones
+  memcpy(out, RAY_COMPRESS_MAGIC, RAY_COMPRESS_HEADER);
+  size_t offset = RAY_COMPRESS_HEADER;
+  for (int i = 0; i < count; i++) {
+    memmove(out + offset, out + RAY_COMPRESS_HEADER + (size_t)i*slot, sizes[i]);
+    offset += sizes[i];
+  }
+  memset(out + offset, 0, RAY_COMPRESS_FRAME);
+  free(sizes);
+  *outSize = offset + RAY_COMPRESS_FRAME;
+  return out;
+}
+
+void ray_compress_unblockJob(void * data, int i){
+  ray_compress_job * job = (ray_compress_job *)data;
+  const unsigned char * frame = job->src + job->sizes[i];
+  int rawSize = ray_archive_u32(frame), storedSize = ray_archive_u32(frame + 4);
+  if (!ray_compress_unblock(frame + RAY_COMPRESS_FRAME, storedSize, job->dst + job->offsets[i], rawSize)) job->failed = 1;
+}
+
+// Decompresses stream by pool threads, returns allocated data or NULL with error message
+unsigned char * ray_compress_unblocks(const unsigned char * data, int size, int * outSize, const char ** error){
+  *error = "compressed data is damaged";
+  if (size < RAY_COMPRESS_HEADER || memcmp(data, RAY_COMPRESS_MAGIC, RAY_COMPRESS_HEADER)) return NULL;
+  // frames are counted and validated first
+  int count = 0;
+  size_t offset = RAY_COMPRESS_HEADER, total = 0;
+  while (1) {
+    if (size - offset < RAY_COMPRESS_FRAME) return NULL;
+    unsigned int rawSize = ray_archive_u32(data + offset), storedSize = ray_archive_u32(data + offset + 4);
+    if (!ray_compress_checkFrame(rawSize, storedSize) || size - offset - RAY_COMPRESS_FRAME < storedSize) return NULL;
+    offset += RAY_COMPRESS_FRAME + storedSize;
+    if (!rawSize) break;
+    total += rawSize;
+    if (total > 0x7FFFFFFF) return NULL;
+    count++;
+  }
+  if (offset != (size_t)size) return NULL;
+  *error = "can't allocate memory";
+  int * frames  = (int *)malloc((count ? count : 1)*2*sizeof(int));
+  unsigned char * out = (unsigned char *)malloc(total ? total : 1);
+  if (!frames || !out) {
+    free(frames);
+    free(out);
+    return NULL;
+  }
+  offset = RAY_COMPRESS_HEADER;
+  total  = 0;
+  for (int i = 0; i < count; i++) {
+    frames[i] = offset;
+    frames[count + i] = total;
+    total  += ray_archive_u32(data + offset);
+    offset += RAY_COMPRESS_FRAME + ray_archive_u32(data + offset + 4);
+  }
+  ray_compress_job job = {data, out, size, 0, 0, frames, frames + count, 0};
+  ray_threads_parallel(ray_compress_unblockJob, &job, count, 0);
+  free(frames);
+  if (job.failed) {
+    *error = "compressed data is damaged";
+    free(out);
+    return NULL;
+  }
+  *error   = NULL;
+  *outSize = total;
+  return out;
+}
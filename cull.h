@@ -0,0 +1,142 @@
+// Frustum culling of instances on CPU: bounding box of model is transformed by every instance matrix and tested
+// against 6 planes of view frustum. SSE tests 4 instances at once if compiler supports it (see kernels.h).
+// Test is conservative: boxes near frustum corners may be reported visible, visible boxes are never dropped.
+
+int   ray_cull_simd        = 1;    // use SIMD test if it is compiled in
+int * ray_cull_scratch     = NULL; // growing array of visible instances, used by drawing
+int   ray_cull_scratchSize = 0;
+
+// Returns scratch array of count indices at least, NULL on allocation failure
+int * ray_cull_reserve(int count){
+  if (count > ray_cull_scratchSize) {
+    int * scratch = (int *)realloc(ray_cull_scratch, count*sizeof(int));
+    if (!scratch) return NULL;
+    ray_cull_scratch     = scratch;
+    ray_cull_scratchSize = count;
+  }
+  return ray_cull_scratch;
+}
+
+// Planes (a, b, c, d) with normals directed inside, a*x + b*y + c*z + d >= 0 for inner points
+typedef struct {
+  float planes[6][4];
+} ray_cull_frustum;
+
+// Extracts planes from view-projection matrix (Gribb/Hartmann), matrix is MatrixMultiply(view, projection)
+void ray_cull_frustumFromMatrix(ray_cull_frustum * f, Matrix m){
+  float rows[4][4] = {
+    { m.m0, m.m4, m.m8,  m.m12 },
+    { m.m1, m.m5, m.m9,  m.m13 },
+    { m.m2, m.m6, m.m10, m.m14 },
+    { m.m3, m.m7, m.m11, m.m15 },
+  };
+  for (int i = 0; i < 6; i++) {
+    // left, right, bottom, top, near, far
+    float sign = i % 2 ? -1.0f : 1.0f;
+    float * p  = f->planes[i];
+    for (int j = 0; j < 4; j++) p[j] = rows[3][j] + sign*rows[i/2][j];
+    float len = sqrtf(p[0]*p[0] + p[1]*p[1] + p[2]*p[2]);
+    if (len > 0) for (int j = 0; j < 4; j++) p[j] /= len;
+  }
+}
+
+// Axis aligned box of transformed box
+BoundingBox ray_cull_transformBox(BoundingBox box, Matrix m){
+  Vector3 c = Vector3Scale(Vector3Add(box.min, box.max), 0.5f);
+  Vector3 e = Vector3Scale(Vector3Subtract(box.max, box.min), 0.5f);
+  Vector3 center = {
+    m.m0*c.x + m.m4*c.y + m.m8*c.z  + m.m12,
+    m.m1*c.x + m.m5*c.y + m.m9*c.z  + m.m13,
+    m.m2*c.x + m.m6*c.y + m.m10*c.z + m.m14,
+  };
+  Vector3 extent = {
+    fabsf(m.m0)*e.x + fabsf(m.m4)*e.y + fabsf(m.m8)*e.z,
+    fabsf(m.m1)*e.x + fabsf(m.m5)*e.y + fabsf(m.m9)*e.z,
+    fabsf(m.m2)*e.x + fabsf(m.m6)*e.y + fabsf(m.m10)*e.z,
+  };
+  return (BoundingBox){ Vector3Subtract(center, extent), Vector3Add(center, extent) };
+}
+
+// Box given by center and half size is visible if it is not outside of any plane
+int ray_cull_boxVisible(const ray_cull_frustum * f, Vector3 center, Vector3 extent){
+  for (int i = 0; i < 6; i++) {
+    const float * p = f->planes[i];
+    float d = p[0]*center.x + p[1]*center.y + p[2]*center.z + p[3];
+    float r = fabsf(p[0])*extent.x + fabsf(p[1])*extent.y + fabsf(p[2])*extent.z;
+    if (d + r < 0) return 0;
+  }
+  return 1;
+}
+
+// Transforms are 16 floats per instance in Matrix field order (m0, m4, m8, m12, m1, ...)
+void ray_cull_rangeScalar(const ray_cull_frustum * f, BoundingBox box, const float * transforms, int from, int to, int * visible, int * count){
+  Vector3 c = Vector3Scale(Vector3Add(box.min, box.max), 0.5f);
+  Vector3 e = Vector3Scale(Vector3Subtract(box.max, box.min), 0.5f);
+  for (int i = from; i < to; i++) {
+    const float * m = transforms + i*16;
+    Vector3 center = {
+      m[0]*c.x + m[1]*c.y + m[2]*c.z  + m[3],
+      m[4]*c.x + m[5]*c.y + m[6]*c.z  + m[7],
+      m[8]*c.x + m[9]*c.y + m[10]*c.z + m[11],
+    };
+    Vector3 extent = {
+      fabsf(m[0])*e.x + fabsf(m[1])*e.y + fabsf(m[2])*e.z,
+      fabsf(m[4])*e.x + fabsf(m[5])*e.y + fabsf(m[6])*e.z,
+      fabsf(m[8])*e.x + fabsf(m[9])*e.y + fabsf(m[10])*e.z,
+    };
+    if (ray_cull_boxVisible(f, center, extent)) visible[(*count)++] = i;
+  }
+}
+
+#ifdef RAY_KERNELS_SSE2
+// Rows of 4 matrices are transposed, so every register holds one matrix element of 4 instances
+int ray_cull_rangeSIMD(const ray_cull_frustum * f, BoundingBox box, const float * transforms, int count, int * visible){
+  Vector3 c  = Vector3Scale(Vector3Add(box.min, box.max), 0.5f);
+  Vector3 e  = Vector3Scale(Vector3Subtract(box.max, box.min), 0.5f);
+  __m128 abs = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+  __m128 cx  = _mm_set1_ps(c.x), cy = _mm_set1_ps(c.y), cz = _mm_set1_ps(c.z);
+  __m128 ex  = _mm_set1_ps(e.x), ey = _mm_set1_ps(e.y), ez = _mm_set1_ps(e.z);
+  __m128 zero = _mm_setzero_ps();
+  int n = 0, i = 0;
+  for (; i + 4 <= count; i += 4) {
+    const float * m = transforms + i*16;
+    __m128 center[3], extent[3];
+    for (int row = 0; row < 3; row++) {
+      __m128 a = _mm_loadu_ps(m + row*4);
+      __m128 b = _mm_loadu_ps(m + 16 + row*4);
+      __m128 d = _mm_loadu_ps(m + 32 + row*4);
+      __m128 g = _mm_loadu_ps(m + 48 + row*4);
+      _MM_TRANSPOSE4_PS(a, b, d, g);
+      // sums are in the same order as in scalar code, so both modes give the same results
+      center[row] = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(a, cx), _mm_mul_ps(b, cy)), _mm_mul_ps(d, cz)), g);
+      extent[row] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_and_ps(a, abs), ex), _mm_mul_ps(_mm_and_ps(b, abs), ey)),
+                               _mm_mul_ps(_mm_and_ps(d, abs), ez));
+    }
+    __m128 outside = _mm_setzero_ps();
+    for (int p = 0; p < 6; p++) {
+      const float * pl = f->planes[p];
+      __m128 px = _mm_set1_ps(pl[0]), py = _mm_set1_ps(pl[1]), pz = _mm_set1_ps(pl[2]);
+      __m128 dist = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(px, center[0]), _mm_mul_ps(py, center[1])),
+                               _mm_mul_ps(pz, center[2])), _mm_set1_ps(pl[3]));
+      __m128 radius = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_and_ps(px, abs), extent[0]), _mm_mul_ps(_mm_and_ps(py, abs), extent[1])),
+                                 _mm_mul_ps(_mm_and_ps(pz, abs), extent[2]));
+      outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(dist, radius), zero));
+    }
+    int mask = _mm_movemask_ps(outside);
+    if (mask == 15) continue;
+    for (int k = 0; k < 4; k++) if (!(mask & 1 << k)) visible[n++] = i + k;
+  }
+  ray_cull_rangeScalar(f, box, transforms, i, count, visible, &n);
+  return n;
+}
+#endif
+
+// Writes indices of visible instances to visible (count elements at most), returns count of them
+int ray_cull_instances(const ray_cull_frustum * f, BoundingBox box, const float * transforms, int count, int * visible){
+#ifdef RAY_KERNELS_SSE2
+  if (ray_cull_simd) return ray_cull_rangeSIMD(f, box, transforms, count, visible);
+#endif
+  int n = 0;
+  ray_cull_rangeScalar(f, box, transforms, 0, count, visible, &n);
+  return n;
+}
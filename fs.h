@@ -0,0 +1,220 @@
+// Directory walking without global buffers: entries are read one by one, with type, size and modification time
+// from the same pass, so directories of any size are listed with memory per opened directory level only.
+// This part has no raylib or Lua calls, walker may be used by pool threads.
+
+#include <ctype.h>
+
+#define RAY_FS_PATH 4096
+
+#if defined(_WIN32)
+  // layout of WIN32_FIND_DATAA, windows.h conflicts with raylib.h (see threads.h)
+  typedef struct {
+    unsigned long attributes;
+    unsigned long creationTime[2], accessTime[2], writeTime[2];
+    unsigned long sizeHigh, sizeLow;
+    unsigned long reserved[2];
+    char          name[260];
+    char          alternateName[14];
+  } ray_fs_findData;
+
+  void * __stdcall FindFirstFileA(const char * pattern, ray_fs_findData * data);
+  int    __stdcall FindNextFileA(void * find, ray_fs_findData * data);
+  int    __stdcall FindClose(void * find);
+#else
+  #include <dirent.h>
+  #include <sys/stat.h>
+#endif
+
+typedef struct {
+#if defined(_WIN32)
+  void          * find;
+  ray_fs_findData data;
+  int             first;           // data contains the first entry, which is not read yet
+#else
+  DIR           * dir;
+  unsigned long long device, inode; // identity of directory, symbolic links to parents are not entered
+#endif
+  size_t          length;          // length of directory path
+} ray_fs_level;
+
+typedef struct {
+  const char * path;               // root and relative path, valid until next ray_fs_next call
+  const char * relative;           // path relative to root
+  const char * name;
+  int          isDir;
+  long long    size;
+  long long    modTime;
+  int          depth;              // 0 for entries of root
+} ray_fs_entry;
+
+typedef struct {
+  char           path[RAY_FS_PATH];
+  size_t         rootLength;
+  ray_fs_level * levels;           // opened directories, the last one is read
+  int            depth, capacity;
+  int            maxDepth;         // depth of entered directories, -1 for unlimited
+  int            directories;      // report directories too
+  char         * patterns;         // zero separated glob patterns
+  size_t         patternsSize;
+  int            patternsCount;
+} ray_fs_walker;
+
+void ray_fs_init(ray_fs_walker * walker){
+  memset(walker, 0, sizeof(ray_fs_walker));
+  walker->maxDepth = -1;
+}
+
+// Adds glob pattern: "*" matches any characters except "/", "**" matches "/" too, "?" matches one character.
+// Patterns with "/" are matched against relative path, other ones against name, case is ignored.
+// Returns 0 on allocation failure
+int ray_fs_addPattern(ray_fs_walker * walker, const char * pattern){
+  size_t len = strlen(pattern) + 1;
+  char * patterns = (char *)realloc(walker->patterns, walker->patternsSize + len);
+  if (!patterns) return 0;
+  memcpy(patterns + walker->patternsSize, pattern, len);
+  walker->patterns      = patterns;
+  walker->patternsSize += len;
+  walker->patternsCount++;
+  return 1;
+}
+
+int ray_fs_match(const char * pattern, const char * s){
+  for (; *pattern; pattern++, s++) {
+    if (*pattern == '*') {
+      int deep = pattern[1] == '*';
+      while (*pattern == '*') pattern++;
+      for (;; s++) {
+        if (ray_fs_match(pattern, s)) return 1;
+        if (!*s || (!deep && *s == '/')) return 0;
+      }
+    }
+    if (!*s || (*pattern == '?' ? *s == '/' : tolower((unsigned char)*pattern) != tolower((unsigned char)*s))) return 0;
+  }
+  return !*s;
+}
+
+int ray_fs_matchAny(ray_fs_walker * walker, const char * relative, const char * name){
+  if (!walker->patternsCount) return 1;
+  for (const char * pattern = walker->patterns; pattern < walker->patterns + walker->patternsSize; pattern += strlen(pattern) + 1)
+    if (ray_fs_match(pattern, strchr(pattern, '/') ? relative : name)) return 1;
+  return 0;
+}
+
+// Opens directory of current path as next level, returns 0 on error
+int ray_fs_enter(ray_fs_walker * walker){
+  if (walker->depth == walker->capacity) {
+    int capacity = walker->capacity ? walker->capacity*2 : 8;
+    ray_fs_level * levels = (ray_fs_level *)realloc(walker->levels, capacity*sizeof(ray_fs_level));
+    if (!levels) return 0;
+    walker->levels   = levels;
+    walker->capacity = capacity;
+  }
+  ray_fs_level * level = &walker->levels[walker->depth];
+  level->length = strlen(walker->path);
+#if defined(_WIN32)
+  if (level->length + 2 >= RAY_FS_PATH) return 0;
+  strcpy(walker->path + level->length, "/*");
+  level->find  = FindFirstFileA(walker->path, &level->data);
+  level->first = 1;
+  walker->path[level->length] = '\0';
+  if (level->find == (void *)(intptr_t)-1) return 0;
+#else
+  struct stat st;
+  if (stat(walker->path, &st)) return 0;
+  for (int i = 0; i < walker->depth; i++)
+    if (walker->levels[i].device == (unsigned long long)st.st_dev && walker->levels[i].inode == (unsigned long long)st.st_ino) return 0;
+  level->dir = opendir(walker->path);
+  if (!level->dir) return 0;
+  level->device = st.st_dev;
+  level->inode  = st.st_ino;
+#endif
+  walker->depth++;
+  return 1;
+}
+
+void ray_fs_leave(ray_fs_walker * walker){
+  ray_fs_level * level = &walker->levels[--walker->depth];
+#if defined(_WIN32)
+  FindClose(level->find);
+#else
+  closedir(level->dir);
+#endif
+  walker->path[level->length] = '\0';
+}
+
+// Starts walking of directory, returns 0 if it can't be opened (walker should be closed anyway)
+int ray_fs_open(ray_fs_walker * walker, const char * root){
+  size_t len = strlen(root);
+  while (len > 1 && (root[len - 1] == '/' || root[len - 1] == '\\')) len--;
+  if (!len) root = ".", len = 1;
+  if (len >= RAY_FS_PATH) return 0;
+  memcpy(walker->path, root, len);
+  walker->path[len]  = '\0';
+  walker->rootLength = len;
+  return ray_fs_enter(walker);
+}
+
+// Reads next entry (directories are entered after they are reported), returns 0 when walking is finished
+int ray_fs_next(ray_fs_walker * walker, ray_fs_entry * entry){
+  while (walker->depth) {
+    ray_fs_level * level = &walker->levels[walker->depth - 1];
+    walker->path[level->length] = '\0';
+#if defined(_WIN32)
+    if (!level->first && !FindNextFileA(level->find, &level->data)) {
+      ray_fs_leave(walker);
+      continue;
+    }
+    level->first = 0;
+    const char * name = level->data.name;
+#else
+    struct dirent * ent = readdir(level->dir);
+    if (!ent) {
+      ray_fs_leave(walker);
+      continue;
+    }
+    const char * name = ent->d_name;
+#endif
+    if (name[0] == '.' && (!name[1] || (name[1] == '.' && !name[2]))) continue;
+    size_t len = strlen(name);
+    if (level->length + 1 + len >= RAY_FS_PATH) continue;
+    walker->path[level->length] = '/';
+    memcpy(walker->path + level->length + 1, name, len + 1);
+#if defined(_WIN32)
+    entry->isDir   = (level->data.attributes & 0x10 /* FILE_ATTRIBUTE_DIRECTORY */) != 0;
+    int link       = (level->data.attributes & 0x400 /* FILE_ATTRIBUTE_REPARSE_POINT */) != 0;
+    entry->size    = (long long)level->data.sizeHigh << 32 | level->data.sizeLow;
+    // FILETIME is in 100 ns intervals since 1601
+    entry->modTime = ((long long)level->data.writeTime[1] << 32 | level->data.writeTime[0])/10000000 - 11644473600LL;
+#else
+    struct stat st;
+    if (stat(walker->path, &st)) continue;
+    entry->isDir   = S_ISDIR(st.st_mode);
+    entry->size    = st.st_size;
+    entry->modTime = st.st_mtime;
+    int link       = 0;
+#endif
+    entry->depth    = walker->depth - 1;
+    entry->path     = walker->path;
+    entry->relative = walker->path + walker->rootLength + 1;
+    entry->name     = walker->path + level->length + 1;
+    if (entry->isDir) {
+      // junctions and links to parents are not entered, they may be loops
+      if (!link && (walker->maxDepth < 0 || entry->depth < walker->maxDepth)) ray_fs_enter(walker);
+      if (!walker->directories) continue;
+    }
+    if (ray_fs_matchAny(walker, entry->relative, entry->name)) return 1;
+  }
+  return 0;
+}
+
+// Closes opened directories and frees patterns
+void ray_fs_close(ray_fs_walker * walker){
+  while (walker->depth) ray_fs_leave(walker);
+  free(walker->levels);
+  free(walker->patterns);
+  walker->levels   = NULL;
+  walker->capacity = 0;
+  walker->patterns = NULL;
+  walker->patternsSize  = 0;
+  walker->patternsCount = 0;
+}
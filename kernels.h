@@ -0,0 +1,283 @@
+// Image processing kernels for UNCOMPRESSED_R8G8B8A8 images, working in place.
+// raylib versions (textures.c) converts whole image to Color array, processes it with float math and converts it back,
+// these ones works directly with image data. SSE2 is used if compiler supports it, scalar code otherwise.
+// Results are the same as raylib ones, except grayscale (fixed-point weights, rarely differs by 1).
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  #define RAY_KERNELS_SSE2
+  #include <emmintrin.h>
+#endif
+
+enum {
+  RAY_KERNELS_RAYLIB, // use raylib functions
+  RAY_KERNELS_SCALAR, // use scalar kernels
+  RAY_KERNELS_SIMD,   // use SIMD kernels (falls back to scalar if SIMD isn't compiled in)
+};
+
+int ray_kernels_mode = RAY_KERNELS_SIMD;
+
+#define ray_kernels_useSIMD() (ray_kernels_mode == RAY_KERNELS_SIMD)
+
+// floor(x/255) for 0 <= x <= 65025
+#define ray_kernels_div255(x) (((x) + 1 + ((x) >> 8)) >> 8)
+
+// Returns 1 if image can be processed by kernels (raylib drops mipmaps, so images with mipmaps goes there)
+int ray_kernels_supported(Image * img){
+  return ray_kernels_mode != RAY_KERNELS_RAYLIB && img->format == UNCOMPRESSED_R8G8B8A8 &&
+         img->mipmaps == 1 && img->data && img->width > 0 && img->height > 0;
+}
+
+void ray_kernels_tint(Color * px, int count, Color c){
+  int i = 0;
+#ifdef RAY_KERNELS_SSE2
+  if (ray_kernels_useSIMD()) {
+    __m128i zero = _mm_setzero_si128();
+    __m128i one  = _mm_set1_epi16(1);
+    __m128i tint = _mm_set_epi16(c.a, c.b, c.g, c.r, c.a, c.b, c.g, c.r);
+    for (; i + 4 <= count; i += 4) {
+      __m128i v  = _mm_loadu_si128((__m128i *)(px + i));
+      __m128i lo = _mm_mullo_epi16(_mm_unpacklo_epi8(v, zero), tint);
+      __m128i hi = _mm_mullo_epi16(_mm_unpackhi_epi8(v, zero), tint);
+      lo = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(lo, one), _mm_srli_epi16(lo, 8)), 8);
+      hi = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(hi, one), _mm_srli_epi16(hi, 8)), 8);
+      _mm_storeu_si128((__m128i *)(px + i), _mm_packus_epi16(lo, hi));
+    }
+  }
+#endif
+  for (; i < count; i++) {
+    px[i].r = ray_kernels_div255(px[i].r*c.r);
+    px[i].g = ray_kernels_div255(px[i].g*c.g);
+    px[i].b = ray_kernels_div255(px[i].b*c.b);
+    px[i].a = ray_kernels_div255(px[i].a*c.a);
+  }
+}
+
+void ray_kernels_invert(Color * px, int count){
+  int i = 0;
+#ifdef RAY_KERNELS_SSE2
+  if (ray_kernels_useSIMD()) {
+    __m128i mask = _mm_set1_epi32(0x00FFFFFF); // alpha is not changed
+    for (; i + 4 <= count; i += 4) {
+      __m128i v = _mm_loadu_si128((__m128i *)(px + i));
+      _mm_storeu_si128((__m128i *)(px + i), _mm_xor_si128(v, mask));
+    }
+  }
+#endif
+  for (; i < count; i++) {
+    px[i].r = 255 - px[i].r;
+    px[i].g = 255 - px[i].g;
+    px[i].b = 255 - px[i].b;
+  }
+}
+
+// NOTE: raylib clamps negative results to 1, not 0, kept for compatibility
+void ray_kernels_brightness(Color * px, int count, int brightness){
+  if (brightness < -255) brightness = -255;
+  if (brightness > 255)  brightness = 255;
+
+  int i = 0;
+#ifdef RAY_KERNELS_SSE2
+  if (ray_kernels_useSIMD()) {
+    unsigned char b = brightness < 0 ? -brightness : brightness;
+    __m128i amount  = _mm_set1_epi32(b | b << 8 | b << 16); // alpha is not changed
+    __m128i one     = _mm_set1_epi8(1);
+    __m128i zero    = _mm_setzero_si128();
+    for (; i + 4 <= count; i += 4) {
+      __m128i v = _mm_loadu_si128((__m128i *)(px + i));
+      if (brightness >= 0) v = _mm_adds_epu8(v, amount);
+      else {
+        // channels with value < amount becomes 1
+        __m128i under = _mm_andnot_si128(_mm_cmpeq_epi8(_mm_subs_epu8(amount, v), zero), one);
+        v = _mm_or_si128(_mm_subs_epu8(v, amount), under);
+      }
+      _mm_storeu_si128((__m128i *)(px + i), v);
+    }
+  }
+#endif
+  for (; i < count; i++) {
+    int r = px[i].r + brightness, g = px[i].g + brightness, b = px[i].b + brightness;
+    px[i].r = r < 0 ? 1 : r > 255 ? 255 : r;
+    px[i].g = g < 0 ? 1 : g > 255 ? 255 : g;
+    px[i].b = b < 0 ? 1 : b > 255 ? 255 : b;
+  }
+}
+
+// Lookup table is built with the same float math as raylib, so results are identical
+void ray_kernels_contrast(Color * px, int count, float contrast){
+  if (contrast < -100) contrast = -100;
+  if (contrast > 100)  contrast = 100;
+  contrast = (100.0f + contrast)/100.0f;
+  contrast *= contrast;
+
+  unsigned char lut[256];
+  for (int i = 0; i < 256; i++) {
+    float p = (float)i/255.0f;
+    p -= 0.5;
+    p *= contrast;
+    p += 0.5;
+    p *= 255;
+    if (p < 0)   p = 0;
+    if (p > 255) p = 255;
+    lut[i] = (unsigned char)p;
+  }
+
+  for (int i = 0; i < count; i++) {
+    px[i].r = lut[px[i].r];
+    px[i].g = lut[px[i].g];
+    px[i].b = lut[px[i].b];
+  }
+}
+
+void ray_kernels_replace(Color * px, int count, Color from, Color to){
+  unsigned int f, t;
+  memcpy(&f, &from, 4);
+  memcpy(&t, &to,   4);
+
+  int i = 0;
+#ifdef RAY_KERNELS_SSE2
+  if (ray_kernels_useSIMD()) {
+    __m128i vf = _mm_set1_epi32(f);
+    __m128i vt = _mm_set1_epi32(t);
+    for (; i + 4 <= count; i += 4) {
+      __m128i v    = _mm_loadu_si128((__m128i *)(px + i));
+      __m128i mask = _mm_cmpeq_epi32(v, vf);
+      v = _mm_or_si128(_mm_and_si128(mask, vt), _mm_andnot_si128(mask, v));
+      _mm_storeu_si128((__m128i *)(px + i), v);
+    }
+  }
+#endif
+  unsigned int * p = (unsigned int *)px;
+  for (; i < count; i++) if (p[i] == f) p[i] = t;
+}
+
+// Converts pixels to grayscale bytes (dst can be the same memory as src), uses raylib luminance weights
+void ray_kernels_grayscale(const Color * src, unsigned char * dst, int count){
+  int i = 0;
+#ifdef RAY_KERNELS_SSE2
+  if (ray_kernels_useSIMD()) {
+    // weights are scaled by 2^15: 0.299, 0.587, 0.114
+    __m128i w    = _mm_set_epi16(0, 3736, 19235, 9797, 0, 3736, 19235, 9797);
+    __m128i zero = _mm_setzero_si128();
+    for (; i + 8 <= count; i += 8) {
+      __m128i v0 = _mm_loadu_si128((__m128i *)(src + i));
+      __m128i v1 = _mm_loadu_si128((__m128i *)(src + i + 4));
+      // r*wr + g*wg, b*wb + a*0 for each pixel
+      __m128i s0 = _mm_madd_epi16(_mm_unpacklo_epi8(v0, zero), w);
+      __m128i s1 = _mm_madd_epi16(_mm_unpackhi_epi8(v0, zero), w);
+      __m128i s2 = _mm_madd_epi16(_mm_unpacklo_epi8(v1, zero), w);
+      __m128i s3 = _mm_madd_epi16(_mm_unpackhi_epi8(v1, zero), w);
+      // horizontal add of pairs: shuffle and add
+      s0 = _mm_add_epi32(s0, _mm_shuffle_epi32(s0, _MM_SHUFFLE(2, 3, 0, 1)));
+      s1 = _mm_add_epi32(s1, _mm_shuffle_epi32(s1, _MM_SHUFFLE(2, 3, 0, 1)));
+      s2 = _mm_add_epi32(s2, _mm_shuffle_epi32(s2, _MM_SHUFFLE(2, 3, 0, 1)));
+      s3 = _mm_add_epi32(s3, _mm_shuffle_epi32(s3, _MM_SHUFFLE(2, 3, 0, 1)));
+      // pick lanes 0 and 2 (pixel sums)
+      s0 = _mm_shuffle_epi32(s0, _MM_SHUFFLE(3, 1, 2, 0));
+      s1 = _mm_shuffle_epi32(s1, _MM_SHUFFLE(3, 1, 2, 0));
+      s2 = _mm_shuffle_epi32(s2, _MM_SHUFFLE(3, 1, 2, 0));
+      s3 = _mm_shuffle_epi32(s3, _MM_SHUFFLE(3, 1, 2, 0));
+      __m128i a = _mm_srli_epi32(_mm_unpacklo_epi64(s0, s1), 15);
+      __m128i b = _mm_srli_epi32(_mm_unpacklo_epi64(s2, s3), 15);
+      __m128i g = _mm_packs_epi32(a, b);
+      g = _mm_packus_epi16(g, g);
+      _mm_storel_epi64((__m128i *)(dst + i), g);
+    }
+  }
+#endif
+  for (; i < count; i++) {
+    Color c = src[i];
+    dst[i] = (c.r*9797 + c.g*19235 + c.b*3736) >> 15;
+  }
+}
+
+// Resize and mipmaps generation, split by rows between pool threads.
+// stb_image_resize is compiled into raylib, resampling of every strip uses offset of its first row,
+// so output is the same as ImageResize one. Supported formats are R8G8B8A8 and R8G8B8:
+// raylib converts them to Color array without changes.
+#include "raylib/external/stb_image_resize.h"
+
+#define RAY_KERNELS_RESIZE_ROWS 32 // min rows count per job
+
+int ray_kernels_threads = 0;       // threads count for resize/mipmaps, 0 is all pool threads
+
+typedef struct {
+  const unsigned char * src;
+  unsigned char       * dst;
+  int srcWidth, srcHeight, dstWidth, dstHeight, channels, rows;
+} ray_kernels_resizeJob;
+
+int ray_kernels_resizable(Image * img){
+  return (img->format == UNCOMPRESSED_R8G8B8A8 || img->format == UNCOMPRESSED_R8G8B8) &&
+         img->data && img->width > 0 && img->height > 0;
+}
+
+void ray_kernels_resizeRows(void * data, int index){
+  ray_kernels_resizeJob * job = (ray_kernels_resizeJob *)data;
+  int y      = index*job->rows;
+  int height = job->dstHeight - y < job->rows ? job->dstHeight - y : job->rows;
+  stbir_resize_subpixel(job->src, job->srcWidth, job->srcHeight, 0,
+                        job->dst + y*job->dstWidth*job->channels, job->dstWidth, height, 0,
+                        STBIR_TYPE_UINT8, job->channels, STBIR_ALPHA_CHANNEL_NONE, 0,
+                        STBIR_EDGE_CLAMP, STBIR_EDGE_CLAMP, STBIR_FILTER_DEFAULT, STBIR_FILTER_DEFAULT,
+                        STBIR_COLORSPACE_LINEAR, NULL,
+                        (float)job->dstWidth/job->srcWidth, (float)job->dstHeight/job->srcHeight, 0, (float)y);
+}
+
+void ray_kernels_resizePixels(const unsigned char * src, int srcWidth, int srcHeight,
+                              unsigned char * dst, int dstWidth, int dstHeight, int channels){
+  ray_kernels_resizeJob job = {src, dst, srcWidth, srcHeight, dstWidth, dstHeight, channels, dstHeight};
+  int threads = ray_kernels_threads;
+  if (threads != 1) {
+    if (threads <= 0) threads = ray_threads_getCount() + 1;
+    int jobs = dstHeight/RAY_KERNELS_RESIZE_ROWS;
+    if (jobs > threads) jobs = threads;
+    if (jobs > 1) job.rows = (dstHeight + jobs - 1)/jobs;
+  }
+  int jobs = (dstHeight + job.rows - 1)/job.rows;
+  if (jobs > 1) ray_threads_parallel(ray_kernels_resizeRows, &job, jobs, threads);
+  else ray_kernels_resizeRows(&job, 0);
+}
+
+// Returns 0 on allocation failure, image is not changed then
+int ray_kernels_resize(Image * img, int width, int height){
+  int channels = img->format == UNCOMPRESSED_R8G8B8A8 ? 4 : 3;
+  unsigned char * data = (unsigned char *)malloc(width*height*channels);
+  if (!data) return 0;
+  ray_kernels_resizePixels((unsigned char *)img->data, img->width, img->height, data, width, height, channels);
+  free(img->data);
+  img->data    = data;
+  img->width   = width;
+  img->height  = height;
+  img->mipmaps = 1;
+  return 1;
+}
+
+// Generates all mipmap levels of image without mipmaps, every level is resized from previous one
+// (as ImageMipmaps does), returns 0 on allocation failure
+int ray_kernels_mipmaps(Image * img){
+  int channels = img->format == UNCOMPRESSED_R8G8B8A8 ? 4 : 3;
+  int count    = 1;
+  int size     = img->width*img->height*channels;
+  for (int w = img->width, h = img->height; w > 1 || h > 1; count++) {
+    w = w > 1 ? w/2 : 1;
+    h = h > 1 ? h/2 : 1;
+    size += w*h*channels;
+  }
+  if (count == 1) return 1;
+
+  unsigned char * data = (unsigned char *)realloc(img->data, size);
+  if (!data) return 0;
+  img->data = data;
+
+  int w = img->width, h = img->height;
+  for (int i = 1; i < count; i++) {
+    int nw = w > 1 ? w/2 : 1;
+    int nh = h > 1 ? h/2 : 1;
+    ray_kernels_resizePixels(data, w, h, data + w*h*channels, nw, nh, channels);
+    data += w*h*channels;
+    w = nw;
+    h = nh;
+  }
+  img->mipmaps = count;
+  return 1;
+}
@@ -1,5 +1,18 @@
 #include "main.h"
 #include "enums.h"
+#include "threads.h"
+#include "kernels.h"
+#include "atlas.h"
+#include "archive.h"
+#include "compress.h"
+#include "store.h"
+#include "fs.h"
+#include "watch.h"
+#include "bvh.h"
+#include "skin.h"
+#include "pose.h"
+#include "cull.h"
+#include "physics.h"
 #include "classes.h"
 
 /*!MD
@@ -106,6 +119,8 @@
 | [GetFileInfo](#GetFileInfo)                                   | Get info table for a given path
 | [CompressData](#CompressData)                                 | Compress data (DEFLATE algorythm)
 | [DecompressData](#DecompressData)                             | Decompress data (DEFLATE algorythm)
+| [CompressBlocks](#CompressBlocks)                             | Compress data by independent blocks using pool threads
+| [DecompressBlocks](#DecompressBlocks)                         | Decompress data of CompressBlocks or DeflateStream
 | [OpenURL](#OpenURL)                                           | Open URL with default system browser (if available)
 | **Persistent storage management**                             | 
 | [StorageSaveValue](#StorageSaveValue)                         | Save integer value to storage file (to defined position)
@@ -166,31 +181,148 @@
 | [SetCameraMoveControls](#SetCameraMoveControls)               | Set camera move controls (1st person and 3rd person cameras)
 
 
-| [Shapes](#Shapes)     | Description
-| :-------------------- | :------------
-|  --                   | --
-
-| [Textures](#Textures) | Description
-| :-------------------- | :------------
-|  --                   | --
+| [Shapes](#Shapes)                                             | Description
+| :------------------------------------------------------------ | :-----------------------------------------------------------
+| [DrawPixel](#DrawPixel)                                       | Draw a pixel
+| **Batched drawing functions**                                 | 
+| [DrawPixels](#DrawPixels)                                     | Draw array of pixels in one call
+| [DrawLines](#DrawLines)                                       | Draw array of lines in one call
+| [DrawRectangles](#DrawRectangles)                             | Draw array of filled rectangles in one call
+| [DrawCircles](#DrawCircles)                                   | Draw array of filled circles in one call
+
+| [Textures](#Textures)                                         | Description
+| :------------------------------------------------------------ | :-----------------------------------------------------------
+| **Image manipulation functions**                              | 
+| [SetImageKernels](#SetImageKernels)                           | Select implementation of Image color operations
+| [SetImageThreads](#SetImageThreads)                           | Set threads count for Image resize and mipmaps generation
+| **Asset cache functions**                                     | 
+| [SetAssetCacheBudget](#SetAssetCacheBudget)                   | Set memory budget of asset cache
+| [GetAssetCacheStats](#GetAssetCacheStats)                     | Get number and size of cached assets
+| [ClearAssetCache](#ClearAssetCache)                           | Free all unused assets kept in cache
+
+| [Text](#Text)                                                 | Description
+| :------------------------------------------------------------ | :-----------------------------------------------------------
+| **Font loading/unloading functions**                          | 
+| [GetFontDefault](#GetFontDefault)                             | Get the default Font
+| **Text drawing functions**                                    | 
+| [DrawFPS](#DrawFPS)                                           | Shows current FPS
+| [DrawText](#DrawText)                                         | Draw text (using default font)
+| [DrawTextEx](#DrawTextEx)                                     | Draw text using font and additional parameters
+| [DrawTextRec](#DrawTextRec)                                   | Draw text using font inside rectangle limits
+| **Text misc. functions**                                      | 
+| [MeasureText](#MeasureText)                                   | Measure string width for default font
+| [MeasureTextEx](#MeasureTextEx)                               | Measure string size for Font
+
+
+| [Models](#Models)                                             | Description
+| :------------------------------------------------------------ | :-----------------------------------------------------------
+| **Mesh generation functions**                                 | 
+| [GenMeshHeightmap](#GenMeshHeightmap)                         | Generate heightmap mesh from image data
+| [GenMeshPlane](#GenMeshPlane)                                 | Generate plane mesh (with subdivisions)
+| [GenMeshCube](#GenMeshCube)                                   | Generate cuboid mesh
+| [GenMeshSphere](#GenMeshSphere)                               | Generate sphere mesh (standard sphere)
+| **Model drawing functions**                                   | 
+| [DrawModel](#DrawModel)                                       | Draw a model (with texture if set)
+| [DrawModelInstanced](#DrawModelInstanced)                     | Draw model many times, culled by camera frustum
+| [CullInstances](#CullInstances)                               | Find instances visible by camera
+| [SetCullingMode](#SetCullingMode)                             | Select instance culling implementation
+| **Model animations functions**                                | 
+| [LoadModelAnimations](#LoadModelAnimations)                   | Load model animations from file
+| [UpdateModelAnimation](#UpdateModelAnimation)                 | Skin model meshes by animation frame
+| [IsModelAnimationValid](#IsModelAnimationValid)               | Check model animation skeleton match
+| [SetSkinningMode](#SetSkinningMode)                           | Select skinning implementation
+| [SetSkinningThreads](#SetSkinningThreads)                     | Set threads count for skinning
+| [SetPoseCache](#SetPoseCache)                                 | Set size of Animator pose cache
+| [GetPoseCacheStats](#GetPoseCacheStats)                       | Get hits and misses of pose cache
+| **Collision detection functions**                             | 
+| [GetCollisionRayModel](#GetCollisionRayModel)                 | Get collision info between ray and model (every triangle is tested)
+| [RaycastModel](#RaycastModel)                                 | Find the nearest triangle of model hit by ray, using BVH
+| [RaycastModelMany](#RaycastModelMany)                         | Cast many rays by pool threads
 
-| [Text](#Text)         | Description
+| [Shaders](#Shaders)   | Description
 | :-------------------- | :------------
 |  --                   | --
 
 
-| [Models](#Models)     | Description
+| [Audio](#Audio)       | Description
 | :-------------------- | :------------
 |  --                   | --
 
-| [Shaders](#Shaders)   | Description
-| :-------------------- | :------------
-|  --                   | --
+| [Async](#Async)                                               | Description
+| :------------------------------------------------------------ | :-----------------------------------------------------------
+| [LoadImage](#LoadImage)                                       | Load image from file by pool thread
+| [LoadFileData](#LoadFileData)                                 | Load file data by pool thread
+| [Await](#Await)                                               | Wait for task result, yielding current coroutine
+| [Update](#Update)                                             | Call callbacks of finished tasks
+| [SetThreadCount](#SetThreadCount)                             | Set count of pool threads
+| [GetThreadCount](#GetThreadCount)                             | Get count of pool threads
+
+| [Assets](#Assets)                                             | Description
+| :------------------------------------------------------------ | :-----------------------------------------------------------
+| [LoadImage](#LoadImage-1)                                     | Load image from file through asset cache
+| [LoadImageAsync](#LoadImageAsync)                             | Load image through asset cache by pool thread
+| [LoadFileData](#LoadFileData-1)                               | Load file contents through asset cache
+| [LoadTexture](#LoadTexture)                                   | Load shared texture from file
+| [LoadFont](#LoadFont)                                         | Load shared font from file
+| [SetBudget](#SetBudget)                                       | Set memory budget of asset cache
+| [GetStats](#GetStats)                                         | Get asset cache counters
+| [Clear](#Clear)                                               | Free all unused assets kept in cache
+
+| [Watch](#Watch)                                               | Description
+| :------------------------------------------------------------ | :-----------------------------------------------------------
+| [Add](#Add)                                                   | Start watching of file or directory
+| [Remove](#Remove)                                             | Stop watching of path
+| [Clear](#Clear-1)                                             | Stop watching of all paths
+| [Update](#Update-1)                                           | Get changed files and reload their assets
+| [IsNative](#IsNative)                                         | Check if changes are reported by system
+| [SetPollBudget](#SetPollBudget)                               | Set count of paths checked per update when polling
+
+| [Archive](#Archive)                                           | Description
+| :------------------------------------------------------------ | :-----------------------------------------------------------
+| [Open](#Open)                                                 | Open packed archive
+| [Pack](#Pack)                                                 | Create packed archive from files
 
+| [Storage](#Storage)                                           | Description
+| :------------------------------------------------------------ | :-----------------------------------------------------------
+| [Open](#Open-1)                                               | Open or create save data store
 
-| [Audio](#Audio)       | Description
-| :-------------------- | :------------
-|  --                   | --
+| [Fs](#Fs)                                                     | Description
+| :------------------------------------------------------------ | :-----------------------------------------------------------
+| [Walk](#Walk)                                                 | Iterate directory entries recursively
+| [WalkAsync](#WalkAsync)                                       | Walk directory by pool thread
+
+| [Physics](#Physics)                                           | Description
+| :------------------------------------------------------------ | :-----------------------------------------------------------
+| [InitPhysics](#InitPhysics)                                   | Destroy all bodies and reset world settings
+| [ClosePhysics](#ClosePhysics)                                 | Destroy all bodies and free memory of world
+| [ResetPhysics](#ResetPhysics)                                 | Destroy all bodies
+| [RunPhysicsStep](#RunPhysicsStep)                             | Run fixed time steps
+| [SetPhysicsTimeStep](#SetPhysicsTimeStep)                     | Set fixed time step in milliseconds
+| [SetPhysicsGravity](#SetPhysicsGravity)                       | Set gravity force
+| [SetPhysicsIterations](#SetPhysicsIterations)                 | Set count of impulse iterations per step
+| [SetPhysicsBroadphase](#SetPhysicsBroadphase)                 | Select search of body pairs: spatial hash grid or every pair
+| [GetPhysicsStats](#GetPhysicsStats)                           | Get count of tested pairs and contacts
+| [CreatePhysicsBodyCircle](#CreatePhysicsBodyCircle)           | Create circle body
+| [CreatePhysicsBodyRectangle](#CreatePhysicsBodyRectangle)     | Create rectangle body
+| [CreatePhysicsBodyPolygon](#CreatePhysicsBodyPolygon)         | Create regular polygon body
+| [GetPhysicsBodiesCount](#GetPhysicsBodiesCount)               | Get count of bodies
+| [GetPhysicsBody](#GetPhysicsBody)                             | Get body by index
+| [DestroyPhysicsBody](#DestroyPhysicsBody)                     | Remove body from world
+| [PhysicsAddForce](#PhysicsAddForce)                           | Add force to body
+| [PhysicsAddTorque](#PhysicsAddTorque)                         | Add torque to body
+| [SetPhysicsBodyRotation](#SetPhysicsBodyRotation)             | Set rotation of body
+| [GetPhysicsShapeVerticesCount](#GetPhysicsShapeVerticesCount) | Get count of body shape vertices
+| [GetPhysicsShapeVertex](#GetPhysicsShapeVertex)               | Get body shape vertex in world space
+
+| [Profiler](#Profiler)                                         | Description
+| :------------------------------------------------------------ | :-----------------------------------------------------------
+| [Enable](#Enable)                                             | Start profiling of binding functions
+| [Disable](#Disable)                                           | Stop profiling
+| [IsEnabled](#IsEnabled)                                       | Check if profiler is enabled
+| [Reset](#Reset)                                               | Clear collected stats and trace
+| [EndFrame](#EndFrame)                                         | Finish current frame stats
+| [Get](#Get)                                                   | Get collected stats
+| [DumpTrace](#DumpTrace)                                       | Save trace as Chrome trace JSON
 
 | [Classes](#Classes)               | Description
 | :--------------------             | :------------
@@ -201,11 +333,15 @@
 | [Color](#Color)                   | Color type, RGBA (32bit)
 | [Rectangle](#Rectangle)           | Rectangle type
 | [Image](#Image)                   | Image type (multiple pixel formats supported), stored in CPU memory (RAM)
+| [Buffer](#Buffer)                 | Typed arrays (Float32Buffer, Int32Buffer, Uint16Buffer, Uint8Buffer), stored in CPU memory (RAM)
+| [AsyncTask](#AsyncTask)           | Result of asynchronous loading
 | [Texture](#Texture)               | Texture type (multiple internal formats supported), stored in GPU memory (VRAM)
 | [RenderTexture](#RenderTexture)   | RenderTexture type, for texture rendering
 | [NPatchInfo](#NPatchInfo)         | N-Patch layout info
 | [CharInfo](#CharInfo)             | Font character info
 | [Font](#Font)                     | Font type, includes texture and chars data
+| [DynamicFont](#DynamicFont)       | Font with glyph atlas filled on demand, for large character sets
+| [TextLayout](#TextLayout)         | Prepared text quads for fast drawing of static strings
 | [Camera](#Camera3D)               | Camera3D type, defines 3d camera position/orientation
 | [Camera2D](#Camera2D)             | Camera2D type, defines a 2d camera
 | [Mesh](#Mesh)                     | Vertex data definning a mesh
@@ -216,6 +352,7 @@
 | [Transform](#Transform)           | Transformation (used for bones)
 | [BoneInfo](#BoneInfo)             | Bone information
 | [ModelAnimation](#ModelAnimation) | Model animation data (bones and frames)
+| [Animator](#Animator)             | Blended playback of model animations
 | [Ray](#Ray)                       | Ray type (useful for raycast)
 | [RayHitInfo](#RayHitInfo)         | Raycast hit information
 | [BoundingBox](#BoundingBox)       | Bounding box type for 3d mesh
@@ -224,6 +361,7 @@
 | [Music](#Music)                   | Music type (file streaming from memory)
 | [AudioStream](#AudioStream)       | Raw audio stream type
 | [VrDeviceInfo](#VrDeviceInfo)     | VR device parameters
+| [PhysicsBody](#PhysicsBody)       | 2D rigid body of physics world
 
 */
 
@@ -734,7 +872,7 @@ Set background color (framebuffer clear color).
 See [Color](#Color).
 */
 int lua_core_ClearBackground(lua_State *L){
-  Color * c = luaL_checkudata(L, 1, "Color");
+  Color * c = luax_checkclass(L, 1, "Color");
   ClearBackground(*c);
   return 0;
 }
@@ -824,8 +962,7 @@ Initializes render texture for drawing.
 See [RenderTexture](#RenderTexture).
 */
 int lua_core_BeginTextureMode(lua_State *L){
-  RenderTexture2D  * t = luaL_checkudata(L, 1, "RenderTexture");
-  BeginTextureMode(*t);
+  BeginTextureMode(_ptr_rendertexture_Check(L, 1)->target);
   return 0;
 }
 
@@ -881,7 +1018,7 @@ Returns a ray trace from mouse position.
 See [Ray](#Ray), [Vector2](#Vector2).
 */
 int lua_core_GetMouseRay(lua_State *L){
-  Vector2  * v = luaL_checkudata(L, 1, "Vector2");
+  Vector2  * v = luax_checkclass(L, 1, "Vector2");
   Camera3D * c = luaL_checkudata(L, 2, "Camera3D");
   if (luax_optstring(L, 3, "\0")[0] == 'v') {
     Ray r = GetMouseRay(*v, *c);
@@ -935,7 +1072,7 @@ Returns the screen space position for a 3d world space position.
 See [Vector2](#Vector2), [Vector3](#Vector3), [Camera3D](#Camera3D).
 */
 int lua_core_GetWorldToScreen(lua_State *L){
-  Vector3  * v = luaL_checkudata(L, 1, "Vector3");
+  Vector3  * v = luax_checkclass(L, 1, "Vector3");
   Camera3D * c = luaL_checkudata(L, 2, "Camera3D");
   Vector2 * p  = luax_newobject(L, "Vector2", sizeof(Vector2));
   *p = GetWorldToScreen(*v, *c);
@@ -951,7 +1088,7 @@ Returns size position for a 3d world space position.
 See [Vector2](#Vector2), [Vector3](#Vector3), [Camera3D](#Camera3D).
 */
 int lua_core_GetWorldToScreenEx(lua_State *L){
-  Vector3  * v = luaL_checkudata(L, 1, "Vector3");
+  Vector3  * v = luax_checkclass(L, 1, "Vector3");
   Camera3D * c = luaL_checkudata(L, 2, "Camera3D");
   int w = luaL_checkinteger(L, 3);
   int h = luaL_checkinteger(L, 4);
@@ -969,7 +1106,7 @@ Returns the screen space position for a 2d camera world space position.
 See [Vector2](#Vector2), [Camera2D](#Camera2D).
 */
 int lua_core_GetWorldToScreen2D(lua_State *L){
-  Vector2  * v = luaL_checkudata(L, 1, "Vector2");
+  Vector2  * v = luax_checkclass(L, 1, "Vector2");
   Camera2D * c = luaL_checkudata(L, 2, "Camera2D");
   Vector2  * p = luax_newobject(L, "Vector2", sizeof(Vector2));
   *p = GetWorldToScreen2D(*v, *c);
@@ -985,7 +1122,7 @@ Returns the world space position for a 2d camera screen space position.
 See [Vector2](#Vector2), [Camera2D](#Camera2D).
 */
 int lua_core_GetScreenToWorld2D(lua_State *L){
-  Vector2  * v = luaL_checkudata(L, 1, "Vector2");
+  Vector2  * v = luax_checkclass(L, 1, "Vector2");
   Camera2D * c = luaL_checkudata(L, 2, "Camera2D");
   Vector2 *  p = luax_newobject(L, "Vector2", sizeof(Vector2));
   *p = GetScreenToWorld2D(*v, *c);
@@ -1051,7 +1188,7 @@ integer iColor = rl.core.ColorToInt(Color Color)
 Returns hexadecimal value for a Color.
 */
 int lua_core_ColorToInt(lua_State *L){
-  Color * c = luaL_checkudata(L, 1, "Color");
+  Color * c = luax_checkclass(L, 1, "Color");
   lua_pushnumber(L, ColorToInt(*c));
   return 1;
 }
@@ -1068,7 +1205,7 @@ Returns color normalized as float [0..1].
 See [Vector4](#Vector4), [Color](#Color).
 */
 int lua_core_ColorNormalize(lua_State *L){
-  Color   * c = luaL_checkudata(L, 1, "Color");
+  Color   * c = luax_checkclass(L, 1, "Color");
   Vector4   v = ColorNormalize(*c);
 
    if (lua_isstring(L, 2)) {
@@ -1109,7 +1246,7 @@ See [Vector4](#Vector4), [Color](#Color).
 int lua_core_ColorFromNormalized(lua_State *L){
   Color * c = luax_newobject(L, "Color", sizeof(Color));
   if (luax_isclass(L, 1, "Vector4")) {
-    Vector4 * v = luaL_checkudata(L, 1, "Vector4");
+    Vector4 * v = luax_checkclass(L, 1, "Vector4");
     *c = ColorFromNormalized(*v);
     return 1;
   }
@@ -1147,7 +1284,7 @@ Returns HSV values for a Color.
 See [Vector3](#Vector3), [Color](#Color).
 */
 int lua_core_ColorToHSV(lua_State *L){
-  Color   * c = luaL_checkudata(L, 1, "Color");
+  Color   * c = luax_checkclass(L, 1, "Color");
   Vector3   v = ColorToHSV(*c);
    if (lua_isstring(L, 2)) {
      const char c = luaL_checkstring(L, 2)[0];
@@ -1185,7 +1322,7 @@ See [Vector3](#Vector3), [Color](#Color).
 int lua_core_ColorFromHSV(lua_State *L){
   Color   * c = luax_newobject(L, "Color", sizeof(Color));
   if (luax_checkclass(L, 1, "Vector3")) {
-    Vector3 * v = luaL_checkudata(L, 1, "Vector3");
+    Vector3 * v = luax_checkclass(L, 1, "Vector3");
     *c = ColorFromHSV(*v);
     return 1;
   }
@@ -1235,7 +1372,7 @@ Color fade-in or fade-out, alpha goes from 0.0f to 1.0f.
 See [Color](#Color)
 */
 int lua_core_Fade(lua_State *L){
-  Color * c = luaL_checkudata(L, 1, "Color");
+  Color * c = luax_checkclass(L, 1, "Color");
   float   a = luaL_checknumber(L, 2);
   Color * r = luax_newobject(L, "Color", sizeof(Color));
   *r = Fade(*c, a);
@@ -1599,6 +1736,7 @@ table Files = rl.core.GetDirectoryFiles(string DirectoryPath)
 ```
 Get filenames in a directory path. [ClearDirectoryFiles](#ClearDirectoryFiles) is called automatically.
 Table Files contains string names like `{"file1.png", "directory1", "file2.lua", ...}`.
+Count of files is limited by raylib buffer, use [rl.fs.Walk](#Walk) for big directories.
 */
 int lua_core_GetDirectoryFiles(lua_State *L){
   const char * dpath = luaL_checkstring(L, 1);
@@ -1770,6 +1908,54 @@ int lua_core_DecompressData(lua_State *L){
   return 1;
 }
 
+/*!MD
+#### CompressBlocks
+```lua
+string CompressedData = rl.core.CompressBlocks(string Data[, integer Level[, integer BlockSize]])
+```
+Compress data by independent blocks (DEFLATE algorythm), blocks are compressed by pool threads at once.
+Level is 0 (no compression) to 9 (best compression), 6 by default, BlockSize is 256 KB by default.
+Result is the same as [DeflateStream](#DeflateStream) output, it can be decompressed by parts with [InflateStream](#InflateStream).
+*/
+int lua_core_CompressBlocks(lua_State *L){
+  size_t srclen;
+  const unsigned char * src = (const unsigned char *)luaL_checklstring(L, 1, &srclen);
+  int level     = luax_optinteger(L, 2, 6);
+  int blockSize = luax_optinteger(L, 3, RAY_COMPRESS_BLOCK);
+  if (level < 0 || level > 9) return luaL_error(L, "Compression level should be in range 0..9");
+  if (blockSize < 1 || blockSize > RAY_COMPRESS_MAXBLOCK) return luaL_error(L, "Block size should be in range 1..%d", RAY_COMPRESS_MAXBLOCK);
+  if (srclen > 0x7FFFFFFF) return luaL_error(L, "Data is too big");
+  int dstlen;
+  unsigned char * dst = ray_compress_blocks(src, srclen, level, blockSize, &dstlen);
+  if (!dst) return luaL_error(L, "Can't allocate memory for compressed data");
+  lua_pushlstring(L, (const char *)dst, dstlen);
+  free(dst);
+  return 1;
+}
+
+/*!MD
+#### DecompressBlocks
+```lua
+string Data = rl.core.DecompressBlocks(string CompressedData)
+```
+Decompress result of [rl.core.CompressBlocks](#CompressBlocks) or [DeflateStream](#DeflateStream), blocks are decompressed by pool threads at once.
+*/
+int lua_core_DecompressBlocks(lua_State *L){
+  size_t srclen;
+  const unsigned char * src = (const unsigned char *)luaL_checklstring(L, 1, &srclen);
+  const char * error = "data is too big";
+  int dstlen;
+  unsigned char * dst = srclen <= 0x7FFFFFFF ? ray_compress_unblocks(src, srclen, &dstlen, &error) : NULL;
+  if (!dst) {
+    lua_pushnil(L);
+    lua_pushfstring(L, "Can't decompress data, %s", error);
+    return 2;
+  }
+  lua_pushlstring(L, (const char *)dst, dstlen);
+  free(dst);
+  return 1;
+}
+
 /*!MD
 #### OpenURL
 ```lua
@@ -1789,7 +1975,7 @@ int lua_core_OpenURL(lua_State *L){
 ```lua
 rl.core.StorageSaveValue(integer Position, integer Value)
 ```
-Save integer value to storage file (to defined position).
+Save integer value to storage file (to defined position). Whole file is rewritten, see [rl.storage](#Storage) for many values.
 */
 int lua_core_StorageSaveValue(lua_State *L){
   int key   = luaL_checkinteger(L, 1);
@@ -2201,7 +2387,7 @@ Set mouse position XY.
 */
 int lua_core_SetMousePosition(lua_State *L){
   if (luax_checkclass(L, 1, "Vector2")){
-    Vector2 * v = luaL_checkudata(L, 1, "Vector2");
+    Vector2 * v = luax_checkclass(L, 1, "Vector2");
     SetMousePosition(v->x, v->y);
     return 0;
   }
@@ -2222,7 +2408,7 @@ Set mouse offset.
 */
 int lua_core_SetMouseOffset(lua_State *L){
   if (luax_checkclass(L, 1, "Vector2")){
-    Vector2 * v = luaL_checkudata(L, 1, "Vector2");
+    Vector2 * v = luax_checkclass(L, 1, "Vector2");
     SetMouseOffset(v->x, v->y);
     return 0;
   }
@@ -2243,7 +2429,7 @@ Set mouse scaling.
 */
 int lua_core_SetMouseScale(lua_State *L){
   if (luax_checkclass(L, 1, "Vector2")){
-    Vector2 * v = luaL_checkudata(L, 1, "Vector2");
+    Vector2 * v = luax_checkclass(L, 1, "Vector2");
     SetMouseScale(v->x, v->y);
     return 0;
   }
@@ -2788,6 +2974,8 @@ luaL_Reg luaray_core[] = {
   {"GetFileInfo",                  lua_core_GetFileInfo},
   {"CompressData",                 lua_core_CompressData},
   {"DecompressData",               lua_core_DecompressData},
+  {"CompressBlocks",               lua_core_CompressBlocks},
+  {"DecompressBlocks",             lua_core_DecompressBlocks},
   {"OpenURL",                      lua_core_OpenURL},
   // Persistent storage management
   {"StorageSaveValue",             lua_core_StorageSaveValue},
@@ -2851,20 +3039,282 @@ luaL_Reg luaray_core[] = {
 };
 
 // SHAPES
-// Basic shapes drawing functions
+/*!MD
+## Shapes
+### Basic shapes drawing functions
+#### DrawPixel
+```lua
+rl.shapes.DrawPixel(number X, number Y, Color Color)
+```
+Draw a pixel
+*/
 int lua_shapes_DrawPixel(lua_State* L) {
     int x = luaL_checknumber(L, 1);
     int y = luaL_checknumber(L, 2);
-    Color* c = (Color*)luaL_checkudata(L, 3, "Color");
+    Color* c = (Color*)luax_checkclass(L, 3, "Color");
     DrawPixel(x, y, *c);
     return 0;
 }
 
+/*!MD
+### Batched drawing functions
+Every function draws an array of primitives in one call, vertices are pushed directly into the rlgl batch.
+Buffer of coordinates can be:
+* table of numbers `{x1, y1, x2, y2, ...}`;
+* [Float32Buffer](#Buffer) (no conversion);
+* string of packed native floats (like `ffi.string(floatArray, n*4)`);
+* FFI `float[n]` or `float[?]` cdata (if FFI layer is loaded), its size is taken from `ffi.sizeof`.
+
+Colors can be single Color object, table of Color objects (one per primitive), string or Uint8Buffer of packed RGBA bytes (4 bytes per primitive).
+Count is optional and defaults to the number of primitives in the buffer.
+```lua
+local points = {}
+for i = 1, 50000 do points[#points + 1] = math.random(800); points[#points + 1] = math.random(600) end
+rl.shapes.DrawPixels(points, rl.Color("red"))
+```
+*/
+
+// Growing scratch buffers, used to convert Lua tables into plain arrays
+float * ray_shapes_floatScratch = NULL;
+int     ray_shapes_floatScratchSize = 0;
+Color * ray_shapes_colorScratch = NULL;
+int     ray_shapes_colorScratchSize = 0;
+
+// Returns pointer to float array from table/string/cdata at idx, count receives number of floats
+const float * ray_shapes_checkFloats(lua_State *L, int idx, int * count){
+  switch (lua_type(L, idx)) {
+    case LUA_TSTRING: {
+      size_t len;
+      const char * str = lua_tolstring(L, idx, &len);
+      *count = len / sizeof(float);
+      return (const float *)str;
+    }
+    case LUA_TUSERDATA: {
+      DataBuffer * b = lua_class_buffer_checktype(L, idx, DATABUFFER_FLOAT32);
+      *count = b->count;
+      return (const float *)b->data;
+    }
+    case LUA_TTABLE: {
+      int n = lua_objlen(L, idx);
+      if (n > ray_shapes_floatScratchSize) {
+        float * scratch = (float *)realloc(ray_shapes_floatScratch, n * sizeof(float));
+        if (!scratch) luaL_error(L, "Can't allocate %d floats", n);
+        ray_shapes_floatScratch     = scratch;
+        ray_shapes_floatScratchSize = n;
+      }
+      for (int i = 0; i < n; i++) {
+        lua_rawgeti(L, idx, i + 1);
+        ray_shapes_floatScratch[i] = lua_tonumber(L, -1);
+        lua_pop(L, 1);
+      }
+      *count = n;
+      return ray_shapes_floatScratch;
+    }
+    case LUAX_TCDATA: {
+      const float * floats = (const float *)luax_tocdata(L, idx, "float[]", count);
+      if (floats) return floats;
+    }
+  }
+  luaL_typerror(L, idx, "table, string, Float32Buffer or cdata");
+  return NULL;
+}
+
+// Returns pointer to color array for count primitives, or single color (*single is set to 1)
+const Color * ray_shapes_checkColors(lua_State *L, int idx, int count, int * single){
+  *single = 0;
+  switch (lua_type(L, idx)) {
+    case LUA_TSTRING: {
+      size_t len;
+      const char * str = lua_tolstring(L, idx, &len);
+      if (len < count * sizeof(Color)) luaL_argerror(L, idx, "not enough colors");
+      return (const Color *)str;
+    }
+    case LUA_TTABLE: {
+      if ((int)lua_objlen(L, idx) < count) luaL_argerror(L, idx, "not enough colors");
+      if (count > ray_shapes_colorScratchSize) {
+        Color * scratch = (Color *)realloc(ray_shapes_colorScratch, count * sizeof(Color));
+        if (!scratch) luaL_error(L, "Can't allocate %d colors", count);
+        ray_shapes_colorScratch     = scratch;
+        ray_shapes_colorScratchSize = count;
+      }
+      for (int i = 0; i < count; i++) {
+        lua_rawgeti(L, idx, i + 1);
+        ray_shapes_colorScratch[i] = *(Color *)luax_checkclass(L, -1, "Color");
+        lua_pop(L, 1);
+      }
+      return ray_shapes_colorScratch;
+    }
+  }
+  DataBuffer * b = lua_class_buffer_test(L, idx);
+  if (b && b->type == DATABUFFER_UINT8) {
+    if (b->count < count * (int)sizeof(Color)) luaL_argerror(L, idx, "not enough colors");
+    return (const Color *)b->data;
+  }
+  *single = 1;
+  return (const Color *)luax_checkclass(L, idx, "Color");
+}
+
+// Returns number of primitives, checks optional Count argument
+int ray_shapes_getCount(lua_State *L, int idx, int floats, int stride){
+  int count = luax_optinteger(L, idx, floats / stride);
+  if (count < 0 || count > floats / stride) luaL_argerror(L, idx, "count is out of buffer size");
+  return count;
+}
+
+// Keeps rlgl batch from overflowing: starts new rlBegin/rlEnd chunk when needed
+#define RAY_SHAPES_BATCH_VERTICES 4096
+#define ray_shapes_batchVertices(mode, vertices, counter) \
+        if ((counter) + (vertices) > RAY_SHAPES_BATCH_VERTICES) { \
+          rlEnd();                                              \
+          if (rlCheckBufferLimit(RAY_SHAPES_BATCH_VERTICES)) rlglDraw(); \
+          rlBegin(mode);                                        \
+          (counter) = 0;                                        \
+        }                                                       \
+        (counter) += (vertices)
+
+#define ray_shapes_batchBegin(mode) \
+        if (rlCheckBufferLimit(RAY_SHAPES_BATCH_VERTICES)) rlglDraw(); \
+        rlBegin(mode)
+
+/*!MD
+#### DrawPixels
+```lua
+rl.shapes.DrawPixels(Buffer Points, Color|Colors Colors, [integer Count])
+```
+Draw array of pixels, Points is `{x1, y1, x2, y2, ...}`
+*/
+int lua_shapes_DrawPixels(lua_State *L){
+  int floats;
+  const float * v      = ray_shapes_checkFloats(L, 1, &floats);
+  int           count  = ray_shapes_getCount(L, 3, floats, 2);
+  int           single;
+  const Color * colors = ray_shapes_checkColors(L, 2, count, &single);
+
+  int counter = 0;
+  ray_shapes_batchBegin(RL_LINES);
+  for (int i = 0; i < count; i++, v += 2) {
+    const Color * c = single ? colors : colors + i;
+    ray_shapes_batchVertices(RL_LINES, 2, counter);
+    rlColor4ub(c->r, c->g, c->b, c->a);
+    rlVertex2f(v[0], v[1]);
+    rlColor4ub(c->r, c->g, c->b, c->a);
+    rlVertex2f(v[0] + 1.0f, v[1] + 1.0f);
+  }
+  rlEnd();
+  return 0;
+}
+
+/*!MD
+#### DrawLines
+```lua
+rl.shapes.DrawLines(Buffer Lines, Color|Colors Colors, [integer Count])
+```
+Draw array of lines, Lines is `{startX1, startY1, endX1, endY1, ...}`
+*/
+int lua_shapes_DrawLines(lua_State *L){
+  int floats;
+  const float * v      = ray_shapes_checkFloats(L, 1, &floats);
+  int           count  = ray_shapes_getCount(L, 3, floats, 4);
+  int           single;
+  const Color * colors = ray_shapes_checkColors(L, 2, count, &single);
+
+  int counter = 0;
+  ray_shapes_batchBegin(RL_LINES);
+  for (int i = 0; i < count; i++, v += 4) {
+    const Color * c = single ? colors : colors + i;
+    ray_shapes_batchVertices(RL_LINES, 2, counter);
+    rlColor4ub(c->r, c->g, c->b, c->a);
+    rlVertex2f(v[0], v[1]);
+    rlColor4ub(c->r, c->g, c->b, c->a);
+    rlVertex2f(v[2], v[3]);
+  }
+  rlEnd();
+  return 0;
+}
+
+/*!MD
+#### DrawRectangles
+```lua
+rl.shapes.DrawRectangles(Buffer Rectangles, Color|Colors Colors, [integer Count])
+```
+Draw array of filled rectangles, Rectangles is `{x1, y1, width1, height1, ...}`
+*/
+int lua_shapes_DrawRectangles(lua_State *L){
+  int floats;
+  const float * v      = ray_shapes_checkFloats(L, 1, &floats);
+  int           count  = ray_shapes_getCount(L, 3, floats, 4);
+  int           single;
+  const Color * colors = ray_shapes_checkColors(L, 2, count, &single);
+
+  int counter = 0;
+  ray_shapes_batchBegin(RL_TRIANGLES);
+  for (int i = 0; i < count; i++, v += 4) {
+    const Color * c = single ? colors : colors + i;
+    float x1 = v[0], y1 = v[1], x2 = v[0] + v[2], y2 = v[1] + v[3];
+    ray_shapes_batchVertices(RL_TRIANGLES, 6, counter);
+    rlColor4ub(c->r, c->g, c->b, c->a); rlVertex2f(x1, y1);
+    rlColor4ub(c->r, c->g, c->b, c->a); rlVertex2f(x1, y2);
+    rlColor4ub(c->r, c->g, c->b, c->a); rlVertex2f(x2, y1);
+
+    rlColor4ub(c->r, c->g, c->b, c->a); rlVertex2f(x2, y1);
+    rlColor4ub(c->r, c->g, c->b, c->a); rlVertex2f(x1, y2);
+    rlColor4ub(c->r, c->g, c->b, c->a); rlVertex2f(x2, y2);
+  }
+  rlEnd();
+  return 0;
+}
+
+/*!MD
+#### DrawCircles
+```lua
+rl.shapes.DrawCircles(Buffer Circles, Color|Colors Colors, [integer Segments], [integer Count])
+```
+Draw array of filled circles, Circles is `{centerX1, centerY1, radius1, ...}`
+* Default Segments is 36 (3..360)
+*/
+int lua_shapes_DrawCircles(lua_State *L){
+  int floats;
+  const float * v        = ray_shapes_checkFloats(L, 1, &floats);
+  int           segments = luax_optinteger(L, 3, 36);
+  int           count    = ray_shapes_getCount(L, 4, floats, 3);
+  int           single;
+  const Color * colors   = ray_shapes_checkColors(L, 2, count, &single);
+
+  if (segments < 3)   segments = 3;
+  if (segments > 360) segments = 360;
+
+  float s[361], c[361];
+  for (int i = 0; i <= segments; i++) {
+    s[i] = sinf(2*PI*i/segments);
+    c[i] = cosf(2*PI*i/segments);
+  }
+
+  int counter = 0;
+  ray_shapes_batchBegin(RL_TRIANGLES);
+  for (int i = 0; i < count; i++, v += 3) {
+    const Color * col = single ? colors : colors + i;
+    float x = v[0], y = v[1], r = v[2];
+    ray_shapes_batchVertices(RL_TRIANGLES, segments*3, counter);
+    for (int j = 0; j < segments; j++) {
+      rlColor4ub(col->r, col->g, col->b, col->a); rlVertex2f(x, y);
+      rlColor4ub(col->r, col->g, col->b, col->a); rlVertex2f(x + s[j]*r,     y + c[j]*r);
+      rlColor4ub(col->r, col->g, col->b, col->a); rlVertex2f(x + s[j + 1]*r, y + c[j + 1]*r);
+    }
+  }
+  rlEnd();
+  return 0;
+}
+
 
 // Basic shapes collision detection functions
 
 luaL_Reg luaray_shapes[] = {
   {"DrawPixel",         lua_shapes_DrawPixel},
+  // Batched drawing functions
+  {"DrawPixels",        lua_shapes_DrawPixels},
+  {"DrawLines",         lua_shapes_DrawLines},
+  {"DrawRectangles",    lua_shapes_DrawRectangles},
+  {"DrawCircles",       lua_shapes_DrawCircles},
   {NULL, NULL}
 };
 
@@ -2873,6 +3323,82 @@ luaL_Reg luaray_shapes[] = {
 // Image/Texture2D data loading/unloading/saving functions
 
 // Image manipulation functions 
+/*!MD
+## Textures
+### Image manipulation functions
+#### SetImageKernels
+```lua
+string PrevMode = rl.textures.SetImageKernels(string Mode)
+```
+Select implementation of Image:tint, invert, grayscale, contrast, brightness and replaceColor for R8G8B8A8 images:
+* "simd" - in-place SSE2 kernels, if compiled in (default);
+* "scalar" - in-place scalar kernels;
+* "raylib" - raylib functions (converts whole image to colors and back).
+*/
+const char * lua_textures_kernelModes[] = {"raylib", "scalar", "simd"};
+
+int lua_textures_SetImageKernels(lua_State *L){
+  const char * mode = luaL_checkstring(L, 1);
+  lua_pushstring(L, lua_textures_kernelModes[ray_kernels_mode]);
+  for (int i = 0; i < 3; i++) {
+    if (!strcmp(mode, lua_textures_kernelModes[i])) {
+      ray_kernels_mode = i;
+      return 1;
+    }
+  }
+  return luaL_error(L, "Unknown image kernels mode \"%s\"", mode);
+}
+
+/*!MD
+#### SetImageThreads
+```lua
+integer PrevCount = rl.textures.SetImageThreads(integer Count)
+```
+Set threads count for Image:resize and Image:genMipmaps (R8G8B8A8 and R8G8B8 images).
+Count 1 runs them on calling thread, 0 (default) uses calling thread and all pool threads (CPU count - 1).
+Output does not depend on threads count.
+*/
+int lua_textures_SetImageThreads(lua_State *L){
+  int count = luaL_checkinteger(L, 1);
+  lua_pushinteger(L, ray_kernels_threads);
+  ray_kernels_threads = count < 0 ? 0 : count;
+  return 1;
+}
+
+/*!MD
+### Asset cache functions
+Same cache as [rl.assets](#Assets) uses, these functions are kept for compatibility.
+#### SetAssetCacheBudget
+```lua
+integer PrevBudget = rl.textures.SetAssetCacheBudget(integer Bytes)
+```
+Same as [rl.assets.SetBudget](#SetBudget).
+*/
+int lua_assets_SetBudget(lua_State *L); // see Assets
+int lua_assets_Clear(lua_State *L);
+
+/*!MD
+#### GetAssetCacheStats
+```lua
+integer Count, integer Bytes, integer Budget = rl.textures.GetAssetCacheStats()
+```
+Get number and total estimated size of unused assets kept in cache, and cache budget.
+See [rl.assets.GetStats](#GetStats) for all counters.
+*/
+int lua_textures_GetAssetCacheStats(lua_State *L){
+  lua_pushinteger(L, lua_class_assets.retainedCount);
+  lua_pushinteger(L, lua_class_assets.retainedBytes);
+  lua_pushinteger(L, lua_class_assets.budget);
+  return 3;
+}
+
+/*!MD
+#### ClearAssetCache
+```lua
+rl.textures.ClearAssetCache()
+```
+Same as [rl.assets.Clear](#Clear).
+*/
 
 // Image generation functions
 
@@ -2881,15 +3407,51 @@ luaL_Reg luaray_shapes[] = {
 // Texture2D drawing functions
 
 luaL_Reg luaray_textures[] = {
+  // Image manipulation functions
+  {"SetImageKernels",     lua_textures_SetImageKernels},
+  {"SetImageThreads",     lua_textures_SetImageThreads},
+  // Asset cache functions
+  {"SetAssetCacheBudget", lua_assets_SetBudget},
+  {"GetAssetCacheStats",  lua_textures_GetAssetCacheStats},
+  {"ClearAssetCache",     lua_assets_Clear},
   {NULL, NULL}
 };
 
 
 // TEXT
+/*!MD
+## Text
+Text functions use glyph lookup tables of [Font](#Font) objects instead of raylib linear glyph search,
+results are the same as raylib ones.
 
-// Font loading/unloading functions
+### Font loading/unloading functions
+#### GetFontDefault
+```lua
+Font Fnt = rl.text.GetFontDefault()
+```
+Get the default Font (available after rl.core.InitWindow).
+*/
+const char * lua_text_defaultFontKey = "raylib_luamore.fontdefault";
+
+int lua_text_GetFontDefault(lua_State *L){
+  lua_getfield(L, LUA_REGISTRYINDEX, lua_text_defaultFontKey);
+  if (!lua_isnil(L, -1)) return 1;
+  FontObject * fnt = (FontObject *)luax_newobject(L, "Font", sizeof(FontObject));
+  memset(fnt, 0, sizeof(FontObject));
+  fnt->isDefault = 1;
+  lua_pushvalue(L, -1);
+  lua_setfield(L, LUA_REGISTRYINDEX, lua_text_defaultFontKey);
+  return 1;
+}
 
-// Text drawing functions
+/*!MD
+### Text drawing functions
+#### DrawFPS
+```lua
+rl.text.DrawFPS(integer X, integer Y)
+```
+Shows current FPS
+*/
 int lua_text_DrawFPS(lua_State *L){
   int x = luaL_checknumber(L, 1);
   int y = luaL_checknumber(L, 2);
@@ -2897,44 +3459,2053 @@ int lua_text_DrawFPS(lua_State *L){
   return 0;
 }
 
+/*!MD
+#### DrawText
+```lua
+rl.text.DrawText(string Text, integer X, integer Y, integer FontSize, Color Tint)
+```
+Draw text (using default font)
+*/
 int lua_text_DrawText(lua_State *L){
-  const char * text = luaL_checkstring(L, 1);
+  size_t len;
+  const char * text = luaL_checklstring(L, 1, &len);
   int x = luaL_checknumber(L, 2);
   int y = luaL_checknumber(L, 3);
   int s = luaL_checknumber(L, 4);
-  Color * c = (Color *)luaL_checkudata(L, 5, "Color");
-  DrawText(text, x, y, s, *c);
+  Color * c = (Color *)luax_checkclass(L, 5, "Color");
+  FontObject * fnt = _ptr_font_Default();
+  if (fnt->font.texture.id == 0) return 0;
+  if (s < 10) s = 10; // same as DrawText
+  _ptr_font_DrawText(fnt, text, len, (Vector2){ (float)x, (float)y }, s, s/10, *c);
+  return 0;
+}
+
+/*!MD
+#### DrawTextEx
+```lua
+rl.text.DrawTextEx(Font Fnt, string Text, Vector2 Position, number FontSize, number Spacing, Color Tint)
+```
+Draw text using font and additional parameters
+*/
+int lua_text_DrawTextEx(lua_State *L){
+  FontObject * fnt = _ptr_font_Check(L, 1);
+  size_t len;
+  const char * text  = luaL_checklstring(L, 2, &len);
+  Vector2 * position = (Vector2 *)luax_checkclass(L, 3, "Vector2");
+  float size         = luaL_checknumber(L, 4);
+  float spacing      = luaL_checknumber(L, 5);
+  Color * tint       = (Color *)luax_checkclass(L, 6, "Color");
+  _ptr_font_DrawText(fnt, text, len, *position, size, spacing, *tint);
+  return 0;
+}
+
+/*!MD
+#### DrawTextRec
+```lua
+rl.text.DrawTextRec(Font Fnt, string Text, Rectangle Rec, number FontSize, number Spacing, boolean WordWrap, Color Tint)
+```
+Draw text using font inside rectangle limits
+*/
+int lua_text_DrawTextRec(lua_State *L){
+  FontObject * fnt = _ptr_font_Check(L, 1);
+  size_t len;
+  const char * text = luaL_checklstring(L, 2, &len);
+  Rectangle * rec   = (Rectangle *)luax_checkclass(L, 3, "Rectangle");
+  float size        = luaL_checknumber(L, 4);
+  float spacing     = luaL_checknumber(L, 5);
+  bool  wordWrap    = lua_toboolean(L, 6);
+  Color * tint      = (Color *)luax_checkclass(L, 7, "Color");
+  _ptr_font_DrawTextRec(fnt, text, len, *rec, size, spacing, wordWrap, *tint);
   return 0;
 }
 
-// Text misc. functions
+/*!MD
+### Text misc. functions
+#### MeasureText
+```lua
+integer Width = rl.text.MeasureText(string Text, integer FontSize)
+```
+Measure string width for default font
+*/
+int lua_text_MeasureText(lua_State *L){
+  size_t len;
+  const char * text = luaL_checklstring(L, 1, &len);
+  int s = luaL_checkinteger(L, 2);
+  FontObject * fnt = _ptr_font_Default();
+  if (fnt->font.texture.id == 0) {
+    lua_pushinteger(L, 0);
+    return 1;
+  }
+  if (s < 10) s = 10; // same as MeasureText
+  lua_pushinteger(L, (int)_ptr_font_MeasureText(fnt, text, len, s, s/10).x);
+  return 1;
+}
+
+/*!MD
+#### MeasureTextEx
+```lua
+Vector2 Size = rl.text.MeasureTextEx(Font Fnt, string Text, number FontSize, number Spacing[, Vector2 Out])
+```
+Measure string size for Font, result is written to Out if it is passed.
+*/
+int lua_text_MeasureTextEx(lua_State *L){
+  FontObject * fnt = _ptr_font_Check(L, 1);
+  size_t len;
+  const char * text = luaL_checklstring(L, 2, &len);
+  float size        = luaL_checknumber(L, 3);
+  float spacing     = luaL_checknumber(L, 4);
+  Vector2 * out;
+  if (lua_isnoneornil(L, 5)) out = (Vector2 *)luax_newobject(L, "Vector2", sizeof(Vector2));
+  else {
+    out = (Vector2 *)luax_checkclass(L, 5, "Vector2");
+    lua_settop(L, 5);
+  }
+  *out = _ptr_font_MeasureText(fnt, text, len, size, spacing);
+  return 1;
+}
 
 // Text strings management functions (no UTF-8 encoded strings, only byte chars)
 
 // UTF-8 encoded text strings management functions
 
 luaL_Reg luaray_text[] = {
-  {"DrawFPS",  lua_text_DrawFPS},
-  {"DrawText", lua_text_DrawText},
+  // Font loading/unloading functions
+  {"GetFontDefault", lua_text_GetFontDefault},
+  // Text drawing functions
+  {"DrawFPS",        lua_text_DrawFPS},
+  {"DrawText",       lua_text_DrawText},
+  {"DrawTextEx",     lua_text_DrawTextEx},
+  {"DrawTextRec",    lua_text_DrawTextRec},
+  // Text misc. functions
+  {"MeasureText",    lua_text_MeasureText},
+  {"MeasureTextEx",  lua_text_MeasureTextEx},
   {NULL, NULL}
 };
 
-#if defined(_WIN32) || defined(_WIN64)
-__declspec(dllexport)
-#endif
-int luaopen_raylib_luamore(lua_State *L) {
-  lua_newtable(L);
-  lua_class_register(L);
-  
-  // modules
-  lua_pushstring(L, "core");     luax_pushfunctable(L, luaray_core);     lua_rawset(L, -3);
-  lua_pushstring(L, "shapes");   luax_pushfunctable(L, luaray_shapes);   lua_rawset(L, -3);
-  lua_pushstring(L, "textures"); luax_pushfunctable(L, luaray_textures); lua_rawset(L, -3);
-  lua_pushstring(L, "text");     luax_pushfunctable(L, luaray_text);     lua_rawset(L, -3);
 
-  // enums
-  lua_pushstring(L, "ekey");     luaray_exportKeyboardKeys(L);           lua_rawset(L, -3);
-  lua_pushstring(L, "etexture"); luaray_exportTextureFormat(L);          lua_rawset(L, -3);
+// MODELS
+/*!MD
+## Models
+Models keep vertex data in RAM, so they are picked by rays on CPU. [RaycastModel](#RaycastModel) uses
+bounding volume hierarchy of meshes (built once per mesh, see [Model:buildBVH](#ModelbuildBVH)) instead of testing
+every triangle as GetCollisionRayModel does.
+```lua
+local terrain = rl.Model(rl.models.GenMeshHeightmap(rl.Image("heightmap.png"), rl.Vector3(64, 8, 64)))
+local position, direction = rl.core.GetMouseRay(rl.core.GetMousePosition(), camera, "v")
+local distance, point, normal = rl.models.RaycastModel(position, direction, terrain)
+```
+
+### Mesh generation functions
+#### GenMeshHeightmap
+```lua
+Mesh Msh = rl.models.GenMeshHeightmap(Image Heightmap, Vector3 Size)
+```
+Generate heightmap mesh from image data.
+*/
+int lua_models_GenMeshHeightmap(lua_State *L){
+  Image * img  = (Image *)luaL_checkudata(L, 1, "Image");
+  Vector3 size = *(Vector3 *)luax_checkclass(L, 2, "Vector3");
+  _ptr_mesh_Push(L, GenMeshHeightmap(*img, size));
+  return 1;
+}
+
+/*!MD
+#### GenMeshPlane
+```lua
+Mesh Msh = rl.models.GenMeshPlane(number Width, number Length, integer ResX, integer ResZ)
+```
+Generate plane mesh (with subdivisions).
+*/
+int lua_models_GenMeshPlane(lua_State *L){
+  float width  = luaL_checknumber(L, 1);
+  float length = luaL_checknumber(L, 2);
+  int   resX   = luaL_checkinteger(L, 3);
+  int   resZ   = luaL_checkinteger(L, 4);
+  _ptr_mesh_Push(L, GenMeshPlane(width, length, resX, resZ));
+  return 1;
+}
+
+/*!MD
+#### GenMeshCube
+```lua
+Mesh Msh = rl.models.GenMeshCube(number Width, number Height, number Length)
+```
+Generate cuboid mesh.
+*/
+int lua_models_GenMeshCube(lua_State *L){
+  float width  = luaL_checknumber(L, 1);
+  float height = luaL_checknumber(L, 2);
+  float length = luaL_checknumber(L, 3);
+  _ptr_mesh_Push(L, GenMeshCube(width, height, length));
+  return 1;
+}
+
+/*!MD
+#### GenMeshSphere
+```lua
+Mesh Msh = rl.models.GenMeshSphere(number Radius, integer Rings, integer Slices)
+```
+Generate sphere mesh (standard sphere).
+*/
+int lua_models_GenMeshSphere(lua_State *L){
+  float radius = luaL_checknumber(L, 1);
+  int   rings  = luaL_checkinteger(L, 2);
+  int   slices = luaL_checkinteger(L, 3);
+  _ptr_mesh_Push(L, GenMeshSphere(radius, rings, slices));
+  return 1;
+}
+
+/*!MD
+### Model drawing functions
+#### DrawModel
+```lua
+rl.models.DrawModel(Model Mdl, Vector3 Position, number Scale, Color Tint)
+```
+Draw a model (with texture if set).
+*/
+int lua_models_DrawModel(lua_State *L){
+  ModelObject * obj = _ptr_model_Check(L, 1);
+  Vector3 position  = *(Vector3 *)luax_checkclass(L, 2, "Vector3");
+  float   scale     = luaL_checknumber(L, 3);
+  Color   tint      = *(Color *)luax_checkclass(L, 4, "Color");
+  DrawModel(obj->model, position, scale, tint);
+  return 0;
+}
+
+/*!MD
+#### DrawModelInstanced
+```lua
+integer Drawn = rl.models.DrawModelInstanced(Model Mdl, Float32Buffer Transforms[, Color Tint])
+```
+Draw model many times (between BeginMode3D and EndMode3D), Transforms are 16 numbers per instance in Matrix
+field order (m0, m4, m8, m12, m1, ...), so translation is 4th, 8th and 12th number. Model transform is applied first.
+Instances out of camera frustum are skipped (bounding box of meshes in bind pose is tested by
+[CullInstances](#CullInstances) code). Small models (1024 vertices at most) with default shader are transformed on CPU
+and pushed into rlgl batch, so thousands of instances take a few draw calls, others are drawn mesh by mesh.
+Returns count of drawn instances.
+```lua
+local trees = rl.Float32Buffer(16*count) -- filled by positions
+rl.core.BeginMode3D(camera)
+rl.models.DrawModelInstanced(tree, trees)
+rl.core.EndMode3D()
+```
+*/
+#define LUA_MODELS_BATCHVERTICES 1024
+
+// Model can be pushed into rlgl batch if meshes are in RAM, small and drawn by default shader
+int lua_models_Batchable(Model * model){
+  int vertices = 0;
+  for (int i = 0; i < model->meshCount; i++) {
+    Mesh * mesh = &model->meshes[i];
+    if (!mesh->vertices || model->materials[model->meshMaterial[i]].shader.id != GetShaderDefault().id) return 0;
+    vertices += _ptr_mesh_TriangleCount(mesh)*3;
+  }
+  return vertices <= LUA_MODELS_BATCHVERTICES;
+}
+
+Color lua_models_Tint(Color color, Color tint){
+  return (Color){ color.r*tint.r/255, color.g*tint.g/255, color.b*tint.b/255, color.a*tint.a/255 };
+}
+
+// Pushes transformed triangles of mesh into rlgl batch, caller checks buffer limit
+void lua_models_BatchMesh(Mesh * mesh, Matrix m, Color color){
+  const float * v = mesh->animVertices ? mesh->animVertices : mesh->vertices;
+  int count = _ptr_mesh_TriangleCount(mesh)*3;
+  rlBegin(RL_TRIANGLES);
+  rlColor4ub(color.r, color.g, color.b, color.a);
+  for (int i = 0; i < count; i++) {
+    int k = mesh->indices ? mesh->indices[i] : i;
+    const float * p = v + k*3;
+    if (mesh->colors) {
+      const unsigned char * c = mesh->colors + k*4;
+      rlColor4ub(c[0]*color.r/255, c[1]*color.g/255, c[2]*color.b/255, c[3]*color.a/255);
+    }
+    if (mesh->texcoords) rlTexCoord2f(mesh->texcoords[k*2], mesh->texcoords[k*2 + 1]);
+    rlVertex3f(m.m0*p[0] + m.m4*p[1] + m.m8*p[2]  + m.m12,
+               m.m1*p[0] + m.m5*p[1] + m.m9*p[2]  + m.m13,
+               m.m2*p[0] + m.m6*p[1] + m.m10*p[2] + m.m14);
+  }
+  rlEnd();
+}
+
+int lua_models_DrawModelInstanced(lua_State *L){
+  ModelObject * obj = _ptr_model_Check(L, 1);
+  DataBuffer * buf  = lua_class_buffer_checktype(L, 2, DATABUFFER_FLOAT32);
+  Color tint        = lua_isnoneornil(L, 3) ? WHITE : *(Color *)luax_checkclass(L, 3, "Color");
+  Model * model     = &obj->model;
+  const float * transforms = (const float *)buf->data;
+  int count = buf->count/16;
+  int * visible = ray_cull_reserve(count > 0 ? count : 1);
+  if (!visible) return luaL_error(L, "Can't allocate %d instances", count);
+  ray_cull_frustum frustum;
+  ray_cull_frustumFromMatrix(&frustum, MatrixMultiply(GetMatrixModelview(), GetMatrixProjection()));
+  BoundingBox box = ray_cull_transformBox(_ptr_model_Bounds(obj), model->transform);
+  int drawn = ray_cull_instances(&frustum, box, transforms, count, visible);
+  if (lua_models_Batchable(model)) {
+    int vertices = 0;
+    for (int i = 0; i < model->meshCount; i++) vertices += _ptr_mesh_TriangleCount(&model->meshes[i])*3;
+    for (int j = 0; j < drawn; j++) {
+      Matrix instance;
+      memcpy(&instance, transforms + visible[j]*16, sizeof(Matrix));
+      instance = MatrixMultiply(model->transform, instance);
+      if (rlCheckBufferLimit(vertices)) rlglDraw();
+      for (int i = 0; i < model->meshCount; i++) {
+        MaterialMap * map = &model->materials[model->meshMaterial[i]].maps[MAP_DIFFUSE];
+        rlEnableTexture(map->texture.id ? map->texture.id : GetTextureDefault().id);
+        lua_models_BatchMesh(&model->meshes[i], instance, lua_models_Tint(map->color, tint));
+      }
+    }
+    rlDisableTexture();
+  }
+  else {
+    for (int j = 0; j < drawn; j++) {
+      Matrix instance;
+      memcpy(&instance, transforms + visible[j]*16, sizeof(Matrix));
+      instance = MatrixMultiply(model->transform, instance);
+      for (int i = 0; i < model->meshCount; i++) {
+        Material material = model->materials[model->meshMaterial[i]];
+        material.maps[MAP_DIFFUSE].color = lua_models_Tint(material.maps[MAP_DIFFUSE].color, tint);
+        rlDrawMesh(model->meshes[i], material, instance);
+      }
+    }
+  }
+  lua_pushinteger(L, drawn);
+  return 1;
+}
+
+/*!MD
+#### CullInstances
+```lua
+-- variants
+Int32Buffer Visible, integer Count = rl.models.CullInstances(Model Mdl, Float32Buffer Transforms, Matrix View, Matrix Projection[, Int32Buffer Visible])
+Int32Buffer Visible, integer Count = rl.models.CullInstances(Vector3 Min, Vector3 Max, Float32Buffer Transforms, Matrix View, Matrix Projection[, Int32Buffer Visible])
+```
+Find instances visible by camera, as [DrawModelInstanced](#DrawModelInstanced) does, without window.
+Bounding box is given by model (with its transform) or by Min and Max corners, Transforms are the same as in DrawModelInstanced.
+Indices of visible instances (started from 1) are stored to the first Count elements of Visible buffer if it is passed, or of new one.
+Test is conservative: boxes near corners of frustum can be reported visible, visible boxes are never dropped.
+```lua
+local view = rl.Matrix():lookAt(rl.Vector3(0, 10, 10), rl.Vector3(0, 0, 0), rl.Vector3(0, 1, 0))
+local projection = rl.Matrix():perspective(math.rad(45), 16/9, 0.01, 1000) -- as BeginMode3D sets it
+local visible, count = rl.models.CullInstances(tree, trees, view, projection)
+```
+*/
+int lua_models_CullInstances(lua_State *L){
+  BoundingBox box;
+  int arg = 2;
+  if (luax_isclass(L, 1, "Model")) {
+    ModelObject * obj = _ptr_model_Check(L, 1);
+    box = ray_cull_transformBox(_ptr_model_Bounds(obj), obj->model.transform);
+  }
+  else {
+    box.min = *(Vector3 *)luax_checkclass(L, 1, "Vector3");
+    box.max = *(Vector3 *)luax_checkclass(L, 2, "Vector3");
+    arg = 3;
+  }
+  DataBuffer * buf = lua_class_buffer_checktype(L, arg, DATABUFFER_FLOAT32);
+  Matrix view       = *(Matrix *)luax_checkclass(L, arg + 1, "Matrix");
+  Matrix projection = *(Matrix *)luax_checkclass(L, arg + 2, "Matrix");
+  int count = buf->count/16;
+  DataBuffer * out;
+  if (lua_isnoneornil(L, arg + 3)) {
+    lua_settop(L, arg + 2);
+    out = lua_class_buffer_push(L, DATABUFFER_INT32, count);
+  }
+  else {
+    out = lua_class_buffer_checktype(L, arg + 3, DATABUFFER_INT32);
+    if (out->count < count) return luaL_error(L, "Visible buffer should have %d elements at least", count);
+    lua_pushvalue(L, arg + 3);
+  }
+  ray_cull_frustum frustum;
+  ray_cull_frustumFromMatrix(&frustum, MatrixMultiply(view, projection));
+  int * visible = (int *)out->data;
+  int drawn = ray_cull_instances(&frustum, box, (const float *)buf->data, count, visible);
+  for (int i = 0; i < drawn; i++) visible[i]++;
+  lua_pushinteger(L, drawn);
+  return 2;
+}
+
+/*!MD
+#### SetCullingMode
+```lua
+string PrevMode = rl.models.SetCullingMode(string Mode)
+```
+Select implementation of instance culling: "simd" - SSE test of 4 instances at once, if compiled in (default), or "scalar".
+*/
+const char * lua_models_cullModes[] = {"scalar", "simd"};
+
+int lua_models_SetCullingMode(lua_State *L){
+  const char * mode = luaL_checkstring(L, 1);
+  lua_pushstring(L, lua_models_cullModes[ray_cull_simd]);
+  for (int i = 0; i < 2; i++) {
+    if (!strcmp(mode, lua_models_cullModes[i])) {
+      ray_cull_simd = i;
+      return 1;
+    }
+  }
+  return luaL_error(L, "Unknown culling mode \"%s\"", mode);
+}
+
+/*!MD
+### Model animations functions
+Animated meshes are skinned on CPU: matrices of bones are computed once per frame, up to 4 weighted bones
+are blended per vertex (raylib uses first one only), and vertices are split between pool threads.
+```lua
+local model = rl.Model("guy.iqm")
+local walk  = rl.models.LoadModelAnimations("guyanim.iqm")[1]
+rl.models.UpdateModelAnimation(model, walk, frame)
+model:draw(rl.Vector3(0, 0, 0))
+```
+#### LoadModelAnimations
+```lua
+table Animations = rl.models.LoadModelAnimations(string Filename)
+```
+Load animations from IQM file, returns list of [ModelAnimation](#ModelAnimation).
+*/
+int lua_models_LoadModelAnimations(lua_State *L){
+  const char * fname = luaL_checkstring(L, 1);
+  if (!FileExists(fname)) return luaL_error(L, "Can't load animations \"%s\", file is not exists", fname);
+  int count = 0;
+  ModelAnimation * anims = LoadModelAnimations(fname, &count);
+  if (!anims) return luaL_error(L, "Can't load animations \"%s\"", fname);
+  lua_createtable(L, count, 0);
+  for (int i = 0; i < count; i++) {
+    ModelAnimationObject * obj = (ModelAnimationObject *)luax_newobject(L, "ModelAnimation", sizeof(ModelAnimationObject));
+    obj->anim   = anims[i];
+    obj->loaded = 1;
+    obj->id     = ++_ptr_modelanimation_lastId;
+    lua_rawseti(L, -2, i + 1);
+  }
+  RL_FREE(anims); // frames are owned by objects now
+  return 1;
+}
+
+/*!MD
+#### UpdateModelAnimation
+```lua
+rl.models.UpdateModelAnimation(Model Mdl, ModelAnimation Anim, integer Frame[, boolean Upload])
+```
+Skin model meshes by animation frame (0-based, it is wrapped by frame count). Skinned vertices are uploaded
+to GPU unless Upload is false (they are kept in RAM then, "raylib" mode always uploads them).
+Animation should have the same skeleton as model, see [IsModelAnimationValid](#IsModelAnimationValid).
+*/
+int lua_models_UpdateModelAnimation(lua_State *L){
+  ModelObject * obj          = _ptr_model_Check(L, 1);
+  ModelAnimationObject * ani = _ptr_modelanimation_Check(L, 2);
+  int  frame                 = luaL_checkinteger(L, 3);
+  int  upload                = lua_isnoneornil(L, 4) || lua_toboolean(L, 4);
+  if (!IsModelAnimationValid(obj->model, ani->anim)) return luaL_error(L, "Animation doesn't match model skeleton");
+  if (ani->anim.frameCount <= 0) return 0;
+  frame %= ani->anim.frameCount;
+  if (frame < 0) frame += ani->anim.frameCount;
+  if (ray_skin_mode == RAY_SKIN_RAYLIB) {
+    UpdateModelAnimation(obj->model, ani->anim, frame);
+    return 0;
+  }
+  if (!ray_skin_model(&obj->model, ani->anim.framePoses[frame])) return luaL_error(L, "Can't allocate bones");
+  if (upload) ray_skin_upload(&obj->model);
+  return 0;
+}
+
+/*!MD
+#### IsModelAnimationValid
+```lua
+boolean Valid = rl.models.IsModelAnimationValid(Model Mdl, ModelAnimation Anim)
+```
+Check model animation skeleton match (count of bones and their parents).
+*/
+int lua_models_IsModelAnimationValid(lua_State *L){
+  ModelObject * obj          = _ptr_model_Check(L, 1);
+  ModelAnimationObject * ani = _ptr_modelanimation_Check(L, 2);
+  lua_pushboolean(L, IsModelAnimationValid(obj->model, ani->anim));
+  return 1;
+}
+
+/*!MD
+#### SetSkinningMode
+```lua
+string PrevMode = rl.models.SetSkinningMode(string Mode)
+```
+Select implementation of UpdateModelAnimation:
+* "simd" - SSE blending of bone matrices, if compiled in (default);
+* "scalar" - the same in scalar code;
+* "raylib" - raylib function (first bone of vertex only, single thread).
+*/
+const char * lua_models_skinModes[] = {"raylib", "scalar", "simd"};
+
+int lua_models_SetSkinningMode(lua_State *L){
+  const char * mode = luaL_checkstring(L, 1);
+  lua_pushstring(L, lua_models_skinModes[ray_skin_mode]);
+  for (int i = 0; i < 3; i++) {
+    if (!strcmp(mode, lua_models_skinModes[i])) {
+      ray_skin_mode = i;
+      return 1;
+    }
+  }
+  return luaL_error(L, "Unknown skinning mode \"%s\"", mode);
+}
+
+/*!MD
+#### SetSkinningThreads
+```lua
+integer PrevCount = rl.models.SetSkinningThreads(integer Count)
+```
+Set threads count for UpdateModelAnimation. Count 1 skins on calling thread, 0 (default) uses calling thread and
+all pool threads, meshes are split by 1024 vertices.
+*/
+int lua_models_SetSkinningThreads(lua_State *L){
+  int count = luaL_checkinteger(L, 1);
+  lua_pushinteger(L, ray_skin_threads);
+  ray_skin_threads = count < 0 ? 0 : count;
+  return 1;
+}
+
+/*!MD
+#### SetPoseCache
+```lua
+integer PrevSize, integer PrevSteps = rl.models.SetPoseCache(integer Size[, integer Steps])
+```
+Set count of poses kept by [Animator](#Animator) cache (256 by default, 0 disables it, 8 at least otherwise)
+and count of steps per frame which fractional frames are rounded down to (16 by default). Cached poses are dropped.
+*/
+int lua_models_SetPoseCache(lua_State *L){
+  ray_pose_cache * cache = ray_pose_getShared();
+  int size  = luaL_checkinteger(L, 1);
+  int steps = luax_optinteger(L, 2, cache->steps);
+  lua_pushinteger(L, cache->capacity);
+  lua_pushinteger(L, cache->steps);
+  if (!ray_pose_cacheInit(cache, size, steps)) return luaL_error(L, "Can't allocate pose cache");
+  return 2;
+}
+
+/*!MD
+#### GetPoseCacheStats
+```lua
+integer Hits, integer Misses = rl.models.GetPoseCacheStats()
+```
+Get count of poses found in cache and evaluated, since the last SetPoseCache call.
+*/
+int lua_models_GetPoseCacheStats(lua_State *L){
+  ray_pose_cache * cache = ray_pose_getShared();
+  lua_pushnumber(L, (lua_Number)cache->hits);
+  lua_pushnumber(L, (lua_Number)cache->misses);
+  return 2;
+}
+
+/*!MD
+### Collision detection functions
+#### GetCollisionRayModel
+```lua
+boolean Hit, number Distance, Vector3 Point, Vector3 Normal = rl.models.GetCollisionRayModel(Vector3 Position, Vector3 Direction, Model Mdl)
+```
+Get collision info between ray and model by raylib, which tests every triangle. Use [RaycastModel](#RaycastModel) instead.
+*/
+int lua_models_GetCollisionRayModel(lua_State *L){
+  Ray ray;
+  ray.position  = *(Vector3 *)luax_checkclass(L, 1, "Vector3");
+  ray.direction = *(Vector3 *)luax_checkclass(L, 2, "Vector3");
+  ModelObject * obj = _ptr_model_Check(L, 3);
+  RayHitInfo info = GetCollisionRayModel(ray, obj->model);
+  lua_pushboolean(L, info.hit);
+  lua_pushnumber(L, info.distance);
+  *(Vector3 *)luax_newobject(L, "Vector3", sizeof(Vector3)) = info.position;
+  *(Vector3 *)luax_newobject(L, "Vector3", sizeof(Vector3)) = info.normal;
+  return 4;
+}
+
+/*!MD
+#### RaycastModel
+```lua
+number Distance, Vector3 Point, Vector3 Normal, integer Triangle, integer Mesh = rl.models.RaycastModel(Vector3 Position, Vector3 Direction, Model Mdl[, number MaxDistance])
+nil = rl.models.RaycastModel(...) -- nothing is hit
+```
+Find the nearest triangle hit by ray (model transform is applied), both sides of triangles are hit.
+Triangle is index of triangle in Mesh (both are started from 1). BVH is built on first call if it is not built yet.
+*/
+int lua_models_RaycastModel(lua_State *L){
+  Vector3 position  = *(Vector3 *)luax_checkclass(L, 1, "Vector3");
+  Vector3 direction = Vector3Normalize(*(Vector3 *)luax_checkclass(L, 2, "Vector3"));
+  ModelObject * obj = _ptr_model_Check(L, 3);
+  float maxDistance = luax_optnumber(L, 4, 3.4e38f);
+  _ptr_model_BuildBVH(L, obj);
+  Matrix inverse;
+  int transformed = _ptr_model_Inverse(obj, &inverse);
+  ModelRayHit hit;
+  _ptr_model_Raycast(obj, transformed ? &inverse : NULL, position, direction, maxDistance, &hit);
+  if (hit.mesh < 0) return 0;
+  lua_pushnumber(L, hit.distance);
+  *(Vector3 *)luax_newobject(L, "Vector3", sizeof(Vector3)) = Vector3Add(position, Vector3Scale(direction, hit.distance));
+  *(Vector3 *)luax_newobject(L, "Vector3", sizeof(Vector3)) = hit.normal;
+  lua_pushinteger(L, hit.triangle + 1);
+  lua_pushinteger(L, hit.mesh + 1);
+  return 5;
+}
+
+/*!MD
+#### RaycastModelMany
+```lua
+Float32Buffer Results, integer Hits = rl.models.RaycastModelMany(Float32Buffer Rays, Model Mdl[, Float32Buffer Results[, number MaxDistance]])
+```
+Cast many rays by pool threads. Rays contains 6 numbers per ray: position and direction.
+Results are 6 numbers per ray: distance (-1 if nothing is hit), normal, triangle and mesh, they are stored to
+Results buffer if it is passed, or to new one.
+*/
+#define LUA_MODELS_RAYCHUNK 64
+
+typedef struct {
+  ModelObject  * model;
+  const Matrix * inverse;
+  const float  * rays;
+  float        * results;
+  int            count;
+  float          maxDistance;
+} lua_models_RaycastJob;
+
+void lua_models_RaycastChunk(void * data, int chunk){
+  lua_models_RaycastJob * job = (lua_models_RaycastJob *)data;
+  int last = (chunk + 1)*LUA_MODELS_RAYCHUNK < job->count ? (chunk + 1)*LUA_MODELS_RAYCHUNK : job->count;
+  for (int i = chunk*LUA_MODELS_RAYCHUNK; i < last; i++) {
+    const float * ray = job->rays + i*6;
+    float * result = job->results + i*6;
+    ModelRayHit hit;
+    Vector3 direction = Vector3Normalize((Vector3){ ray[3], ray[4], ray[5] });
+    _ptr_model_Raycast(job->model, job->inverse, (Vector3){ ray[0], ray[1], ray[2] }, direction, job->maxDistance, &hit);
+    if (hit.mesh < 0) {
+      memset(result, 0, 6*sizeof(float));
+      result[0] = -1;
+      continue;
+    }
+    result[0] = hit.distance;
+    result[1] = hit.normal.x;
+    result[2] = hit.normal.y;
+    result[3] = hit.normal.z;
+    result[4] = hit.triangle + 1;
+    result[5] = hit.mesh + 1;
+  }
+}
+
+int lua_models_RaycastModelMany(lua_State *L){
+  DataBuffer * rays = lua_class_buffer_checktype(L, 1, DATABUFFER_FLOAT32);
+  ModelObject * obj = _ptr_model_Check(L, 2);
+  int count = rays->count/6;
+  DataBuffer * results;
+  if (lua_isnoneornil(L, 3)) {
+    lua_settop(L, 2);
+    results = lua_class_buffer_push(L, DATABUFFER_FLOAT32, count*6);
+  }
+  else {
+    results = lua_class_buffer_checktype(L, 3, DATABUFFER_FLOAT32);
+    if (results->count < count*6) return luaL_error(L, "Results buffer should have %d elements at least", count*6);
+    lua_pushvalue(L, 3);
+  }
+  _ptr_model_BuildBVH(L, obj);
+  Matrix inverse;
+  int transformed = _ptr_model_Inverse(obj, &inverse);
+  lua_models_RaycastJob job = {obj, transformed ? &inverse : NULL, (const float *)rays->data, (float *)results->data, count, luax_optnumber(L, 4, 3.4e38f)};
+  ray_threads_parallel(lua_models_RaycastChunk, &job, (count + LUA_MODELS_RAYCHUNK - 1)/LUA_MODELS_RAYCHUNK, 0);
+  int hits = 0;
+  for (int i = 0; i < count; i++) hits += job.results[i*6] >= 0;
+  lua_pushinteger(L, hits);
+  return 2;
+}
+
+luaL_Reg luaray_models[] = {
+  // Mesh generation functions
+  {"GenMeshHeightmap",      lua_models_GenMeshHeightmap},
+  {"GenMeshPlane",          lua_models_GenMeshPlane},
+  {"GenMeshCube",           lua_models_GenMeshCube},
+  {"GenMeshSphere",         lua_models_GenMeshSphere},
+  // Model drawing functions
+  {"DrawModel",             lua_models_DrawModel},
+  {"DrawModelInstanced",    lua_models_DrawModelInstanced},
+  {"CullInstances",         lua_models_CullInstances},
+  {"SetCullingMode",        lua_models_SetCullingMode},
+  // Model animations functions
+  {"LoadModelAnimations",   lua_models_LoadModelAnimations},
+  {"UpdateModelAnimation",  lua_models_UpdateModelAnimation},
+  {"IsModelAnimationValid", lua_models_IsModelAnimationValid},
+  {"SetSkinningMode",       lua_models_SetSkinningMode},
+  {"SetSkinningThreads",    lua_models_SetSkinningThreads},
+  {"SetPoseCache",          lua_models_SetPoseCache},
+  {"GetPoseCacheStats",     lua_models_GetPoseCacheStats},
+  // Collision detection functions
+  {"GetCollisionRayModel",  lua_models_GetCollisionRayModel},
+  {"RaycastModel",          lua_models_RaycastModel},
+  {"RaycastModelMany",      lua_models_RaycastModelMany},
+  {NULL, NULL}
+};
+
+
+// ASYNC
+/*!MD
+## Async
+Files are read and decoded by pool threads (CPU count - 1 by default), Lua objects are created on main thread.
+```lua
+local task = rl.async.LoadImage("hero.png", function(img, err) print("loaded", img, err) end)
+-- per frame
+rl.async.Update() -- calls callbacks of finished tasks
+
+-- inside of coroutine
+local img, err = rl.async.Await(rl.async.LoadImage("level.png"))
+```
+
+#### LoadImage
+```lua
+AsyncTask Task = rl.async.LoadImage(string Filename[, function Callback(Image Img, string Error)])
+```
+Load image from file by pool thread, see [AsyncTask](#AsyncTask).
+Formats which are not supported by stb_image (DDS, KTX etc) are loaded by raylib on main thread, when result is requested.
+Callback is called by [rl.async.Update](#Update), task is not collected until then.
+*/
+const char * lua_async_pendingKey = "raylib_luamore.async";
+
+// Stores callback from stack index 2 for task on top of the stack,
+// several callbacks of one task are collected to table
+void lua_async_SetCallback(lua_State *L){
+  if (lua_isnoneornil(L, 2)) return;
+  luaL_checktype(L, 2, LUA_TFUNCTION);
+  lua_getfield(L, LUA_REGISTRYINDEX, lua_async_pendingKey);
+  lua_pushvalue(L, -2);
+  lua_rawget(L, -2);
+  if (lua_isnil(L, -1)) {
+    lua_pop(L, 1);
+    lua_pushvalue(L, -2);
+    lua_pushvalue(L, 2);
+    lua_rawset(L, -3);
+  }
+  else {
+    if (lua_isfunction(L, -1)) {
+      lua_createtable(L, 2, 0);
+      lua_insert(L, -2);
+      lua_rawseti(L, -2, 1);
+      lua_pushvalue(L, -3);
+      lua_pushvalue(L, -2);
+      lua_rawset(L, -4);
+    }
+    lua_pushvalue(L, 2);
+    lua_rawseti(L, -2, lua_objlen(L, -2) + 1);
+    lua_pop(L, 1);
+  }
+  lua_pop(L, 1);
+}
+
+int lua_async_LoadImage(lua_State *L){
+  const char * fname = luaL_checkstring(L, 1);
+  _ptr_asynctask_Push(L, ASYNCTASK_IMAGE, fname);
+  lua_async_SetCallback(L);
+  return 1;
+}
+
+/*!MD
+#### LoadFileData
+```lua
+AsyncTask Task = rl.async.LoadFileData(string Filename[, function Callback(string Data, string Error)])
+```
+Load file contents as string by pool thread, see [AsyncTask](#AsyncTask).
+*/
+int lua_async_LoadFileData(lua_State *L){
+  const char * fname = luaL_checkstring(L, 1);
+  _ptr_asynctask_Push(L, ASYNCTASK_FILEDATA, fname);
+  lua_async_SetCallback(L);
+  return 1;
+}
+
+/*!MD
+#### Await
+```lua
+Image/string Result, string Error = rl.async.Await(AsyncTask Task)
+```
+Yield current coroutine (passing Task to resume caller) until task is finished, then return its result.
+Outside of coroutines blocks main thread as AsyncTask:wait.
+*/
+const char * lua_async_awaitSource =
+  "local isDone, get, wait, incoroutine, yield = ...\n"
+  "return function(task)\n"
+  "  if not incoroutine() then return wait(task) end\n"
+  "  while not isDone(task) do yield(task) end\n"
+  "  return get(task)\n"
+  "end\n";
+
+int lua_async_InCoroutine(lua_State *L){
+  lua_pushboolean(L, !lua_pushthread(L));
+  return 1;
+}
+
+int lua_async_Yield(lua_State *L){
+  return lua_yield(L, lua_gettop(L));
+}
+
+// Sets Await function to the table on top of the stack
+void lua_async_pushAwait(lua_State *L){
+  if (luaL_loadbuffer(L, lua_async_awaitSource, strlen(lua_async_awaitSource), "=rl.async.Await")) lua_error(L);
+  lua_pushcfunction(L, lua_class_asynctask_IsDone);
+  lua_pushcfunction(L, lua_class_asynctask_Get);
+  lua_pushcfunction(L, lua_class_asynctask_Wait);
+  lua_pushcfunction(L, lua_async_InCoroutine);
+  lua_pushcfunction(L, lua_async_Yield);
+  lua_call(L, 5, 1);
+  lua_setfield(L, -2, "Await");
+}
+
+/*!MD
+#### Update
+```lua
+integer Count = rl.async.Update()
+```
+Call callbacks of finished tasks, returns count of called callbacks.
+Should be called once per frame if callbacks are used.
+*/
+int lua_async_Update(lua_State *L){
+  lua_settop(L, 0);
+  lua_getfield(L, LUA_REGISTRYINDEX, lua_async_pendingKey); // 1: pending
+  lua_newtable(L);                                           // 2: finished tasks
+  int count = 0;
+  lua_pushnil(L);
+  while (lua_next(L, 1)) {
+    AsyncTask * task = *(AsyncTask **)lua_touserdata(L, -2);
+    lua_pop(L, 1);
+    if (_ptr_asynctask_GetState(task) != ASYNCTASK_PENDING) {
+      lua_pushvalue(L, -1);
+      lua_rawseti(L, 2, ++count);
+    }
+  }
+  for (int i = 1; i <= count; i++) {
+    lua_rawgeti(L, 2, i);                                    // 3: task
+    lua_pushvalue(L, 3);
+    lua_rawget(L, 1);                                        // 4: callback
+    lua_pushvalue(L, 3);
+    lua_pushnil(L);
+    lua_rawset(L, 1);
+    AsyncTask * task = *(AsyncTask **)lua_touserdata(L, 3);
+    if (lua_istable(L, 4)) {
+      int n = lua_objlen(L, 4);
+      for (int j = 1; j <= n; j++) {
+        lua_rawgeti(L, 4, j);
+        lua_call(L, _ptr_asynctask_PushResult(L, task), 0);
+      }
+    }
+    else lua_call(L, _ptr_asynctask_PushResult(L, task), 0);
+    lua_settop(L, 2);
+  }
+  lua_pushinteger(L, count);
+  return 1;
+}
+
+/*!MD
+#### SetThreadCount
+```lua
+rl.async.SetThreadCount(integer Count)
+```
+Set count of pool threads, used by async loading and parallel image functions.
+Waits for the running jobs, queued ones are kept. 0 disables pool: jobs are executed immediately by calling thread.
+*/
+int lua_async_SetThreadCount(lua_State *L){
+  int count = luaL_checkinteger(L, 1);
+  ray_threads_setCount(count < 0 ? 0 : count);
+  return 0;
+}
+
+/*!MD
+#### GetThreadCount
+```lua
+integer Count = rl.async.GetThreadCount()
+```
+Get count of pool threads.
+*/
+int lua_async_GetThreadCount(lua_State *L){
+  lua_pushinteger(L, ray_threads_getCount());
+  return 1;
+}
+
+luaL_Reg luaray_async[] = {
+  {"LoadImage",      lua_async_LoadImage},
+  {"LoadFileData",   lua_async_LoadFileData},
+  {"Update",         lua_async_Update},
+  {"SetThreadCount", lua_async_SetThreadCount},
+  {"GetThreadCount", lua_async_GetThreadCount},
+  {NULL, NULL}
+};
+
+// ASSETS
+/*!MD
+## Assets
+Cache of loaded assets shared by all loading functions. Assets are found by file name (and loading parameters),
+the same object is returned while it is used, and unused ones are kept in cache within memory budget,
+so loading them again doesn't touch the disk (and GPU). The least recently used ones are freed first.
+Cached assets are dropped when their files are modified.
+Textures and fonts are shared objects, released by `:unload()` or garbage collector.
+Images are mutable, so cached one is decoded once and copied for each call.
+```lua
+rl.assets.SetBudget(64*1024*1024)
+local img = rl.assets.LoadImage("tiles.png")  -- decoded and cached
+local img2 = rl.assets.LoadImage("tiles.png") -- copy of cached image
+print(rl.assets.GetStats().hits) -- 1
+```
+
+#### LoadImage
+```lua
+Image Img = rl.assets.LoadImage(string Filename)
+```
+Load image from file through asset cache, returns copy of cached image.
+*/
+int lua_assets_LoadImage(lua_State *L){
+  const char * fname = luaL_checkstring(L, 1);
+  lua_settop(L, 1);
+  lua_pushfstring(L, "Image|%s", fname);
+  if (!_ptr_asset_Find(L, lua_tostring(L, 2), fname)) {
+    if (!FileExists(fname)) return luaL_error(L, "Can't load image \"%s\", file is not exists", fname);
+    Image image = LoadImage(fname);
+    if (!image.data) return luaL_error(L, "Can't load image \"%s\"", fname);
+    _ptr_assetentry_New(L, lua_tostring(L, 2), fname, image, NULL, 0);
+  }
+  AssetEntry * entry = (AssetEntry *)lua_touserdata(L, 3);
+  Image * img = (Image *)luax_newobject(L, "Image", sizeof(Image));
+  *img = ImageCopy(entry->image);
+  _ptr_asset_Release(L, 3, &entry->asset);
+  return 1;
+}
+
+/*!MD
+#### LoadImageAsync
+```lua
+AsyncTask Task = rl.assets.LoadImageAsync(string Filename[, function Callback(Image Img, string Error)])
+```
+Load image through asset cache by pool thread, same as [rl.async.LoadImage](#LoadImage).
+Cached image is returned by already finished task, and loading of the same file is started only once:
+tasks of other callers wait for the same job, and every task returns its own copy of the image.
+*/
+const char * lua_assets_loadingKey = "raylib_luamore.assetsLoading";
+
+// Keeps copy of loaded image in cache
+void lua_assets_StoreResult(lua_State *L, AsyncTask * task, int index){
+  int top = lua_gettop(L);
+  lua_pushfstring(L, "Image|%s", task->path);
+  Asset * asset = _ptr_asset_Lookup(L, lua_tostring(L, -1));
+  if (!asset || !asset->loaded) {
+    Image * img = (Image *)lua_touserdata(L, index);
+    AssetEntry * entry = _ptr_assetentry_New(L, lua_tostring(L, top + 1), task->path, ImageCopy(*img), NULL, 0);
+    _ptr_asset_Release(L, top + 2, &entry->asset);
+  }
+  lua_settop(L, top);
+}
+
+int lua_assets_LoadImageAsync(lua_State *L){
+  const char * fname = luaL_checkstring(L, 1);
+  lua_settop(L, 2);
+  lua_pushfstring(L, "Image|%s", fname);                // 3: key
+  if (_ptr_asset_Find(L, lua_tostring(L, 3), fname)) {  // 4: entry
+    AssetEntry * entry = (AssetEntry *)lua_touserdata(L, 4);
+    AsyncTask * task = _ptr_asynctask_New(L, ASYNCTASK_IMAGE, fname);
+    task->image = ImageCopy(entry->image);
+    task->state = ASYNCTASK_DONE;
+    _ptr_asset_Release(L, 4, &entry->asset);
+    lua_async_SetCallback(L);
+    return 1;
+  }
+  _ptr_asset_PushTable(L, lua_assets_loadingKey, "v"); // 4: loading tasks
+  lua_getfield(L, 4, fname);
+  AsyncTask ** ptr = (AsyncTask **)lua_touserdata(L, -1);
+  // leader can be followed until its image is taken by its own result
+  if (!ptr || (*ptr)->result != LUA_NOREF) {
+    lua_pop(L, 1);
+    AsyncTask * task = _ptr_asynctask_Push(L, ASYNCTASK_IMAGE, fname);
+    task->onResult = lua_assets_StoreResult;
+    lua_pushvalue(L, -1);
+    lua_setfield(L, 4, fname);
+  }
+  else _ptr_asynctask_Follow(_ptr_asynctask_New(L, ASYNCTASK_IMAGE, fname), *ptr);
+  lua_async_SetCallback(L);
+  return 1;
+}
+
+/*!MD
+#### LoadFileData
+```lua
+string Data = rl.assets.LoadFileData(string Filename)
+```
+Load file contents as string through asset cache.
+*/
+int lua_assets_LoadFileData(lua_State *L){
+  const char * fname = luaL_checkstring(L, 1);
+  lua_settop(L, 1);
+  lua_pushfstring(L, "Data|%s", fname);
+  if (!_ptr_asset_Find(L, lua_tostring(L, 2), fname)) {
+    FILE * f = fopen(fname, "rb");
+    if (!f) return luaL_error(L, "Can't load file \"%s\", file is not exists", fname);
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    unsigned char * data = (unsigned char *)malloc(size > 0 ? size : 1);
+    int ok = size >= 0 && data && fread(data, 1, size, f) == (size_t)size;
+    fclose(f);
+    if (!ok) {
+      free(data);
+      return luaL_error(L, "Can't read file \"%s\"", fname);
+    }
+    _ptr_assetentry_New(L, lua_tostring(L, 2), fname, (Image){ 0 }, data, (int)size);
+  }
+  AssetEntry * entry = (AssetEntry *)lua_touserdata(L, 3);
+  lua_pushlstring(L, (const char *)entry->data, entry->size);
+  _ptr_asset_Release(L, 3, &entry->asset);
+  return 1;
+}
+
+/*!MD
+#### LoadTexture
+```lua
+Texture Tex = rl.assets.LoadTexture(string Filename)
+```
+Same as [rl.Texture](#Texture) constructor: texture is shared while it is not released by `Texture:unload()`.
+*/
+
+/*!MD
+#### LoadFont
+```lua
+Font Fnt = rl.assets.LoadFont(string Filename[, integer Size[, table/string Codepoints]])
+```
+Same as [rl.Font](#Font) constructor: font is shared while it is not released by `Font:unload()`.
+*/
+
+/*!MD
+#### SetBudget
+```lua
+integer PrevBudget = rl.assets.SetBudget(integer Bytes)
+```
+Set memory budget of unused assets kept in cache, sizes are estimated by pixel data size.
+Default budget is 0: assets are freed as soon as they are not used.
+*/
+int lua_assets_SetBudget(lua_State *L){
+  int budget = luaL_checkinteger(L, 1);
+  lua_pushinteger(L, lua_class_assets.budget);
+  lua_class_assets.budget = budget < 0 ? 0 : budget;
+  _ptr_asset_Trim(L);
+  return 1;
+}
+
+/*!MD
+#### GetStats
+```lua
+table Stats = rl.assets.GetStats()
+```
+Get asset cache counters: `hits`, `misses`, `evictions` (freed to fit budget), `invalidations` (dropped due to file changes),
+`count` and `bytes` of unused assets kept in cache, and `budget`.
+*/
+int lua_assets_GetStats(lua_State *L){
+  lua_createtable(L, 0, 7);
+  lua_pushinteger(L, lua_class_assets.hits);
+  lua_setfield(L, -2, "hits");
+  lua_pushinteger(L, lua_class_assets.misses);
+  lua_setfield(L, -2, "misses");
+  lua_pushinteger(L, lua_class_assets.evictions);
+  lua_setfield(L, -2, "evictions");
+  lua_pushinteger(L, lua_class_assets.invalidations);
+  lua_setfield(L, -2, "invalidations");
+  lua_pushinteger(L, lua_class_assets.retainedCount);
+  lua_setfield(L, -2, "count");
+  lua_pushinteger(L, lua_class_assets.retainedBytes);
+  lua_setfield(L, -2, "bytes");
+  lua_pushinteger(L, lua_class_assets.budget);
+  lua_setfield(L, -2, "budget");
+  return 1;
+}
+
+/*!MD
+#### Clear
+```lua
+rl.assets.Clear()
+```
+Free all unused assets kept in cache.
+*/
+int lua_assets_Clear(lua_State *L){
+  int budget = lua_class_assets.budget;
+  lua_class_assets.budget = 0;
+  _ptr_asset_Trim(L);
+  lua_class_assets.budget = budget;
+  return 0;
+}
+
+luaL_Reg luaray_assets[] = {
+  {"LoadImage",      lua_assets_LoadImage},
+  {"LoadImageAsync", lua_assets_LoadImageAsync},
+  {"LoadFileData",   lua_assets_LoadFileData},
+  {"LoadTexture",    lua_class_texture_new},
+  {"LoadFont",       lua_class_font_new},
+  {"SetBudget",      lua_assets_SetBudget},
+  {"GetStats",       lua_assets_GetStats},
+  {"Clear",          lua_assets_Clear},
+  {NULL, NULL}
+};
+
+// WATCH
+/*!MD
+## Watch
+File change notifications for hot reloading: inotify on Linux, polling of modification times elsewhere.
+Textures and fonts loaded from changed files are reloaded in place: the same objects get new data,
+so references kept by scripts stay valid. Other cached assets of changed files are dropped from [asset cache](#Assets).
+Paths are compared as strings, so assets should be loaded by the same paths as used for watching.
+```lua
+rl.watch.Add("res")          -- all files in directory
+rl.watch.Add("scripts/ui.lua")
+-- per frame
+for _, path in ipairs(rl.watch.Update() or {}) do
+  if path:match("%.lua$") then dofile(path) end
+end
+```
+
+#### Add
+```lua
+boolean Ok = rl.watch.Add(string Path)
+```
+Start watching of file or directory, files in directory are reported as "Path/name" (subdirectories are not watched).
+Returns false if path is not exists or can't be watched.
+*/
+int lua_watch_Add(lua_State *L){
+  lua_pushboolean(L, ray_watch_add(luaL_checkstring(L, 1)));
+  return 1;
+}
+
+/*!MD
+#### Remove
+```lua
+boolean Ok = rl.watch.Remove(string Path)
+```
+Stop watching of path, returns false if it is not watched.
+*/
+int lua_watch_Remove(lua_State *L){
+  lua_pushboolean(L, ray_watch_remove(luaL_checkstring(L, 1)));
+  return 1;
+}
+
+/*!MD
+#### Clear
+```lua
+rl.watch.Clear()
+```
+Stop watching of all paths.
+*/
+int lua_watch_Clear(lua_State *L){
+  ray_watch_clear();
+  return 0;
+}
+
+/*!MD
+#### Update
+```lua
+table Changed = rl.watch.Update()
+```
+Get list of files changed since previous call (each path is listed once) and reload their assets,
+returns nil if nothing is changed. Should be called once per frame, outside of drawing.
+Without inotify only [budget](#SetPollBudget) of paths is checked per call, every file of watched directory is
+compared with modification time seen by previous check, so files edited in place are reported too.
+*/
+
+// Collects unique paths: 1 - list, 2 - set
+void lua_watch_Report(const char * path, void * data){
+  lua_State * L = (lua_State *)data;
+  if (!lua_gettop(L)) {
+    lua_newtable(L);
+    lua_newtable(L);
+  }
+  lua_pushstring(L, path);
+  lua_rawget(L, 2);
+  int found = lua_toboolean(L, -1);
+  lua_pop(L, 1);
+  if (found) return;
+  lua_pushstring(L, path);
+  lua_pushboolean(L, 1);
+  lua_rawset(L, 2);
+  lua_pushstring(L, path);
+  lua_rawseti(L, 1, lua_objlen(L, 1) + 1);
+}
+
+int lua_watch_Update(lua_State *L){
+  lua_settop(L, 0);
+  ray_watch_poll(lua_watch_Report, L);
+  if (!lua_gettop(L)) return 0;
+  for (int i = 1, count = lua_objlen(L, 1); i <= count; i++) {
+    lua_rawgeti(L, 1, i);
+    _ptr_asset_Reload(L, lua_tostring(L, -1));
+    lua_pop(L, 1);
+  }
+  lua_settop(L, 1);
+  return 1;
+}
+
+/*!MD
+#### IsNative
+```lua
+boolean Native = rl.watch.IsNative()
+```
+Check if changes are reported by system (inotify), false if polling is used.
+*/
+int lua_watch_IsNative(lua_State *L){
+  lua_pushboolean(L, ray_watch_isNative());
+  return 1;
+}
+
+/*!MD
+#### SetPollBudget
+```lua
+integer PrevBudget = rl.watch.SetPollBudget(integer Count)
+```
+Set count of paths checked per [rl.watch.Update](#Update-1) call when polling is used (64 by default),
+all paths are checked in turn over several calls.
+*/
+int lua_watch_SetPollBudget(lua_State *L){
+  int budget = luaL_checkinteger(L, 1);
+  lua_pushinteger(L, ray_watch_pollBudget);
+  ray_watch_pollBudget = budget < 1 ? 1 : budget;
+  return 1;
+}
+
+luaL_Reg luaray_watch[] = {
+  {"Add",           lua_watch_Add},
+  {"Remove",        lua_watch_Remove},
+  {"Clear",         lua_watch_Clear},
+  {"Update",        lua_watch_Update},
+  {"IsNative",      lua_watch_IsNative},
+  {"SetPollBudget", lua_watch_SetPollBudget},
+  {NULL, NULL}
+};
+
+// ARCHIVE
+/*!MD
+## Archive
+Packed archives: many small files stored in one file with sorted index, loaded by one mapping instead of
+opening and reading every file. Entries may be compressed (DEFLATE), stored as is otherwise,
+so images are decoded right from mapped memory. See [Archive](#Archive-1) class.
+```lua
+rl.archive.Pack("data.pak", {"res/hero.png", ["ui/font.ttf"] = "res/fonts/main.ttf"})
+local pak = rl.archive.Open("data.pak")
+local img = pak:loadImage("res/hero.png")
+```
+Packer script for directories is `build/pack.lua`.
+
+#### Open
+```lua
+Archive Arc = rl.archive.Open(string Filename)
+```
+Open (map to memory) archive created by [rl.archive.Pack](#Pack).
+*/
+int lua_archive_Open(lua_State *L){
+  const char * fname = luaL_checkstring(L, 1);
+  ray_archive * archive = (ray_archive *)luax_newobject(L, "Archive", sizeof(ray_archive));
+  const char * error = ray_archive_open(archive, fname);
+  if (error) return luaL_error(L, "Can't open archive \"%s\", %s", fname, error);
+  return 1;
+}
+
+/*!MD
+#### Pack
+```lua
+integer Size = rl.archive.Pack(string Filename, table Files[, boolean Compress])
+```
+Create archive from files and return its size. Files table contains paths (entries are named by them)
+or `[string Name] = string Path` pairs. If Compress is true, entries are compressed when it makes them smaller,
+already compressed formats (PNG, OGG etc) should be packed without it for faster loading.
+*/
+typedef struct {
+  const char * name;
+  size_t       nameLength;
+  const char * path;
+  unsigned int offset, size, rawSize, flags;
+} lua_archive_Item;
+
+int lua_archive_CompareItems(const void * a, const void * b){
+  const lua_archive_Item * x = (const lua_archive_Item *)a, * y = (const lua_archive_Item *)b;
+  return ray_archive_compare(x->name, x->nameLength, y->name, y->nameLength);
+}
+
+// Writes entries data, index and header, returns error message or NULL
+const char * lua_archive_Write(FILE * f, lua_archive_Item * items, int count, int compress, const char ** failed){
+  unsigned char record[RAY_ARCHIVE_RECORD];
+  unsigned long long offset = RAY_ARCHIVE_HEADER;
+  memset(record, 0, RAY_ARCHIVE_HEADER);
+  if (fwrite(record, 1, RAY_ARCHIVE_HEADER, f) != RAY_ARCHIVE_HEADER) return "can't write file";
+  for (int i = 0; i < count; i++) {
+    lua_archive_Item * item = &items[i];
+    *failed = item->path;
+    FILE * src = fopen(item->path, "rb");
+    if (!src) return "can't open file";
+    fseek(src, 0, SEEK_END);
+    long size = ftell(src);
+    fseek(src, 0, SEEK_SET);
+    unsigned char * data = (unsigned char *)malloc(size > 0 ? size : 1);
+    int ok = size >= 0 && data && fread(data, 1, size, src) == (size_t)size;
+    fclose(src);
+    if (!ok) {
+      free(data);
+      return "can't read file";
+    }
+    item->offset  = offset;
+    item->size    = size;
+    item->rawSize = size;
+    item->flags   = 0;
+    unsigned char * stored = data;
+    int packed = 0;
+    unsigned char * compressed = compress && size ? CompressData(data, size, &packed) : NULL;
+    if (compressed && packed < size) {
+      stored      = compressed;
+      item->size  = packed;
+      item->flags = RAY_ARCHIVE_COMPRESSED;
+    }
+    ok = fwrite(stored, 1, item->size, f) == item->size;
+    free(compressed);
+    free(data);
+    if (!ok) return "can't write file";
+    offset += item->size;
+    if (offset > 0xFFFFFFFFu) return "archive is too big";
+  }
+  *failed = NULL;
+  unsigned int nameOffset = 0;
+  for (int i = 0; i < count; i++) {
+    ray_archive_put32(record,      items[i].offset);
+    ray_archive_put32(record + 4,  items[i].size);
+    ray_archive_put32(record + 8,  items[i].rawSize);
+    ray_archive_put32(record + 12, nameOffset);
+    ray_archive_put32(record + 16, items[i].nameLength);
+    ray_archive_put32(record + 20, items[i].flags);
+    if (fwrite(record, 1, RAY_ARCHIVE_RECORD, f) != RAY_ARCHIVE_RECORD) return "can't write file";
+    nameOffset += items[i].nameLength;
+  }
+  for (int i = 0; i < count; i++)
+    if (fwrite(items[i].name, 1, items[i].nameLength, f) != items[i].nameLength) return "can't write file";
+  memcpy(record, RAY_ARCHIVE_MAGIC, 4);
+  ray_archive_put32(record + 4,  RAY_ARCHIVE_VERSION);
+  ray_archive_put32(record + 8,  count);
+  ray_archive_put32(record + 12, offset);
+  if (fseek(f, 0, SEEK_SET) || fwrite(record, 1, RAY_ARCHIVE_HEADER, f) != RAY_ARCHIVE_HEADER) return "can't write file";
+  return NULL;
+}
+
+int lua_archive_Pack(lua_State *L){
+  const char * fname = luaL_checkstring(L, 1);
+  luaL_checktype(L, 2, LUA_TTABLE);
+  int compress = lua_toboolean(L, 3);
+  int count = 0;
+  lua_pushnil(L);
+  while (lua_next(L, 2)) {
+    if (lua_type(L, -1) != LUA_TSTRING) return luaL_error(L, "Files table should contain paths");
+    count++;
+    lua_pop(L, 1);
+  }
+  lua_archive_Item * items = (lua_archive_Item *)malloc((count ? count : 1)*sizeof(lua_archive_Item));
+  if (!items) return luaL_error(L, "Can't allocate archive index");
+  int i = 0;
+  lua_pushnil(L);
+  while (lua_next(L, 2)) {
+    // strings are kept by Files table
+    items[i].path = lua_tostring(L, -1);
+    items[i].name = lua_type(L, -2) == LUA_TSTRING ? lua_tolstring(L, -2, &items[i].nameLength) : lua_tolstring(L, -1, &items[i].nameLength);
+    i++;
+    lua_pop(L, 1);
+  }
+  qsort(items, count, sizeof(lua_archive_Item), lua_archive_CompareItems);
+  for (i = 1; i < count; i++) {
+    if (!lua_archive_CompareItems(&items[i - 1], &items[i])) {
+      lua_pushstring(L, items[i].name);
+      free(items);
+      return luaL_error(L, "Can't pack archive \"%s\", duplicated entry \"%s\"", fname, lua_tostring(L, -1));
+    }
+  }
+  FILE * f = fopen(fname, "wb");
+  if (!f) {
+    free(items);
+    return luaL_error(L, "Can't pack archive \"%s\", can't create file", fname);
+  }
+  const char * failed = NULL;
+  const char * error = lua_archive_Write(f, items, count, compress, &failed);
+  long size = ftell(f);
+  fclose(f);
+  if (failed) lua_pushfstring(L, "Can't pack archive \"%s\", %s \"%s\"", fname, error, failed);
+  free(items);
+  if (failed) return lua_error(L);
+  if (error) return luaL_error(L, "Can't pack archive \"%s\", %s", fname, error);
+  lua_pushinteger(L, size);
+  return 1;
+}
+
+luaL_Reg luaray_archive[] = {
+  {"Open", lua_archive_Open},
+  {"Pack", lua_archive_Pack},
+  {NULL, NULL}
+};
+
+// STORAGE
+/*!MD
+## Storage
+Save data store: numbers, strings and booleans by string keys, kept in memory and appended to log file.
+Replaces [StorageSaveValue](#StorageSaveValue), which rewrites storage file for every value.
+See [Storage](#Storage-1) class.
+*/
+
+/*!MD
+#### Open
+```lua
+Storage Store = rl.storage.Open(string Filename[, integer BatchSize])
+```
+Open or create store. Changes are written when their size reaches BatchSize (64 KB by default, 0 writes every change).
+Unwritten changes are lost if program is stopped without Storage:flush or Storage:close.
+*/
+int lua_storage_Open(lua_State *L){
+  const char * fname = luaL_checkstring(L, 1);
+  int batchSize = luax_optinteger(L, 2, 64*1024);
+  lua_settop(L, 2);
+  Storage * store = (Storage *)luax_newobject(L, "Storage", sizeof(Storage));   // 3
+  memset(store, 0, sizeof(Storage));
+  store->batchSize = batchSize < 0 ? 0 : batchSize;
+  store->values    = LUA_NOREF;
+  store->path      = (char *)malloc(strlen(fname) + 1);
+  if (!store->path) return luaL_error(L, "Can't allocate storage");
+  strcpy(store->path, fname);
+  lua_newtable(L);                                                              // 4
+  lua_pushvalue(L, 4);
+  store->values = luaL_ref(L, LUA_REGISTRYINDEX);
+
+  ray_store_recover(fname);
+  FILE * f = fopen(fname, "rb");
+  size_t size = 0, valid = 0;
+  if (f) {
+    fseek(f, 0, SEEK_END);
+    long len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    unsigned char * data = (unsigned char *)malloc(len > 0 ? len : 1);
+    int ok = len >= 0 && data && fread(data, 1, len, f) == (size_t)len;
+    fclose(f);
+    if (!ok) {
+      free(data);
+      return luaL_error(L, "Can't read storage \"%s\"", fname);
+    }
+    _ptr_storage_Loader loader = {L, 4};
+    size  = len;
+    valid = ray_store_parse(data, size, _ptr_storage_Load, &loader);
+    free(data);
+    if (size && !valid) return luaL_error(L, "Can't open storage \"%s\", file has wrong format", fname);
+  }
+  lua_pushnil(L);
+  while (lua_next(L, 4)) {
+    store->liveBytes += ray_store_recordSize(lua_objlen(L, -2), _ptr_storage_ValueSize(L, -1));
+    store->count++;
+    lua_pop(L, 1);
+  }
+  store->fileBytes = valid;
+  if (!size || valid < size) {
+    // new file, or the last records are damaged by interrupted writing
+    store->file = fopen(fname, "ab");
+    if (!store->file) return luaL_error(L, "Can't create storage \"%s\"", fname);
+    _ptr_storage_Compact(L, store);
+  }
+  else {
+    store->file = fopen(fname, "ab");
+    if (!store->file) return luaL_error(L, "Can't open storage \"%s\" for writing", fname);
+  }
+  lua_settop(L, 3);
+  return 1;
+}
+
+luaL_Reg luaray_storage[] = {
+  {"Open", lua_storage_Open},
+  {NULL, NULL}
+};
+
+// FS
+/*!MD
+## Fs
+Walking of directories without limits of [GetDirectoryFiles](#GetDirectoryFiles): entries are read one by one
+with their type, size and modification time, recursively, filtered by extensions or glob patterns.
+See [FileWalker](#FileWalker) class.
+```lua
+for path in rl.fs.Walk("res/sprites", {extensions = "png"}) do
+  rl.assets.LoadTexture(path)
+end
+```
+
+Options table of walking functions:
+
+| **Option**    | description
+| :------------ | :-----------
+| recursive     | Enter subdirectories, true by default
+| depth         | Max depth of entered subdirectories (0 for entries of Path only), unlimited by default
+| directories   | Report directories too, false by default
+| extensions    | Extension or list of extensions of reported entries (like "png" or ".png"), case is ignored
+| pattern       | Glob pattern or list of patterns of reported entries, case is ignored: `*` matches any characters except `/`, `**` matches `/` too, `?` matches one character. Patterns with `/` are matched against path relative to Path, other ones against names
+
+Entries are reported if they match any extension or pattern. Symbolic links to directories are entered unless they point to
+their parents, Windows junctions are not entered.
+*/
+void lua_fs_AddPatterns(lua_State *L, ray_fs_walker * walker, const char * field, const char * prefix){
+  lua_getfield(L, 2, field);
+  int n = lua_istable(L, -1) ? lua_objlen(L, -1) : 1;
+  for (int i = 1; i <= n; i++) {
+    if (lua_istable(L, -1)) lua_rawgeti(L, -1, i);
+    else lua_pushvalue(L, -1);
+    if (!lua_isnil(L, -1)) {
+      const char * pattern = lua_tostring(L, -1);
+      if (!pattern) luaL_error(L, "Walk option \"%s\" should be string or table of strings", field);
+      if (*prefix && *pattern == '.') pattern++;
+      lua_pushfstring(L, "%s%s", prefix, pattern);
+      int ok = ray_fs_addPattern(walker, lua_tostring(L, -1));
+      lua_pop(L, 1);
+      if (!ok) luaL_error(L, "Can't allocate walk patterns");
+    }
+    lua_pop(L, 1);
+  }
+  lua_pop(L, 1);
+}
+
+// Reads options from stack index 2 to walker, it should be closed on errors
+void lua_fs_Options(lua_State *L, ray_fs_walker * walker){
+  if (lua_isnoneornil(L, 2)) return;
+  luaL_checktype(L, 2, LUA_TTABLE);
+  lua_getfield(L, 2, "recursive");
+  if (!lua_isnil(L, -1) && !lua_toboolean(L, -1)) walker->maxDepth = 0;
+  lua_getfield(L, 2, "depth");
+  if (!lua_isnil(L, -1)) walker->maxDepth = luaL_checkinteger(L, -1);
+  lua_getfield(L, 2, "directories");
+  walker->directories = lua_toboolean(L, -1);
+  lua_pop(L, 3);
+  lua_fs_AddPatterns(L, walker, "extensions", "*.");
+  lua_fs_AddPatterns(L, walker, "pattern", "");
+}
+
+/*!MD
+#### Walk
+```lua
+FileWalker Walker = rl.fs.Walk(string Path[, table Options])
+```
+Start walking of directory, see [FileWalker](#FileWalker). Error is raised if directory can't be opened.
+*/
+int lua_fs_Walk(lua_State *L){
+  const char * dpath = luaL_checkstring(L, 1);
+  ray_fs_walker * walker = (ray_fs_walker *)luax_newobject(L, "FileWalker", sizeof(ray_fs_walker));
+  ray_fs_init(walker);
+  lua_fs_Options(L, walker);
+  if (!ray_fs_open(walker, dpath)) {
+    ray_fs_close(walker);
+    return luaL_error(L, "Can't open directory \"%s\"", dpath);
+  }
+  return 1;
+}
+
+/*!MD
+#### WalkAsync
+```lua
+AsyncTask Task = rl.fs.WalkAsync(string Path[, table Options[, function Callback(table Entries, string Error)]])
+```
+Walk directory by pool thread, see [AsyncTask](#AsyncTask). Result is list of entries like
+`{path = "res/hero.png", type = "file", size = 1024, modTime = 1700000000}`.
+*/
+int lua_fs_WalkAsync(lua_State *L){
+  const char * dpath = luaL_checkstring(L, 1);
+  lua_settop(L, 3);
+  AsyncTask * task = _ptr_asynctask_New(L, ASYNCTASK_WALK, dpath);
+  task->walker = (ray_fs_walker *)malloc(sizeof(ray_fs_walker));
+  if (!task->walker) return luaL_error(L, "Can't allocate walker");
+  ray_fs_init(task->walker);
+  lua_fs_Options(L, task->walker);
+  // callback is expected at index 2
+  lua_remove(L, 2);
+  task->refs = 2;
+  ray_threads_push(_ptr_asynctask_Job, task);
+  lua_async_SetCallback(L);
+  return 1;
+}
+
+luaL_Reg luaray_fs[] = {
+  {"Walk",      lua_fs_Walk},
+  {"WalkAsync", lua_fs_WalkAsync},
+  {NULL, NULL}
+};
+
+// PHYSICS
+/*!MD
+## Physics
+2D physics of polygon bodies (port of Physac): bodies are created in one shared world and stepped with fixed
+time step. Pairs of bodies for collision tests are found by spatial hash grid, so step time grows with count of
+touching bodies, not with count of all pairs. Bodies and contacts have no count limit.
+```lua
+local ground = rl.physics.CreatePhysicsBodyRectangle(rl.Vector2(400, 500), 800, 20, 10)
+ground:setEnabled(false)
+for i = 1, 100 do rl.physics.CreatePhysicsBodyCircle(rl.Vector2(math.random(800), 0), 10, 1) end
+-- every frame
+rl.physics.RunPhysicsStep(rl.core.GetFrameTime())
+for i = 1, rl.physics.GetPhysicsBodiesCount() do
+  local body = rl.physics.GetPhysicsBody(i)
+  -- draw shape by body:getVertex(1 .. body:getVertexCount())
+end
+```
+#### InitPhysics
+```lua
+rl.physics.InitPhysics()
+```
+Destroy all bodies and reset world settings to defaults (world is ready without this call).
+*/
+int lua_physics_InitPhysics(lua_State *L){
+  _ptr_physicsbody_DestroyAll(L);
+  ray_physics_worldDefaults(&ray_physics_shared);
+  return 0;
+}
+
+/*!MD
+#### ClosePhysics
+```lua
+rl.physics.ClosePhysics()
+```
+Destroy all bodies and free memory of world.
+*/
+int lua_physics_ClosePhysics(lua_State *L){
+  _ptr_physicsbody_DestroyAll(L);
+  ray_physics_worldFree(&ray_physics_shared);
+  return 0;
+}
+
+/*!MD
+#### ResetPhysics
+```lua
+rl.physics.ResetPhysics()
+```
+Destroy all bodies, settings are kept.
+*/
+int lua_physics_ResetPhysics(lua_State *L){
+  _ptr_physicsbody_DestroyAll(L);
+  ray_physics_shared.accumulator = 0;
+  return 0;
+}
+
+/*!MD
+#### RunPhysicsStep
+```lua
+integer Steps = rl.physics.RunPhysicsStep([number Delta])
+```
+Run one step, or accumulate Delta seconds (like frame time) and run as many fixed steps as fit into
+accumulated time. Returns count of steps done.
+*/
+int lua_physics_RunPhysicsStep(lua_State *L){
+  int steps;
+  if (lua_isnoneornil(L, 1)) steps = ray_physics_step(&ray_physics_shared) ? 1 : -1;
+  else steps = ray_physics_advance(&ray_physics_shared, luaL_checknumber(L, 1)*1000);
+  if (steps < 0) return luaL_error(L, "Can't allocate physics contacts");
+  lua_pushinteger(L, steps);
+  return 1;
+}
+
+/*!MD
+#### SetPhysicsTimeStep
+```lua
+rl.physics.SetPhysicsTimeStep(number Milliseconds)
+```
+Set fixed time step, default is 1.666 ms (ten steps per 60 fps frame). Velocities are in units per millisecond.
+*/
+int lua_physics_SetPhysicsTimeStep(lua_State *L){
+  double step = luaL_checknumber(L, 1);
+  if (!(step > 0)) return luaL_argerror(L, 1, "time step should be positive");
+  ray_physics_shared.timeStep = step;
+  return 0;
+}
+
+/*!MD
+#### SetPhysicsGravity
+```lua
+rl.physics.SetPhysicsGravity(number X, number Y)
+```
+Default gravity is (0, 9.81).
+*/
+int lua_physics_SetPhysicsGravity(lua_State *L){
+  ray_physics_shared.gravity = (Vector2){ luaL_checknumber(L, 1), luaL_checknumber(L, 2) };
+  return 0;
+}
+
+/*!MD
+#### SetPhysicsIterations
+```lua
+rl.physics.SetPhysicsIterations(integer Iterations)
+```
+Set count of impulse iterations per step, default is 100. Less iterations are faster, but stacks are softer.
+*/
+int lua_physics_SetPhysicsIterations(lua_State *L){
+  int iterations = luaL_checkinteger(L, 1);
+  ray_physics_shared.iterations = iterations > 1 ? iterations : 1;
+  return 0;
+}
+
+/*!MD
+#### SetPhysicsBroadphase
+```lua
+string PrevMode = rl.physics.SetPhysicsBroadphase(string Mode[, number CellSize])
+```
+Select search of body pairs: "grid" - spatial hash grid (default), or "pairs" - test of every pair, as Physac does.
+Default CellSize is 0, cell is twice as large as average size of moving bodies then. Both modes give the
+same simulation, "pairs" is for comparison.
+*/
+const char * lua_physics_broadphaseModes[] = {"grid", "pairs"};
+
+int lua_physics_SetPhysicsBroadphase(lua_State *L){
+  const char * mode = luaL_checkstring(L, 1);
+  lua_pushstring(L, lua_physics_broadphaseModes[ray_physics_shared.broadphase]);
+  for (int i = 0; i < 2; i++) {
+    if (!strcmp(mode, lua_physics_broadphaseModes[i])) {
+      ray_physics_shared.broadphase = i;
+      ray_physics_shared.cellSize   = luax_optnumber(L, 2, 0);
+      return 1;
+    }
+  }
+  return luaL_error(L, "Unknown broadphase mode \"%s\"", mode);
+}
+
+/*!MD
+#### GetPhysicsStats
+```lua
+integer Pairs, integer Contacts, integer Steps = rl.physics.GetPhysicsStats()
+```
+Get count of body pairs tested by narrow phase and count of touching pairs at the last step, and count of all steps.
+*/
+int lua_physics_GetPhysicsStats(lua_State *L){
+  lua_pushinteger(L, ray_physics_shared.tested);
+  lua_pushinteger(L, ray_physics_shared.manifoldCount);
+  lua_pushnumber(L, (lua_Number)ray_physics_shared.steps);
+  return 3;
+}
+
+/*!MD
+#### CreatePhysicsBodyCircle
+```lua
+PhysicsBody Body = rl.physics.CreatePhysicsBodyCircle(Vector2 Position, number Radius, number Density)
+```
+Circle is polygon of 24 sides. See [PhysicsBody](#PhysicsBody).
+*/
+int lua_physics_CreatePhysicsBodyCircle(lua_State *L){
+  Vector2 pos    = *(Vector2 *)luax_checkclass(L, 1, "Vector2");
+  float  radius  = luaL_checknumber(L, 2);
+  float  density = luaL_checknumber(L, 3);
+  PhysicsBodyObject * obj = _ptr_physicsbody_New(L);
+  ray_physics_bodyPolygon(&obj->body, pos, radius, RAY_PHYSICS_MAX_VERTICES, density);
+  _ptr_physicsbody_Add(L, obj);
+  return 1;
+}
+
+/*!MD
+#### CreatePhysicsBodyRectangle
+```lua
+PhysicsBody Body = rl.physics.CreatePhysicsBodyRectangle(Vector2 Position, number Width, number Height, number Density)
+```
+*/
+int lua_physics_CreatePhysicsBodyRectangle(lua_State *L){
+  Vector2 pos     = *(Vector2 *)luax_checkclass(L, 1, "Vector2");
+  float   width   = luaL_checknumber(L, 2);
+  float   height  = luaL_checknumber(L, 3);
+  float   density = luaL_checknumber(L, 4);
+  PhysicsBodyObject * obj = _ptr_physicsbody_New(L);
+  ray_physics_bodyRectangle(&obj->body, pos, width, height, density);
+  _ptr_physicsbody_Add(L, obj);
+  return 1;
+}
+
+/*!MD
+#### CreatePhysicsBodyPolygon
+```lua
+PhysicsBody Body = rl.physics.CreatePhysicsBodyPolygon(Vector2 Position, number Radius, integer Sides, number Density)
+```
+Regular polygon, Sides from 3 to 24.
+*/
+int lua_physics_CreatePhysicsBodyPolygon(lua_State *L){
+  Vector2 pos     = *(Vector2 *)luax_checkclass(L, 1, "Vector2");
+  float   radius  = luaL_checknumber(L, 2);
+  int     sides   = luaL_checkinteger(L, 3);
+  float   density = luaL_checknumber(L, 4);
+  if (sides < 3 || sides > RAY_PHYSICS_MAX_VERTICES) return luaL_argerror(L, 3, "sides should be from 3 to 24");
+  PhysicsBodyObject * obj = _ptr_physicsbody_New(L);
+  ray_physics_bodyPolygon(&obj->body, pos, radius, sides, density);
+  _ptr_physicsbody_Add(L, obj);
+  return 1;
+}
+
+/*!MD
+#### GetPhysicsBodiesCount
+```lua
+integer Count = rl.physics.GetPhysicsBodiesCount()
+```
+*/
+int lua_physics_GetPhysicsBodiesCount(lua_State *L){
+  lua_pushinteger(L, ray_physics_shared.bodyCount);
+  return 1;
+}
+
+/*!MD
+#### GetPhysicsBody
+```lua
+PhysicsBody Body = rl.physics.GetPhysicsBody(integer Index)
+```
+Get body by index from 1 to bodies count, nil if index is out of range. Destroying of body moves the last body
+to its index.
+*/
+int lua_physics_GetPhysicsBody(lua_State *L){
+  int index = luaL_checkinteger(L, 1);
+  if (index < 1 || index > ray_physics_shared.bodyCount) lua_pushnil(L);
+  else lua_rawgeti(L, LUA_REGISTRYINDEX, ((PhysicsBodyObject *)ray_physics_shared.bodies[index - 1])->ref);
+  return 1;
+}
+
+/*!MD
+#### DestroyPhysicsBody
+```lua
+rl.physics.DestroyPhysicsBody(PhysicsBody Body)
+```
+Remove body from world, methods of destroyed body raise error (except isValid).
+*/
+
+/*!MD
+#### PhysicsAddForce
+```lua
+rl.physics.PhysicsAddForce(PhysicsBody Body, Vector2 Force)
+```
+Same as [PhysicsBody:addForce](#PhysicsBodyaddForce).
+#### PhysicsAddTorque
+```lua
+rl.physics.PhysicsAddTorque(PhysicsBody Body, number Amount)
+```
+#### SetPhysicsBodyRotation
+```lua
+rl.physics.SetPhysicsBodyRotation(PhysicsBody Body, number Radians)
+```
+#### GetPhysicsShapeVerticesCount
+```lua
+integer Count = rl.physics.GetPhysicsShapeVerticesCount(PhysicsBody Body)
+```
+#### GetPhysicsShapeVertex
+```lua
+Vector2 Vertex = rl.physics.GetPhysicsShapeVertex(PhysicsBody Body, integer Index)
+```
+Vertex in world space, Index is from 1 to vertex count.
+*/
+
+luaL_Reg luaray_physics[] = {
+  {"InitPhysics",                  lua_physics_InitPhysics},
+  {"ClosePhysics",                 lua_physics_ClosePhysics},
+  {"ResetPhysics",                 lua_physics_ResetPhysics},
+  {"RunPhysicsStep",               lua_physics_RunPhysicsStep},
+  {"SetPhysicsTimeStep",           lua_physics_SetPhysicsTimeStep},
+  {"SetPhysicsGravity",            lua_physics_SetPhysicsGravity},
+  {"SetPhysicsIterations",         lua_physics_SetPhysicsIterations},
+  {"SetPhysicsBroadphase",         lua_physics_SetPhysicsBroadphase},
+  {"GetPhysicsStats",              lua_physics_GetPhysicsStats},
+  {"CreatePhysicsBodyCircle",      lua_physics_CreatePhysicsBodyCircle},
+  {"CreatePhysicsBodyRectangle",   lua_physics_CreatePhysicsBodyRectangle},
+  {"CreatePhysicsBodyPolygon",     lua_physics_CreatePhysicsBodyPolygon},
+  {"GetPhysicsBodiesCount",        lua_physics_GetPhysicsBodiesCount},
+  {"GetPhysicsBody",               lua_physics_GetPhysicsBody},
+  {"DestroyPhysicsBody",           lua_class_physicsbody_Destroy},
+  {"PhysicsAddForce",              lua_class_physicsbody_AddForce},
+  {"PhysicsAddTorque",             lua_class_physicsbody_AddTorque},
+  {"SetPhysicsBodyRotation",       lua_class_physicsbody_SetRotation},
+  {"GetPhysicsShapeVerticesCount", lua_class_physicsbody_GetVertexCount},
+  {"GetPhysicsShapeVertex",        lua_class_physicsbody_GetVertex},
+  {NULL, NULL}
+};
+
+// PROFILER
+/*!MD
+## Profiler
+Measures time and calls count of module functions and class methods (including metamethods),
+and counts created objects per class. Disabled profiler costs nothing: timing wrappers are installed
+into module and class tables by rl.profiler.Enable and removed by rl.profiler.Disable.
+Functions saved to local variables before enabling are not measured.
+Frame stats are finished by rl.core.EndDrawing (or rl.profiler.EndFrame).
+```lua
+rl.profiler.Enable(true)
+-- ... some frames
+local stats = rl.profiler.Get()
+for name, f in pairs(stats.functions) do print(name, f.calls, f.time, f.frameTime) end
+rl.profiler.DumpTrace("trace.json") -- open in chrome://tracing or Perfetto
+```
+
+#### Enable
+```lua
+rl.profiler.Enable([boolean Trace])
+```
+Start profiling, if Trace is true every call is recorded for rl.profiler.DumpTrace
+(up to 1048576 events, check `dropped` field of rl.profiler.Get result).
+*/
+int lua_profiler_Enable(lua_State *L){
+  luax_profiler_enable(L, 1, lua_toboolean(L, 1));
+  return 0;
+}
+
+/*!MD
+#### Disable
+```lua
+rl.profiler.Disable()
+```
+Stop profiling, collected stats are kept.
+*/
+int lua_profiler_Disable(lua_State *L){
+  luax_profiler_enable(L, 0, 0);
+  return 0;
+}
+
+/*!MD
+#### IsEnabled
+```lua
+boolean Enabled = rl.profiler.IsEnabled()
+```
+Check if profiler is enabled.
+*/
+int lua_profiler_IsEnabled(lua_State *L){
+  lua_pushboolean(L, luax_profiler.enabled);
+  return 1;
+}
+
+/*!MD
+#### Reset
+```lua
+rl.profiler.Reset()
+```
+Clear collected stats and trace events.
+*/
+int lua_profiler_Reset(lua_State *L){
+  luax_profiler_reset();
+  return 0;
+}
+
+/*!MD
+#### EndFrame
+```lua
+rl.profiler.EndFrame()
+```
+Finish current frame stats, for applications which don't use rl.core.EndDrawing.
+*/
+int lua_profiler_EndFrame(lua_State *L){
+  if (luax_profiler.enabled) luax_profiler_endframe();
+  return 0;
+}
+
+/*!MD
+#### Get
+```lua
+table Stats = rl.profiler.Get()
+--[[ Stats = {
+  frames      = integer, -- finished frames count
+  time        = number,  -- seconds since Enable or Reset
+  dropped     = integer, -- trace events over the limit
+  functions   = {["core.DrawText"] = {calls = integer, time = number, frameCalls = integer, frameTime = number}, ...},
+  allocations = {Vector2 = {count = integer, frameCount = integer}, ...},
+} ]]
+```
+Get collected stats, only called functions and allocated classes are listed.
+Time is in seconds, frame values are taken from the last finished frame.
+Methods are named as "Class:method", metamethods as "Class.__name".
+*/
+int lua_profiler_Get(lua_State *L){
+  lua_newtable(L);
+  luax_tsnumber(L, "frames",  luax_profiler.frames);
+  luax_tsnumber(L, "time",    luax_profiler.enabled ? luax_profiler_now() - luax_profiler.start : 0);
+  luax_tsnumber(L, "dropped", luax_profiler.eventsDropped);
+
+  lua_pushstring(L, "functions");
+  lua_newtable(L);
+  for (int i = 0; i < luax_profiler.entriesCount; i++) {
+    luax_ProfilerEntry * e = &luax_profiler.entries[i];
+    if (!e->calls) continue;
+    lua_pushfstring(L, "%s%s%s", e->owner, !e->isClass ? "." : e->name[0] == '_' ? "." : ":", e->name);
+    lua_newtable(L);
+    luax_tsnumber(L, "calls",      e->calls);
+    luax_tsnumber(L, "time",       e->time);
+    luax_tsnumber(L, "frameCalls", e->lastCalls);
+    luax_tsnumber(L, "frameTime",  e->lastTime);
+    lua_rawset(L, -3);
+  }
+  lua_rawset(L, -3);
+
+  lua_pushstring(L, "allocations");
+  lua_newtable(L);
+  for (int i = 0; i < luax_profiler.classesCount; i++) {
+    luax_ProfilerClass * c = &luax_profiler.classes[i];
+    if (!c->count) continue;
+    lua_pushstring(L, c->name);
+    lua_newtable(L);
+    luax_tsnumber(L, "count",      c->count);
+    luax_tsnumber(L, "frameCount", c->lastCount);
+    lua_rawset(L, -3);
+  }
+  lua_rawset(L, -3);
+  return 1;
+}
+
+/*!MD
+#### DumpTrace
+```lua
+boolean Success = rl.profiler.DumpTrace(string Filename)
+```
+Save recorded calls and frames as Chrome trace JSON (chrome://tracing, Perfetto etc).
+Profiler should be enabled with Trace flag.
+*/
+int lua_profiler_DumpTrace(lua_State *L){
+  const char * fname = luaL_checkstring(L, 1);
+  FILE * f = fopen(fname, "w");
+  if (!f) {
+    lua_pushboolean(L, 0);
+    return 1;
+  }
+  fprintf(f, "{\"traceEvents\":[\n");
+  for (int i = 0; i < luax_profiler.eventsCount; i++) {
+    luax_ProfilerEvent * ev = &luax_profiler.events[i];
+    const char * owner = "", * sep = "", * name = "frame";
+    if (ev->entry >= 0) {
+      luax_ProfilerEntry * e = &luax_profiler.entries[ev->entry];
+      owner = e->owner;
+      sep   = !e->isClass ? "." : e->name[0] == '_' ? "." : ":";
+      name  = e->name;
+    }
+    fprintf(f, "{\"name\":\"%s%s%s\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%d}%s\n",
+      owner, sep, name, ev->entry >= 0 ? "call" : "frame",
+      (ev->start - luax_profiler.start)*1e6, ev->duration*1e6, ev->entry >= 0 ? 1 : 0,
+      i + 1 < luax_profiler.eventsCount ? "," : "");
+  }
+  fprintf(f, "]}\n");
+  lua_pushboolean(L, !ferror(f));
+  fclose(f);
+  return 1;
+}
+
+luaL_Reg luaray_profiler[] = {
+  {"Enable",    lua_profiler_Enable},
+  {"Disable",   lua_profiler_Disable},
+  {"IsEnabled", lua_profiler_IsEnabled},
+  {"Reset",     lua_profiler_Reset},
+  {"EndFrame",  lua_profiler_EndFrame},
+  {"Get",       lua_profiler_Get},
+  {"DumpTrace", lua_profiler_DumpTrace},
+  {NULL, NULL}
+};
+
+#if defined(_WIN32) || defined(_WIN64)
+__declspec(dllexport)
+#endif
+int luaopen_raylib_luamore(lua_State *L) {
+  lua_newtable(L);
+  lua_class_register(L);
+  lua_newtable(L); lua_setfield(L, LUA_REGISTRYINDEX, lua_async_pendingKey);
+  
+  // modules
+  lua_pushstring(L, "core");     luax_pushfunctable(L, "core",     luaray_core);      lua_rawset(L, -3);
+  lua_pushstring(L, "shapes");   luax_pushfunctable(L, "shapes",   luaray_shapes);    lua_rawset(L, -3);
+  lua_pushstring(L, "textures"); luax_pushfunctable(L, "textures", luaray_textures);  lua_rawset(L, -3);
+  lua_pushstring(L, "text");     luax_pushfunctable(L, "text",     luaray_text);      lua_rawset(L, -3);
+  lua_pushstring(L, "models");   luax_pushfunctable(L, "models",   luaray_models);    lua_rawset(L, -3);
+  lua_pushstring(L, "async");    luax_pushfunctable(L, "async",    luaray_async);     lua_async_pushAwait(L); lua_rawset(L, -3);
+  lua_pushstring(L, "assets");   luax_pushfunctable(L, "assets",   luaray_assets);    lua_rawset(L, -3);
+  lua_pushstring(L, "watch");    luax_pushfunctable(L, "watch",    luaray_watch);     lua_rawset(L, -3);
+  lua_pushstring(L, "archive");  luax_pushfunctable(L, "archive",  luaray_archive);   lua_rawset(L, -3);
+  lua_pushstring(L, "storage");  luax_pushfunctable(L, "storage",  luaray_storage);   lua_rawset(L, -3);
+  lua_pushstring(L, "fs");       luax_pushfunctable(L, "fs",       luaray_fs);        lua_rawset(L, -3);
+  lua_pushstring(L, "physics");  luax_pushfunctable(L, "physics",  luaray_physics);   lua_rawset(L, -3);
+  lua_pushstring(L, "profiler"); luax_pushfunctable(L, "profiler", luaray_profiler);  lua_rawset(L, -3);
+
+  // enums
+  lua_pushstring(L, "ekey");     luaray_exportKeyboardKeys(L);           lua_rawset(L, -3);
+  lua_pushstring(L, "etexture"); luaray_exportTextureFormat(L);          lua_rawset(L, -3);
+
+  // LuaJIT FFI layer (raylib_luamore_ffi.lua) hook
+  luax_tsfunction(L, "_EnableCData", luax_enablecdata);
   
   return 1;
 }
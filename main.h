@@ -1,10 +1,17 @@
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+	#define _POSIX_C_SOURCE 200809L // POSIX declarations (clock_gettime etc) in strict C modes
+#endif
 #include "stdio.h"
 #include "stdlib.h"
 #include "string.h"
+#include "stddef.h"
 #include "lua/lua.h"
 #include "lua/lauxlib.h"
 #include "raylib/raylib.h"
 #include "raylib/raymath.h"
+#include "raylib/rlgl.h"
+#include "raylib/external/stb_image.h"
+#include "profiler.h"
 #define luax_tnfunction(L, index, func)  lua_pushnumber(L, index); lua_pushcfunction(L, func); lua_rawset(L, -3)
 #define luax_tsfunction(L, name,  func)  lua_pushstring(L, name);  lua_pushcfunction(L, func); lua_rawset(L, -3)
 #define luax_tnnumber(L,   index, value) lua_pushnumber(L, index); lua_pushnumber(L, value);   lua_rawset(L, -3)
@@ -52,8 +59,10 @@ void luax_newclass(lua_State *L, char * classname, luaL_Reg *func) {
 	lua_rawset(L, -3);               // mt, "__index", ct
 	// pass all methods that start with _ to the metatable, and all others to the index table
 	bool usedIndex = 0;              // Checks custom index function
+	luax_profiler_addclass(classname);
 	for (; func->name; func++) {
 		if (!strcmp(func->name, "__index")) usedIndex = true;
+		luax_profiler_add(classname, func->name, func->func, 1);
 		lua_pushstring(L, func->name);
 		lua_pushcfunction(L, func->func);
 		bool v = func->name[0] == '_'; // if it is metamethod
@@ -90,15 +99,183 @@ void luax_setclass(lua_State *L, const char *classname, int objidx) {
 void * luax_newobject(lua_State *L, const char *classname, int size) {
 	void * p = (void * )lua_newuserdata(L, size);
 	luax_setclass(L, classname, -1);
+	if (luax_profiler.enabled) luax_profiler_countobject(classname);
+	return p;
+}
+
+// LuaJIT cdata support: structs created by raylib_luamore_ffi.lua are passed to C functions as is.
+// FFI layer registers resolver function, which checks ctype of cdata and returns its payload address,
+// so cdata of other type (pointer, array, other struct) is rejected like wrong userdata.
+#define LUAX_TCDATA 10 // LuaJIT cdata type tag, not declared in lua.h
+int luax_cdataresolver = LUA_NOREF; // registry reference of resolver, LUA_NOREF if FFI layer is not loaded
+
+// Returns payload of cdata at index if its ctype matches classname, NULL otherwise.
+// For classname "float[]" cdata must be float array, *count is set to number of floats.
+void * luax_tocdata(lua_State * L, int index, const char * classname, int * count) {
+	if (luax_cdataresolver == LUA_NOREF || lua_type(L, index) != LUAX_TCDATA) return NULL;
+	if (index < 0 && index > LUA_REGISTRYINDEX) index = lua_gettop(L) + index + 1;
+	lua_rawgeti(L, LUA_REGISTRYINDEX, luax_cdataresolver);
+	lua_pushvalue(L, index);
+	lua_pushstring(L, classname);
+	lua_call(L, 2, 2);
+	void * p = lua_isnumber(L, -2) ? (void *)(size_t)lua_tonumber(L, -2) : NULL;
+	if (count) *count = (int)lua_tointeger(L, -1);
+	lua_pop(L, 2);
 	return p;
 }
 
 void * luax_checkclass(lua_State * L, int index, const char * classname) {
+	if (lua_type(L, index) == LUAX_TCDATA) {
+		void * p = luax_tocdata(L, index, classname, NULL);
+		if (!p) luaL_typerror(L, index, classname);
+		return p;
+	}
 	return luaL_checkudata(L, index, classname);
 }
 
+// Called by FFI layer with resolver function
+int luax_enablecdata(lua_State * L) {
+	luaL_checktype(L, 1, LUA_TFUNCTION);
+	luaL_unref(L, LUA_REGISTRYINDEX, luax_cdataresolver);
+	lua_pushvalue(L, 1);
+	luax_cdataresolver = luaL_ref(L, LUA_REGISTRYINDEX);
+	return 0;
+}
+
+// Field descriptors, used for fast __index/__newindex of struct-based classes.
+// Instead of strcmp chains every class with fields gets "fields_t" table (field name -> descriptor index),
+// so lookup is a single rawget by interned string, and methods are taken from class_t upvalue
+// without luaL_getmetafield call.
+enum {
+  LUAX_FIELD_FLOAT,
+  LUAX_FIELD_INT,
+  LUAX_FIELD_UCHAR,
+  LUAX_FIELD_CUSTOM, // uses getter function
+};
+#define LUAX_FIELD_READONLY 0x100
+
+typedef struct luax_Field {
+  const char * name;
+  size_t       offset;
+  int          type;
+  int       (* get)(lua_State *L, void * obj); // for LUAX_FIELD_CUSTOM, pushes value and returns number of results
+} luax_Field;
+
+#define luax_field(structtype, name, structfield, type) {name, offsetof(structtype, structfield), type, NULL}
+#define luax_fieldcustom(name, getter)                  {name, 0, LUAX_FIELD_CUSTOM | LUAX_FIELD_READONLY, getter}
+
+// upvalues: metatable, fields_t, class_t, fields, classname
+int luax_fieldindex(lua_State *L){
+  if (!lua_getmetatable(L, 1) || !lua_rawequal(L, -1, lua_upvalueindex(1)))
+    return luaL_typerror(L, 1, lua_tostring(L, lua_upvalueindex(5)));
+  lua_settop(L, 2);
+  lua_pushvalue(L, 2);
+  lua_rawget(L, lua_upvalueindex(2)); // fields_t[key]
+  if (lua_type(L, -1) != LUA_TNUMBER) {
+    lua_pushvalue(L, 2);
+    lua_rawget(L, lua_upvalueindex(3)); // class_t[key]
+    return 1;
+  }
+  const luax_Field * f   = (const luax_Field *)lua_touserdata(L, lua_upvalueindex(4)) + lua_tointeger(L, -1);
+  char *             obj = (char *)lua_touserdata(L, 1);
+  switch (f->type & 0xFF) {
+    case LUAX_FIELD_FLOAT:  lua_pushnumber(L,  *(float *)(obj + f->offset)); return 1;
+    case LUAX_FIELD_INT:    lua_pushinteger(L, *(int *)(obj + f->offset)); return 1;
+    case LUAX_FIELD_UCHAR:  lua_pushinteger(L, *(unsigned char *)(obj + f->offset)); return 1;
+    case LUAX_FIELD_CUSTOM: return f->get(L, obj);
+  }
+  return 0;
+}
+
+// upvalues: metatable, fields_t, class_t, fields, classname
+int luax_fieldnewindex(lua_State *L){
+  if (!lua_getmetatable(L, 1) || !lua_rawequal(L, -1, lua_upvalueindex(1)))
+    return luaL_typerror(L, 1, lua_tostring(L, lua_upvalueindex(5)));
+  lua_pushvalue(L, 2);
+  lua_rawget(L, lua_upvalueindex(2));
+  if (lua_type(L, -1) != LUA_TNUMBER) return 0;
+
+  const luax_Field * f   = (const luax_Field *)lua_touserdata(L, lua_upvalueindex(4)) + lua_tointeger(L, -1);
+  char *             obj = (char *)lua_touserdata(L, 1);
+  if (f->type & LUAX_FIELD_READONLY) return 0;
+  switch (f->type) {
+    case LUAX_FIELD_FLOAT:  *(float *)(obj + f->offset)         = luaL_checknumber(L, 3);  break;
+    case LUAX_FIELD_INT:    *(int *)(obj + f->offset)           = luaL_checkinteger(L, 3); break;
+    case LUAX_FIELD_UCHAR:  *(unsigned char *)(obj + f->offset) = luaL_checkinteger(L, 3); break;
+  }
+  return 0;
+}
+
+// Reference dispatchers of strcmp chains that classes used before fields_t: the object is checked by
+// luaL_checkudata, fields are compared in order, methods are taken by luax_getclasskey.
+// They are kept in mt.baseline_t for fields_benchmark.lua only, same upvalues as above.
+int luax_fieldindexstrcmp(lua_State *L){
+  if (lua_type(L, 2) != LUA_TSTRING) return 0;
+  char *       obj = (char *)luaL_checkudata(L, 1, lua_tostring(L, lua_upvalueindex(5)));
+  const char * key = luaL_checkstring(L, 2);
+  for (const luax_Field * f = (const luax_Field *)lua_touserdata(L, lua_upvalueindex(4)); f->name; f++) {
+    if (strcmp(key, f->name)) continue;
+    switch (f->type & 0xFF) {
+      case LUAX_FIELD_FLOAT:  lua_pushnumber(L,  *(float *)(obj + f->offset)); return 1;
+      case LUAX_FIELD_INT:    lua_pushinteger(L, *(int *)(obj + f->offset)); return 1;
+      case LUAX_FIELD_UCHAR:  lua_pushinteger(L, *(unsigned char *)(obj + f->offset)); return 1;
+      case LUAX_FIELD_CUSTOM: return f->get(L, obj);
+    }
+  }
+  luax_getclasskey(L, 1, 2);
+  return 1;
+}
+
+int luax_fieldnewindexstrcmp(lua_State *L){
+  if (lua_type(L, 2) != LUA_TSTRING) return 0;
+  char *       obj   = (char *)luaL_checkudata(L, 1, lua_tostring(L, lua_upvalueindex(5)));
+  const char * key   = luaL_checkstring(L, 2);
+  float        value = luaL_checknumber(L, 3);
+  for (const luax_Field * f = (const luax_Field *)lua_touserdata(L, lua_upvalueindex(4)); f->name; f++) {
+    if (strcmp(key, f->name)) continue;
+    if (f->type & LUAX_FIELD_READONLY) return 0;
+    switch (f->type) {
+      case LUAX_FIELD_FLOAT:  *(float *)(obj + f->offset)         = value; break;
+      case LUAX_FIELD_INT:    *(int *)(obj + f->offset)           = (int)value; break;
+      case LUAX_FIELD_UCHAR:  *(unsigned char *)(obj + f->offset) = (unsigned char)value; break;
+    }
+    return 0;
+  }
+  return 0;
+}
+
+// Replaces __index and __newindex of registered class by field dispatchers, fields array should be static and {NULL} terminated
+void luax_setclassfields(lua_State *L, const char * classname, const luax_Field * fields) {
+	luaL_getmetatable(L, classname); // mt
+	lua_newtable(L);                 // mt, ft
+	for (int i = 0; fields[i].name; i++) {
+		lua_pushstring(L, fields[i].name);
+		lua_pushinteger(L, i);
+		lua_rawset(L, -3);
+	}
+	lua_pushvalue(L, -1);
+	lua_setfield(L, -3, "fields_t"); // mt.fields_t = ft
+
+	const char * events[2]         = {"__index", "__newindex"};
+	lua_CFunction dispatchers[4]   = {luax_fieldindex, luax_fieldnewindex, luax_fieldindexstrcmp, luax_fieldnewindexstrcmp};
+	lua_newtable(L);                 // mt, ft, bt
+	for (int i = 0; i < 4; i++) {
+		lua_pushstring(L, events[i % 2]); // mt, ft, bt, event
+		lua_pushvalue(L, -4);            // mt, ft, bt, event, mt
+		lua_pushvalue(L, -4);            // mt, ft, bt, event, mt, ft
+		lua_getfield(L, -6, "class_t");  // mt, ft, bt, event, mt, ft, ct
+		lua_pushlightuserdata(L, (void *)fields);
+		lua_pushstring(L, classname);
+		lua_pushcclosure(L, dispatchers[i], 5);
+		lua_rawset(L, i < 2 ? -5 : -3);  // mt[event] = closure, or bt[event] for reference ones
+	}
+	lua_setfield(L, -3, "baseline_t"); // mt.baseline_t = bt
+	lua_pop(L, 2);
+}
+
 // compare metatables
 int luax_isclass(lua_State * L, int index, const char * classname) {
+	if (lua_type(L, index) == LUAX_TCDATA) return luax_tocdata(L, index, classname, NULL) != NULL;
 	if (lua_type(L, index) != LUA_TUSERDATA) return 0;
 	if (!lua_getmetatable(L, index)) return 0; // mt
 	luaL_getmetatable(L, classname);
@@ -109,9 +286,11 @@ int luax_isclass(lua_State * L, int index, const char * classname) {
 	return res;
 }
 
-void luax_pushfunctable(lua_State *L, luaL_Reg *func){
+void luax_pushfunctable(lua_State *L, const char * name, luaL_Reg *func){
 	lua_newtable(L);
+	luax_profiler_addtable(L, name);
 	for (; func->name; func++) {
+		luax_profiler_add(name, func->name, func->func, 0);
 		lua_pushstring(L,    func->name);
 		lua_pushcfunction(L, func->func);
 		lua_rawset(L, -3);
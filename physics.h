@@ -0,0 +1,665 @@
+// 2D rigid body physics, based on Physac 1.1 by Victor Fisac (zlib license), altered source:
+// bodies and contacts are kept in growing arrays instead of fixed pools, there is no physics thread, and pairs
+// for collision test are found by spatial hash grid instead of testing every pair of bodies.
+// All shapes are convex polygons (circle is 24-gon, as in Physac). Time step is in milliseconds.
+
+#include <float.h>
+
+#define RAY_PHYSICS_MAX_VERTICES 24
+#define RAY_PHYSICS_TIMESTEP     (1.0/60.0/10.0*1000)
+#define RAY_PHYSICS_ITERATIONS   100       // default count of impulse iterations per step
+#define RAY_PHYSICS_ALLOWANCE    0.05f     // penetration allowance
+#define RAY_PHYSICS_CORRECTION   0.4f      // penetration correction percentage
+#define RAY_PHYSICS_EPSILON      0.000001f
+#define RAY_PHYSICS_LARGE        64        // bodies covering more grid cells are tested against all bodies
+#define RAY_PHYSICS_CELL_LIMIT   (1 << 20) // cell coordinates are clamped, far cells are merged
+
+enum { RAY_PHYSICS_GRID, RAY_PHYSICS_PAIRS };
+
+typedef struct {
+  float m00, m01, m10, m11;
+} ray_physics_mat2;
+
+typedef struct {
+  int              index;             // position in world, -1 if body isn't added
+  int              enabled;           // dynamics state, collisions are detected anyway
+  Vector2          position, velocity, force;
+  float            angularVelocity, torque, orient;
+  float            inertia, inverseInertia, mass, inverseMass;
+  float            staticFriction, dynamicFriction, restitution;
+  int              useGravity, isGrounded, freezeOrient;
+  float            radius;            // distance of the farthest vertex from position
+  ray_physics_mat2 transform;         // rotation of vertices
+  int              vertexCount;
+  Vector2          positions[RAY_PHYSICS_MAX_VERTICES];
+  Vector2          normals[RAY_PHYSICS_MAX_VERTICES];
+} ray_physics_body;
+
+typedef struct {
+  ray_physics_body * bodyA, * bodyB;
+  float              penetration;
+  Vector2            normal;          // from A to B
+  Vector2            contacts[2];
+  int                contactsCount;
+  float              restitution, dynamicFriction, staticFriction;
+} ray_physics_manifold;
+
+typedef struct {
+  float minX, minY, maxX, maxY;
+  int   large;
+} ray_physics_box;
+
+typedef struct {
+  int cx, cy, body;
+} ray_physics_cell;
+
+typedef struct {
+  ray_physics_body     ** bodies;
+  int                     bodyCount, bodyCapacity;
+  ray_physics_manifold  * manifolds;
+  int                     manifoldCount, manifoldCapacity;
+  Vector2                 gravity;
+  double                  timeStep, accumulator;
+  int                     iterations;
+  int                     broadphase;
+  float                   cellSize;   // 0 for size by bodies
+  long long               steps;
+  int                     tested;     // pairs tested by narrow phase at last step
+  // broadphase scratch
+  ray_physics_box       * boxes;
+  int                   * large;
+  int                     boxCapacity;
+  ray_physics_cell      * cells, * sorted;
+  int                     cellCapacity;
+  int                   * buckets;    // bucket starts, one more than buckets count
+  int                     bucketCapacity;
+  unsigned long long    * pairs;      // body indices, lower one in high half
+  int                     pairCount, pairCapacity;
+} ray_physics_world;
+
+ray_physics_world ray_physics_shared = {
+  .gravity = { 0.0f, 9.81f }, .timeStep = RAY_PHYSICS_TIMESTEP, .iterations = RAY_PHYSICS_ITERATIONS,
+  .broadphase = RAY_PHYSICS_GRID,
+};
+
+// Grows array to count elements at least, returns 0 on allocation failure
+int ray_physics_reserve(void ** data, int * capacity, int count, int size){
+  if (count <= *capacity) return 1;
+  int n = *capacity > 0 ? *capacity*2 : 64;
+  while (n < count) n *= 2;
+  void * p = realloc(*data, (size_t)n*size);
+  if (!p) return 0;
+  *data     = p;
+  *capacity = n;
+  return 1;
+}
+
+// Math
+
+ray_physics_mat2 ray_physics_mat2Radians(float radians){
+  float c = cosf(radians), s = sinf(radians);
+  return (ray_physics_mat2){ c, -s, s, c };
+}
+
+ray_physics_mat2 ray_physics_mat2Transpose(ray_physics_mat2 m){
+  return (ray_physics_mat2){ m.m00, m.m10, m.m01, m.m11 };
+}
+
+Vector2 ray_physics_mat2Multiply(ray_physics_mat2 m, Vector2 v){
+  return (Vector2){ m.m00*v.x + m.m01*v.y, m.m10*v.x + m.m11*v.y };
+}
+
+// Cross product of scalar and vector
+Vector2 ray_physics_cross(float value, Vector2 v){
+  return (Vector2){ -value*v.y, value*v.x };
+}
+
+float ray_physics_crossVector2(Vector2 a, Vector2 b){
+  return a.x*b.y - a.y*b.x;
+}
+
+Vector2 ray_physics_normalize(Vector2 v){
+  float length = sqrtf(v.x*v.x + v.y*v.y);
+  if (length == 0) length = 1.0f;
+  return (Vector2){ v.x/length, v.y/length };
+}
+
+// Bodies
+
+// Computes normals, centroid, mass and inertia of body with vertices set, and resets its state
+void ray_physics_bodySetup(ray_physics_body * body, Vector2 pos, float density){
+  int n = body->vertexCount;
+  for (int i = 0; i < n; i++) {
+    Vector2 face = Vector2Subtract(body->positions[(i + 1) % n], body->positions[i]);
+    body->normals[i] = ray_physics_normalize((Vector2){ face.y, -face.x });
+  }
+  // triangles with third vertex at (0, 0)
+  Vector2 center = { 0.0f, 0.0f };
+  float area = 0.0f, inertia = 0.0f;
+  for (int i = 0; i < n; i++) {
+    Vector2 p1 = body->positions[i], p2 = body->positions[(i + 1) % n];
+    float cross        = ray_physics_crossVector2(p1, p2);
+    float triangleArea = cross/2;
+    area     += triangleArea;
+    center.x += triangleArea*(1.0f/3.0f)*(p1.x + p2.x);
+    center.y += triangleArea*(1.0f/3.0f)*(p1.y + p2.y);
+    float intx2 = p1.x*p1.x + p2.x*p1.x + p2.x*p2.x;
+    float inty2 = p1.y*p1.y + p2.y*p1.y + p2.y*p2.y;
+    inertia += (0.25f*(1.0f/3.0f)*cross)*(intx2 + inty2);
+  }
+  center.x *= 1.0f/area;
+  center.y *= 1.0f/area;
+  // centroid is (0, 0) in model space
+  body->radius = 0;
+  for (int i = 0; i < n; i++) {
+    body->positions[i] = Vector2Subtract(body->positions[i], center);
+    float length = Vector2Length(body->positions[i]);
+    if (length > body->radius) body->radius = length;
+  }
+  body->index           = -1;
+  body->enabled         = 1;
+  body->position        = pos;
+  body->velocity        = body->force = (Vector2){ 0.0f, 0.0f };
+  body->angularVelocity = body->torque = body->orient = 0.0f;
+  body->transform       = ray_physics_mat2Radians(0.0f);
+  body->mass            = density*area;
+  body->inverseMass     = body->mass != 0.0f ? 1.0f/body->mass : 0.0f;
+  body->inertia         = density*inertia;
+  body->inverseInertia  = body->inertia != 0.0f ? 1.0f/body->inertia : 0.0f;
+  body->staticFriction  = 0.4f;
+  body->dynamicFriction = 0.2f;
+  body->restitution     = 0.0f;
+  body->useGravity      = 1;
+  body->isGrounded      = 0;
+  body->freezeOrient    = 0;
+}
+
+// Regular polygon, sides from 3 to RAY_PHYSICS_MAX_VERTICES
+void ray_physics_bodyPolygon(ray_physics_body * body, Vector2 pos, float radius, int sides, float density){
+  body->vertexCount = sides;
+  for (int i = 0; i < sides; i++) {
+    float angle = 360.0f/sides*i*DEG2RAD;
+    body->positions[i] = (Vector2){ cosf(angle)*radius, sinf(angle)*radius };
+  }
+  ray_physics_bodySetup(body, pos, density);
+}
+
+void ray_physics_bodyRectangle(ray_physics_body * body, Vector2 pos, float width, float height, float density){
+  body->vertexCount  = 4;
+  body->positions[0] = (Vector2){  width/2, -height/2 };
+  body->positions[1] = (Vector2){  width/2,  height/2 };
+  body->positions[2] = (Vector2){ -width/2,  height/2 };
+  body->positions[3] = (Vector2){ -width/2, -height/2 };
+  ray_physics_bodySetup(body, pos, density);
+}
+
+void ray_physics_bodyRotation(ray_physics_body * body, float radians){
+  body->orient    = radians;
+  body->transform = ray_physics_mat2Radians(radians);
+}
+
+// Vertex in world space
+Vector2 ray_physics_bodyVertex(const ray_physics_body * body, int vertex){
+  return Vector2Add(body->position, ray_physics_mat2Multiply(body->transform, body->positions[vertex]));
+}
+
+// World
+
+void ray_physics_worldDefaults(ray_physics_world * world){
+  world->gravity     = (Vector2){ 0.0f, 9.81f };
+  world->timeStep    = RAY_PHYSICS_TIMESTEP;
+  world->accumulator = 0;
+  world->iterations  = RAY_PHYSICS_ITERATIONS;
+  world->broadphase  = RAY_PHYSICS_GRID;
+  world->cellSize    = 0;
+  world->steps       = 0;
+  world->tested      = 0;
+}
+
+// Frees storage, bodies are owned by caller and should be removed before
+void ray_physics_worldFree(ray_physics_world * world){
+  free(world->bodies);
+  free(world->manifolds);
+  free(world->boxes);
+  free(world->large);
+  free(world->cells);
+  free(world->sorted);
+  free(world->buckets);
+  free(world->pairs);
+  world->bodies    = NULL; world->bodyCount = world->bodyCapacity = 0;
+  world->manifolds = NULL; world->manifoldCount = world->manifoldCapacity = 0;
+  world->boxes     = NULL; world->large = NULL; world->boxCapacity = 0;
+  world->cells     = NULL; world->sorted = NULL; world->cellCapacity = 0;
+  world->buckets   = NULL; world->bucketCapacity = 0;
+  world->pairs     = NULL; world->pairCount = world->pairCapacity = 0;
+}
+
+// Returns 0 on allocation failure
+int ray_physics_add(ray_physics_world * world, ray_physics_body * body){
+  if (!ray_physics_reserve((void **)&world->bodies, &world->bodyCapacity, world->bodyCount + 1, sizeof(ray_physics_body *))) return 0;
+  body->index = world->bodyCount;
+  world->bodies[world->bodyCount++] = body;
+  return 1;
+}
+
+// Last body takes place of removed one
+void ray_physics_remove(ray_physics_world * world, ray_physics_body * body){
+  if (body->index < 0) return;
+  ray_physics_body * last = world->bodies[--world->bodyCount];
+  world->bodies[body->index] = last;
+  last->index = body->index;
+  body->index = -1;
+  // contacts of removed body are dropped till next step
+  world->manifoldCount = 0;
+}
+
+// Narrow phase: separating axis test of polygons and clipping of incident face (Physac SolvePolygonToPolygon)
+
+Vector2 ray_physics_support(const ray_physics_body * body, Vector2 dir){
+  float bestProjection = -FLT_MAX;
+  Vector2 bestVertex = { 0.0f, 0.0f };
+  for (int i = 0; i < body->vertexCount; i++) {
+    float projection = Vector2DotProduct(body->positions[i], dir);
+    if (projection > bestProjection) {
+      bestVertex     = body->positions[i];
+      bestProjection = projection;
+    }
+  }
+  return bestVertex;
+}
+
+float ray_physics_leastPenetration(int * faceIndex, const ray_physics_body * a, const ray_physics_body * b){
+  float bestDistance = -FLT_MAX;
+  int   bestIndex    = 0;
+  ray_physics_mat2 buT = ray_physics_mat2Transpose(b->transform);
+  for (int i = 0; i < a->vertexCount; i++) {
+    // face normal of A and its vertex in model space of B
+    Vector2 normal  = ray_physics_mat2Multiply(buT, ray_physics_mat2Multiply(a->transform, a->normals[i]));
+    Vector2 support = ray_physics_support(b, (Vector2){ -normal.x, -normal.y });
+    Vector2 vertex  = Vector2Add(ray_physics_mat2Multiply(a->transform, a->positions[i]), a->position);
+    vertex = ray_physics_mat2Multiply(buT, Vector2Subtract(vertex, b->position));
+    float distance = Vector2DotProduct(normal, Vector2Subtract(support, vertex));
+    if (distance > bestDistance) {
+      bestDistance = distance;
+      bestIndex    = i;
+    }
+  }
+  *faceIndex = bestIndex;
+  return bestDistance;
+}
+
+void ray_physics_incidentFace(Vector2 * v0, Vector2 * v1, const ray_physics_body * ref, const ray_physics_body * inc, int index){
+  // reference normal in incident's model space
+  Vector2 referenceNormal = ray_physics_mat2Multiply(ref->transform, ref->normals[index]);
+  referenceNormal = ray_physics_mat2Multiply(ray_physics_mat2Transpose(inc->transform), referenceNormal);
+  // the most anti-normal face
+  int incidentFace = 0;
+  float minDot = FLT_MAX;
+  for (int i = 0; i < inc->vertexCount; i++) {
+    float dot = Vector2DotProduct(referenceNormal, inc->normals[i]);
+    if (dot < minDot) {
+      minDot       = dot;
+      incidentFace = i;
+    }
+  }
+  *v0 = ray_physics_bodyVertex(inc, incidentFace);
+  *v1 = ray_physics_bodyVertex(inc, (incidentFace + 1) % inc->vertexCount);
+}
+
+int ray_physics_clip(Vector2 normal, float clip, Vector2 * faceA, Vector2 * faceB){
+  int sp = 0;
+  Vector2 out[2] = { *faceA, *faceB };
+  float distanceA = Vector2DotProduct(normal, *faceA) - clip;
+  float distanceB = Vector2DotProduct(normal, *faceB) - clip;
+  if (distanceA <= 0.0f) out[sp++] = *faceA;
+  if (distanceB <= 0.0f) out[sp++] = *faceB;
+  // points are on different sides of plane
+  if (distanceA*distanceB < 0.0f) {
+    float alpha = distanceA/(distanceA - distanceB);
+    out[sp++] = Vector2Add(*faceA, Vector2Scale(Vector2Subtract(*faceB, *faceA), alpha));
+  }
+  *faceA = out[0];
+  *faceB = out[1];
+  return sp;
+}
+
+// Fills contacts of manifold with bodies set, returns count of them
+int ray_physics_solve(ray_physics_manifold * manifold){
+  const ray_physics_body * a = manifold->bodyA;
+  const ray_physics_body * b = manifold->bodyB;
+  manifold->contactsCount = 0;
+  int faceA = 0, faceB = 0;
+  float penetrationA = ray_physics_leastPenetration(&faceA, a, b);
+  if (penetrationA >= 0.0f) return 0;
+  float penetrationB = ray_physics_leastPenetration(&faceB, b, a);
+  if (penetrationB >= 0.0f) return 0;
+
+  // reference face is on A unless B penetrates less (with bias), normal points from A to B anyway
+  const ray_physics_body * ref = a, * inc = b;
+  int referenceIndex = faceA, flip = 0;
+  if (!(penetrationA >= penetrationB*0.95f + penetrationA*0.01f)) {
+    ref            = b;
+    inc            = a;
+    referenceIndex = faceB;
+    flip           = 1;
+  }
+  Vector2 incidentFace[2];
+  ray_physics_incidentFace(&incidentFace[0], &incidentFace[1], ref, inc, referenceIndex);
+  Vector2 v1 = ray_physics_bodyVertex(ref, referenceIndex);
+  Vector2 v2 = ray_physics_bodyVertex(ref, (referenceIndex + 1) % ref->vertexCount);
+
+  Vector2 sidePlaneNormal = ray_physics_normalize(Vector2Subtract(v2, v1));
+  Vector2 refFaceNormal   = { sidePlaneNormal.y, -sidePlaneNormal.x };
+  float refC    = Vector2DotProduct(refFaceNormal, v1);
+  float negSide = -Vector2DotProduct(sidePlaneNormal, v1);
+  float posSide = Vector2DotProduct(sidePlaneNormal, v2);
+  // due to floating point error clipping may leave less than 2 points
+  if (ray_physics_clip((Vector2){ -sidePlaneNormal.x, -sidePlaneNormal.y }, negSide, &incidentFace[0], &incidentFace[1]) < 2) return 0;
+  if (ray_physics_clip(sidePlaneNormal, posSide, &incidentFace[0], &incidentFace[1]) < 2) return 0;
+
+  manifold->normal      = flip ? (Vector2){ -refFaceNormal.x, -refFaceNormal.y } : refFaceNormal;
+  manifold->penetration = 0.0f;
+  // keep points behind reference face, penetration is average
+  int count = 0;
+  for (int i = 0; i < 2; i++) {
+    float separation = Vector2DotProduct(refFaceNormal, incidentFace[i]) - refC;
+    if (separation <= 0.0f) {
+      manifold->contacts[count++] = incidentFace[i];
+      manifold->penetration -= separation;
+    }
+  }
+  if (count) manifold->penetration /= count;
+  manifold->contactsCount = count;
+  return count;
+}
+
+// Tests pair of bodies and keeps manifold if they touch. Returns 0 on allocation failure
+int ray_physics_collide(ray_physics_world * world, ray_physics_body * a, ray_physics_body * b){
+  ray_physics_manifold manifold = { a, b };
+  world->tested++;
+  if (!ray_physics_solve(&manifold)) return 1;
+  if (!ray_physics_reserve((void **)&world->manifolds, &world->manifoldCapacity, world->manifoldCount + 1, sizeof(ray_physics_manifold))) return 0;
+  world->manifolds[world->manifoldCount++] = manifold;
+  if (manifold.normal.y < 0) b->isGrounded = 1;
+  return 1;
+}
+
+// Broadphase: bodies are put by bounding boxes into cells of uniform grid, cells are hashed into buckets, pairs are
+// taken from the same cells. Pair is reported once, by cell holding minimal corner of boxes intersection.
+
+int ray_physics_cellOf(float v, float inverseSize){
+  float c = floorf(v*inverseSize);
+  if (!(c > -RAY_PHYSICS_CELL_LIMIT)) return -RAY_PHYSICS_CELL_LIMIT; // NaN too
+  if (c > RAY_PHYSICS_CELL_LIMIT) return RAY_PHYSICS_CELL_LIMIT;
+  return (int)c;
+}
+
+unsigned int ray_physics_cellHash(int cx, int cy, int mask){
+  return ((unsigned int)cx*73856093u ^ (unsigned int)cy*19349663u) & mask;
+}
+
+int ray_physics_overlap(const ray_physics_box * a, const ray_physics_box * b){
+  return a->minX <= b->maxX && b->minX <= a->maxX && a->minY <= b->maxY && b->minY <= a->maxY;
+}
+
+int ray_physics_pushPair(ray_physics_world * world, int a, int b){
+  if (!ray_physics_reserve((void **)&world->pairs, &world->pairCapacity, world->pairCount + 1, sizeof(unsigned long long))) return 0;
+  world->pairs[world->pairCount++] = a < b ? (unsigned long long)a << 32 | b : (unsigned long long)b << 32 | a;
+  return 1;
+}
+
+int ray_physics_comparePairs(const void * a, const void * b){
+  unsigned long long x = *(const unsigned long long *)a, y = *(const unsigned long long *)b;
+  return x < y ? -1 : x > y;
+}
+
+// Collects candidate pairs into world->pairs sorted by body indices (same order as testing of every pair),
+// returns 0 on allocation failure
+int ray_physics_gridPairs(ray_physics_world * world){
+  int count = world->bodyCount;
+  world->pairCount = 0;
+  if (!ray_physics_reserve((void **)&world->boxes, &world->boxCapacity, count, sizeof(ray_physics_box))) return 0;
+  int * large = (int *)realloc(world->large, world->boxCapacity*sizeof(int));
+  if (!large) return 0;
+  world->large = large;
+
+  // cell is twice as large as average dynamic body, so most bodies take 1 to 4 cells
+  float size = world->cellSize, sum = 0;
+  int dynamic = 0;
+  if (size <= 0) {
+    for (int i = 0; i < count; i++) {
+      if (world->bodies[i]->inverseMass == 0) continue;
+      sum += world->bodies[i]->radius*2;
+      dynamic++;
+    }
+    size = dynamic && sum > 0 ? sum/dynamic*2 : 64;
+  }
+  float inverseSize = 1.0f/size;
+
+  int entries = 0, largeCount = 0;
+  for (int i = 0; i < count; i++) {
+    const ray_physics_body * body = world->bodies[i];
+    ray_physics_box * box = &world->boxes[i];
+    box->minX = body->position.x - body->radius;
+    box->minY = body->position.y - body->radius;
+    box->maxX = body->position.x + body->radius;
+    box->maxY = body->position.y + body->radius;
+    long long cells = (long long)(ray_physics_cellOf(box->maxX, inverseSize) - ray_physics_cellOf(box->minX, inverseSize) + 1)*
+                      (ray_physics_cellOf(box->maxY, inverseSize) - ray_physics_cellOf(box->minY, inverseSize) + 1);
+    box->large = cells > RAY_PHYSICS_LARGE;
+    if (box->large) world->large[largeCount++] = i;
+    else entries += (int)cells;
+  }
+
+  int buckets = 16;
+  while (buckets < entries*2) buckets *= 2;
+  if (!ray_physics_reserve((void **)&world->cells, &world->cellCapacity, entries, sizeof(ray_physics_cell))) return 0;
+  ray_physics_cell * sorted = (ray_physics_cell *)realloc(world->sorted, world->cellCapacity*sizeof(ray_physics_cell));
+  if (!sorted) return 0;
+  world->sorted = sorted;
+  if (!ray_physics_reserve((void **)&world->buckets, &world->bucketCapacity, buckets + 1, sizeof(int))) return 0;
+
+  // counting sort of cells by buckets, bucket b takes sorted[buckets[b]] .. sorted[buckets[b + 1] - 1]
+  int n = 0;
+  memset(world->buckets, 0, (buckets + 1)*sizeof(int));
+  for (int i = 0; i < count; i++) {
+    const ray_physics_box * box = &world->boxes[i];
+    if (box->large) continue;
+    int x0 = ray_physics_cellOf(box->minX, inverseSize), x1 = ray_physics_cellOf(box->maxX, inverseSize);
+    int y0 = ray_physics_cellOf(box->minY, inverseSize), y1 = ray_physics_cellOf(box->maxY, inverseSize);
+    for (int cy = y0; cy <= y1; cy++) {
+      for (int cx = x0; cx <= x1; cx++) {
+        world->cells[n++] = (ray_physics_cell){ cx, cy, i };
+        world->buckets[ray_physics_cellHash(cx, cy, buckets - 1)]++;
+      }
+    }
+  }
+  for (int b = 0, total = 0; b < buckets; b++) {
+    total += world->buckets[b];
+    world->buckets[b] = total;
+  }
+  world->buckets[buckets] = entries;
+  for (int i = entries - 1; i >= 0; i--) {
+    ray_physics_cell cell = world->cells[i];
+    world->sorted[--world->buckets[ray_physics_cellHash(cell.cx, cell.cy, buckets - 1)]] = cell;
+  }
+
+  for (int b = 0; b < buckets; b++) {
+    for (int i = world->buckets[b]; i < world->buckets[b + 1]; i++) {
+      ray_physics_cell c1 = world->sorted[i];
+      const ray_physics_box * box1 = &world->boxes[c1.body];
+      for (int j = i + 1; j < world->buckets[b + 1]; j++) {
+        ray_physics_cell c2 = world->sorted[j];
+        if (c1.cx != c2.cx || c1.cy != c2.cy) continue;
+        if (world->bodies[c1.body]->inverseMass == 0 && world->bodies[c2.body]->inverseMass == 0) continue;
+        const ray_physics_box * box2 = &world->boxes[c2.body];
+        if (!ray_physics_overlap(box1, box2)) continue;
+        if (ray_physics_cellOf(fmaxf(box1->minX, box2->minX), inverseSize) != c1.cx) continue;
+        if (ray_physics_cellOf(fmaxf(box1->minY, box2->minY), inverseSize) != c1.cy) continue;
+        if (!ray_physics_pushPair(world, c1.body, c2.body)) return 0;
+      }
+    }
+  }
+
+  // large bodies (like ground) are tested against every body
+  for (int k = 0; k < largeCount; k++) {
+    int i = world->large[k];
+    for (int j = 0; j < count; j++) {
+      if (j == i || (world->boxes[j].large && j < i)) continue;
+      if (world->bodies[i]->inverseMass == 0 && world->bodies[j]->inverseMass == 0) continue;
+      if (!ray_physics_overlap(&world->boxes[i], &world->boxes[j])) continue;
+      if (!ray_physics_pushPair(world, i, j)) return 0;
+    }
+  }
+  qsort(world->pairs, world->pairCount, sizeof(unsigned long long), ray_physics_comparePairs);
+  return 1;
+}
+
+// Dynamics (Physac integrators, time is in milliseconds)
+
+void ray_physics_integrateForces(const ray_physics_world * world, ray_physics_body * body){
+  if (body->inverseMass == 0.0f || !body->enabled) return;
+  double dt = world->timeStep;
+  body->velocity.x += (body->force.x*body->inverseMass)*(dt/2.0);
+  body->velocity.y += (body->force.y*body->inverseMass)*(dt/2.0);
+  if (body->useGravity) {
+    body->velocity.x += world->gravity.x*(dt/1000/2.0);
+    body->velocity.y += world->gravity.y*(dt/1000/2.0);
+  }
+  if (!body->freezeOrient) body->angularVelocity += body->torque*body->inverseInertia*(dt/2.0);
+}
+
+void ray_physics_initializeManifold(const ray_physics_world * world, ray_physics_manifold * manifold){
+  ray_physics_body * a = manifold->bodyA, * b = manifold->bodyB;
+  manifold->restitution     = sqrtf(a->restitution*b->restitution);
+  manifold->staticFriction  = sqrtf(a->staticFriction*b->staticFriction);
+  manifold->dynamicFriction = sqrtf(a->dynamicFriction*b->dynamicFriction);
+  // resting collision (moved by gravity only) is performed without restitution
+  Vector2 g = Vector2Scale(world->gravity, world->timeStep/1000);
+  for (int i = 0; i < manifold->contactsCount; i++) {
+    Vector2 radiusA = Vector2Subtract(manifold->contacts[i], a->position);
+    Vector2 radiusB = Vector2Subtract(manifold->contacts[i], b->position);
+    Vector2 crossA  = ray_physics_cross(a->angularVelocity, radiusA);
+    Vector2 crossB  = ray_physics_cross(b->angularVelocity, radiusB);
+    Vector2 radiusV = { b->velocity.x + crossB.x - a->velocity.x - crossA.x, b->velocity.y + crossB.y - a->velocity.y - crossA.y };
+    if (Vector2DotProduct(radiusV, radiusV) < Vector2DotProduct(g, g) + RAY_PHYSICS_EPSILON) manifold->restitution = 0;
+  }
+}
+
+// Applies impulse to A negated and to B as is
+void ray_physics_applyImpulse(ray_physics_body * a, ray_physics_body * b, Vector2 radiusA, Vector2 radiusB, Vector2 impulse){
+  if (a->enabled) {
+    a->velocity.x -= a->inverseMass*impulse.x;
+    a->velocity.y -= a->inverseMass*impulse.y;
+    if (!a->freezeOrient) a->angularVelocity += a->inverseInertia*ray_physics_crossVector2(radiusA, (Vector2){ -impulse.x, -impulse.y });
+  }
+  if (b->enabled) {
+    b->velocity.x += b->inverseMass*impulse.x;
+    b->velocity.y += b->inverseMass*impulse.y;
+    if (!b->freezeOrient) b->angularVelocity += b->inverseInertia*ray_physics_crossVector2(radiusB, impulse);
+  }
+}
+
+Vector2 ray_physics_relativeVelocity(const ray_physics_body * a, const ray_physics_body * b, Vector2 radiusA, Vector2 radiusB){
+  Vector2 crossA = ray_physics_cross(a->angularVelocity, radiusA);
+  Vector2 crossB = ray_physics_cross(b->angularVelocity, radiusB);
+  return (Vector2){ b->velocity.x + crossB.x - a->velocity.x - crossA.x, b->velocity.y + crossB.y - a->velocity.y - crossA.y };
+}
+
+void ray_physics_integrateImpulses(ray_physics_manifold * manifold){
+  ray_physics_body * a = manifold->bodyA, * b = manifold->bodyB;
+  if (fabsf(a->inverseMass + b->inverseMass) <= RAY_PHYSICS_EPSILON) {
+    a->velocity = b->velocity = (Vector2){ 0.0f, 0.0f };
+    return;
+  }
+  for (int i = 0; i < manifold->contactsCount; i++) {
+    Vector2 radiusA = Vector2Subtract(manifold->contacts[i], a->position);
+    Vector2 radiusB = Vector2Subtract(manifold->contacts[i], b->position);
+    Vector2 radiusV = ray_physics_relativeVelocity(a, b, radiusA, radiusB);
+    float contactVelocity = Vector2DotProduct(radiusV, manifold->normal);
+    // velocities are separating
+    if (contactVelocity > 0.0f) return;
+
+    float raCrossN = ray_physics_crossVector2(radiusA, manifold->normal);
+    float rbCrossN = ray_physics_crossVector2(radiusB, manifold->normal);
+    float inverseMassSum = a->inverseMass + b->inverseMass + raCrossN*raCrossN*a->inverseInertia + rbCrossN*rbCrossN*b->inverseInertia;
+    float impulse = -(1.0f + manifold->restitution)*contactVelocity/inverseMassSum/manifold->contactsCount;
+    ray_physics_applyImpulse(a, b, radiusA, radiusB, Vector2Scale(manifold->normal, impulse));
+
+    // friction by Coulomb's law
+    radiusV = ray_physics_relativeVelocity(a, b, radiusA, radiusB);
+    Vector2 tangent = ray_physics_normalize(Vector2Subtract(radiusV, Vector2Scale(manifold->normal, Vector2DotProduct(radiusV, manifold->normal))));
+    float impulseTangent = -Vector2DotProduct(radiusV, tangent)/inverseMassSum/manifold->contactsCount;
+    if (fabsf(impulseTangent) <= RAY_PHYSICS_EPSILON) return;
+    if (fabsf(impulseTangent) < impulse*manifold->staticFriction) tangent = Vector2Scale(tangent, impulseTangent);
+    else tangent = Vector2Scale(tangent, -impulse*manifold->dynamicFriction);
+    ray_physics_applyImpulse(a, b, radiusA, radiusB, tangent);
+  }
+}
+
+void ray_physics_integrateVelocity(const ray_physics_world * world, ray_physics_body * body){
+  if (!body->enabled) return;
+  body->position.x += body->velocity.x*world->timeStep;
+  body->position.y += body->velocity.y*world->timeStep;
+  if (!body->freezeOrient) body->orient += body->angularVelocity*world->timeStep;
+  body->transform = ray_physics_mat2Radians(body->orient);
+  ray_physics_integrateForces(world, body);
+}
+
+void ray_physics_correctPositions(ray_physics_manifold * manifold){
+  ray_physics_body * a = manifold->bodyA, * b = manifold->bodyB;
+  float amount = fmaxf(manifold->penetration - RAY_PHYSICS_ALLOWANCE, 0.0f)/(a->inverseMass + b->inverseMass)*RAY_PHYSICS_CORRECTION;
+  Vector2 correction = Vector2Scale(manifold->normal, amount);
+  if (a->enabled) a->position = Vector2Subtract(a->position, Vector2Scale(correction, a->inverseMass));
+  if (b->enabled) b->position = Vector2Add(b->position, Vector2Scale(correction, b->inverseMass));
+}
+
+// One fixed step of world, returns 0 on allocation failure
+int ray_physics_step(ray_physics_world * world){
+  int count = world->bodyCount;
+  world->steps++;
+  world->manifoldCount = 0;
+  world->tested        = 0;
+  for (int i = 0; i < count; i++) world->bodies[i]->isGrounded = 0;
+
+  if (world->broadphase == RAY_PHYSICS_GRID) {
+    if (!ray_physics_gridPairs(world)) return 0;
+    for (int i = 0; i < world->pairCount; i++) {
+      unsigned long long pair = world->pairs[i];
+      if (!ray_physics_collide(world, world->bodies[pair >> 32], world->bodies[pair & 0xFFFFFFFF])) return 0;
+    }
+  }
+  else {
+    for (int i = 0; i < count; i++) {
+      for (int j = i + 1; j < count; j++) {
+        if (world->bodies[i]->inverseMass == 0 && world->bodies[j]->inverseMass == 0) continue;
+        if (!ray_physics_collide(world, world->bodies[i], world->bodies[j])) return 0;
+      }
+    }
+  }
+
+  for (int i = 0; i < count; i++) ray_physics_integrateForces(world, world->bodies[i]);
+  for (int i = 0; i < world->manifoldCount; i++) ray_physics_initializeManifold(world, &world->manifolds[i]);
+  for (int k = 0; k < world->iterations; k++) {
+    for (int i = 0; i < world->manifoldCount; i++) ray_physics_integrateImpulses(&world->manifolds[i]);
+  }
+  for (int i = 0; i < count; i++) ray_physics_integrateVelocity(world, world->bodies[i]);
+  for (int i = 0; i < world->manifoldCount; i++) ray_physics_correctPositions(&world->manifolds[i]);
+  for (int i = 0; i < count; i++) {
+    world->bodies[i]->force  = (Vector2){ 0.0f, 0.0f };
+    world->bodies[i]->torque = 0.0f;
+  }
+  return 1;
+}
+
+// Runs fixed steps for elapsed time in milliseconds, returns count of steps or -1 on allocation failure
+int ray_physics_advance(ray_physics_world * world, double elapsed){
+  int steps = 0;
+  world->accumulator += elapsed;
+  while (world->accumulator >= world->timeStep) {
+    if (!ray_physics_step(world)) return -1;
+    world->accumulator -= world->timeStep;
+    steps++;
+  }
+  return steps;
+}
@@ -0,0 +1,201 @@
+// Pose evaluation for skinning (see skin.h): animation frames are sampled at fractional positions with
+// interpolation, several animations are blended by weights. Sampled poses are kept in LRU cache keyed by
+// animation and frame quantized to 1/steps, so characters playing the same animation share evaluations.
+
+#define RAY_POSE_CACHE  256       // default count of cached poses
+#define RAY_POSE_STEPS  16        // default quantization of fractional frames
+#define RAY_POSE_LAYERS 8         // poses blended at once, cache keeps this count of poses at least
+
+typedef struct {
+  unsigned int id;                // animation id, 0 for free entry
+  int          frame;             // quantized frame
+  int          boneCount;
+  Transform  * pose;
+  int          prev, next;        // LRU list, the most recent first
+  int          chain;             // next entry of hash bucket
+} ray_pose_entry;
+
+typedef struct {
+  ray_pose_entry * entries;
+  int            * buckets;       // first entries of hash chains, -1 if bucket is empty
+  int              capacity, bucketMask;
+  int              head, tail;
+  int              steps;
+  long long        hits, misses;
+} ray_pose_cache;
+
+void ray_pose_cacheFree(ray_pose_cache * cache){
+  for (int i = 0; i < cache->capacity; i++) free(cache->entries[i].pose);
+  free(cache->entries);
+  free(cache->buckets);
+  cache->entries  = NULL;
+  cache->buckets  = NULL;
+  cache->capacity = 0;
+  cache->head = cache->tail = -1;
+}
+
+// Drops cached poses and sets size, capacity 0 disables caching. Returns 0 on allocation failure (cache is disabled then)
+int ray_pose_cacheInit(ray_pose_cache * cache, int capacity, int steps){
+  ray_pose_cacheFree(cache);
+  cache->steps = steps > 0 ? steps : 1;
+  cache->hits  = cache->misses = 0;
+  if (capacity <= 0) return 1;
+  if (capacity < RAY_POSE_LAYERS) capacity = RAY_POSE_LAYERS;
+  int buckets = 16;
+  while (buckets < capacity*2) buckets *= 2;
+  cache->entries = (ray_pose_entry *)calloc(capacity, sizeof(ray_pose_entry));
+  cache->buckets = (int *)malloc(buckets*sizeof(int));
+  if (!cache->entries || !cache->buckets) {
+    ray_pose_cacheFree(cache);
+    return 0;
+  }
+  for (int i = 0; i < buckets; i++) cache->buckets[i] = -1;
+  for (int i = 0; i < capacity; i++) {
+    cache->entries[i].prev = i - 1;
+    cache->entries[i].next = i + 1 < capacity ? i + 1 : -1;
+  }
+  cache->capacity   = capacity;
+  cache->bucketMask = buckets - 1;
+  cache->head       = 0;
+  cache->tail       = capacity - 1;
+  return 1;
+}
+
+unsigned int ray_pose_hash(unsigned int id, int frame){
+  unsigned int h = id*2654435761u ^ (unsigned int)frame*2246822519u;
+  return h ^ h >> 15;
+}
+
+// Wraps frame to [0, frameCount)
+float ray_pose_wrap(float frame, int frameCount){
+  frame = fmodf(frame, (float)frameCount);
+  if (frame < 0) frame += frameCount;
+  return frame < frameCount ? frame : 0;
+}
+
+// Samples animation between two nearest frames, the last frame is interpolated to the first one
+void ray_pose_sample(const ModelAnimation * anim, float frame, Transform * out){
+  frame = ray_pose_wrap(frame, anim->frameCount);
+  int   f0 = (int)frame;
+  int   f1 = f0 + 1 < anim->frameCount ? f0 + 1 : 0;
+  float t  = frame - f0;
+  const Transform * a = anim->framePoses[f0];
+  const Transform * b = anim->framePoses[f1];
+  if (t == 0) {
+    memcpy(out, a, anim->boneCount*sizeof(Transform));
+    return;
+  }
+  for (int i = 0; i < anim->boneCount; i++) {
+    out[i].translation = Vector3Lerp(a[i].translation, b[i].translation, t);
+    out[i].scale       = Vector3Lerp(a[i].scale, b[i].scale, t);
+    // the shortest arc, normalized lerp
+    Quaternion q = b[i].rotation;
+    if (a[i].rotation.x*q.x + a[i].rotation.y*q.y + a[i].rotation.z*q.z + a[i].rotation.w*q.w < 0) q = (Quaternion){ -q.x, -q.y, -q.z, -q.w };
+    out[i].rotation    = QuaternionNlerp(a[i].rotation, q, t);
+  }
+}
+
+// Returns quantized frame, key of cache
+int ray_pose_key(const ray_pose_cache * cache, const ModelAnimation * anim, float frame){
+  return (int)(ray_pose_wrap(frame, anim->frameCount)*cache->steps) % (anim->frameCount*cache->steps);
+}
+
+void ray_pose_unlink(ray_pose_cache * cache, int i){
+  ray_pose_entry * e = &cache->entries[i];
+  if (e->prev >= 0) cache->entries[e->prev].next = e->next; else cache->head = e->next;
+  if (e->next >= 0) cache->entries[e->next].prev = e->prev; else cache->tail = e->prev;
+}
+
+void ray_pose_pushFront(ray_pose_cache * cache, int i){
+  ray_pose_entry * e = &cache->entries[i];
+  e->prev = -1;
+  e->next = cache->head;
+  if (cache->head >= 0) cache->entries[cache->head].prev = i; else cache->tail = i;
+  cache->head = i;
+}
+
+// Returns pose of animation at quantized frame, it is valid for next RAY_POSE_LAYERS - 1 calls at least.
+// scratch (anim->boneCount transforms) is used if cache is disabled or allocation fails, NULL is returned if there is no scratch then
+const Transform * ray_pose_get(ray_pose_cache * cache, unsigned int id, const ModelAnimation * anim, float frame, Transform * scratch){
+  int key = ray_pose_key(cache, anim, frame);
+  if (!cache->capacity) {
+    if (scratch) ray_pose_sample(anim, (float)key/cache->steps, scratch);
+    return scratch;
+  }
+  int * bucket = &cache->buckets[ray_pose_hash(id, key) & cache->bucketMask];
+  for (int i = *bucket; i >= 0; i = cache->entries[i].chain) {
+    ray_pose_entry * e = &cache->entries[i];
+    if (e->id != id || e->frame != key) continue;
+    cache->hits++;
+    ray_pose_unlink(cache, i);
+    ray_pose_pushFront(cache, i);
+    return e->pose;
+  }
+  cache->misses++;
+  // the least recently used entry is reused
+  int i = cache->tail;
+  ray_pose_entry * e = &cache->entries[i];
+  if (e->id) {
+    int * link = &cache->buckets[ray_pose_hash(e->id, e->frame) & cache->bucketMask];
+    while (*link != i) link = &cache->entries[*link].chain;
+    *link = e->chain;
+    e->id = 0;
+  }
+  if (e->boneCount != anim->boneCount) {
+    Transform * pose = (Transform *)realloc(e->pose, (anim->boneCount > 0 ? anim->boneCount : 1)*sizeof(Transform));
+    if (!pose) {
+      if (scratch) ray_pose_sample(anim, (float)key/cache->steps, scratch);
+      return scratch;
+    }
+    e->pose      = pose;
+    e->boneCount = anim->boneCount;
+  }
+  ray_pose_sample(anim, (float)key/cache->steps, e->pose);
+  e->id    = id;
+  e->frame = key;
+  e->chain = *bucket;
+  *bucket  = i;
+  ray_pose_unlink(cache, i);
+  ray_pose_pushFront(cache, i);
+  return e->pose;
+}
+
+// Weighted average of poses, rotations are aligned to the first pose and normalized. Weights should be positive
+void ray_pose_blend(const Transform ** poses, const float * weights, int count, int boneCount, Transform * out){
+  float total = 0;
+  for (int j = 0; j < count; j++) total += weights[j];
+  if (count == 1 || total <= 0) {
+    memcpy(out, poses[0], boneCount*sizeof(Transform));
+    return;
+  }
+  for (int i = 0; i < boneCount; i++) {
+    Vector3    t = { 0 }, s = { 0 };
+    Quaternion r = { 0 }, first = poses[0][i].rotation;
+    for (int j = 0; j < count; j++) {
+      const Transform * p = &poses[j][i];
+      float w = weights[j]/total;
+      t = Vector3Add(t, Vector3Scale(p->translation, w));
+      s = Vector3Add(s, Vector3Scale(p->scale, w));
+      if (first.x*p->rotation.x + first.y*p->rotation.y + first.z*p->rotation.z + first.w*p->rotation.w < 0) w = -w;
+      r.x += p->rotation.x*w;
+      r.y += p->rotation.y*w;
+      r.z += p->rotation.z*w;
+      r.w += p->rotation.w*w;
+    }
+    out[i].translation = t;
+    out[i].scale       = s;
+    out[i].rotation    = QuaternionNormalize(r);
+  }
+}
+
+// Cache of all animators, it is created on first use
+ray_pose_cache ray_pose_shared      = { NULL, NULL, 0, 0, -1, -1, RAY_POSE_STEPS, 0, 0 };
+int            ray_pose_sharedReady = 0;
+
+ray_pose_cache * ray_pose_getShared(void){
+  if (!ray_pose_sharedReady) {
+    ray_pose_sharedReady = 1;
+    ray_pose_cacheInit(&ray_pose_shared, RAY_POSE_CACHE, RAY_POSE_STEPS);
+  }
+  return &ray_pose_shared;
+}
@@ -0,0 +1,233 @@
+// Opt-in profiler of binding functions.
+// Every function registered by luax_pushfunctable and luax_newclass is recorded as entry; when profiler is enabled,
+// functions in module tables and class tables are replaced by timing closures, disabling puts original ones back,
+// so disabled profiler costs nothing except single flag check in luax_newobject.
+
+#if defined(_WIN32)
+	int __stdcall QueryPerformanceCounter(long long * counter);
+	int __stdcall QueryPerformanceFrequency(long long * frequency);
+
+	double luax_profiler_now() {
+		static long long frequency = 0;
+		long long counter;
+		if (!frequency) QueryPerformanceFrequency(&frequency);
+		QueryPerformanceCounter(&counter);
+		return (double)counter/frequency;
+	}
+#else
+	#include <time.h>
+
+	// monotonic clock, so profiles are not broken by system time changes
+	double luax_profiler_now() {
+		struct timespec ts;
+		clock_gettime(CLOCK_MONOTONIC, &ts);
+		return ts.tv_sec + ts.tv_nsec*1e-9;
+	}
+#endif
+
+#define LUAX_PROFILER_MAXEVENTS (1 << 20) // trace events limit, the rest are dropped
+#define LUAX_PROFILER_KEY "raylib_luamore.profiler" // registry table of module tables
+
+typedef struct {
+	const char  * owner;      // module or class name
+	const char  * name;
+	lua_CFunction func;
+	int           isClass;
+	long          calls, frameCalls, lastCalls;
+	double        time,  frameTime,  lastTime;   // seconds, "last" is previous finished frame
+} luax_ProfilerEntry;
+
+typedef struct {
+	const char  * name;
+	long          count, frameCount, lastCount;
+} luax_ProfilerClass;
+
+typedef struct {
+	int           entry;      // -1 is frame
+	double        start, duration;
+} luax_ProfilerEvent;
+
+struct {
+	int                  enabled, tracing;
+	int                  frameEntry;   // core.EndDrawing entry, ends frame
+	long                 frames;
+	double               start, frameStart;
+	luax_ProfilerEntry * entries;
+	int                  entriesCount, entriesCapacity;
+	luax_ProfilerClass * classes;
+	int                  classesCount, classesCapacity;
+	luax_ProfilerEvent * events;
+	int                  eventsCount, eventsCapacity;
+	long                 eventsDropped;
+} luax_profiler = {0};
+
+// registration, called on module loading only
+void luax_profiler_add(const char * owner, const char * name, lua_CFunction func, int isClass) {
+	if (luax_profiler.entriesCount == luax_profiler.entriesCapacity) {
+		int capacity = luax_profiler.entriesCapacity ? luax_profiler.entriesCapacity*2 : 256;
+		luax_ProfilerEntry * entries = (luax_ProfilerEntry *)realloc(luax_profiler.entries, capacity*sizeof(luax_ProfilerEntry));
+		if (!entries) return;
+		luax_profiler.entries         = entries;
+		luax_profiler.entriesCapacity = capacity;
+	}
+	luax_ProfilerEntry * e = &luax_profiler.entries[luax_profiler.entriesCount++];
+	memset(e, 0, sizeof(luax_ProfilerEntry));
+	e->owner   = owner;
+	e->name    = name;
+	e->func    = func;
+	e->isClass = isClass;
+}
+
+void luax_profiler_addclass(const char * name) {
+	if (luax_profiler.classesCount == luax_profiler.classesCapacity) {
+		int capacity = luax_profiler.classesCapacity ? luax_profiler.classesCapacity*2 : 32;
+		luax_ProfilerClass * classes = (luax_ProfilerClass *)realloc(luax_profiler.classes, capacity*sizeof(luax_ProfilerClass));
+		if (!classes) return;
+		luax_profiler.classes         = classes;
+		luax_profiler.classesCapacity = capacity;
+	}
+	luax_ProfilerClass * c = &luax_profiler.classes[luax_profiler.classesCount++];
+	memset(c, 0, sizeof(luax_ProfilerClass));
+	c->name = name;
+}
+
+// module table on top of the stack
+void luax_profiler_addtable(lua_State *L, const char * name) {
+	lua_getfield(L, LUA_REGISTRYINDEX, LUAX_PROFILER_KEY);
+	if (lua_isnil(L, -1)) {
+		lua_pop(L, 1);
+		lua_newtable(L);
+		lua_pushvalue(L, -1);
+		lua_setfield(L, LUA_REGISTRYINDEX, LUAX_PROFILER_KEY);
+	}
+	lua_pushvalue(L, -2);
+	lua_setfield(L, -2, name);
+	lua_pop(L, 1);
+}
+
+void luax_profiler_countobject(const char * classname) {
+	for (int i = 0; i < luax_profiler.classesCount; i++) {
+		luax_ProfilerClass * c = &luax_profiler.classes[i];
+		if (c->name == classname || !strcmp(c->name, classname)) {
+			c->count++;
+			c->frameCount++;
+			return;
+		}
+	}
+}
+
+void luax_profiler_pushevent(int entry, double start, double duration) {
+	if (luax_profiler.eventsCount == luax_profiler.eventsCapacity) {
+		int capacity = luax_profiler.eventsCapacity ? luax_profiler.eventsCapacity*2 : 4096;
+		luax_ProfilerEvent * events = capacity > LUAX_PROFILER_MAXEVENTS ? NULL :
+			(luax_ProfilerEvent *)realloc(luax_profiler.events, capacity*sizeof(luax_ProfilerEvent));
+		if (!events) {
+			luax_profiler.eventsDropped++;
+			return;
+		}
+		luax_profiler.events         = events;
+		luax_profiler.eventsCapacity = capacity;
+	}
+	luax_ProfilerEvent * ev = &luax_profiler.events[luax_profiler.eventsCount++];
+	ev->entry    = entry;
+	ev->start    = start;
+	ev->duration = duration;
+}
+
+// Moves current frame stats to "last" ones
+void luax_profiler_endframe() {
+	double now = luax_profiler_now();
+	for (int i = 0; i < luax_profiler.entriesCount; i++) {
+		luax_ProfilerEntry * e = &luax_profiler.entries[i];
+		e->lastCalls  = e->frameCalls;
+		e->lastTime   = e->frameTime;
+		e->frameCalls = 0;
+		e->frameTime  = 0;
+	}
+	for (int i = 0; i < luax_profiler.classesCount; i++) {
+		luax_ProfilerClass * c = &luax_profiler.classes[i];
+		c->lastCount  = c->frameCount;
+		c->frameCount = 0;
+	}
+	if (luax_profiler.tracing) luax_profiler_pushevent(-1, luax_profiler.frameStart, now - luax_profiler.frameStart);
+	luax_profiler.frameStart = now;
+	luax_profiler.frames++;
+}
+
+// Timing closure, upvalue 1 is entry index
+int luax_profiler_call(lua_State *L) {
+	int index = lua_tointeger(L, lua_upvalueindex(1));
+	luax_ProfilerEntry * e = &luax_profiler.entries[index];
+	double start = luax_profiler_now();
+	int    res   = e->func(L);
+	double time  = luax_profiler_now() - start;
+	e->calls++;
+	e->frameCalls++;
+	e->time      += time;
+	e->frameTime += time;
+	if (luax_profiler.tracing) luax_profiler_pushevent(index, start, time);
+	if (index == luax_profiler.frameEntry) luax_profiler_endframe();
+	return res;
+}
+
+// Pushes table which contains entry function (module table, class table or metatable)
+void luax_profiler_pushtarget(lua_State *L, luax_ProfilerEntry * e) {
+	if (e->isClass) {
+		luaL_getmetatable(L, e->owner);
+		if (e->name[0] != '_') {
+			lua_getfield(L, -1, "class_t");
+			lua_remove(L, -2);
+		}
+	}
+	else {
+		lua_getfield(L, LUA_REGISTRYINDEX, LUAX_PROFILER_KEY);
+		lua_getfield(L, -1, e->owner);
+		lua_remove(L, -2);
+	}
+}
+
+void luax_profiler_enable(lua_State *L, int enable, int tracing) {
+	luax_profiler.tracing = tracing;
+	if (luax_profiler.enabled == enable) return;
+	luax_profiler.frameEntry = -1;
+	for (int i = 0; i < luax_profiler.entriesCount; i++) {
+		luax_ProfilerEntry * e = &luax_profiler.entries[i];
+		if (!e->isClass && !strcmp(e->owner, "profiler")) continue;
+		if (!e->isClass && !strcmp(e->owner, "core") && !strcmp(e->name, "EndDrawing")) luax_profiler.frameEntry = i;
+		luax_profiler_pushtarget(L, e);
+		if (!lua_istable(L, -1)) {
+			lua_pop(L, 1);
+			continue;
+		}
+		lua_pushstring(L, e->name);
+		if (enable) {
+			lua_pushinteger(L, i);
+			lua_pushcclosure(L, luax_profiler_call, 1);
+		}
+		else lua_pushcfunction(L, e->func);
+		lua_rawset(L, -3);
+		lua_pop(L, 1);
+	}
+	luax_profiler.enabled = enable;
+	if (enable) {
+		luax_profiler.start      = luax_profiler_now();
+		luax_profiler.frameStart = luax_profiler.start;
+	}
+}
+
+void luax_profiler_reset() {
+	for (int i = 0; i < luax_profiler.entriesCount; i++) {
+		luax_ProfilerEntry * e = &luax_profiler.entries[i];
+		e->calls = e->frameCalls = e->lastCalls = 0;
+		e->time  = e->frameTime  = e->lastTime  = 0;
+	}
+	for (int i = 0; i < luax_profiler.classesCount; i++) {
+		luax_ProfilerClass * c = &luax_profiler.classes[i];
+		c->count = c->frameCount = c->lastCount = 0;
+	}
+	luax_profiler.frames        = 0;
+	luax_profiler.eventsCount   = 0;
+	luax_profiler.eventsDropped = 0;
+	luax_profiler.start         = luax_profiler_now();
+	luax_profiler.frameStart    = luax_profiler.start;
+}
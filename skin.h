@@ -0,0 +1,225 @@
+// CPU skinning of animated meshes (animVertices/animNormals from vertices/normals).
+// raylib UpdateModelAnimation computes bone rotation for every vertex and uses first bone only, here
+// bone matrices are computed once per pose and up to 4 weighted bones are blended, vertices of all meshes
+// are split into chunks for pool threads. SSE is used if compiler supports it (see kernels.h), scalar code otherwise.
+// Vertices with one bone are transformed exactly as raylib does it.
+
+#define RAY_SKIN_CHUNK 1024       // vertices per job
+
+enum {
+  RAY_SKIN_RAYLIB,                // use raylib UpdateModelAnimation
+  RAY_SKIN_SCALAR,
+  RAY_SKIN_SIMD,                  // falls back to scalar if SIMD isn't compiled in
+};
+
+int ray_skin_mode    = RAY_SKIN_SIMD;
+int ray_skin_threads = 0;         // 0 is all pool threads
+
+// Columns of bone matrices, 4th component is padding
+typedef struct {
+  float position[4][4];           // scale and rotation, translation is the last column
+  float normal[3][4];             // rotation only
+} ray_skin_bone;
+
+// Computes matrices of bones which move them from bind pose to given pose, raylib transforms vertices by
+// (vertex*poseScale - bindTranslation) rotated by poseRotation*inverse(bindRotation) plus poseTranslation
+void ray_skin_bones(const Transform * bind, const Transform * pose, int count, ray_skin_bone * bones){
+  for (int i = 0; i < count; i++) {
+    Quaternion q = QuaternionMultiply(pose[i].rotation, QuaternionInvert(bind[i].rotation));
+    // columns of Vector3RotateByQuaternion
+    Vector3 r[3] = {
+      { q.x*q.x + q.w*q.w - q.y*q.y - q.z*q.z, 2*q.w*q.z + 2*q.x*q.y, -2*q.w*q.y + 2*q.x*q.z },
+      { 2*q.x*q.y - 2*q.w*q.z, q.w*q.w - q.x*q.x + q.y*q.y - q.z*q.z, 2*q.w*q.x + 2*q.y*q.z },
+      { 2*q.x*q.z + 2*q.w*q.y, -2*q.w*q.x + 2*q.y*q.z, q.w*q.w - q.x*q.x - q.y*q.y + q.z*q.z },
+    };
+    float   s[3] = { pose[i].scale.x, pose[i].scale.y, pose[i].scale.z };
+    Vector3 t    = Vector3Subtract(pose[i].translation, Vector3RotateByQuaternion(bind[i].translation, q));
+    ray_skin_bone * b = &bones[i];
+    for (int c = 0; c < 3; c++) {
+      b->position[c][0] = r[c].x*s[c];
+      b->position[c][1] = r[c].y*s[c];
+      b->position[c][2] = r[c].z*s[c];
+      b->position[c][3] = 0;
+      b->normal[c][0]   = r[c].x;
+      b->normal[c][1]   = r[c].y;
+      b->normal[c][2]   = r[c].z;
+      b->normal[c][3]   = 0;
+    }
+    b->position[3][0] = t.x;
+    b->position[3][1] = t.y;
+    b->position[3][2] = t.z;
+    b->position[3][3] = 1;
+  }
+}
+
+// Collects bones of vertex with weights, raylib behaviour (first bone with weight 1) is used without weights.
+// Weights are divided by their sum: IQM ones are quantized to 1/255 and bones out of skeleton are dropped,
+// so kept weights may not sum to 1 and vertex would be scaled toward the origin
+int ray_skin_influences(const Mesh * mesh, int vertex, int boneCount, int * ids, float * weights){
+  const int * id = mesh->boneIds + vertex*4;
+  if (mesh->boneWeights) {
+    const float * w = mesh->boneWeights + vertex*4;
+    int   count = 0;
+    float sum   = 0;
+    for (int i = 0; i < 4; i++) {
+      if (w[i] <= 0 || id[i] < 0 || id[i] >= boneCount) continue;
+      ids[count]     = id[i];
+      weights[count] = w[i];
+      sum += w[i];
+      count++;
+    }
+    if (count) {
+      if (sum != 1) for (int i = 0; i < count; i++) weights[i] /= sum;
+      return count;
+    }
+  }
+  if (id[0] < 0 || id[0] >= boneCount) return 0;
+  ids[0]     = id[0];
+  weights[0] = 1;
+  return 1;
+}
+
+void ray_skin_rangeScalar(const ray_skin_bone * bones, int boneCount, Mesh * mesh, int from, int to){
+  int   ids[4];
+  float weights[4];
+  for (int i = from; i < to; i++) {
+    const float * v = mesh->vertices + i*3;
+    const float * n = mesh->normals ? mesh->normals + i*3 : NULL;
+    float p[3] = { 0 }, r[3] = { 0 };
+    int count = ray_skin_influences(mesh, i, boneCount, ids, weights);
+    if (!count) {
+      // bone is out of skeleton, vertex is kept as is
+      memcpy(mesh->animVertices + i*3, v, 3*sizeof(float));
+      if (n && mesh->animNormals) memcpy(mesh->animNormals + i*3, n, 3*sizeof(float));
+      continue;
+    }
+    for (int j = 0; j < count; j++) {
+      const ray_skin_bone * b = &bones[ids[j]];
+      float w = weights[j];
+      for (int k = 0; k < 3; k++) {
+        p[k] += w*(b->position[0][k]*v[0] + b->position[1][k]*v[1] + b->position[2][k]*v[2] + b->position[3][k]);
+        if (n) r[k] += w*(b->normal[0][k]*n[0] + b->normal[1][k]*n[1] + b->normal[2][k]*n[2]);
+      }
+    }
+    memcpy(mesh->animVertices + i*3, p, 3*sizeof(float));
+    if (!n || !mesh->animNormals) continue;
+    if (count > 1) {
+      // blended rotations are not rotations
+      float len = sqrtf(r[0]*r[0] + r[1]*r[1] + r[2]*r[2]);
+      if (len > 0) r[0] /= len, r[1] /= len, r[2] /= len;
+    }
+    memcpy(mesh->animNormals + i*3, r, 3*sizeof(float));
+  }
+}
+
+#ifdef RAY_KERNELS_SSE2
+// Same as scalar version, columns of every bone are scaled by weight and summed in SSE registers
+void ray_skin_rangeSIMD(const ray_skin_bone * bones, int boneCount, Mesh * mesh, int from, int to){
+  int   ids[4];
+  float weights[4];
+  for (int i = from; i < to; i++) {
+    const float * v = mesh->vertices + i*3;
+    const float * n = mesh->normals && mesh->animNormals ? mesh->normals + i*3 : NULL;
+    int count = ray_skin_influences(mesh, i, boneCount, ids, weights);
+    if (!count) {
+      memcpy(mesh->animVertices + i*3, v, 3*sizeof(float));
+      if (n) memcpy(mesh->animNormals + i*3, n, 3*sizeof(float));
+      continue;
+    }
+    __m128 vx = _mm_set1_ps(v[0]), vy = _mm_set1_ps(v[1]), vz = _mm_set1_ps(v[2]);
+    __m128 p  = _mm_setzero_ps(), r = _mm_setzero_ps();
+    for (int j = 0; j < count; j++) {
+      const ray_skin_bone * b = &bones[ids[j]];
+      __m128 w = _mm_set1_ps(weights[j]);
+      __m128 t = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(b->position[0]), vx), _mm_mul_ps(_mm_loadu_ps(b->position[1]), vy)),
+                            _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(b->position[2]), vz), _mm_loadu_ps(b->position[3])));
+      p = _mm_add_ps(p, _mm_mul_ps(w, t));
+    }
+    // x and y by one 64-bit store, z separately, so next vertex is not touched
+    float * out = mesh->animVertices + i*3;
+    _mm_storel_pi((__m64 *)out, p);
+    _mm_store_ss(out + 2, _mm_shuffle_ps(p, p, _MM_SHUFFLE(2, 2, 2, 2)));
+    if (!n) continue;
+    __m128 nx = _mm_set1_ps(n[0]), ny = _mm_set1_ps(n[1]), nz = _mm_set1_ps(n[2]);
+    for (int j = 0; j < count; j++) {
+      const ray_skin_bone * b = &bones[ids[j]];
+      __m128 t = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(b->normal[0]), nx), _mm_mul_ps(_mm_loadu_ps(b->normal[1]), ny)),
+                            _mm_mul_ps(_mm_loadu_ps(b->normal[2]), nz));
+      r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(weights[j]), t));
+    }
+    if (count > 1) {
+      __m128 sq  = _mm_mul_ps(r, r);
+      __m128 len = _mm_sqrt_ss(_mm_add_ss(_mm_add_ss(sq, _mm_shuffle_ps(sq, sq, _MM_SHUFFLE(1, 1, 1, 1))), _mm_movehl_ps(sq, sq)));
+      if (_mm_cvtss_f32(len) > 0) r = _mm_div_ps(r, _mm_shuffle_ps(len, len, _MM_SHUFFLE(0, 0, 0, 0)));
+    }
+    out = mesh->animNormals + i*3;
+    _mm_storel_pi((__m64 *)out, r);
+    _mm_store_ss(out + 2, _mm_shuffle_ps(r, r, _MM_SHUFFLE(2, 2, 2, 2)));
+  }
+}
+#endif
+
+void ray_skin_range(const ray_skin_bone * bones, int boneCount, Mesh * mesh, int from, int to){
+#ifdef RAY_KERNELS_SSE2
+  if (ray_skin_mode == RAY_SKIN_SIMD) {
+    ray_skin_rangeSIMD(bones, boneCount, mesh, from, to);
+    return;
+  }
+#endif
+  ray_skin_rangeScalar(bones, boneCount, mesh, from, to);
+}
+
+// Meshes which can be skinned, other ones (generated meshes, for example) are skipped
+int ray_skin_skinnable(const Mesh * mesh){
+  return mesh->vertices && mesh->animVertices && mesh->boneIds && mesh->vertexCount > 0;
+}
+
+typedef struct {
+  const ray_skin_bone * bones;
+  int                   boneCount;
+  Mesh                * meshes;
+  int                   meshCount;
+} ray_skin_job;
+
+void ray_skin_chunk(void * data, int index){
+  ray_skin_job * job = (ray_skin_job *)data;
+  for (int i = 0; i < job->meshCount; i++) {
+    Mesh * mesh = &job->meshes[i];
+    if (!ray_skin_skinnable(mesh)) continue;
+    int chunks = (mesh->vertexCount + RAY_SKIN_CHUNK - 1)/RAY_SKIN_CHUNK;
+    if (index >= chunks) {
+      index -= chunks;
+      continue;
+    }
+    int from = index*RAY_SKIN_CHUNK;
+    int to   = from + RAY_SKIN_CHUNK < mesh->vertexCount ? from + RAY_SKIN_CHUNK : mesh->vertexCount;
+    ray_skin_range(job->bones, job->boneCount, mesh, from, to);
+    return;
+  }
+}
+
+// Skins meshes of model by pose with model.boneCount transforms, GPU buffers are not updated.
+// Returns 0 on allocation failure
+int ray_skin_model(Model * model, const Transform * pose){
+  ray_skin_bone * bones = (ray_skin_bone *)malloc((model->boneCount > 0 ? model->boneCount : 1)*sizeof(ray_skin_bone));
+  if (!bones) return 0;
+  ray_skin_bones(model->bindPose, pose, model->boneCount, bones);
+  ray_skin_job job = {bones, model->boneCount, model->meshes, model->meshCount};
+  int chunks = 0;
+  for (int i = 0; i < model->meshCount; i++)
+    if (ray_skin_skinnable(&model->meshes[i])) chunks += (model->meshes[i].vertexCount + RAY_SKIN_CHUNK - 1)/RAY_SKIN_CHUNK;
+  if (chunks > 1 && ray_skin_threads != 1) ray_threads_parallel(ray_skin_chunk, &job, chunks, ray_skin_threads);
+  else for (int i = 0; i < chunks; i++) ray_skin_chunk(&job, i);
+  free(bones);
+  return 1;
+}
+
+// Uploads skinned vertices and normals of meshes to GPU, as UpdateModelAnimation does
+void ray_skin_upload(Model * model){
+  for (int i = 0; i < model->meshCount; i++) {
+    Mesh * mesh = &model->meshes[i];
+    if (!ray_skin_skinnable(mesh) || !mesh->vboId) continue;
+    rlUpdateBuffer(mesh->vboId[0], mesh->animVertices, mesh->vertexCount*3*sizeof(float));
+    if (mesh->animNormals) rlUpdateBuffer(mesh->vboId[2], mesh->animNormals, mesh->vertexCount*3*sizeof(float));
+  }
+}
@@ -0,0 +1,146 @@
+// Save-data store format: append-only log of key-value records, the last record of a key wins.
+// Records have checksums, so log which is cut by crash is read up to the last complete record.
+// Compaction writes live records to temporary file and replaces log by it.
+// This part has no Lua calls, values are encoded by user.
+//
+// Layout (little endian):
+//   header  "RLSV", u32 version
+//   record  u32 crc32 (of the rest of record), u8 type, u32 keyLength, u32 valueLength, key, value
+
+#if defined(_WIN32)
+  #include <io.h>
+#else
+  #include <unistd.h>
+
+  int fileno(FILE * f); // POSIX, stdio.h hides it in strict C modes
+#endif
+
+#define RAY_STORE_MAGIC   "RLSV"
+#define RAY_STORE_VERSION 1
+#define RAY_STORE_HEADER  8
+#define RAY_STORE_RECORD  13     // record header size
+
+enum {
+  RAY_STORE_DELETE,
+  RAY_STORE_NUMBER,              // 8 bytes double
+  RAY_STORE_STRING,
+  RAY_STORE_BOOLEAN,             // 1 byte
+};
+
+typedef struct {
+  unsigned char * data;
+  size_t          size, capacity;
+} ray_store_buffer;
+
+unsigned int ray_store_crcTable[256];
+
+unsigned int ray_store_crc32(const unsigned char * data, size_t size){
+  if (!ray_store_crcTable[1]) {
+    for (unsigned int i = 0; i < 256; i++) {
+      unsigned int c = i;
+      for (int k = 0; k < 8; k++) c = c & 1 ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+      ray_store_crcTable[i] = c;
+    }
+  }
+  unsigned int crc = 0xFFFFFFFFu;
+  for (size_t i = 0; i < size; i++) crc = ray_store_crcTable[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+  return ~crc;
+}
+
+size_t ray_store_recordSize(size_t keyLength, size_t valueLength){
+  return RAY_STORE_RECORD + keyLength + valueLength;
+}
+
+// Grows buffer, returns 0 on allocation failure
+int ray_store_reserve(ray_store_buffer * buffer, size_t size){
+  if (buffer->size + size <= buffer->capacity) return 1;
+  size_t capacity = buffer->capacity ? buffer->capacity : 4096;
+  while (capacity < buffer->size + size) capacity *= 2;
+  unsigned char * data = (unsigned char *)realloc(buffer->data, capacity);
+  if (!data) return 0;
+  buffer->data     = data;
+  buffer->capacity = capacity;
+  return 1;
+}
+
+// Appends file header to buffer, returns 0 on allocation failure
+int ray_store_header(ray_store_buffer * buffer){
+  if (!ray_store_reserve(buffer, RAY_STORE_HEADER)) return 0;
+  memcpy(buffer->data + buffer->size, RAY_STORE_MAGIC, 4);
+  ray_archive_put32(buffer->data + buffer->size + 4, RAY_STORE_VERSION);
+  buffer->size += RAY_STORE_HEADER;
+  return 1;
+}
+
+// Appends record to buffer, returns 0 on allocation failure
+int ray_store_append(ray_store_buffer * buffer, int type, const char * key, size_t keyLength, const void * value, size_t valueLength){
+  size_t size = ray_store_recordSize(keyLength, valueLength);
+  if (!ray_store_reserve(buffer, size)) return 0;
+  unsigned char * record = buffer->data + buffer->size;
+  record[4] = type;
+  ray_archive_put32(record + 5, keyLength);
+  ray_archive_put32(record + 9, valueLength);
+  memcpy(record + RAY_STORE_RECORD, key, keyLength);
+  if (valueLength) memcpy(record + RAY_STORE_RECORD + keyLength, value, valueLength);
+  ray_archive_put32(record, ray_store_crc32(record + 4, size - 4));
+  buffer->size += size;
+  return 1;
+}
+
+// Calls func for every valid record, returns size of valid part of log (0 if header is invalid)
+size_t ray_store_parse(const unsigned char * data, size_t size, void (* func)(void * user, int type, const char * key, size_t keyLength, const unsigned char * value, size_t valueLength), void * user){
+  if (size < RAY_STORE_HEADER || memcmp(data, RAY_STORE_MAGIC, 4) || ray_archive_u32(data + 4) != RAY_STORE_VERSION) return 0;
+  size_t offset = RAY_STORE_HEADER;
+  while (size - offset >= RAY_STORE_RECORD) {
+    const unsigned char * record = data + offset;
+    int    type        = record[4];
+    size_t keyLength   = ray_archive_u32(record + 5);
+    size_t valueLength = ray_archive_u32(record + 9);
+    if (keyLength > size - offset - RAY_STORE_RECORD || valueLength > size - offset - RAY_STORE_RECORD - keyLength) break;
+    size_t recordSize = ray_store_recordSize(keyLength, valueLength);
+    if (type > RAY_STORE_BOOLEAN || ray_archive_u32(record) != ray_store_crc32(record + 4, recordSize - 4)) break;
+    if ((type == RAY_STORE_NUMBER && valueLength != 8) || (type == RAY_STORE_BOOLEAN && valueLength != 1)) break;
+    func(user, type, (const char *)record + RAY_STORE_RECORD, keyLength, record + RAY_STORE_RECORD + keyLength, valueLength);
+    offset += recordSize;
+  }
+  return offset;
+}
+
+// Writes data and waits until it is stored by system, returns 0 on error
+int ray_store_write(FILE * f, const void * data, size_t size){
+  if (size && fwrite(data, 1, size, f) != size) return 0;
+  if (fflush(f)) return 0;
+#if defined(_WIN32)
+  return !_commit(_fileno(f));
+#else
+  return !fsync(fileno(f));
+#endif
+}
+
+// Temporary file of compaction, it replaces log only when it is complete
+void ray_store_tempPath(char * temp, size_t size, const char * path){
+  snprintf(temp, size, "%s.tmp", path);
+}
+
+// Finishes or drops interrupted compaction
+void ray_store_recover(const char * path){
+  char temp[4096];
+  ray_store_tempPath(temp, sizeof(temp), path);
+  FILE * f = fopen(path, "rb");
+  if (f) {
+    fclose(f);
+    remove(temp);
+  }
+  else rename(temp, path);
+}
+
+// Replaces log by complete temporary file
+int ray_store_replace(const char * path){
+  char temp[4096];
+  ray_store_tempPath(temp, sizeof(temp), path);
+#if defined(_WIN32)
+  // rename doesn't replace files, log is restored from temporary file by ray_store_recover if it is interrupted
+  remove(path);
+#endif
+  return !rename(temp, path);
+}
@@ -0,0 +1,244 @@
+// Portable threads, mutexes, condition variables and shared worker pool.
+// Windows API is declared manually: windows.h conflicts with raylib.h (Rectangle, CloseWindow, LoadImage etc).
+
+#if defined(_WIN32)
+  #include <stdint.h>
+
+  // layout of RTL_CRITICAL_SECTION
+  typedef struct {
+    void * debugInfo;
+    long   lockCount;
+    long   recursionCount;
+    void * owningThread;
+    void * lockSemaphore;
+    size_t spinCount;
+  } ray_threads_mutex;
+  typedef struct { void * ptr; } ray_threads_cond;
+  typedef void * ray_threads_thread;
+
+  void __stdcall InitializeCriticalSection(ray_threads_mutex * cs);
+  void __stdcall DeleteCriticalSection(ray_threads_mutex * cs);
+  void __stdcall EnterCriticalSection(ray_threads_mutex * cs);
+  void __stdcall LeaveCriticalSection(ray_threads_mutex * cs);
+  void __stdcall InitializeConditionVariable(ray_threads_cond * cv);
+  int  __stdcall SleepConditionVariableCS(ray_threads_cond * cv, ray_threads_mutex * cs, unsigned long ms);
+  void __stdcall WakeConditionVariable(ray_threads_cond * cv);
+  void __stdcall WakeAllConditionVariable(ray_threads_cond * cv);
+  unsigned long __stdcall WaitForSingleObject(void * handle, unsigned long ms);
+  int  __stdcall CloseHandle(void * handle);
+  unsigned long __stdcall GetActiveProcessorCount(unsigned short group);
+  uintptr_t _beginthreadex(void * security, unsigned stack, unsigned (__stdcall * func)(void *), void * arg, unsigned flags, unsigned * id);
+
+  #define RAY_THREADS_PROC(name) unsigned __stdcall name(void * arg)
+  #define RAY_THREADS_RETURN     return 0
+
+  #define ray_threads_mutexInit(m)    InitializeCriticalSection(m)
+  #define ray_threads_mutexFree(m)    DeleteCriticalSection(m)
+  #define ray_threads_lock(m)         EnterCriticalSection(m)
+  #define ray_threads_unlock(m)       LeaveCriticalSection(m)
+  #define ray_threads_condInit(c)     InitializeConditionVariable(c)
+  #define ray_threads_condFree(c)     ((void)(c))
+  #define ray_threads_wait(c, m)      SleepConditionVariableCS(c, m, 0xFFFFFFFF)
+  #define ray_threads_signal(c)       WakeConditionVariable(c)
+  #define ray_threads_broadcast(c)    WakeAllConditionVariable(c)
+  #define ray_threads_spawn(t, f, a)  ((*(t) = (void *)_beginthreadex(NULL, 0, f, a, 0, NULL)) != NULL)
+  #define ray_threads_join(t)         (WaitForSingleObject(t, 0xFFFFFFFF), CloseHandle(t))
+  #define ray_threads_cpuCount()      ((int)GetActiveProcessorCount(0xFFFF))
+#else
+  #include <pthread.h>
+  #include <unistd.h>
+
+  typedef pthread_mutex_t ray_threads_mutex;
+  typedef pthread_cond_t  ray_threads_cond;
+  typedef pthread_t       ray_threads_thread;
+
+  #define RAY_THREADS_PROC(name) void * name(void * arg)
+  #define RAY_THREADS_RETURN     return NULL
+
+  #define ray_threads_mutexInit(m)    pthread_mutex_init(m, NULL)
+  #define ray_threads_mutexFree(m)    pthread_mutex_destroy(m)
+  #define ray_threads_lock(m)         pthread_mutex_lock(m)
+  #define ray_threads_unlock(m)       pthread_mutex_unlock(m)
+  #define ray_threads_condInit(c)     pthread_cond_init(c, NULL)
+  #define ray_threads_condFree(c)     pthread_cond_destroy(c)
+  #define ray_threads_wait(c, m)      pthread_cond_wait(c, m)
+  #define ray_threads_signal(c)       pthread_cond_signal(c)
+  #define ray_threads_broadcast(c)    pthread_cond_broadcast(c)
+  #define ray_threads_spawn(t, f, a)  (pthread_create(t, NULL, f, a) == 0)
+  #define ray_threads_join(t)         pthread_join(t, NULL)
+  #define ray_threads_cpuCount()      ((int)sysconf(_SC_NPROCESSORS_ONLN))
+#endif
+
+#define RAY_THREADS_MAX 64
+
+// Pool of worker threads, started on first use. Jobs are executed in order of pushing.
+typedef void (*ray_threads_func)(void * data);
+
+typedef struct {
+  ray_threads_func func;
+  void           * data;
+} ray_threads_job;
+
+struct {
+  int                inited, started, quit;
+  int                count;                      // worker threads count, -1 is CPU count - 1
+  ray_threads_thread threads[RAY_THREADS_MAX];
+  ray_threads_mutex  lock;
+  ray_threads_cond   work;                       // signaled on pushing jobs
+  ray_threads_cond   done;                       // broadcasted on finishing parallel jobs
+  ray_threads_job  * jobs;                       // ring buffer of queued jobs
+  int                first, size, capacity;
+} ray_threads_pool = {0, 0, 0, -1};
+
+void ray_threads_init(){
+  if (ray_threads_pool.inited) return;
+  ray_threads_mutexInit(&ray_threads_pool.lock);
+  ray_threads_condInit(&ray_threads_pool.work);
+  ray_threads_condInit(&ray_threads_pool.done);
+  ray_threads_pool.inited = 1;
+}
+
+RAY_THREADS_PROC(ray_threads_worker){
+  (void)arg;
+  ray_threads_lock(&ray_threads_pool.lock);
+  while (1) {
+    while (!ray_threads_pool.size && !ray_threads_pool.quit) ray_threads_wait(&ray_threads_pool.work, &ray_threads_pool.lock);
+    if (ray_threads_pool.quit) break;
+    ray_threads_job job = ray_threads_pool.jobs[ray_threads_pool.first];
+    ray_threads_pool.first = (ray_threads_pool.first + 1) % ray_threads_pool.capacity;
+    ray_threads_pool.size--;
+    ray_threads_unlock(&ray_threads_pool.lock);
+    job.func(job.data);
+    ray_threads_lock(&ray_threads_pool.lock);
+  }
+  ray_threads_unlock(&ray_threads_pool.lock);
+  RAY_THREADS_RETURN;
+}
+
+// Must be called with pool locked
+void ray_threads_start(){
+  if (ray_threads_pool.started) return;
+  int count = ray_threads_pool.count;
+  if (count < 0) count = ray_threads_cpuCount() - 1;
+  if (count > RAY_THREADS_MAX) count = RAY_THREADS_MAX;
+  ray_threads_pool.count = 0;
+  for (int i = 0; i < count; i++) {
+    if (!ray_threads_spawn(&ray_threads_pool.threads[i], ray_threads_worker, NULL)) break;
+    ray_threads_pool.count++;
+  }
+  ray_threads_pool.started = 1;
+}
+
+// Stops workers (they finish current jobs, queued ones are kept) and sets new count, 0 disables pool.
+void ray_threads_setCount(int count){
+  ray_threads_init();
+  if (count > RAY_THREADS_MAX) count = RAY_THREADS_MAX;
+  ray_threads_lock(&ray_threads_pool.lock);
+  if (ray_threads_pool.started) {
+    ray_threads_pool.quit = 1;
+    ray_threads_broadcast(&ray_threads_pool.work);
+    ray_threads_unlock(&ray_threads_pool.lock);
+    for (int i = 0; i < ray_threads_pool.count; i++) ray_threads_join(ray_threads_pool.threads[i]);
+    ray_threads_lock(&ray_threads_pool.lock);
+    ray_threads_pool.quit    = 0;
+    ray_threads_pool.started = 0;
+  }
+  ray_threads_pool.count = count;
+  if (ray_threads_pool.size) ray_threads_start();
+  ray_threads_unlock(&ray_threads_pool.lock);
+}
+
+// Returns worker threads count (starts pool)
+int ray_threads_getCount(){
+  ray_threads_init();
+  ray_threads_lock(&ray_threads_pool.lock);
+  ray_threads_start();
+  int count = ray_threads_pool.count;
+  ray_threads_unlock(&ray_threads_pool.lock);
+  return count;
+}
+
+// Must be called with pool locked, returns 0 on allocation failure
+int ray_threads_pushLocked(ray_threads_func func, void * data){
+  if (ray_threads_pool.size == ray_threads_pool.capacity) {
+    int capacity = ray_threads_pool.capacity ? ray_threads_pool.capacity*2 : 64;
+    ray_threads_job * jobs = (ray_threads_job *)malloc(capacity*sizeof(ray_threads_job));
+    if (!jobs) return 0;
+    for (int i = 0; i < ray_threads_pool.size; i++)
+      jobs[i] = ray_threads_pool.jobs[(ray_threads_pool.first + i) % ray_threads_pool.capacity];
+    free(ray_threads_pool.jobs);
+    ray_threads_pool.jobs     = jobs;
+    ray_threads_pool.first    = 0;
+    ray_threads_pool.capacity = capacity;
+  }
+  ray_threads_pool.jobs[(ray_threads_pool.first + ray_threads_pool.size) % ray_threads_pool.capacity] = (ray_threads_job){func, data};
+  ray_threads_pool.size++;
+  ray_threads_start();
+  ray_threads_signal(&ray_threads_pool.work);
+  return 1;
+}
+
+// Queues job for worker threads, if there is no workers - executes it immediately
+void ray_threads_push(ray_threads_func func, void * data){
+  ray_threads_init();
+  ray_threads_lock(&ray_threads_pool.lock);
+  ray_threads_start();
+  int queued = ray_threads_pool.count > 0 && ray_threads_pushLocked(func, data);
+  ray_threads_unlock(&ray_threads_pool.lock);
+  if (!queued) func(data);
+}
+
+// Parallel loop: func(data, i) for i in [0, count), executed by calling thread and up to threads - 1 workers
+typedef struct {
+  void (*func)(void * data, int index);
+  void  * data;
+  int     count, next, refs;
+} ray_threads_group;
+
+void ray_threads_groupRun(ray_threads_group * group){
+  while (1) {
+    ray_threads_lock(&ray_threads_pool.lock);
+    int i = group->next < group->count ? group->next++ : -1;
+    ray_threads_unlock(&ray_threads_pool.lock);
+    if (i < 0) return;
+    group->func(group->data, i);
+  }
+}
+
+void ray_threads_groupJob(void * data){
+  ray_threads_group * group = (ray_threads_group *)data;
+  ray_threads_groupRun(group);
+  ray_threads_lock(&ray_threads_pool.lock);
+  group->refs--;
+  ray_threads_broadcast(&ray_threads_pool.done);
+  ray_threads_unlock(&ray_threads_pool.lock);
+}
+
+// threads <= 0 means all workers
+void ray_threads_parallel(void (*func)(void * data, int index), void * data, int count, int threads){
+  ray_threads_group group = {func, data, count, 0, 0};
+  ray_threads_init();
+  ray_threads_lock(&ray_threads_pool.lock);
+  ray_threads_start();
+  if (threads <= 0 || threads > ray_threads_pool.count + 1) threads = ray_threads_pool.count + 1;
+  if (threads > count) threads = count;
+  for (int i = 1; i < threads; i++) {
+    if (!ray_threads_pushLocked(ray_threads_groupJob, &group)) break;
+    group.refs++;
+  }
+  ray_threads_unlock(&ray_threads_pool.lock);
+
+  ray_threads_groupRun(&group);
+
+  // remove jobs which workers had no time to take, wait for the rest
+  ray_threads_lock(&ray_threads_pool.lock);
+  int size = 0;
+  for (int i = 0; i < ray_threads_pool.size; i++) {
+    ray_threads_job job = ray_threads_pool.jobs[(ray_threads_pool.first + i) % ray_threads_pool.capacity];
+    if (job.data == &group) group.refs--;
+    else ray_threads_pool.jobs[(ray_threads_pool.first + size++) % ray_threads_pool.capacity] = job;
+  }
+  ray_threads_pool.size = size;
+  while (group.refs) ray_threads_wait(&ray_threads_pool.done, &ray_threads_pool.lock);
+  ray_threads_unlock(&ray_threads_pool.lock);
+}
@@ -0,0 +1,315 @@
+// File change notifications: inotify on Linux, polling of modification times elsewhere (or if inotify is unavailable).
+// inotify watches parent directories of files, so files replaced by rename (as editors save them) are reported too.
+// Polling checks only ray_watch_pollBudget entries per ray_watch_poll call, spreading stat calls over frames.
+// Polled directories keep modification times of their files (read by fs.h walker, subdirectories are not entered),
+// so files edited in place, created or deleted are reported as with inotify.
+// This part has no raylib or Lua calls, paths are reported as they were added (or as "dir/name" for directories).
+
+#include <sys/stat.h>
+
+#if !defined(S_ISDIR)
+  #define S_ISDIR(mode) (((mode) & S_IFMT) == S_IFDIR)
+#endif
+
+#if defined(__linux__)
+  #include <sys/inotify.h>
+  #include <unistd.h>
+#endif
+
+typedef struct {
+  char * name;
+  long   modTime;
+  int    seen;              // found by current scan
+} ray_watch_file;
+
+typedef struct {
+  char * path;              // as passed to ray_watch_add
+  const char * name;        // file name part of path
+  int    dir;               // index of parent (or own for directories) watch, -1 if polled
+  int    isDir;
+  long   modTime;           // last seen modification time, used by polling
+  ray_watch_file * files;   // files of polled directory
+  int    filesCount, filesCapacity;
+} ray_watch_entry;
+
+typedef struct {
+  int    wd;                // inotify watch descriptor
+  int    refs;              // entries which use this watch, 0 for free slot
+} ray_watch_dir;
+
+struct {
+  int               fd;     // inotify descriptor, -1 if polling is used
+  int               init;
+  ray_watch_entry * entries;
+  int               count, capacity;
+  ray_watch_dir   * dirs;
+  int               dirsCount, dirsCapacity;
+  int               next;   // next polled entry
+} ray_watch = {0};
+
+int ray_watch_pollBudget = 64; // entries checked per poll without inotify
+
+long ray_watch_modTime(const char * path, int * isDir){
+  struct stat st;
+  if (stat(path, &st)) return -1;
+  if (isDir) *isDir = S_ISDIR(st.st_mode);
+  return (long)st.st_mtime;
+}
+
+void ray_watch_init(void){
+  if (ray_watch.init) return;
+  ray_watch.init = 1;
+  ray_watch.fd   = -1;
+#if defined(__linux__)
+  ray_watch.fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+#endif
+}
+
+// 1 if changes are reported by system, 0 if polling is used
+int ray_watch_isNative(void){
+  ray_watch_init();
+  return ray_watch.fd >= 0;
+}
+
+// Paths are compared without trailing slashes
+int ray_watch_find(const char * path){
+  size_t len = strlen(path);
+  while (len > 1 && (path[len - 1] == '/' || path[len - 1] == '\\')) len--;
+  for (int i = 0; i < ray_watch.count; i++)
+    if (!strncmp(ray_watch.entries[i].path, path, len) && !ray_watch.entries[i].path[len]) return i;
+  return -1;
+}
+
+// Returns index of directory watch, -1 on error
+int ray_watch_addDir(const char * path){
+#if defined(__linux__)
+  int wd = inotify_add_watch(ray_watch.fd, path, IN_CLOSE_WRITE | IN_MOVED_TO | IN_DELETE | IN_MOVED_FROM);
+  if (wd < 0) return -1;
+  // the same directory has the same descriptor, whatever path is used
+  int index = -1;
+  for (int i = 0; i < ray_watch.dirsCount; i++) {
+    if (ray_watch.dirs[i].refs && ray_watch.dirs[i].wd == wd) {
+      ray_watch.dirs[i].refs++;
+      return i;
+    }
+    if (!ray_watch.dirs[i].refs) index = i;
+  }
+  if (index >= 0) {
+    ray_watch.dirs[index].wd   = wd;
+    ray_watch.dirs[index].refs = 1;
+    return index;
+  }
+  if (ray_watch.dirsCount == ray_watch.dirsCapacity) {
+    int capacity = ray_watch.dirsCapacity ? ray_watch.dirsCapacity*2 : 8;
+    ray_watch_dir * dirs = (ray_watch_dir *)realloc(ray_watch.dirs, capacity*sizeof(ray_watch_dir));
+    if (!dirs) {
+      inotify_rm_watch(ray_watch.fd, wd);
+      return -1;
+    }
+    ray_watch.dirs         = dirs;
+    ray_watch.dirsCapacity = capacity;
+  }
+  ray_watch_dir * dir = &ray_watch.dirs[ray_watch.dirsCount];
+  dir->wd   = wd;
+  dir->refs = 1;
+  return ray_watch.dirsCount++;
+#else
+  (void)path;
+  return -1;
+#endif
+}
+
+void ray_watch_releaseDir(int index){
+#if defined(__linux__)
+  ray_watch_dir * dir = &ray_watch.dirs[index];
+  if (--dir->refs) return;
+  // slot is kept to keep indices of other watches
+  inotify_rm_watch(ray_watch.fd, dir->wd);
+  dir->wd = -1;
+#else
+  (void)index;
+#endif
+}
+
+// Reads files of polled directory, reports created, changed and deleted ones as "dir/name" (if report is set).
+// Returns number of reports
+int ray_watch_scan(ray_watch_entry * entry, void (* report)(const char * path, void * data), void * data){
+  int count = 0, hint = 0;
+  for (int i = 0; i < entry->filesCount; i++) entry->files[i].seen = 0;
+  ray_fs_walker walker;
+  ray_fs_entry  file;
+  ray_fs_init(&walker);
+  walker.maxDepth = 0;
+  if (ray_fs_open(&walker, entry->path)) {
+    while (ray_fs_next(&walker, &file)) {
+      // directory order is usually kept between reads, so the file after previous one is checked first
+      int index = -1;
+      if (hint < entry->filesCount && !strcmp(entry->files[hint].name, file.name)) index = hint;
+      else for (int i = 0; i < entry->filesCount; i++) {
+        if (strcmp(entry->files[i].name, file.name)) continue;
+        index = i;
+        break;
+      }
+      if (index < 0) {
+        if (entry->filesCount == entry->filesCapacity) {
+          int capacity = entry->filesCapacity ? entry->filesCapacity*2 : 16;
+          ray_watch_file * files = (ray_watch_file *)realloc(entry->files, capacity*sizeof(ray_watch_file));
+          if (!files) continue;
+          entry->files         = files;
+          entry->filesCapacity = capacity;
+        }
+        char * name = (char *)malloc(strlen(file.name) + 1);
+        if (!name) continue;
+        strcpy(name, file.name);
+        index = entry->filesCount++;
+        entry->files[index].name    = name;
+        entry->files[index].modTime = -1; // reported as changed
+      }
+      hint = index + 1;
+      entry->files[index].seen = 1;
+      if (entry->files[index].modTime == (long)file.modTime) continue;
+      entry->files[index].modTime = (long)file.modTime;
+      if (report) {
+        report(file.path, data);
+        count++;
+      }
+    }
+  }
+  ray_fs_close(&walker);
+  for (int i = entry->filesCount - 1; i >= 0; i--) {
+    if (entry->files[i].seen) continue;
+    if (report) {
+      char path[4096];
+      snprintf(path, sizeof(path), "%s/%s", entry->path, entry->files[i].name);
+      report(path, data);
+      count++;
+    }
+    free(entry->files[i].name);
+    entry->files[i] = entry->files[--entry->filesCount];
+  }
+  return count;
+}
+
+// Starts watching of file or directory, returns 0 if it is not exists or can't be watched
+int ray_watch_add(const char * path){
+  ray_watch_init();
+  if (ray_watch_find(path) >= 0) return 1;
+  int isDir = 0;
+  long modTime = ray_watch_modTime(path, &isDir);
+  if (modTime < 0) return 0;
+  if (ray_watch.count == ray_watch.capacity) {
+    int capacity = ray_watch.capacity ? ray_watch.capacity*2 : 16;
+    ray_watch_entry * entries = (ray_watch_entry *)realloc(ray_watch.entries, capacity*sizeof(ray_watch_entry));
+    if (!entries) return 0;
+    ray_watch.entries  = entries;
+    ray_watch.capacity = capacity;
+  }
+  size_t len = strlen(path);
+  char * copy = (char *)malloc(len + 1);
+  if (!copy) return 0;
+  strcpy(copy, path);
+  while (len > 1 && (copy[len - 1] == '/' || copy[len - 1] == '\\')) copy[--len] = '\0';
+  const char * name = copy + len;
+  while (name > copy && name[-1] != '/' && name[-1] != '\\') name--;
+
+  int dir = -1;
+  if (ray_watch.fd >= 0) {
+    if (isDir) dir = ray_watch_addDir(copy);
+    else {
+      char parent[4096];
+      if (name == copy) strcpy(parent, ".");
+      else if (name - copy == 1) strcpy(parent, "/");
+      else snprintf(parent, sizeof(parent), "%.*s", (int)(name - copy - 1), copy);
+      dir = ray_watch_addDir(parent);
+    }
+    if (dir < 0) {
+      free(copy);
+      return 0;
+    }
+  }
+  ray_watch_entry * entry = &ray_watch.entries[ray_watch.count++];
+  entry->path    = copy;
+  entry->name    = name;
+  entry->dir     = dir;
+  entry->isDir   = isDir;
+  entry->modTime = modTime;
+  entry->files   = NULL;
+  entry->filesCount = entry->filesCapacity = 0;
+  if (isDir && ray_watch.fd < 0) ray_watch_scan(entry, NULL, NULL);
+  return 1;
+}
+
+// Stops watching of path, returns 0 if it is not watched
+int ray_watch_remove(const char * path){
+  int index = ray_watch_find(path);
+  if (index < 0) return 0;
+  ray_watch_entry * entry = &ray_watch.entries[index];
+  if (entry->dir >= 0) ray_watch_releaseDir(entry->dir);
+  for (int i = 0; i < entry->filesCount; i++) free(entry->files[i].name);
+  free(entry->files);
+  free(entry->path);
+  *entry = ray_watch.entries[--ray_watch.count];
+  if (ray_watch.next >= ray_watch.count) ray_watch.next = 0;
+  return 1;
+}
+
+// Calls report for every changed file since previous call, returns number of reports.
+// The same path may be reported several times if it was changed several times.
+int ray_watch_poll(void (* report)(const char * path, void * data), void * data){
+  int count = 0;
+  ray_watch_init();
+#if defined(__linux__)
+  if (ray_watch.fd >= 0) {
+    char   buffer[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+    char   path[4096];
+    ssize_t len;
+    while ((len = read(ray_watch.fd, buffer, sizeof(buffer))) > 0) {
+      for (char * ptr = buffer; ptr < buffer + len; ) {
+        struct inotify_event * event = (struct inotify_event *)ptr;
+        ptr += sizeof(struct inotify_event) + event->len;
+        if (event->mask & IN_Q_OVERFLOW) {
+          // events are lost, every file may be changed
+          for (int i = 0; i < ray_watch.count; i++, count++) report(ray_watch.entries[i].path, data);
+          continue;
+        }
+        if (!event->len) continue;
+        for (int i = 0; i < ray_watch.count; i++) {
+          ray_watch_entry * entry = &ray_watch.entries[i];
+          if (ray_watch.dirs[entry->dir].wd != event->wd) continue;
+          if (entry->isDir) {
+            snprintf(path, sizeof(path), "%s/%s", entry->path, event->name);
+            report(path, data);
+            count++;
+          }
+          else if (!strcmp(entry->name, event->name)) {
+            report(entry->path, data);
+            count++;
+          }
+        }
+      }
+    }
+    return count;
+  }
+#endif
+  // polling, a directory is one check, but all its files are read
+  int checks = ray_watch_pollBudget < ray_watch.count ? ray_watch_pollBudget : ray_watch.count;
+  for (int i = 0; i < checks; i++) {
+    if (ray_watch.next >= ray_watch.count) ray_watch.next = 0;
+    ray_watch_entry * entry = &ray_watch.entries[ray_watch.next++];
+    if (entry->isDir) {
+      count += ray_watch_scan(entry, report, data);
+      continue;
+    }
+    long modTime = ray_watch_modTime(entry->path, NULL);
+    if (modTime == entry->modTime) continue;
+    entry->modTime = modTime;
+    report(entry->path, data);
+    count++;
+  }
+  return count;
+}
+
+// Stops watching of all paths
+void ray_watch_clear(void){
+  while (ray_watch.count) ray_watch_remove(ray_watch.entries[0].path);
+}